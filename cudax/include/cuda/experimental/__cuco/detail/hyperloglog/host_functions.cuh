@@ -0,0 +1,200 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_DETAIL_HYPERLOGLOG_HOST_FUNCTIONS_CUH
+#define _CUDAX___CUCO_DETAIL_HYPERLOGLOG_HOST_FUNCTIONS_CUH
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/in_range.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__cstddef/byte.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__cuco/detail/utility/cuda.cuh>
+
+#include <cuda/std/__cccl/prologue.h>
+
+#if !_CCCL_COMPILER(NVRTC)
+
+namespace cuda::experimental::cuco::__hyperloglog_ns
+{
+//! @brief Minimum number of items counted by a single host thread in bulk additions.
+//!
+//! Every thread fills a private sketch of up to 1 MB, which has to be amortized over its items.
+inline constexpr detail::__index_type __host_min_items_per_thread = 1 << 16;
+
+//! @brief Serialized sketch format.
+//!
+//! | Bytes             | Content                                               |
+//! |-------------------|-------------------------------------------------------|
+//! | `[0, 4)`          | Magic `'C' 'H' 'L' 'L'`                               |
+//! | `4`               | Format version, currently `1`                         |
+//! | `5`               | Precision `p` in `[4, 18]`                            |
+//! | `[6, 8)`          | Reserved, zero                                        |
+//! | `[8, 8 + 2^p)`    | Register values, one byte each, in register order     |
+//!
+//! The format is independent of the register type, the thread scope and the host endianness.
+inline constexpr unsigned char __serialized_magic[4] = {'C', 'H', 'L', 'L'};
+inline constexpr unsigned char __serialized_version  = 1;
+inline constexpr ::cuda::std::size_t __serialized_header_bytes = 8;
+
+//! @brief Sum of `2^-register` and number of zero registers, the inputs of the finalizer.
+struct __register_sums
+{
+  double __sum;
+  ::cuda::std::int32_t __zeroes;
+};
+
+//! @brief Computes `__dst[i] = max(__dst[i], __src[i])` for `i` in `[0, __n)`.
+//!
+//! The loop has no dependencies between iterations, so the compiler vectorizes it.
+template <class _Register>
+_CCCL_HOST_API void __host_merge_max(_Register* __dst, const _Register* __src, ::cuda::std::size_t __n) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __n; ++__i)
+  {
+    __dst[__i] = (::cuda::std::max) (__dst[__i], __src[__i]);
+  }
+}
+
+//! @brief Computes the sum of `2^-register` and the number of zero registers of `[__registers, __registers + __n)`.
+//!
+//! `2^-register` is built from its exponent bits, and the registers are summed into independent
+//! partial sums, so that the compiler can process whole vector registers at once. The summation
+//! order differs from a sequential loop.
+template <class _Register>
+[[nodiscard]] _CCCL_HOST_API __register_sums
+__host_register_sums(const _Register* __registers, ::cuda::std::size_t __n) noexcept
+{
+  constexpr ::cuda::std::int64_t __exponent_bias = 1023;
+  constexpr int __mantissa_bits                  = 52;
+  constexpr ::cuda::std::size_t __lanes          = 8;
+
+  double __sums[__lanes]                      = {};
+  ::cuda::std::int32_t __zero_counts[__lanes] = {};
+  ::cuda::std::size_t __i                     = 0;
+  for (; __i + __lanes <= __n; __i += __lanes)
+  {
+    for (::cuda::std::size_t __lane = 0; __lane < __lanes; ++__lane)
+    {
+      const auto __reg = static_cast<::cuda::std::int64_t>(__registers[__i + __lane]);
+      __sums[__lane] += ::cuda::std::bit_cast<double>((__exponent_bias - __reg) << __mantissa_bits);
+      __zero_counts[__lane] += __reg == 0;
+    }
+  }
+
+  double __sum                  = 0;
+  ::cuda::std::int32_t __zeroes = 0;
+  for (::cuda::std::size_t __lane = 0; __lane < __lanes; ++__lane)
+  {
+    __sum += __sums[__lane];
+    __zeroes += __zero_counts[__lane];
+  }
+  for (; __i < __n; ++__i)
+  {
+    const auto __reg = static_cast<::cuda::std::int64_t>(__registers[__i]);
+    __sum += ::cuda::std::bit_cast<double>((__exponent_bias - __reg) << __mantissa_bits);
+    __zeroes += __reg == 0;
+  }
+  return {__sum, __zeroes};
+}
+
+//! @brief Writes the serialized form of a sketch of precision `__precision` to `__out`.
+//!
+//! @throw If `__out` is smaller than the serialized sketch
+template <class _Register>
+_CCCL_HOST_API void __serialize(const _Register* __registers,
+                                ::cuda::std::int32_t __precision,
+                                ::cuda::std::span<::cuda::std::byte> __out)
+{
+  const auto __num_registers = ::cuda::std::size_t{1} << __precision;
+  if (__out.size() < __serialized_header_bytes + __num_registers)
+  {
+    _CCCL_THROW(::std::invalid_argument, "Output is too small for the serialized sketch");
+  }
+
+  for (int __i = 0; __i < 4; ++__i)
+  {
+    __out[__i] = static_cast<::cuda::std::byte>(__serialized_magic[__i]);
+  }
+  __out[4] = static_cast<::cuda::std::byte>(__serialized_version);
+  __out[5] = static_cast<::cuda::std::byte>(__precision);
+  __out[6] = ::cuda::std::byte{0};
+  __out[7] = ::cuda::std::byte{0};
+
+  auto __out_registers = __out.data() + __serialized_header_bytes;
+  for (::cuda::std::size_t __i = 0; __i < __num_registers; ++__i)
+  {
+    __out_registers[__i] = static_cast<::cuda::std::byte>(__registers[__i]);
+  }
+}
+
+//! @brief Validates a serialized sketch and returns its precision.
+//!
+//! @throw If `__in` is not a serialized sketch of a supported format version
+[[nodiscard]] _CCCL_HOST_API inline ::cuda::std::int32_t
+__serialized_precision(::cuda::std::span<const ::cuda::std::byte> __in)
+{
+  if (__in.size() < __serialized_header_bytes)
+  {
+    _CCCL_THROW(::std::invalid_argument, "Serialized sketch is truncated");
+  }
+  for (int __i = 0; __i < 4; ++__i)
+  {
+    if (__in[__i] != static_cast<::cuda::std::byte>(__serialized_magic[__i]))
+    {
+      _CCCL_THROW(::std::invalid_argument, "Input is not a serialized HyperLogLog sketch");
+    }
+  }
+  if (__in[4] != static_cast<::cuda::std::byte>(__serialized_version))
+  {
+    _CCCL_THROW(::std::invalid_argument, "Unsupported serialized sketch version");
+  }
+
+  const auto __precision = static_cast<::cuda::std::int32_t>(__in[5]);
+  if (!::cuda::in_range(__precision, 4, 18)
+      || __in.size() != __serialized_header_bytes + (::cuda::std::size_t{1} << __precision))
+  {
+    _CCCL_THROW(::std::invalid_argument, "Serialized sketch is malformed");
+  }
+  return __precision;
+}
+
+//! @brief Reads the registers of a serialized sketch validated by `__serialized_precision`.
+template <class _Register>
+_CCCL_HOST_API void __deserialize(::cuda::std::span<const ::cuda::std::byte> __in, _Register* __registers) noexcept
+{
+  const auto __num_registers = __in.size() - __serialized_header_bytes;
+  const auto __in_registers  = __in.data() + __serialized_header_bytes;
+  for (::cuda::std::size_t __i = 0; __i < __num_registers; ++__i)
+  {
+    __registers[__i] = static_cast<_Register>(__in_registers[__i]);
+  }
+}
+} // namespace cuda::experimental::cuco::__hyperloglog_ns
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_DETAIL_HYPERLOGLOG_HOST_FUNCTIONS_CUH
@@ -30,6 +30,7 @@
 #include <cuda/__stream/stream_ref.h>
 #include <cuda/__utility/in_range.h>
 #include <cuda/atomic>
+#include <cuda/std/__algorithm/fill_n.h>
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__bit/countr.h>
 #include <cuda/std/__bit/integral.h>
@@ -37,14 +38,19 @@
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__host_stdlib/stdexcept>
 #include <cuda/std/__iterator/concepts.h>
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__memory/pointer_traits.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/detail/hyperloglog/finalizer.cuh>
+#include <cuda/experimental/__cuco/detail/hyperloglog/host_functions.cuh>
 #include <cuda/experimental/__cuco/detail/hyperloglog/kernels.cuh>
+#include <cuda/experimental/__cuco/detail/utility/host_bulk_for.cuh>
 #include <cuda/experimental/__cuco/detail/utility/strong_type.cuh>
 
 #include <cooperative_groups.h>
+#include <mutex>
+#include <vector>
 
 #include <cooperative_groups/reduce.h>
 #include <cuda/std/__cccl/prologue.h>
@@ -454,33 +460,180 @@ public:
     const auto __num_regs = __sketch.size();
 
     ::cuda::host_buffer<__register_type> __host_sketch_buf{__stream, __host_mr, __num_regs, ::cuda::no_init};
+    __copy_to_host(__host_sketch_buf, __stream);
 
-#if _CCCL_CTK_AT_LEAST(13, 0)
-    ::cuda::copy_configuration __config{};
-    __config.src_access_order = ::cuda::source_access_order::stream;
+    // geometric mean computation + count registers with 0s
+    const auto __sums = __hyperloglog_ns::__host_register_sums(__host_sketch_buf.data(), __num_regs);
 
-    ::cuda::copy_bytes(__stream, __sketch, __host_sketch_buf, __config);
-#else // ^^^ _CCCL_CTK_AT_LEAST(13, 0) ^^^ / vvv _CCCL_CTK_BELOW(13, 0) vvv
-    ::cuda::__driver::__memcpyAsync(
-      __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __num_regs, __stream.get());
-#endif // _CCCL_CTK_BELOW(13, 0)
-    __stream.sync();
+    // dispatch to the policy's finalizer for bias correction, etc.
+    return _Policy::finalize(__sums.__sum, __sums.__zeroes, __precision);
+  }
 
-    __fp_type __sum               = 0;
-    ::cuda::std::int32_t __zeroes = 0;
+  //! @brief Resets the estimator from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  _CCCL_HOST_API void __clear_host() noexcept
+  {
+    ::cuda::std::fill_n(__sketch.data(), __sketch.size(), __register_type{0});
+  }
 
-    // geometric mean computation + count registers with 0s
-    for (const auto __reg : __host_sketch_buf)
+  //! @brief Adds to be counted items to the estimator using host threads.
+  //!
+  //! Every host thread counts a chunk of the items into a private sketch, which is then merged
+  //! into the shared sketch.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  template <class _InputIt>
+  _CCCL_HOST_API void __add_host(_InputIt __first, _InputIt __last)
+  {
+    const auto __num_items = static_cast<detail::__index_type>(::cuda::std::distance(__first, __last));
+    ::std::mutex __merge_mutex;
+    detail::__host_bulk_for(
+      __num_items,
+      __hyperloglog_ns::__host_min_items_per_thread,
+      [&](detail::__index_type __begin, detail::__index_type __end) {
+        ::std::vector<__register_type> __local_sketch(__sketch.size(), __register_type{0});
+        auto __it = __first + __begin;
+        for (auto __i = __begin; __i < __end; ++__i, ++__it)
+        {
+          const auto __h     = __policy.hash(*__it);
+          const auto __index = __policy.register_index(__h, __precision);
+          const auto __value = static_cast<__register_type>(__policy.register_value(__h, __precision));
+          __local_sketch[__index] = (::cuda::std::max) (__local_sketch[__index], __value);
+        }
+
+        ::std::lock_guard<::std::mutex> __lock{__merge_mutex};
+        __hyperloglog_ns::__host_merge_max(__sketch.data(), __local_sketch.data(), __sketch.size());
+      });
+  }
+
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator from the
+  //! calling host thread.
+  //!
+  //! @note Both sketches must be host accessible.
+  //!
+  //! @throw If __sketch_bytes() != __other.__sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST_API void __merge_host(const __hyperloglog_impl<_Tp, _OtherScope, _Policy>& __other)
+  {
+    if (__other.__precision != __precision)
     {
-      __sum += __fp_type{1} / static_cast<__fp_type>(1ull << __reg);
-      __zeroes += __reg == 0;
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
     }
+    __hyperloglog_ns::__host_merge_max(__sketch.data(), __other.__sketch.data(), __sketch.size());
+  }
 
-    // dispatch to the policy's finalizer for bias correction, etc.
-    return _Policy::finalize(__sum, __zeroes, __precision);
+  //! @brief Compute the estimated distinct items count from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST_API double __estimate_host() const noexcept
+  {
+    const auto __sums = __hyperloglog_ns::__host_register_sums(__sketch.data(), __sketch.size());
+    return _Policy::finalize(__sums.__sum, __sums.__zeroes, __precision);
   }
 
-  // #endif
+  //! @brief Gets the number of bytes of the serialized sketch.
+  //!
+  //! @return The number of bytes of the serialized sketch
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::size_t __serialized_bytes() const noexcept
+  {
+    return __hyperloglog_ns::__serialized_header_bytes + __sketch.size();
+  }
+
+  //! @brief Serializes the sketch from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @throw If `__out` is smaller than `__serialized_bytes()`
+  //!
+  //! @param __out Host accessible output for the serialized sketch
+  _CCCL_HOST_API void __serialize_host(::cuda::std::span<::cuda::std::byte> __out) const
+  {
+    __hyperloglog_ns::__serialize(__sketch.data(), __precision, __out);
+  }
+
+  //! @brief Serializes the sketch.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If `__out` is smaller than `__serialized_bytes()`
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer required to
+  //! copy the sketch from device to host
+  //!
+  //! @param __out Host accessible output for the serialized sketch
+  //! @param __host_mr Host memory resource used for copying the sketch
+  //! @param __stream CUDA stream this operation is executed in
+  template <typename _HostMemoryResource>
+  _CCCL_HOST_API void __serialize(::cuda::std::span<::cuda::std::byte> __out,
+                                  _HostMemoryResource __host_mr,
+                                  ::cuda::stream_ref __stream) const
+  {
+    ::cuda::host_buffer<__register_type> __host_sketch_buf{__stream, __host_mr, __sketch.size(), ::cuda::no_init};
+    __copy_to_host(__host_sketch_buf, __stream);
+    __hyperloglog_ns::__serialize(__host_sketch_buf.data(), __precision, __out);
+  }
+
+  //! @brief Merges a serialized sketch into `*this` estimator from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @throw If `__in` is not a serialized sketch or was serialized with a different sketch size
+  //!
+  //! @param __in Host accessible serialized sketch
+  _CCCL_HOST_API void __merge_serialized_host(::cuda::std::span<const ::cuda::std::byte> __in)
+  {
+    if (__hyperloglog_ns::__serialized_precision(__in) != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+    ::std::vector<__register_type> __other(__sketch.size());
+    __hyperloglog_ns::__deserialize(__in, __other.data());
+    __hyperloglog_ns::__host_merge_max(__sketch.data(), __other.data(), __sketch.size());
+  }
+
+  //! @brief Merges a serialized sketch into `*this` estimator.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If `__in` is not a serialized sketch or was serialized with a different sketch size
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the device accessible
+  //! host buffer the serialized registers are decoded into
+  //!
+  //! @param __in Host accessible serialized sketch
+  //! @param __host_mr Host memory resource used for decoding the serialized registers
+  //! @param __stream CUDA stream this operation is executed in
+  template <typename _HostMemoryResource>
+  _CCCL_HOST_API void __merge_serialized(::cuda::std::span<const ::cuda::std::byte> __in,
+                                         _HostMemoryResource __host_mr,
+                                         ::cuda::stream_ref __stream)
+  {
+    if (__hyperloglog_ns::__serialized_precision(__in) != __precision)
+    {
+      _CCCL_THROW(::std::invalid_argument, "Cannot merge estimators with different sketch sizes");
+    }
+    ::cuda::host_buffer<__register_type> __other_buf{__stream, __host_mr, __sketch.size(), ::cuda::no_init};
+    __hyperloglog_ns::__deserialize(__in, __other_buf.data());
+
+    const __hyperloglog_impl __other{
+      ::cuda::std::as_writable_bytes(::cuda::std::span{__other_buf.data(), __other_buf.size()}), __policy};
+    // The decoded registers have to outlive the merge
+    __merge(__other, __stream);
+  }
 
   //! @brief Gets the hash function.
   //!
@@ -572,6 +725,25 @@ public:
   }
 
 private:
+  //! @brief Copies the sketch to `__host_sketch_buf` and synchronizes `__stream`.
+  //!
+  //! @param __host_sketch_buf Host buffer of `__sketch.size()` registers
+  //! @param __stream CUDA stream this operation is executed in
+  _CCCL_HOST_API void
+  __copy_to_host(::cuda::host_buffer<__register_type>& __host_sketch_buf, ::cuda::stream_ref __stream) const
+  {
+#if _CCCL_CTK_AT_LEAST(13, 0)
+    ::cuda::copy_configuration __config{};
+    __config.src_access_order = ::cuda::source_access_order::stream;
+
+    ::cuda::copy_bytes(__stream, __sketch, __host_sketch_buf, __config);
+#else // ^^^ _CCCL_CTK_AT_LEAST(13, 0) ^^^ / vvv _CCCL_CTK_BELOW(13, 0) vvv
+    ::cuda::__driver::__memcpyAsync(
+      __host_sketch_buf.data(), __sketch.data(), sizeof(__register_type) * __sketch.size(), __stream.get());
+#endif // _CCCL_CTK_BELOW(13, 0)
+    __stream.sync();
+  }
+
   //! @brief Atomically updates the register at position `i` with `max(reg[i], value)`.
   //!
   //! @param __i Register index
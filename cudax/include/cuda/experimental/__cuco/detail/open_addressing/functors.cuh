@@ -30,7 +30,7 @@
 
 namespace cuda::experimental::cuco::__open_addressing
 {
-//! @brief Device functor returning the content of a slot.
+//! @brief Functor returning the content of a slot.
 //!
 //! @tparam _HasPayload Whether the slot contains a mapped value
 //! @tparam _StorageRef Slot storage reference type
@@ -51,7 +51,7 @@ struct __get_slot
   //! @param __idx Slot index
   //!
   //! @return Slot content
-  [[nodiscard]] _CCCL_DEVICE_API constexpr auto operator()(typename _StorageRef::__size_type __idx) const noexcept
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto operator()(typename _StorageRef::__size_type __idx) const noexcept
   {
     const auto& __slot = *(__storage_ref_.data() + __idx);
     if constexpr (_HasPayload)
@@ -65,7 +65,7 @@ struct __get_slot
   }
 };
 
-//! @brief Device predicate indicating whether a slot is filled.
+//! @brief Predicate indicating whether a slot is filled.
 //!
 //! @tparam _HasPayload Whether the slot contains a mapped value
 //! @tparam _Key Key type
@@ -93,7 +93,7 @@ struct __slot_is_filled
   //!
   //! @return `true` if the slot contains an element
   template <class _Slot>
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool operator()(const _Slot& __slot) const noexcept
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool operator()(const _Slot& __slot) const noexcept
   {
     if constexpr (_HasPayload)
     {
@@ -106,7 +106,7 @@ struct __slot_is_filled
   }
 
 private:
-  [[nodiscard]] _CCCL_DEVICE_API constexpr bool __is_filled(const _Key& __key) const noexcept
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool __is_filled(const _Key& __key) const noexcept
   {
     return !detail::__bitwise_compare(__key, __empty_key_sentinel_)
         && !detail::__bitwise_compare(__key, __erased_key_sentinel_);
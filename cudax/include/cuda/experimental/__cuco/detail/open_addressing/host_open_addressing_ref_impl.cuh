@@ -0,0 +1,522 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_DETAIL_HOST_OPEN_ADDRESSING_REF_IMPL_CUH
+#define _CUDAX___CUCO_DETAIL_HOST_OPEN_ADDRESSING_REF_IMPL_CUH
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__atomic/atomic.h>
+#include <cuda/__cmath/pow2.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/countr.h>
+#include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/__type_traits/make_nbit_int.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__cuco/detail/bitwise_compare.cuh>
+#include <cuda/experimental/__cuco/detail/open_addressing/open_addressing_ref_impl.cuh>
+#include <cuda/experimental/__cuco/detail/utility/cuda.cuh>
+#include <cuda/experimental/__cuco/detail/utility/host_bulk_for.cuh>
+
+#include <thread>
+
+#include <cuda/std/__cccl/prologue.h>
+
+#if !_CCCL_COMPILER(NVRTC)
+
+namespace cuda::experimental::cuco::__open_addressing
+{
+//! @brief Number of keys whose probing iterators are computed and prefetched ahead of the probes.
+inline constexpr int __host_prefetch_distance = 16;
+
+//! @brief Minimum number of keys handled by a single host thread in bulk operations.
+inline constexpr detail::__index_type __host_min_keys_per_thread = 16384;
+
+//! @brief Host non-owning "ref" implementation class of open addressing containers.
+//!
+//! Probes host accessible slot storage from host threads. Operations are thread-safe with respect
+//! to each other: slots are updated with host atomics and read with atomic loads.
+//!
+//! A cooperative group of size `cg_size` probes `cg_size` consecutive buckets per step on the
+//! device. The host probes the same window of `cg_size * bucket_size` slots per step, so keys are
+//! placed exactly where the device would look for them. Each window is loaded once, after which
+//! the equal, empty and erased slots are computed as bit masks over the whole window.
+//!
+//! @note This class should NOT be used directly.
+//!
+//! @tparam _Key Type used for keys
+//! @tparam _Value Type used for storage values
+//! @tparam _KeyEqual Binary callable type used to compare two keys for equality
+//! @tparam _ProbingScheme Probing scheme type
+//! @tparam _StorageRef Storage ref type
+template <class _Key, class _Value, class _KeyEqual, class _ProbingScheme, class _StorageRef>
+class __host_open_addressing_ref_impl
+{
+public:
+  using __key_type         = _Key;
+  using __value_type       = _Value;
+  using __key_equal        = _KeyEqual;
+  using __storage_ref_type = _StorageRef;
+  using __size_type        = typename __storage_ref_type::__size_type;
+
+  static constexpr auto __has_payload = !::cuda::std::is_same_v<_Key, _Value>;
+  static constexpr int __window_size  = _ProbingScheme::cg_size * __storage_ref_type::__bucket_size;
+
+  static_assert(__window_size <= 64, "Host probing supports at most 64 slots per probing window.");
+
+private:
+  using __mask_type = ::cuda::std::uint64_t;
+
+  static constexpr auto __has_packable_representation =
+    sizeof(__value_type) <= 8 && ::cuda::is_power_of_two(sizeof(__value_type))
+    && ::cuda::std::is_trivially_copyable_v<__value_type>;
+
+  //! @brief Bit masks of the slots of a probing window.
+  struct __window_masks
+  {
+    __mask_type __equal;
+    __mask_type __empty;
+    __mask_type __erased;
+  };
+
+  __value_type __empty_slot_sentinel;
+  __key_type __erased_key_sentinel;
+  __key_equal __predicate;
+  _ProbingScheme __probing_scheme;
+  __storage_ref_type __storage_ref;
+
+public:
+  //! @brief Constructs `__host_open_addressing_ref_impl`.
+  //!
+  //! @param __empty_slot_sentinel Sentinel indicating an empty slot
+  //! @param __erased_key_sentinel Sentinel indicating an erased key
+  //! @param __predicate Key equality binary callable
+  //! @param __probing_scheme Probing scheme
+  //! @param __storage_ref Non-owning ref of host accessible slot storage
+  _CCCL_HOST_API explicit __host_open_addressing_ref_impl(
+    __value_type __empty_slot_sentinel,
+    __key_type __erased_key_sentinel,
+    const __key_equal& __predicate,
+    const _ProbingScheme& __probing_scheme,
+    __storage_ref_type __storage_ref) noexcept
+      : __empty_slot_sentinel{__empty_slot_sentinel}
+      , __erased_key_sentinel{__erased_key_sentinel}
+      , __predicate{__predicate}
+      , __probing_scheme{__probing_scheme}
+      , __storage_ref{__storage_ref}
+  {}
+
+  //! @brief Returns a pointer to one past the last slot.
+  [[nodiscard]] _CCCL_HOST_API __value_type* end() const noexcept
+  {
+    return __storage_ref.end();
+  }
+
+  //! @brief Inserts an element.
+  //!
+  //! @return True if the element was inserted, false if an equal key is present or the container is full
+  _CCCL_HOST_API bool insert(const __value_type& __value) noexcept
+  {
+    return __insert(__make_iterator(__extract_key(__value)), __value);
+  }
+
+  //! @brief Indicates whether the probe key is present.
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API bool contains(const _ProbeKey& __key) const noexcept
+  {
+    return __find(__make_iterator(__key), __key) != end();
+  }
+
+  //! @brief Finds the slot holding the probe key.
+  //!
+  //! @return Pointer to the slot holding `__key`, or `end()` if `__key` is not present
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API __value_type* find(const _ProbeKey& __key) const noexcept
+  {
+    const auto __slot = __find(__make_iterator(__key), __key);
+    if constexpr (__has_payload && !__has_packable_representation)
+    {
+      if (__slot != end())
+      {
+        (void) __load_payload(*__slot);
+      }
+    }
+    return __slot;
+  }
+
+  //! @brief Fills all slots with the empty sentinel.
+  _CCCL_HOST_API void clear() const
+  {
+    const auto __slots    = __storage_ref.data();
+    const auto __sentinel = __empty_slot_sentinel;
+    detail::__host_bulk_for(static_cast<detail::__index_type>(__storage_ref.capacity()),
+                            __host_min_keys_per_thread,
+                            [__slots, __sentinel](detail::__index_type __begin, detail::__index_type __end) {
+                              for (auto __i = __begin; __i < __end; ++__i)
+                              {
+                                __slots[__i] = __sentinel;
+                              }
+                            });
+  }
+
+  //! @brief Inserts the first `__n` elements of `__first` whose stencil satisfies `__pred`.
+  //!
+  //! @return Number of successful insertions
+  template <class _InputIt, class _StencilIt, class _Predicate>
+  _CCCL_HOST_API __size_type
+  insert_if_n(_InputIt __first, detail::__index_type __n, _StencilIt __stencil, _Predicate __pred)
+  {
+    ::cuda::std::atomic<__size_type> __num_inserted{0};
+    detail::__host_bulk_for(
+      __n, __host_min_keys_per_thread, [&](detail::__index_type __begin, detail::__index_type __end) {
+        __size_type __local_inserted = 0;
+        __for_each_prefetched(
+          __begin,
+          __end,
+          [&](detail::__index_type __i) {
+            return __extract_key(static_cast<__value_type>(__first[__i]));
+          },
+          [&](detail::__index_type __i, auto __probing_iter) {
+            if (__pred(__stencil[__i]) && __insert(__probing_iter, static_cast<__value_type>(__first[__i])))
+            {
+              ++__local_inserted;
+            }
+          });
+        __num_inserted.fetch_add(__local_inserted, ::cuda::std::memory_order_relaxed);
+      });
+    return __num_inserted.load(::cuda::std::memory_order_relaxed);
+  }
+
+  //! @brief For the first `__n` keys of `__first` writes whether the key is present, or false when the
+  //! stencil does not satisfy `__pred`.
+  template <class _InputIt, class _StencilIt, class _Predicate, class _OutputIt>
+  _CCCL_HOST_API void contains_if_n(
+    _InputIt __first, detail::__index_type __n, _StencilIt __stencil, _Predicate __pred, _OutputIt __output_begin) const
+  {
+    detail::__host_bulk_for(
+      __n, __host_min_keys_per_thread, [&](detail::__index_type __begin, detail::__index_type __end) {
+        __for_each_prefetched(
+          __begin,
+          __end,
+          [&](detail::__index_type __i) {
+            return __first[__i];
+          },
+          [&](detail::__index_type __i, auto __probing_iter) {
+            __output_begin[__i] = __pred(__stencil[__i]) && __find(__probing_iter, __first[__i]) != end();
+          });
+      });
+  }
+
+  //! @brief For the first `__n` keys of `__first` writes the associated payload, or the empty value
+  //! sentinel when the key is absent or the stencil does not satisfy `__pred`.
+  template <class _InputIt, class _StencilIt, class _Predicate, class _OutputIt>
+  _CCCL_HOST_API void find_if_n(
+    _InputIt __first, detail::__index_type __n, _StencilIt __stencil, _Predicate __pred, _OutputIt __output_begin) const
+  {
+    static_assert(__has_payload, "find requires a container with payloads");
+
+    detail::__host_bulk_for(
+      __n, __host_min_keys_per_thread, [&](detail::__index_type __begin, detail::__index_type __end) {
+        __for_each_prefetched(
+          __begin,
+          __end,
+          [&](detail::__index_type __i) {
+            return __first[__i];
+          },
+          [&](detail::__index_type __i, auto __probing_iter) {
+            const auto __slot   = __pred(__stencil[__i]) ? __find(__probing_iter, __first[__i]) : end();
+            __output_begin[__i] = __slot != end() ? __load_payload(*__slot) : __empty_slot_sentinel.second;
+          });
+      });
+  }
+
+private:
+  //! @brief Extracts the key from a slot value.
+  [[nodiscard]] _CCCL_HOST_API static constexpr const __key_type& __extract_key(const __value_type& __value) noexcept
+  {
+    if constexpr (__has_payload)
+    {
+      return __value.first;
+    }
+    else
+    {
+      return __value;
+    }
+  }
+
+  //! @brief Returns the sentinel of an erased slot.
+  [[nodiscard]] _CCCL_HOST_API __value_type __erased_slot_sentinel() const noexcept
+  {
+    if constexpr (__has_payload)
+    {
+      return __value_type{__erased_key_sentinel, __empty_slot_sentinel.second};
+    }
+    else
+    {
+      return __erased_key_sentinel;
+    }
+  }
+
+  //! @brief Returns a probing iterator over the windows of `__window_size` slots.
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API auto __make_iterator(const _ProbeKey& __key) const noexcept
+  {
+    return __probing_scheme.template make_iterator<__window_size>(__key, __storage_ref.capacity_extent());
+  }
+
+  //! @brief Prefetches the probing window starting at `__index`.
+  _CCCL_HOST_API void __prefetch_window(__size_type __index) const noexcept
+  {
+    [[maybe_unused]] const auto __window = __storage_ref.data() + __index;
+    _CCCL_BUILTIN_PREFETCH(__window, 1, 3);
+    if constexpr (sizeof(__value_type) * __window_size > 64)
+    {
+      _CCCL_BUILTIN_PREFETCH(__window + (__window_size - 1), 1, 3);
+    }
+  }
+
+  //! @brief Invokes `__probe(__i, __probing_iter)` for every `__i` in `[__begin, __end)`.
+  //!
+  //! The probing iterators of `__host_prefetch_distance` keys are computed and their first windows
+  //! prefetched before any of the keys is probed, so the cache misses of a batch overlap.
+  template <class _KeyFn, class _ProbeFn>
+  _CCCL_HOST_API void __for_each_prefetched(
+    detail::__index_type __begin, detail::__index_type __end, _KeyFn __key_fn, _ProbeFn __probe) const
+  {
+    using __probing_iterator_type = decltype(__make_iterator(__key_fn(__begin)));
+
+    __probing_iterator_type __probing_iters[__host_prefetch_distance];
+    for (auto __batch_begin = __begin; __batch_begin < __end; __batch_begin += __host_prefetch_distance)
+    {
+      const auto __batch_size =
+        static_cast<int>((::cuda::std::min) (__end - __batch_begin, detail::__index_type{__host_prefetch_distance}));
+      for (int __j = 0; __j < __batch_size; ++__j)
+      {
+        __probing_iters[__j] = __make_iterator(__key_fn(__batch_begin + __j));
+        __prefetch_window(*__probing_iters[__j]);
+      }
+      for (int __j = 0; __j < __batch_size; ++__j)
+      {
+        __probe(__batch_begin + __j, __probing_iters[__j]);
+      }
+    }
+  }
+
+  //! @brief Atomically loads the key of a slot.
+  [[nodiscard]] _CCCL_HOST_API __key_type __load_key(const __value_type& __slot) const noexcept
+  {
+    if constexpr (__has_packable_representation)
+    {
+      using __packed_type =
+        ::cuda::std::__make_nbit_uint_t<sizeof(__value_type) * ::cuda::std::numeric_limits<unsigned char>::digits>;
+      auto __slot_ref = ::cuda::atomic_ref<__packed_type, ::cuda::thread_scope_system>{
+        *reinterpret_cast<__packed_type*>(const_cast<__value_type*>(&__slot))};
+      return __extract_key(::cuda::std::bit_cast<__value_type>(__slot_ref.load(::cuda::std::memory_order_relaxed)));
+    }
+    else
+    {
+      auto __key_ref = ::cuda::atomic_ref<__key_type, ::cuda::thread_scope_system>{
+        const_cast<__key_type&>(__extract_key(__slot))};
+      return __key_ref.load(::cuda::std::memory_order_relaxed);
+    }
+  }
+
+  //! @brief Atomically loads the payload of a filled slot.
+  //!
+  //! When the key and the payload are written separately, waits until the payload of a concurrent
+  //! insert has been written.
+  [[nodiscard]] _CCCL_HOST_API auto __load_payload(const __value_type& __slot) const noexcept
+  {
+    using __mapped_type = decltype(__slot.second);
+    if constexpr (__has_packable_representation)
+    {
+      using __packed_type =
+        ::cuda::std::__make_nbit_uint_t<sizeof(__value_type) * ::cuda::std::numeric_limits<unsigned char>::digits>;
+      auto __slot_ref = ::cuda::atomic_ref<__packed_type, ::cuda::thread_scope_system>{
+        *reinterpret_cast<__packed_type*>(const_cast<__value_type*>(&__slot))};
+      return ::cuda::std::bit_cast<__value_type>(__slot_ref.load(::cuda::std::memory_order_relaxed)).second;
+    }
+    else
+    {
+      auto __payload_ref =
+        ::cuda::atomic_ref<__mapped_type, ::cuda::thread_scope_system>{const_cast<__mapped_type&>(__slot.second)};
+      auto __payload = __payload_ref.load(::cuda::std::memory_order_acquire);
+      while (detail::__bitwise_compare(__payload, __empty_slot_sentinel.second))
+      {
+        ::std::this_thread::yield();
+        __payload = __payload_ref.load(::cuda::std::memory_order_acquire);
+      }
+      return __payload;
+    }
+  }
+
+  //! @brief Loads the keys of the window starting at `__index` and classifies its slots.
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API __window_masks __probe_window(const _ProbeKey& __key, __size_type __index) const noexcept
+  {
+    const auto __window = __storage_ref.data() + __index;
+
+    __key_type __keys[__window_size];
+    for (int __i = 0; __i < __window_size; ++__i)
+    {
+      __keys[__i] = __load_key(__window[__i]);
+    }
+
+    const auto __empty_key = __extract_key(__empty_slot_sentinel);
+    __window_masks __masks{0, 0, 0};
+    for (int __i = 0; __i < __window_size; ++__i)
+    {
+      const bool __slot_is_empty  = detail::__bitwise_compare(__keys[__i], __empty_key);
+      const bool __slot_is_erased = detail::__bitwise_compare(__keys[__i], __erased_key_sentinel);
+      __masks.__empty |= __mask_type{__slot_is_empty} << __i;
+      __masks.__erased |= __mask_type{__slot_is_erased} << __i;
+    }
+    const auto __filled = ~(__masks.__empty | __masks.__erased);
+    for (int __i = 0; __i < __window_size; ++__i)
+    {
+      if ((__filled >> __i) & 1)
+      {
+        __masks.__equal |= __mask_type{static_cast<bool>(__predicate(__key, __keys[__i]))} << __i;
+      }
+    }
+    return __masks;
+  }
+
+  //! @brief Inserts an element, starting the probe sequence at `__probing_iter`.
+  template <class _ProbingIterator>
+  _CCCL_HOST_API bool __insert(_ProbingIterator __probing_iter, const __value_type& __value) noexcept
+  {
+    const auto __key      = __extract_key(__value);
+    const auto __init_idx = *__probing_iter;
+
+    while (true)
+    {
+      const auto __masks = __probe_window(__key, *__probing_iter);
+      if (__masks.__equal != 0)
+      {
+        return false;
+      }
+
+      const auto __available = __masks.__empty | __masks.__erased;
+      if (__available != 0)
+      {
+        const auto __intra_window_index = ::cuda::std::countr_zero(__available);
+        const auto __expected =
+          ((__masks.__empty >> __intra_window_index) & 1) ? __empty_slot_sentinel : __erased_slot_sentinel();
+        switch (__attempt_insert(__storage_ref.data() + *__probing_iter + __intra_window_index, __expected, __value))
+        {
+          case __insert_result::__success:
+            return true;
+          case __insert_result::__duplicate:
+            return false;
+          default:
+            // Another thread claimed the slot, probe the same window again
+            continue;
+        }
+      }
+
+      ++__probing_iter;
+      if (*__probing_iter == __init_idx)
+      {
+        return false;
+      }
+    }
+  }
+
+  //! @brief Finds the slot holding the probe key, starting the probe sequence at `__probing_iter`.
+  template <class _ProbingIterator, class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API __value_type*
+  __find(_ProbingIterator __probing_iter, const _ProbeKey& __key) const noexcept
+  {
+    const auto __init_idx = *__probing_iter;
+
+    while (true)
+    {
+      const auto __masks = __probe_window(__key, *__probing_iter);
+      if (__masks.__equal != 0)
+      {
+        return __storage_ref.data() + *__probing_iter + ::cuda::std::countr_zero(__masks.__equal);
+      }
+      if (__masks.__empty != 0)
+      {
+        return end();
+      }
+
+      ++__probing_iter;
+      if (_CCCL_BUILTIN_EXPECT(*__probing_iter == __init_idx, 0))
+      {
+        return end();
+      }
+    }
+  }
+
+  //! @brief Attempts to insert an element into a slot.
+  //!
+  //! Slots of up to 8 bytes are written with a single CAS. Larger slots claim the key with a CAS and
+  //! then publish the payload with a release store, which lookups wait for.
+  [[nodiscard]] _CCCL_HOST_API __insert_result
+  __attempt_insert(__value_type* __address, __value_type __expected, const __value_type& __desired) noexcept
+  {
+    if constexpr (__has_packable_representation)
+    {
+      using __packed_type =
+        ::cuda::std::__make_nbit_uint_t<sizeof(__value_type) * ::cuda::std::numeric_limits<unsigned char>::digits>;
+
+      auto __slot_ref = ::cuda::atomic_ref<__packed_type, ::cuda::thread_scope_system>{
+        *reinterpret_cast<__packed_type*>(__address)};
+      auto __expected_packed      = ::cuda::std::bit_cast<__packed_type>(__expected);
+      const auto __desired_packed = ::cuda::std::bit_cast<__packed_type>(__desired);
+
+      if (__slot_ref.compare_exchange_strong(__expected_packed, __desired_packed, ::cuda::std::memory_order_relaxed))
+      {
+        return __insert_result::__success;
+      }
+      return __predicate(__extract_key(__desired),
+                         __extract_key(::cuda::std::bit_cast<__value_type>(__expected_packed)))
+             ? __insert_result::__duplicate
+             : __insert_result::__continue;
+    }
+    else
+    {
+      using __mapped_type = decltype(__address->second);
+
+      auto __key_ref      = ::cuda::atomic_ref<__key_type, ::cuda::thread_scope_system>{__address->first};
+      auto __expected_key = __expected.first;
+      if (__key_ref.compare_exchange_strong(__expected_key, __desired.first, ::cuda::std::memory_order_relaxed))
+      {
+        ::cuda::atomic_ref<__mapped_type, ::cuda::thread_scope_system>{__address->second}.store(
+          __desired.second, ::cuda::std::memory_order_release);
+        return __insert_result::__success;
+      }
+      return __predicate(__desired.first, __expected_key) ? __insert_result::__duplicate : __insert_result::__continue;
+    }
+  }
+};
+} // namespace cuda::experimental::cuco::__open_addressing
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_DETAIL_HOST_OPEN_ADDRESSING_REF_IMPL_CUH
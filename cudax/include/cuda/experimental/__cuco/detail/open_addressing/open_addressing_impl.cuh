@@ -31,17 +31,21 @@
 #include <cuda/__iterator/constant_iterator.h>
 #include <cuda/__iterator/counting_iterator.h>
 #include <cuda/__iterator/transform_iterator.h>
+#include <cuda/__memory_resource/get_property.h>
+#include <cuda/__memory_resource/properties.h>
 #include <cuda/__runtime/api_wrapper.h>
 #include <cuda/__type_traits/is_bitwise_comparable.h>
 #include <cuda/std/__exception/exception_macros.h>
 #include <cuda/std/__execution/env.h>
 #include <cuda/std/__functional/identity.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_base_of.h>
 #include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/capacity.cuh>
 #include <cuda/experimental/__cuco/detail/open_addressing/functors.cuh>
+#include <cuda/experimental/__cuco/detail/open_addressing/host_open_addressing_ref_impl.cuh>
 #include <cuda/experimental/__cuco/detail/open_addressing/kernels.cuh>
 #include <cuda/experimental/__cuco/detail/open_addressing/slot_storage_ref.cuh>
 #include <cuda/experimental/__cuco/detail/utility/cuda.cuh>
@@ -70,7 +74,8 @@ namespace cuda::experimental::cuco::__open_addressing
 //! @tparam _KeyEqual Binary callable type used to compare two keys for equality
 //! @tparam _ProbingScheme Probing scheme type
 //! @tparam _BucketSize Number of slots per bucket
-//! @tparam _MemoryResource Type of memory resource used for device storage
+//! @tparam _MemoryResource Type of memory resource used for slot storage. Storage that is not device
+//! accessible is operated on by host threads.
 template <class _Key,
           class _Value,
           ::cuda::thread_scope _Scope,
@@ -88,12 +93,20 @@ public:
   using __size_type           = ::cuda::std::size_t;
   using __key_equal           = _KeyEqual;
   using __storage_ref_type    = __slot_storage_ref<__value_type, _BucketSize>;
+  using __host_ref_type =
+    __host_open_addressing_ref_impl<_Key, _Value, _KeyEqual, _ProbingScheme, __storage_ref_type>;
 
   static constexpr auto __has_payload  = !::cuda::std::is_same_v<_Key, _Value>;
   static constexpr auto __cg_size      = _ProbingScheme::cg_size;
   static constexpr auto __bucket_size  = _BucketSize;
   static constexpr auto __thread_scope = _Scope;
 
+  //! Whether the slots can be accessed from host threads
+  static constexpr bool __is_host_accessible = ::cuda::has_property<_MemoryResource, ::cuda::mr::host_accessible>;
+  //! Whether the slots can be accessed from device kernels
+  static constexpr bool __is_device_accessible =
+    ::cuda::has_property<_MemoryResource, ::cuda::mr::device_accessible>;
+
   static_assert(sizeof(_Key) <= 8, "Container does not support key types larger than 8 bytes.");
   static_assert(sizeof(_Value) <= 16, "Container does not support slot types larger than 16 bytes.");
   static_assert(::cuda::is_bitwise_comparable_v<_Key>,
@@ -108,7 +121,10 @@ private:
   __key_equal __predicate;
   __probing_scheme_type __probing_scheme;
   mutable _MemoryResource __memory_resource;
-  ::cuda::device_buffer<__value_type> __slots;
+  ::cuda::std::conditional_t<__is_device_accessible,
+                             ::cuda::device_buffer<__value_type>,
+                             ::cuda::host_buffer<__value_type>>
+    __slots;
 
   //! @brief Computes the number of buckets for a requested capacity.
   [[nodiscard]] _CCCL_HOST_API static __size_type __compute_num_buckets(__size_type __requested_capacity)
@@ -239,13 +255,21 @@ public:
     {
       return;
     }
-    _CCCL_TRY_CUDA_API(
-      CUB_NS_QUALIFIER::DeviceTransform::Fill,
-      "cuco: failed to clear slot storage",
-      __slots.data(),
-      static_cast<detail::__index_type>(__n),
-      __empty_slot_sentinel,
-      __stream);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      host_ref().clear();
+    }
+    else
+    {
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceTransform::Fill,
+        "cuco: failed to clear slot storage",
+        __slots.data(),
+        static_cast<detail::__index_type>(__n),
+        __empty_slot_sentinel,
+        __stream);
+    }
   }
 
   //! @brief Inserts keys in `[first, last)` and returns the number of successful insertions.
@@ -273,16 +297,23 @@ public:
     {
       return 0;
     }
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      return host_ref().insert_if_n(__first, __num_keys, __stencil, __pred);
+    }
+    else
+    {
+      auto __counter = __make_counter(__stream);
 
-    auto __counter = __make_counter(__stream);
-
-    const auto __grid_size = detail::__grid_size(__num_keys, __cg_size);
+      const auto __grid_size = detail::__grid_size(__num_keys, __cg_size);
 
-    __open_addressing::__insert_if_n<__cg_size, detail::__default_block_size>
-      <<<static_cast<unsigned>(__grid_size), detail::__default_block_size, 0, __stream.get()>>>(
-        __first, __num_keys, __stencil, __pred, __counter.data(), __container_ref);
+      __open_addressing::__insert_if_n<__cg_size, detail::__default_block_size>
+        <<<static_cast<unsigned>(__grid_size), detail::__default_block_size, 0, __stream.get()>>>(
+          __first, __num_keys, __stencil, __pred, __counter.data(), __container_ref);
 
-    return __read_counter(__counter, __stream);
+      return __read_counter(__counter, __stream);
+    }
   }
 
   //! @brief Asynchronously inserts keys in `[first, last)`.
@@ -313,7 +344,12 @@ public:
       return;
     }
 
-    if constexpr (__cg_size == 1)
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      (void) host_ref().insert_if_n(__first, __num_keys, __stencil, __pred);
+    }
+    else if constexpr (__cg_size == 1)
     {
       __open_addressing::__insert_if_fn __op{__first, __stencil, __pred, __container_ref};
       _CCCL_TRY_CUDA_API(CUB_NS_QUALIFIER::DeviceFor::Bulk, "cuco: failed to insert keys", __num_keys, __op, __stream);
@@ -341,7 +377,13 @@ public:
       return;
     }
 
-    if constexpr (__cg_size == 1)
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      host_ref().contains_if_n(
+        __first, __num_keys, ::cuda::constant_iterator<bool>{true}, ::cuda::std::identity{}, __output_begin);
+    }
+    else if constexpr (__cg_size == 1)
     {
       __open_addressing::__contains_if_fn __op{
         __first, ::cuda::constant_iterator<bool>{true}, ::cuda::std::identity{}, __output_begin, __container_ref};
@@ -383,12 +425,19 @@ public:
     {
       return;
     }
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      host_ref().find_if_n(__first, __num_keys, __stencil, __pred, __output_begin);
+    }
+    else
+    {
+      const auto __grid_size = detail::__grid_size(__num_keys, __cg_size);
 
-    const auto __grid_size = detail::__grid_size(__num_keys, __cg_size);
-
-    __open_addressing::__find_if_n<__cg_size, detail::__default_block_size>
-      <<<static_cast<unsigned>(__grid_size), detail::__default_block_size, 0, __stream.get()>>>(
-        __first, __num_keys, __stencil, __pred, __output_begin, __container_ref);
+      __open_addressing::__find_if_n<__cg_size, detail::__default_block_size>
+        <<<static_cast<unsigned>(__grid_size), detail::__default_block_size, 0, __stream.get()>>>(
+          __first, __num_keys, __stencil, __pred, __output_begin, __container_ref);
+    }
   }
 
   //! @brief Asynchronously finds the payloads for keys in `[first, last)`.
@@ -415,7 +464,7 @@ public:
   //!
   //! @note This function synchronizes the given stream.
   //!
-  //! @tparam _OutputIt Device-accessible random access output iterator
+  //! @tparam _OutputIt Random access output iterator, accessible where the slots are processed
   //!
   //! @param __stream CUDA stream used for this operation
   //! @param __output_begin Beginning of the output range
@@ -424,24 +473,44 @@ public:
   template <class _OutputIt>
   [[nodiscard]] _CCCL_HOST_API _OutputIt retrieve_all(::cuda::stream_ref __stream, _OutputIt __output_begin) const
   {
-    auto __counter = __make_counter(__stream);
-
-    const auto __input_begin = ::cuda::make_transform_iterator(
-      ::cuda::counting_iterator<__size_type>{0}, __get_slot<__has_payload, __storage_ref_type>{storage_ref()});
-    const auto __is_filled = __slot_is_filled<__has_payload, __key_type>{empty_key_sentinel(), erased_key_sentinel()};
-    const auto __env       = ::cuda::std::execution::env{__stream, __memory_resource};
-
-    _CCCL_TRY_CUDA_API(
-      CUB_NS_QUALIFIER::DeviceSelect::If,
-      "cuco: failed to retrieve all elements",
-      __input_begin,
-      __output_begin,
-      __counter.data(),
-      capacity(),
-      __is_filled,
-      __env);
-
-    return __output_begin + __read_counter(__counter, __stream);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      const auto __get = __get_slot<__has_payload, __storage_ref_type>{storage_ref()};
+      const auto __is_filled =
+        __slot_is_filled<__has_payload, __key_type>{empty_key_sentinel(), erased_key_sentinel()};
+      for (__size_type __i = 0; __i < capacity(); ++__i)
+      {
+        const auto __slot = __get(__i);
+        if (__is_filled(__slot))
+        {
+          *__output_begin = __slot;
+          ++__output_begin;
+        }
+      }
+      return __output_begin;
+    }
+    else
+    {
+      auto __counter = __make_counter(__stream);
+
+      const auto __input_begin = ::cuda::make_transform_iterator(
+        ::cuda::counting_iterator<__size_type>{0}, __get_slot<__has_payload, __storage_ref_type>{storage_ref()});
+      const auto __is_filled = __slot_is_filled<__has_payload, __key_type>{empty_key_sentinel(), erased_key_sentinel()};
+      const auto __env       = ::cuda::std::execution::env{__stream, __memory_resource};
+
+      _CCCL_TRY_CUDA_API(
+        CUB_NS_QUALIFIER::DeviceSelect::If,
+        "cuco: failed to retrieve all elements",
+        __input_begin,
+        __output_begin,
+        __counter.data(),
+        capacity(),
+        __is_filled,
+        __env);
+
+      return __output_begin + __read_counter(__counter, __stream);
+    }
   }
 
   //! @brief Returns the total number of slots.
@@ -491,6 +560,13 @@ public:
   {
     return __storage_ref_type{const_cast<__value_type*>(__slots.data()), capacity()};
   }
+
+  //! @brief Returns a non-owning reference that operates on the stored slots from host threads.
+  [[nodiscard]] _CCCL_HOST_API __host_ref_type host_ref() const noexcept
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    return __host_ref_type{__empty_slot_sentinel, __erased_key_sentinel, __predicate, __probing_scheme, storage_ref()};
+  }
 };
 } // namespace cuda::experimental::cuco::__open_addressing
 
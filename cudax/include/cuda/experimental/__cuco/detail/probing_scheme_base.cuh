@@ -50,6 +50,8 @@ public:
   using __step_extent_type     = _StepExtent;
   using __size_type            = typename _CapacityExtent::index_type;
 
+  _CCCL_HIDE_FROM_ABI constexpr __probing_iterator() noexcept = default;
+
   _CCCL_HOST_DEVICE_API constexpr __probing_iterator(
     __size_type __start, _StepExtent __step, _CapacityExtent __capacity) noexcept
       : __curr_index{__start}
@@ -57,28 +59,26 @@ public:
       , __capacity_{__capacity}
   {}
 
-#if _CCCL_CUDA_COMPILATION()
-  _CCCL_DEVICE_API constexpr auto operator*() const noexcept
+  _CCCL_HOST_DEVICE_API constexpr auto operator*() const noexcept
   {
     return __curr_index;
   }
 
-  _CCCL_DEVICE_API constexpr auto operator++() noexcept
+  _CCCL_HOST_DEVICE_API constexpr auto operator++() noexcept
   {
     __curr_index = (__curr_index + __step_.extent(0)) % __capacity_.extent(0);
     return *this;
   }
 
-  _CCCL_DEVICE_API constexpr auto operator++(int) noexcept
+  _CCCL_HOST_DEVICE_API constexpr auto operator++(int) noexcept
   {
     auto __temp = *this;
     ++(*this);
     return __temp;
   }
-#endif // _CCCL_CUDA_COMPILATION()
 
 private:
-  __size_type __curr_index;
+  __size_type __curr_index{};
   _CCCL_NO_UNIQUE_ADDRESS _StepExtent __step_;
   _CCCL_NO_UNIQUE_ADDRESS _CapacityExtent __capacity_;
 };
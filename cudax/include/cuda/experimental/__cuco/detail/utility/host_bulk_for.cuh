@@ -0,0 +1,259 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDAX___CUCO_DETAIL_UTILITY_HOST_BULK_FOR_CUH
+#define _CUDAX___CUCO_DETAIL_UTILITY_HOST_BULK_FOR_CUH
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cstddef/types.h>
+#include <cuda/std/__exception/exception_macros.h>
+
+#include <cuda/experimental/__cuco/detail/utility/cuda.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <cuda/std/__cccl/prologue.h>
+
+#if !_CCCL_COMPILER(NVRTC)
+
+namespace cuda::experimental::cuco::detail
+{
+//! @brief A bulk operation of `__host_bulk_for`, which lives on the stack of the calling thread.
+struct __host_bulk_job
+{
+  using __chunk_fn_t = void(void*, __index_type, __index_type);
+
+  __index_type __n;
+  __index_type __chunk_size;
+  __index_type __num_chunks;
+  __chunk_fn_t* __chunk_fn;
+  void* __fn;
+  ::std::atomic<__index_type> __next_chunk{0};
+  //! Number of workers of `__host_workers` working on the job, guarded by its mutex
+  int __users = 0;
+  ::std::mutex __error_mutex;
+  ::std::exception_ptr __error;
+
+  //! @brief Runs the next unclaimed chunk, and returns false if all chunks are claimed.
+  _CCCL_HOST_API bool __run_one() noexcept
+  {
+    const auto __chunk = __next_chunk.fetch_add(1, ::std::memory_order_relaxed);
+    if (__chunk >= __num_chunks)
+    {
+      return false;
+    }
+    const auto __begin = __chunk * __chunk_size;
+    const auto __end   = (::cuda::std::min) (__begin + __chunk_size, __n);
+    _CCCL_TRY
+    {
+      __chunk_fn(__fn, __begin, __end);
+    }
+    _CCCL_CATCH_ALL
+    {
+      ::std::lock_guard<::std::mutex> __lock{__error_mutex};
+      if (!__error)
+      {
+        __error = ::std::current_exception();
+      }
+    }
+    return true;
+  }
+};
+
+//! @brief The host threads shared by all calls of `__host_bulk_for` in the process.
+//!
+//! The calling thread of a bulk operation runs chunks as well, so there is one worker less than
+//! hardware threads, and concurrent bulk operations share the workers instead of each starting
+//! their own threads.
+class __host_workers
+{
+public:
+  [[nodiscard]] _CCCL_HOST_API static __host_workers& __get()
+  {
+    static __host_workers __instance;
+    return __instance;
+  }
+
+  _CCCL_HOST_API ~__host_workers()
+  {
+    {
+      ::std::lock_guard<::std::mutex> __lock{__mutex_};
+      __stopping_ = true;
+    }
+    __work_available_.notify_all();
+    for (auto& __worker : __threads_)
+    {
+      __worker.join();
+    }
+  }
+
+  //! @brief Runs all chunks of `__job` on the calling thread and the workers, and rethrows the first
+  //! exception thrown by a chunk.
+  _CCCL_HOST_API void __run(__host_bulk_job& __job)
+  {
+    if (!__threads_.empty())
+    {
+      {
+        ::std::lock_guard<::std::mutex> __lock{__mutex_};
+        __jobs_.push_back(&__job);
+      }
+      __work_available_.notify_all();
+    }
+
+    while (__job.__run_one())
+    {
+    }
+
+    if (!__threads_.empty())
+    {
+      ::std::unique_lock<::std::mutex> __lock{__mutex_};
+      __remove(__job);
+      __job_released_.wait(__lock, [&] {
+        return __job.__users == 0;
+      });
+    }
+
+    if (__job.__error)
+    {
+      ::std::rethrow_exception(__job.__error);
+    }
+  }
+
+private:
+  _CCCL_HOST_API __host_workers()
+  {
+    const auto __count = (::cuda::std::max) (1u, ::std::thread::hardware_concurrency()) - 1;
+    __threads_.reserve(__count);
+    for (unsigned __i = 0; __i < __count; ++__i)
+    {
+      _CCCL_TRY
+      {
+        __threads_.emplace_back([this] {
+          __work();
+        });
+      }
+      _CCCL_CATCH_ALL
+      {
+        // The calling threads run all chunks the workers do not, so fewer workers only cost speed
+        break;
+      }
+    }
+  }
+
+  _CCCL_HOST_API void __work() noexcept
+  {
+    ::std::unique_lock<::std::mutex> __lock{__mutex_};
+    while (true)
+    {
+      __work_available_.wait(__lock, [&] {
+        return __stopping_ || !__jobs_.empty();
+      });
+      if (__jobs_.empty())
+      {
+        return;
+      }
+
+      auto& __job = *__jobs_.front();
+      ++__job.__users;
+      __lock.unlock();
+      while (__job.__run_one())
+      {
+      }
+      __lock.lock();
+
+      // All chunks are claimed, so no other worker needs to pick up the job
+      __remove(__job);
+      if (--__job.__users == 0)
+      {
+        __job_released_.notify_all();
+      }
+    }
+  }
+
+  _CCCL_HOST_API void __remove(__host_bulk_job& __job) noexcept
+  {
+    const auto __it = ::std::find(__jobs_.begin(), __jobs_.end(), &__job);
+    if (__it != __jobs_.end())
+    {
+      __jobs_.erase(__it);
+    }
+  }
+
+  ::std::mutex __mutex_;
+  ::std::condition_variable __work_available_;
+  ::std::condition_variable __job_released_;
+  ::std::deque<__host_bulk_job*> __jobs_;
+  bool __stopping_ = false;
+  ::std::vector<::std::thread> __threads_;
+};
+
+//! @brief Invokes `__fn(__begin, __end)` on contiguous chunks of `[0, __n)` using host threads.
+//!
+//! At most one chunk is made per `__min_per_thread` elements, up to the hardware concurrency. The
+//! chunks run on the calling thread and on the workers of `__host_workers`, so small ranges are
+//! processed by the calling thread alone and no threads are started per call.
+//!
+//! @param __n Number of elements
+//! @param __min_per_thread Minimum number of elements handled by a single thread
+//! @param __fn Callable invoked with the bounds of each chunk
+//!
+//! @throw The first exception thrown by `__fn`, after all chunks have run
+template <class _Fn>
+_CCCL_HOST_API void __host_bulk_for(__index_type __n, __index_type __min_per_thread, _Fn __fn)
+{
+  if (__n <= 0)
+  {
+    return;
+  }
+  const auto __max_threads =
+    static_cast<__index_type>((::cuda::std::max) (1u, ::std::thread::hardware_concurrency()));
+  const auto __num_chunks = (::cuda::std::min) (__max_threads, ::cuda::ceil_div(__n, __min_per_thread));
+  if (__num_chunks == 1)
+  {
+    __fn(__index_type{0}, __n);
+    return;
+  }
+
+  const auto __chunk_size = ::cuda::ceil_div(__n, __num_chunks);
+  __host_bulk_job __job{__n,
+                        __chunk_size,
+                        ::cuda::ceil_div(__n, __chunk_size),
+                        [](void* __fn_ptr, __index_type __begin, __index_type __end) {
+                          (*static_cast<_Fn*>(__fn_ptr))(__begin, __end);
+                        },
+                        &__fn};
+  __host_workers::__get().__run(__job);
+}
+} // namespace cuda::experimental::cuco::detail
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDAX___CUCO_DETAIL_UTILITY_HOST_BULK_FOR_CUH
@@ -24,10 +24,12 @@
 #if _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
 
 #  include <cuda/__functional/hash.h>
+#  include <cuda/__iterator/constant_iterator.h>
 #  include <cuda/__iterator/zip_iterator.h>
 #  include <cuda/__memory_pool/device_memory_pool.h>
 #  include <cuda/std/__concepts/concept_macros.h>
 #  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__functional/identity.h>
 #  include <cuda/std/__functional/operations.h>
 #  include <cuda/std/__fwd/extents.h>
 #  include <cuda/std/__memory/unique_ptr.h>
@@ -36,6 +38,7 @@
 #  include <cuda/experimental/__cuco/capacity.cuh>
 #  include <cuda/experimental/__cuco/detail/bitwise_compare.cuh>
 #  include <cuda/experimental/__cuco/detail/open_addressing/open_addressing_impl.cuh>
+#  include <cuda/experimental/__cuco/detail/utility/cuda.cuh>
 #  include <cuda/experimental/__cuco/fixed_capacity_map_ref.cuh>
 #  include <cuda/experimental/__cuco/probing_scheme.cuh>
 #  include <cuda/experimental/__cuco/types.cuh>
@@ -58,6 +61,12 @@ namespace cuda::experimental::cuco
 //! @note `_Capacity` is a span-style `size_t` non-type parameter holding the *valid* (post-rounding)
 //! slot count, or `cuda::std::dynamic_extent` (the default) for runtime-sized maps. Obtain a valid
 //! value with `cuco::make_valid_capacity`.
+//! @note With a host accessible `_MemoryResource`, e.g. a pinned memory pool, the map can also be
+//! used from host threads through the overloads that do not take a stream. Host operations are
+//! thread-safe, including inserts that overlap with lookups, and the bulk host overloads split their
+//! input across host threads. Host operations must not overlap with device work on the same map.
+//! With a memory resource that is not device accessible, the slots are allocated in host memory and
+//! the stream overloads synchronize the stream and then run on host threads as well.
 //!
 //! @tparam _Key Key type. Requires `cuda::is_bitwise_comparable_v<_Key>`
 //! @tparam _Tp Mapped value type
@@ -66,7 +75,7 @@ namespace cuda::experimental::cuco
 //! @tparam _KeyEqual Key equality comparator
 //! @tparam _ProbingScheme Probing scheme type
 //! @tparam _BucketSize Slots per bucket
-//! @tparam _MemoryResource Memory resource for device storage
+//! @tparam _MemoryResource Memory resource for slot storage
 template <class _Key,
           class _Tp,
           ::cuda::std::size_t _Capacity = ::cuda::std::dynamic_extent,
@@ -85,6 +94,8 @@ public:
   using key_equal           = _KeyEqual; ///< Key equality comparator type
   using probing_scheme_type = _ProbingScheme; ///< Probing scheme type
   using hasher              = typename probing_scheme_type::hasher; ///< Hash function type
+  using iterator            = value_type*; ///< Slot iterator
+  using const_iterator      = const value_type*; ///< Const slot iterator
 
   static constexpr auto cg_size      = _ProbingScheme::cg_size; ///< Cooperative-group size used for probing
   static constexpr auto bucket_size  = _BucketSize; ///< Number of slots per bucket
@@ -529,6 +540,162 @@ public:
     return {__keys_out + __num_out, __values_out + __num_out};
   }
 
+  // ===== Host Operations =====
+
+  //! @brief Inserts a key-value pair from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @param __value The key-value pair to insert
+  //!
+  //! @return True if the pair was inserted, false if the key is already present or the map is full
+  _CCCL_HOST_API bool insert(const value_type& __value)
+  {
+    return __impl->host_ref().insert(__value);
+  }
+
+  //! @brief Inserts all key-value pairs in `[__first, __last)` using host threads and returns the number
+  //! of successful insertions.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose `value_type` is convertible
+  //! to the map's `value_type`
+  //!
+  //! @param __first Beginning of the sequence of key-value pairs
+  //! @param __last End of the sequence of key-value pairs
+  //!
+  //! @return Number of successful insertions
+  template <class _InputIt>
+  _CCCL_HOST_API size_type insert(_InputIt __first, _InputIt __last)
+  {
+    return __impl->host_ref().insert_if_n(
+      __first, detail::__distance(__first, __last), ::cuda::constant_iterator<bool>{true}, ::cuda::std::identity{});
+  }
+
+  //! @brief Inserts the key-value pairs in `[__first, __last)` whose stencil satisfies `__pred` using
+  //! host threads.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator whose `value_type` is convertible
+  //! to the map's `value_type`
+  //! @tparam _StencilIt Host accessible random access iterator whose value type is convertible to
+  //! `_Predicate`'s argument type
+  //! @tparam _Predicate Unary callable returning a value convertible to `bool`
+  //!
+  //! @param __first Beginning of the sequence of key-value pairs
+  //! @param __last End of the sequence of key-value pairs
+  //! @param __stencil Beginning of the stencil sequence
+  //! @param __pred Predicate applied to the stencil to determine which elements to insert
+  //!
+  //! @return Number of successful insertions
+  template <class _InputIt, class _StencilIt, class _Predicate>
+  _CCCL_HOST_API size_type insert_if(_InputIt __first, _InputIt __last, _StencilIt __stencil, _Predicate __pred)
+  {
+    return __impl->host_ref().insert_if_n(__first, detail::__distance(__first, __last), __stencil, __pred);
+  }
+
+  //! @brief Indicates whether the key is contained in the map, from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _ProbeKey Probe key type
+  //!
+  //! @param __key The key to search for
+  //!
+  //! @return True if the key is present
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API bool contains(const _ProbeKey& __key) const
+  {
+    return __impl->host_ref().contains(__key);
+  }
+
+  //! @brief Indicates whether each key in `[__first, __last)` is contained in the map, using host threads.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `bool`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the output sequence of booleans
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API void contains(_InputIt __first, _InputIt __last, _OutputIt __output_begin) const
+  {
+    __impl->host_ref().contains_if_n(
+      __first,
+      detail::__distance(__first, __last),
+      ::cuda::constant_iterator<bool>{true},
+      ::cuda::std::identity{},
+      __output_begin);
+  }
+
+  //! @brief Finds the slot holding the key, from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _ProbeKey Probe key type
+  //!
+  //! @param __key The key to search for
+  //!
+  //! @return An iterator to the slot holding `__key`, or `end()` if the key is not present
+  template <class _ProbeKey>
+  [[nodiscard]] _CCCL_HOST_API const_iterator find(const _ProbeKey& __key) const
+  {
+    return __impl->host_ref().find(__key);
+  }
+
+  //! @brief For each key in `[__first, __last)` writes the associated payload, or `empty_value_sentinel()`
+  //! if the key is not present, using host threads.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `mapped_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __output_begin Beginning of the output sequence of payloads
+  template <class _InputIt, class _OutputIt>
+  _CCCL_HOST_API void find(_InputIt __first, _InputIt __last, _OutputIt __output_begin) const
+  {
+    find_if(__first, __last, ::cuda::constant_iterator<bool>{true}, ::cuda::std::identity{}, __output_begin);
+  }
+
+  //! @brief For each key `__first[i]` with `__pred(__stencil[i]) == true` writes the associated payload,
+  //! or `empty_value_sentinel()` if the key is not present, using host threads; writes
+  //! `empty_value_sentinel()` for the rest.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator
+  //! @tparam _StencilIt Host accessible random access iterator whose value type is convertible to
+  //!         `_Predicate`'s argument type
+  //! @tparam _Predicate Unary callable returning `bool`
+  //! @tparam _OutputIt Host accessible random access output iterator assignable from `mapped_type`
+  //!
+  //! @param __first Beginning of the sequence of keys
+  //! @param __last End of the sequence of keys
+  //! @param __stencil Beginning of the stencil sequence
+  //! @param __pred Predicate applied to the stencil to determine which keys to query
+  //! @param __output_begin Beginning of the output sequence of payloads
+  template <class _InputIt, class _StencilIt, class _Predicate, class _OutputIt>
+  _CCCL_HOST_API void
+  find_if(_InputIt __first, _InputIt __last, _StencilIt __stencil, _Predicate __pred, _OutputIt __output_begin) const
+  {
+    __impl->host_ref().find_if_n(__first, detail::__distance(__first, __last), __stencil, __pred, __output_begin);
+  }
+
+  //! @brief Returns an iterator to one past the last slot, which `find` returns for absent keys.
+  //!
+  //! @return Iterator to one past the last slot
+  [[nodiscard]] _CCCL_HOST_API const_iterator end() const noexcept
+  {
+    return __impl->data() + __impl->capacity();
+  }
+
   // ===== Accessors =====
 
   //! @brief Returns the total number of slots the map can hold (the prime/stride-adjusted capacity).
@@ -539,7 +706,7 @@ public:
     return __impl->capacity();
   }
 
-  //! @brief Gets a device pointer to the underlying slot storage.
+  //! @brief Gets a pointer to the underlying slot storage.
   //!
   //! @return Pointer to the underlying slot storage
   [[nodiscard]] _CCCL_HOST_API value_type* data() const
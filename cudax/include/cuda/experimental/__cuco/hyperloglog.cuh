@@ -23,7 +23,9 @@
 
 #include <cuda/__container/buffer.h>
 #include <cuda/__memory_pool/device_memory_pool.h>
+#include <cuda/__memory_resource/get_property.h>
 #include <cuda/__memory_resource/legacy_pinned_memory_resource.h>
+#include <cuda/__memory_resource/properties.h>
 #include <cuda/__stream/stream_ref.h>
 #include <cuda/__utility/in_range.h>
 #include <cuda/__utility/no_init.h>
@@ -31,12 +33,15 @@
 #include <cuda/std/__cccl/assert.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__host_stdlib/stdexcept>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__utility/forward.h>
 #include <cuda/std/span>
 
 #include <cuda/experimental/__cuco/hll_policies.cuh>
 #include <cuda/experimental/__cuco/hyperloglog_ref.cuh>
 
+#include <vector>
+
 #include <cuda/std/__cccl/prologue.h>
 
 #if !_CCCL_COMPILER(NVRTC)
@@ -48,8 +53,13 @@ namespace cuda::experimental::cuco
 //! @note This implementation is based on the HyperLogLog++ algorithm:
 //! https://static.googleusercontent.com/media/research.google.com/de//pubs/archive/40671.pdf.
 //!
+//! @note With a host accessible memory resource the estimator also provides host operations, which
+//! take no stream and run on host threads. With a memory resource that is only host accessible,
+//! for example on nodes without a GPU, the stream operations synchronize the stream and run on host
+//! threads as well.
+//!
 //! @tparam _Tp Type of items to count
-//! @tparam _MemoryResource Type of memory resource used for device storage
+//! @tparam _MemoryResource Type of memory resource used for sketch storage
 //! @tparam _Scope The scope in which operations will be performed by individual threads
 //! @tparam _Policy Policy bundling hash function, bit-slicing rule, and finalizer
 template <class _Tp,
@@ -90,7 +100,16 @@ public:
   using precision = ::cuda::experimental::cuco::__precision_t;
 
 private:
-  ::cuda::device_buffer<register_type> __sketch_buffer; ///< Storage for sketch
+  //! Whether the sketch can be accessed from host threads
+  static constexpr bool __is_host_accessible = ::cuda::has_property<_MemoryResource, ::cuda::mr::host_accessible>;
+  //! Whether the sketch can be accessed from device kernels
+  static constexpr bool __is_device_accessible =
+    ::cuda::has_property<_MemoryResource, ::cuda::mr::device_accessible>;
+
+  ::cuda::std::conditional_t<__is_device_accessible,
+                             ::cuda::device_buffer<register_type>,
+                             ::cuda::host_buffer<register_type>>
+    __sketch_buffer; ///< Storage for sketch
   ref_type<> __ref; ///< Device ref of the current `hyperloglog` object
 
   // Needs to be friends with other instantiations of this class template to have access to their
@@ -106,7 +125,7 @@ public:
   //! synchronizing it.
   //!
   //! @param __stream CUDA stream used to initialize the object
-  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __memory_resource A memory resource used for allocating sketch storage
   //! @param __sketch_size_kb Maximum sketch size in KB
   //! @param __policy The policy used to hash items and finalize the estimate
   //!
@@ -129,7 +148,7 @@ public:
   //! synchronizing it.
   //!
   //! @param __stream CUDA stream used to initialize the object
-  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __memory_resource A memory resource used for allocating sketch storage
   //! @param __sd Desired standard deviation for the approximation error
   //! @param __policy The policy used to hash items and finalize the estimate
   //!
@@ -149,7 +168,7 @@ public:
   //! synchronizing it.
   //!
   //! @param __stream CUDA stream used to initialize the object
-  //! @param __memory_resource A memory resource used for allocating device storage
+  //! @param __memory_resource A memory resource used for allocating sketch storage
   //! @param __precision HyperLogLog precision parameter (determines number of registers as 2^precision)
   //! @param __policy The policy used to hash items and finalize the estimate
   //!
@@ -186,9 +205,17 @@ public:
   //! @brief Asynchronously resets the estimator, i.e., clears the current count estimate.
   //!
   //! @param __stream CUDA stream this operation is executed in
-  _CCCL_HOST_API constexpr void clear_async(::cuda::stream_ref __stream) noexcept
+  _CCCL_HOST_API constexpr void clear_async(::cuda::stream_ref __stream)
   {
-    __ref.clear_async(__stream);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      __ref.clear();
+    }
+    else
+    {
+      __ref.clear_async(__stream);
+    }
   }
 
   //! @brief Resets the estimator, i.e., clears the current count estimate.
@@ -199,7 +226,8 @@ public:
   //! @param __stream CUDA stream this operation is executed in
   _CCCL_HOST_API constexpr void clear(::cuda::stream_ref __stream)
   {
-    __ref.clear(__stream);
+    clear_async(__stream);
+    __stream.sync();
   }
 
   //! @brief Asynchronously adds to be counted items to the estimator.
@@ -214,7 +242,15 @@ public:
   template <class _InputIt>
   _CCCL_HOST_API constexpr void add_async(::cuda::stream_ref __stream, _InputIt __first, _InputIt __last)
   {
-    __ref.add_async(__stream, __first, __last);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      __ref.add(__first, __last);
+    }
+    else
+    {
+      __ref.add_async(__stream, __first, __last);
+    }
   }
 
   //! @brief Adds to be counted items to the estimator.
@@ -232,7 +268,8 @@ public:
   template <class _InputIt>
   _CCCL_HOST_API constexpr void add(::cuda::stream_ref __stream, _InputIt __first, _InputIt __last)
   {
-    __ref.add(__stream, __first, __last);
+    add_async(__stream, __first, __last);
+    __stream.sync();
   }
 
   //! @brief Asynchronously merges the result of `other` estimator into `*this` estimator.
@@ -248,7 +285,23 @@ public:
   _CCCL_HOST_API constexpr void
   merge_async(::cuda::stream_ref __stream, const hyperloglog<_Tp, _OtherMemoryResource, _OtherScope, _Policy>& __other)
   {
-    __ref.merge_async(__stream, __other.__ref);
+    using __other_type = hyperloglog<_Tp, _OtherMemoryResource, _OtherScope, _Policy>;
+    if constexpr (__is_device_accessible && __other_type::__is_device_accessible)
+    {
+      __ref.merge_async(__stream, __other.__ref);
+    }
+    else if constexpr (!__is_device_accessible && __other_type::__is_host_accessible)
+    {
+      __stream.sync();
+      __ref.merge(__other.__ref);
+    }
+    else
+    {
+      // One sketch is only accessible from the host and the other one only from the device
+      ::std::vector<::cuda::std::byte> __serialized(__other.serialized_bytes());
+      __other.serialize(__stream, __serialized);
+      merge_serialized(__stream, __serialized);
+    }
   }
 
   //! @brief Merges the result of `other` estimator into `*this` estimator.
@@ -267,7 +320,8 @@ public:
   _CCCL_HOST_API constexpr void
   merge(::cuda::stream_ref __stream, const hyperloglog<_Tp, _OtherMemoryResource, _OtherScope, _Policy>& __other)
   {
-    __ref.merge(__stream, __other.__ref);
+    merge_async(__stream, __other);
+    __stream.sync();
   }
 
   //! @brief Asynchronously merges the result of `other` estimator reference into `*this` estimator.
@@ -281,7 +335,15 @@ public:
   template <::cuda::thread_scope _OtherScope>
   _CCCL_HOST_API constexpr void merge_async(::cuda::stream_ref __stream, const ref_type<_OtherScope>& __other_ref)
   {
-    __ref.merge_async(__stream, __other_ref);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      __ref.merge(__other_ref);
+    }
+    else
+    {
+      __ref.merge_async(__stream, __other_ref);
+    }
   }
 
   //! @brief Merges the result of `other` estimator reference into `*this` estimator.
@@ -298,7 +360,8 @@ public:
   template <::cuda::thread_scope _OtherScope>
   _CCCL_HOST_API constexpr void merge(::cuda::stream_ref __stream, const ref_type<_OtherScope>& __other_ref)
   {
-    __ref.merge(__stream, __other_ref);
+    merge_async(__stream, __other_ref);
+    __stream.sync();
   }
 
   //! @brief Compute the estimated distinct items count.
@@ -316,7 +379,174 @@ public:
   [[nodiscard]] _CCCL_HOST_API constexpr double
   estimate(::cuda::stream_ref __stream, _HostMemoryResource __host_mr = {}) const
   {
-    return __ref.estimate(__stream, __host_mr);
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      return __ref.estimate();
+    }
+    else
+    {
+      return __ref.estimate(__stream, __host_mr);
+    }
+  }
+
+  //! @brief Gets the number of bytes of the serialized sketch.
+  //!
+  //! @return The number of bytes written by `serialize`
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::size_t serialized_bytes() const noexcept
+  {
+    return __ref.serialized_bytes();
+  }
+
+  //! @brief Serializes the sketch.
+  //!
+  //! The serialized format stores one byte per register after an 8 byte header holding the format
+  //! version and the precision. It does not depend on the memory resource or the thread scope, so
+  //! sketches built on the host and on the device can be merged into each other with
+  //! `merge_serialized`, provided that they use the same policy.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __out.size() < serialized_bytes()
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer required to
+  //! copy the sketch from device to host
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __out Host accessible output for the serialized sketch
+  //! @param __host_mr Host memory resource used for copying the sketch
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  _CCCL_HOST_API void serialize(::cuda::stream_ref __stream,
+                                ::cuda::std::span<::cuda::std::byte> __out,
+                                _HostMemoryResource __host_mr = {}) const
+  {
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      __ref.serialize(__out);
+    }
+    else
+    {
+      __ref.serialize(__stream, __out, __host_mr);
+    }
+  }
+
+  //! @brief Merges a sketch serialized by `serialize` into `*this` estimator.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If `__in` is not a serialized sketch, or if its sketch size differs from sketch_bytes()
+  //!
+  //! @tparam _HostMemoryResource Device accessible host memory resource used for allocating the
+  //! buffer the serialized registers are decoded into
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __in Host accessible serialized sketch
+  //! @param __host_mr Host memory resource used for decoding the serialized registers
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  _CCCL_HOST_API void merge_serialized(::cuda::stream_ref __stream,
+                                       ::cuda::std::span<const ::cuda::std::byte> __in,
+                                       _HostMemoryResource __host_mr = {})
+  {
+    if constexpr (!__is_device_accessible)
+    {
+      __stream.sync();
+      __ref.merge_serialized(__in);
+    }
+    else
+    {
+      __ref.merge_serialized(__stream, __in, __host_mr);
+    }
+  }
+
+  // ===== Host Operations =====
+
+  //! @brief Resets the estimator from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  _CCCL_HOST_API void clear() noexcept
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    __ref.clear();
+  }
+
+  //! @brief Adds to be counted items to the estimator using host threads.
+  //!
+  //! The items are split across host threads, each of which counts into a private sketch that is
+  //! merged into this one at the end.
+  //!
+  //! @note Requires a host accessible memory resource. Must not run concurrently with other
+  //! operations on the same estimator.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  template <class _InputIt>
+  _CCCL_HOST_API void add(_InputIt __first, _InputIt __last)
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    __ref.add(__first, __last);
+  }
+
+  //! @brief Merges the result of `other` estimator into `*this` estimator from the calling host
+  //! thread.
+  //!
+  //! @note Requires host accessible memory resources for both estimators.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //! @tparam _OtherMemoryResource Memory resource type of `other` estimator
+  //!
+  //! @param __other Other estimator to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope, class _OtherMemoryResource>
+  _CCCL_HOST_API void merge(const hyperloglog<_Tp, _OtherMemoryResource, _OtherScope, _Policy>& __other)
+  {
+    using __other_type = hyperloglog<_Tp, _OtherMemoryResource, _OtherScope, _Policy>;
+    static_assert(__is_host_accessible && __other_type::__is_host_accessible,
+                  "Host operations require a host accessible memory resource.");
+    __ref.merge(__other.__ref);
+  }
+
+  //! @brief Compute the estimated distinct items count from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST_API double estimate() const noexcept
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    return __ref.estimate();
+  }
+
+  //! @brief Serializes the sketch from the calling host thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @throw If __out.size() < serialized_bytes()
+  //!
+  //! @param __out Host accessible output for the serialized sketch
+  _CCCL_HOST_API void serialize(::cuda::std::span<::cuda::std::byte> __out) const
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    __ref.serialize(__out);
+  }
+
+  //! @brief Merges a sketch serialized by `serialize` into `*this` estimator from the calling host
+  //! thread.
+  //!
+  //! @note Requires a host accessible memory resource.
+  //!
+  //! @throw If `__in` is not a serialized sketch, or if its sketch size differs from sketch_bytes()
+  //!
+  //! @param __in Host accessible serialized sketch
+  _CCCL_HOST_API void merge_serialized(::cuda::std::span<const ::cuda::std::byte> __in)
+  {
+    static_assert(__is_host_accessible, "Host operations require a host accessible memory resource.");
+    __ref.merge_serialized(__in);
   }
 
   //! @brief Get device ref.
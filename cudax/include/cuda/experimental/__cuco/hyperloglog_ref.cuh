@@ -285,6 +285,135 @@ public:
     return __impl.__estimate(__host_mr, __stream);
   }
 
+  //! @brief Resets the estimator from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  _CCCL_HOST_API void clear() noexcept
+  {
+    __impl.__clear_host();
+  }
+
+  //! @brief Adds to be counted items to the estimator using host threads.
+  //!
+  //! @note The sketch must be host accessible. The items are split across host threads, each of
+  //! which counts into a private sketch that is merged into this one at the end.
+  //!
+  //! @tparam _InputIt Host accessible random access input iterator where
+  //! <tt>std::is_convertible<std::iterator_traits<_InputIt>::value_type,
+  //! _Tp></tt> is `true`
+  //!
+  //! @param __first Beginning of the sequence of items
+  //! @param __last End of the sequence of items
+  template <class _InputIt>
+  _CCCL_HOST_API void add(_InputIt __first, _InputIt __last)
+  {
+    __impl.__add_host(__first, __last);
+  }
+
+  //! @brief Merges the result of `other` estimator reference into `*this` estimator from the
+  //! calling host thread.
+  //!
+  //! @note Both sketches must be host accessible.
+  //!
+  //! @throw If sketch_bytes() != __other.sketch_bytes()
+  //!
+  //! @tparam _OtherScope Thread scope of `other` estimator
+  //!
+  //! @param __other Other estimator reference to be merged into `*this`
+  template <::cuda::thread_scope _OtherScope>
+  _CCCL_HOST_API void merge(const hyperloglog_ref<_Tp, _OtherScope, _Policy>& __other)
+  {
+    __impl.__merge_host(__other.__impl);
+  }
+
+  //! @brief Compute the estimated distinct items count from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @return Approximate distinct items count
+  [[nodiscard]] _CCCL_HOST_API double estimate() const noexcept
+  {
+    return __impl.__estimate_host();
+  }
+
+  //! @brief Gets the number of bytes of the serialized sketch.
+  //!
+  //! @return The number of bytes written by `serialize`
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::size_t serialized_bytes() const noexcept
+  {
+    return __impl.__serialized_bytes();
+  }
+
+  //! @brief Serializes the sketch.
+  //!
+  //! The serialized format stores one byte per register after an 8 byte header holding the format
+  //! version and the precision. It does not depend on where the sketch was built, so sketches
+  //! serialized on the host and on the device can be merged into each other with
+  //! `merge_serialized`, provided that they use the same policy.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If __out.size() < serialized_bytes()
+  //!
+  //! @tparam _HostMemoryResource Host memory resource used for allocating the host buffer required to
+  //! copy the sketch from device to host
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __out Host accessible output for the serialized sketch
+  //! @param __host_mr Host memory resource used for copying the sketch
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  _CCCL_HOST_API void serialize(::cuda::stream_ref __stream,
+                                ::cuda::std::span<::cuda::std::byte> __out,
+                                _HostMemoryResource __host_mr = {}) const
+  {
+    __impl.__serialize(__out, __host_mr, __stream);
+  }
+
+  //! @brief Serializes the sketch from the calling host thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @throw If __out.size() < serialized_bytes()
+  //!
+  //! @param __out Host accessible output for the serialized sketch
+  _CCCL_HOST_API void serialize(::cuda::std::span<::cuda::std::byte> __out) const
+  {
+    __impl.__serialize_host(__out);
+  }
+
+  //! @brief Merges a sketch serialized by `serialize` into `*this` estimator.
+  //!
+  //! @note This function synchronizes the given stream.
+  //!
+  //! @throw If `__in` is not a serialized sketch, or if its sketch size differs from sketch_bytes()
+  //!
+  //! @tparam _HostMemoryResource Device accessible host memory resource used for allocating the
+  //! buffer the serialized registers are decoded into
+  //!
+  //! @param __stream CUDA stream this operation is executed in
+  //! @param __in Host accessible serialized sketch
+  //! @param __host_mr Host memory resource used for decoding the serialized registers
+  template <typename _HostMemoryResource = ::cuda::mr::legacy_pinned_memory_resource>
+  _CCCL_HOST_API void merge_serialized(::cuda::stream_ref __stream,
+                                       ::cuda::std::span<const ::cuda::std::byte> __in,
+                                       _HostMemoryResource __host_mr = {})
+  {
+    __impl.__merge_serialized(__in, __host_mr, __stream);
+  }
+
+  //! @brief Merges a sketch serialized by `serialize` into `*this` estimator from the calling host
+  //! thread.
+  //!
+  //! @note The sketch must be host accessible.
+  //!
+  //! @throw If `__in` is not a serialized sketch, or if its sketch size differs from sketch_bytes()
+  //!
+  //! @param __in Host accessible serialized sketch
+  _CCCL_HOST_API void merge_serialized(::cuda::std::span<const ::cuda::std::byte> __in)
+  {
+    __impl.__merge_serialized_host(__in);
+  }
+
   //! @brief Gets the hash function.
   //!
   //! @return The hash function
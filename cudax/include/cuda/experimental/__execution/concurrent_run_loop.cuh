@@ -0,0 +1,236 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
+#define __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+#include <cuda/experimental/__execution/env.cuh>
+#include <cuda/experimental/__execution/intrusive_queue.cuh>
+#include <cuda/experimental/__execution/run_loop.cuh>
+
+#include <nv/target>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A task queue with many producers and many consumers.
+//!
+//! The queue is split into shards. A producer always pushes to the same shard, so the
+//! tasks of one producer are dequeued in the order they were pushed. A consumer locks a
+//! shard, takes up to `__batch_size` tasks from it, and unlocks the shard before it runs
+//! them. Consumers that find no work block on an atomic wait until a producer wakes them.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __concurrent_task_queue : __immovable
+{
+public:
+  using __task = __run_loop_base::__task;
+
+  static constexpr ::cuda::std::uint32_t __shard_count = 16;
+  static constexpr ::cuda::std::uint32_t __batch_size  = 32;
+
+  _CCCL_HIDE_FROM_ABI __concurrent_task_queue() = default;
+
+  _CCCL_HOST_DEVICE_API void push(__task* __task_ptr) noexcept
+  {
+    __shards_[__thread_index() % __shard_count].__incoming_.push(__task_ptr);
+    __wake_one();
+  }
+
+  //! Runs one batch of tasks. Returns false if no tasks were found.
+  _CCCL_HOST_DEVICE_API auto __run_batch(::cuda::std::uint32_t __start) noexcept -> bool
+  {
+    for (::cuda::std::uint32_t __i = 0; __i < __shard_count; ++__i)
+    {
+      auto& __shard = __shards_[(__start + __i) % __shard_count];
+      if (__shard.__busy_.load(::cuda::std::memory_order_relaxed)
+          || __shard.__busy_.exchange(true, ::cuda::std::memory_order_acquire))
+      {
+        continue;
+      }
+
+      // Tasks left over from an earlier batch are older than anything in __incoming_:
+      if (__shard.__pending_.empty())
+      {
+        __shard.__pending_ = __shard.__incoming_.pop_all();
+      }
+
+      __intrusive_queue<&__task::__next_> __batch;
+      for (::cuda::std::uint32_t __n = 0; __n < __batch_size && !__shard.__pending_.empty(); ++__n)
+      {
+        __batch.push_back(__shard.__pending_.pop_front());
+      }
+      const bool __has_more = !__shard.__pending_.empty();
+      __shard.__busy_.store(false, ::cuda::std::memory_order_release);
+
+      if (__batch.empty())
+      {
+        continue;
+      }
+
+      // Let a sleeping consumer pick up what this batch left behind:
+      if (__has_more)
+      {
+        __wake_one();
+      }
+
+      do
+      {
+        // pop_front reads the next pointer before the task runs and possibly destroys itself.
+        __batch.pop_front()->__execute();
+      } while (!__batch.empty());
+      return true;
+    }
+    return false;
+  }
+
+  //! Runs tasks until the queue is found empty after __finishing_ is set.
+  _CCCL_HOST_DEVICE_API void __run(const ::cuda::std::atomic<bool>& __finishing) noexcept
+  {
+    // Start the search at a different shard on each thread to spread the consumers out:
+    const auto __start = __thread_index();
+    while (true)
+    {
+      if (__run_batch(__start))
+      {
+        continue;
+      }
+
+      // Announce that this thread is about to sleep, then look for work one more time. A
+      // producer that pushes after the second search sees __sleepers_ and changes __epoch_.
+      const auto __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+      ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+
+      if (__run_batch(__start))
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        continue;
+      }
+
+      if (__finishing.load(::cuda::std::memory_order_acquire))
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        return;
+      }
+
+      __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    }
+  }
+
+  //! Wakes every blocked consumer.
+  _CCCL_HOST_DEVICE_API void __wake_all() noexcept
+  {
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+    __epoch_.notify_all();
+  }
+
+private:
+  struct _CCCL_TYPE_VISIBILITY_DEFAULT __shard_t
+  {
+    __atomic_intrusive_queue<&__task::__next_> __incoming_{};
+    alignas(64)::cuda::std::atomic<bool> __busy_{false};
+    __intrusive_queue<&__task::__next_> __pending_{};
+  };
+
+  _CCCL_HOST_DEVICE_API void __wake_one() noexcept
+  {
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_release);
+      __epoch_.notify_one();
+    }
+  }
+
+  _CCCL_HOST_API static auto __host_thread_index() noexcept -> ::cuda::std::uint32_t
+  {
+    static ::cuda::std::atomic<::cuda::std::uint32_t> __next_index{0};
+    thread_local const auto __index = __next_index.fetch_add(1, ::cuda::std::memory_order_relaxed);
+    return __index;
+  }
+
+  // A number that is the same every time it is computed on a given thread.
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static auto __thread_index() noexcept -> ::cuda::std::uint32_t
+  {
+    NV_IF_ELSE_TARGET(NV_IS_HOST,
+                      (return __host_thread_index();),
+                      (return (blockIdx.x * blockDim.x + threadIdx.x) ^ (threadIdx.y << 10) ^ (blockIdx.y << 20);))
+  }
+
+  __shard_t __shards_[__shard_count]{};
+  alignas(64)::cuda::std::atomic<::cuda::std::uint32_t> __epoch_{0};
+  ::cuda::std::atomic<::cuda::std::uint32_t> __sleepers_{0};
+};
+
+//! The base of `basic_concurrent_run_loop`. Any number of threads can call `run()`.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __concurrent_run_loop_base : __immovable
+{
+public:
+  using __task = __run_loop_base::__task;
+
+  template <class _Rcvr>
+  using __opstate_t _CCCL_NODEBUG_ALIAS = __run_loop_base::__opstate_t<_Rcvr, __concurrent_task_queue>;
+
+  _CCCL_HIDE_FROM_ABI __concurrent_run_loop_base() = default;
+
+  //! Runs tasks until `finish()` is called and no tasks are left. Each call to `run()`
+  //! returns once it finds the queue empty after `finish()`.
+  _CCCL_HOST_DEVICE_API void run() noexcept
+  {
+    __queue_.__run(__finishing_);
+  }
+
+  _CCCL_HOST_DEVICE_API void finish() noexcept
+  {
+    if (!__finishing_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      __queue_.__wake_all();
+    }
+  }
+
+  ::cuda::std::atomic<bool> __finishing_{false};
+  __concurrent_task_queue __queue_{};
+};
+
+//! A run loop that can be drained by several threads at once. Work scheduled from one
+//! thread is dequeued in the order it was scheduled; with several threads draining the
+//! loop, it may still start running in a different order.
+template <class _Env>
+using basic_concurrent_run_loop _CCCL_NODEBUG_ALIAS = basic_run_loop<_Env, __concurrent_run_loop_base>;
+
+// A concurrent_run_loop with an empty environment.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT concurrent_run_loop : basic_concurrent_run_loop<env<>>
+{
+  _CCCL_HIDE_FROM_ABI constexpr concurrent_run_loop() noexcept
+      : basic_concurrent_run_loop<env<>>{env{}}
+  {}
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_CONCURRENT_RUN_LOOP
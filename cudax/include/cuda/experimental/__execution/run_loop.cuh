@@ -83,10 +83,10 @@ public:
     __task* __next_               = nullptr;
   };
 
-  template <class _Rcvr>
+  template <class _Rcvr, class _Queue = __atomic_intrusive_queue<&__task::__next_>>
   struct _CCCL_TYPE_VISIBILITY_DEFAULT __opstate_t : __task
   {
-    __atomic_intrusive_queue<&__task::__next_>* __queue_;
+    _Queue* __queue_;
     _Rcvr __rcvr_;
 
     _CCCL_HOST_DEVICE_API static void __execute_impl(__task* __p) noexcept
@@ -104,8 +104,7 @@ public:
       }
     }
 
-    _CCCL_HOST_DEVICE_API constexpr explicit __opstate_t(
-      __atomic_intrusive_queue<&__task::__next_>* __queue, _Rcvr __rcvr)
+    _CCCL_HOST_DEVICE_API constexpr explicit __opstate_t(_Queue* __queue, _Rcvr __rcvr)
         : __task{&__execute_impl}
         , __queue_{__queue}
         , __rcvr_{static_cast<_Rcvr&&>(__rcvr)}
@@ -149,8 +148,10 @@ public:
   __task __noop_task{&__noop_};
 };
 
-template <class _Env>
-struct _CCCL_TYPE_VISIBILITY_DEFAULT basic_run_loop : __run_loop_base
+// _Base provides the work queue and the run() and finish() members. It defaults to a
+// queue with a single consumer thread.
+template <class _Env, class _Base = __run_loop_base>
+struct _CCCL_TYPE_VISIBILITY_DEFAULT basic_run_loop : _Base
 {
 private:
   struct _CCCL_TYPE_VISIBILITY_DEFAULT __attrs_t
@@ -191,9 +192,10 @@ public:
       using sender_concept = sender_t;
 
       template <class _Rcvr>
-      [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto connect(_Rcvr __rcvr) const noexcept -> __opstate_t<_Rcvr>
+      [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr auto connect(_Rcvr __rcvr) const noexcept
+        -> typename _Base::template __opstate_t<_Rcvr>
       {
-        return __opstate_t<_Rcvr>{&__loop_->__queue_, static_cast<_Rcvr&&>(__rcvr)};
+        return typename _Base::template __opstate_t<_Rcvr>{&__loop_->__queue_, static_cast<_Rcvr&&>(__rcvr)};
       }
 
       template <class _Self>
@@ -265,9 +267,9 @@ struct _CCCL_TYPE_VISIBILITY_DEFAULT run_loop : basic_run_loop<env<>>
   {}
 };
 
-template <class _Env>
+template <class _Env, class _Base>
 _CCCL_HOST_DEVICE_API constexpr auto
-basic_run_loop<_Env>::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
+basic_run_loop<_Env, _Base>::__attrs_t::query(get_completion_scheduler_t<set_value_t>) const noexcept
 {
   if constexpr (__callable<get_scheduler_t, _Env&>)
   {
@@ -279,16 +281,16 @@ basic_run_loop<_Env>::__attrs_t::query(get_completion_scheduler_t<set_value_t>)
   }
 }
 
-template <class _Env>
+template <class _Env, class _Base>
 _CCCL_HOST_DEVICE_API constexpr auto
-basic_run_loop<_Env>::__attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
+basic_run_loop<_Env, _Base>::__attrs_t::query(get_completion_scheduler_t<set_stopped_t>) const noexcept
 {
   return query(get_completion_scheduler<set_value_t>);
 }
 
-template <class _Env>
+template <class _Env, class _Base>
 _CCCL_HOST_DEVICE_API constexpr auto
-basic_run_loop<_Env>::__attrs_t::query(get_completion_domain_t<set_value_t>) const noexcept
+basic_run_loop<_Env, _Base>::__attrs_t::query(get_completion_domain_t<set_value_t>) const noexcept
 {
   if constexpr (__callable<get_domain_t, _Env&>)
   {
@@ -300,9 +302,9 @@ basic_run_loop<_Env>::__attrs_t::query(get_completion_domain_t<set_value_t>) con
   }
 }
 
-template <class _Env>
+template <class _Env, class _Base>
 _CCCL_HOST_DEVICE_API constexpr auto
-basic_run_loop<_Env>::__attrs_t::query(get_completion_domain_t<set_stopped_t>) const noexcept
+basic_run_loop<_Env, _Base>::__attrs_t::query(get_completion_domain_t<set_stopped_t>) const noexcept
 {
   return query(get_completion_domain<set_value_t>);
 }
@@ -0,0 +1,647 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_THREAD_POOL
+#define __CUDAX_EXECUTION_THREAD_POOL
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__exception/terminate.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/experimental/__execution/atomic_intrusive_queue.cuh>
+#include <cuda/experimental/__execution/exception.cuh>
+#include <cuda/experimental/__execution/parallel_scheduler_backend.cuh>
+#include <cuda/experimental/__execution/queries.cuh>
+#include <cuda/experimental/__execution/stop_token.cuh>
+#include <cuda/experimental/__execution/task_scheduler.cuh>
+#include <cuda/experimental/__execution/work_stealing_deque.cuh>
+#include <cuda/experimental/__utility/shared_ptr.cuh>
+
+#include <memory>
+#include <new>
+#include <thread>
+
+#include <nv/target>
+
+#if _CCCL_OS(LINUX)
+#  include <pthread.h>
+#  include <sched.h>
+#endif // _CCCL_OS(LINUX)
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief Options for constructing a @c thread_pool.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT thread_pool_options
+{
+  //! The number of worker threads. Zero starts one worker per hardware thread.
+  size_t thread_count = 0;
+  //! Pins the i-th worker to the i-th CPU the process may run on. Only supported on
+  //! Linux, ignored elsewhere.
+  bool pin_threads = false;
+  //! Bulk operations are split into at most this many chunks per worker.
+  size_t chunks_per_thread = 4;
+};
+
+namespace __detail
+{
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_task : __immovable
+{
+  using __execute_fn_t _CCCL_NODEBUG_ALIAS = void(__pool_task*) noexcept;
+
+  _CCCL_HIDE_FROM_ABI __pool_task() = default;
+  _CCCL_HOST_API explicit __pool_task(__execute_fn_t* __execute_fn) noexcept
+      : __execute_fn_(__execute_fn)
+  {}
+
+  _CCCL_HOST_API void __execute() noexcept
+  {
+    (*__execute_fn_)(this);
+  }
+
+  __execute_fn_t* __execute_fn_ = nullptr;
+  __pool_task* __next_          = nullptr;
+};
+
+class __thread_pool_backend;
+
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_worker : __immovable
+{
+  __thread_pool_backend* __pool_ = nullptr;
+  size_t __index_                = 0;
+  ::cuda::std::uint32_t __rng_   = 0;
+  __work_stealing_deque<__pool_task> __deque_{};
+  ::std::thread __thread_{};
+};
+
+// Completes a receiver_proxy with set_value, or with set_stopped if stop was requested.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_schedule_task : __pool_task
+{
+  _CCCL_HOST_API explicit __pool_schedule_task(receiver_proxy& __rcvr, bool __in_situ) noexcept
+      : __pool_task{&__execute_impl}
+      , __rcvr_(__rcvr)
+      , __in_situ_(__in_situ)
+  {}
+
+  _CCCL_HOST_API static void __execute_impl(__pool_task* __task) noexcept
+  {
+    auto* __self  = static_cast<__pool_schedule_task*>(__task);
+    auto& __rcvr  = __self->__rcvr_;
+    if (__self->__in_situ_)
+    {
+      __self->~__pool_schedule_task();
+    }
+    else
+    {
+      delete __self;
+    }
+
+    if (__rcvr.get_env().query(get_stop_token).stop_requested())
+    {
+      __rcvr.set_stopped();
+    }
+    else
+    {
+      __rcvr.set_value();
+    }
+  }
+
+  receiver_proxy& __rcvr_;
+  bool __in_situ_;
+};
+
+struct __pool_bulk_state;
+
+// A task which runs the chunks [__begin, __end_) of a bulk operation, where __begin is the
+// index of the task in __pool_bulk_state::__tasks_.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_bulk_task : __pool_task
+{
+  _CCCL_HOST_API __pool_bulk_task() noexcept
+      : __pool_task{&__execute_impl}
+  {}
+
+  _CCCL_HOST_API static void __execute_impl(__pool_task* __task) noexcept;
+
+  __pool_bulk_state* __state_ = nullptr;
+  size_t __end_               = 0;
+};
+
+// The state of a bulk operation, which is followed by its tasks in the same block of memory.
+struct _CCCL_TYPE_VISIBILITY_DEFAULT __pool_bulk_state
+{
+  _CCCL_HOST_API explicit __pool_bulk_state(
+    __thread_pool_backend& __pool,
+    bulk_item_receiver_proxy& __rcvr,
+    bool __chunked,
+    size_t __shape,
+    size_t __chunk_size,
+    size_t __chunk_count,
+    __pool_bulk_task* __tasks,
+    void* __allocation) noexcept
+      : __pool_(__pool)
+      , __rcvr_(__rcvr)
+      , __stop_token_(__rcvr.get_env().query(get_stop_token))
+      , __chunked_(__chunked)
+      , __shape_(__shape)
+      , __chunk_size_(__chunk_size)
+      , __chunk_count_(__chunk_count)
+      , __remaining_(__chunk_count)
+      , __tasks_(__tasks)
+      , __allocation_(__allocation)
+  {
+    for (size_t __i = 0; __i < __chunk_count_; ++__i)
+    {
+      ::new (__tasks_ + __i) __pool_bulk_task{};
+      __tasks_[__i].__state_ = this;
+    }
+  }
+
+  //! Creates the state of a bulk operation of at most @c __max_chunks chunks in @c __storage,
+  //! or in a single heap allocation if @c __storage is too small.
+  [[nodiscard]] _CCCL_HOST_API static auto __make(
+    __thread_pool_backend& __pool,
+    bulk_item_receiver_proxy& __rcvr,
+    bool __chunked,
+    size_t __shape,
+    size_t __max_chunks,
+    ::cuda::std::span<::cuda::std::byte> __storage) -> __pool_bulk_state*
+  {
+    constexpr size_t __task_align   = alignof(__pool_bulk_task);
+    constexpr size_t __tasks_offset = (sizeof(__pool_bulk_state) + __task_align - 1) / __task_align * __task_align;
+
+    const size_t __chunk_size  = (__shape + __max_chunks - 1) / __max_chunks;
+    const size_t __chunk_count = (__shape + __chunk_size - 1) / __chunk_size;
+    const size_t __bytes       = __tasks_offset + __chunk_count * sizeof(__pool_bulk_task);
+
+    void* __allocation = nullptr;
+    void* __block      = __storage.data();
+    size_t __space     = __storage.size();
+    if (__block == nullptr || ::std::align(alignof(__pool_bulk_state), __bytes, __block, __space) == nullptr)
+    {
+      __allocation = ::operator new(__bytes);
+      __block      = __allocation;
+    }
+
+    auto* __tasks = reinterpret_cast<__pool_bulk_task*>(static_cast<::cuda::std::byte*>(__block) + __tasks_offset);
+    return ::new (__block)
+      __pool_bulk_state{__pool, __rcvr, __chunked, __shape, __chunk_size, __chunk_count, __tasks, __allocation};
+  }
+
+  //! Destroys the state and frees its heap allocation, if it has one. The tasks are
+  //! trivially destructible.
+  _CCCL_HOST_API void __destroy() noexcept
+  {
+    void* __allocation = __allocation_;
+    this->~__pool_bulk_state();
+    ::operator delete(__allocation);
+  }
+
+  _CCCL_HOST_API void __run_chunk(size_t __chunk) noexcept
+  {
+    if (!__stop_token_.stop_requested())
+    {
+      const size_t __begin = __chunk * __chunk_size_;
+      const size_t __end   = (::cuda::std::min) (__shape_, __begin + __chunk_size_);
+      if (__chunked_)
+      {
+        __rcvr_.execute(__begin, __end);
+      }
+      else
+      {
+        for (size_t __i = __begin; __i < __end; ++__i)
+        {
+          __rcvr_.execute(__i, __i + 1);
+        }
+      }
+    }
+
+    // The thread that runs the last chunk completes the operation:
+    if (__remaining_.fetch_sub(1, ::cuda::std::memory_order_acq_rel) == 1)
+    {
+      auto& __rcvr        = __rcvr_;
+      const bool __stopped = __stop_token_.stop_requested();
+      __destroy();
+      if (__stopped)
+      {
+        __rcvr.set_stopped();
+      }
+      else
+      {
+        __rcvr.set_value();
+      }
+    }
+  }
+
+  __thread_pool_backend& __pool_;
+  bulk_item_receiver_proxy& __rcvr_;
+  inplace_stop_token __stop_token_;
+  bool __chunked_;
+  size_t __shape_;
+  size_t __chunk_size_;
+  size_t __chunk_count_;
+  ::cuda::std::atomic<size_t> __remaining_;
+  __pool_bulk_task* __tasks_;
+  void* __allocation_;
+};
+
+//! The parallel_scheduler_backend of a thread_pool.
+//!
+//! Every worker owns a work-stealing deque. Work that is scheduled from a worker is pushed
+//! to the worker's own deque, other work goes through a shared injection queue. Idle
+//! workers steal from the other workers, and block on an atomic wait when there is no
+//! work at all.
+class _CCCL_TYPE_VISIBILITY_DEFAULT __thread_pool_backend : public __task_scheduler_backend
+{
+public:
+  _CCCL_HOST_API explicit __thread_pool_backend(const thread_pool_options& __options)
+      : __thread_count_(
+          __options.thread_count != 0
+            ? __options.thread_count
+            : (::cuda::std::max) (size_t{1}, static_cast<size_t>(::std::thread::hardware_concurrency())))
+      , __chunks_per_thread_((::cuda::std::max) (size_t{1}, __options.chunks_per_thread))
+      , __workers_(new __pool_worker[__thread_count_])
+  {
+    for (size_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      auto& __worker    = __workers_[__i];
+      __worker.__pool_  = this;
+      __worker.__index_ = __i;
+      __worker.__rng_   = static_cast<::cuda::std::uint32_t>(__i * 0x9E3779B9u + 1u);
+    }
+    for (size_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      auto& __worker     = __workers_[__i];
+      __worker.__thread_ = ::std::thread{[this, &__worker] {
+        __run(__worker);
+      }};
+      if (__options.pin_threads)
+      {
+        __pin(__worker);
+      }
+    }
+  }
+
+  _CCCL_HOST_API ~__thread_pool_backend()
+  {
+    join();
+  }
+
+  //! Waits for the workers to run all remaining work and to exit.
+  _CCCL_HOST_API void join() noexcept
+  {
+    if (__stopping_.exchange(true, ::cuda::std::memory_order_acq_rel))
+    {
+      return;
+    }
+    __epoch_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+    __epoch_.notify_all();
+    for (size_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      if (__workers_[__i].__thread_.joinable())
+      {
+        __workers_[__i].__thread_.join();
+      }
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto thread_count() const noexcept -> size_t
+  {
+    return __thread_count_;
+  }
+
+  _CCCL_HOST_DEVICE_API void
+  schedule(receiver_proxy& __rcvr, ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
+  {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (__schedule(__rcvr, __storage);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_HOST_DEVICE_API void schedule_bulk_chunked(
+    size_t __shape,
+    bulk_item_receiver_proxy& __rcvr,
+    ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
+  {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (__schedule_bulk(__rcvr, true, __shape, __storage);), (::cuda::std::terminate();))
+  }
+
+  _CCCL_HOST_DEVICE_API void schedule_bulk_unchunked(
+    size_t __shape,
+    bulk_item_receiver_proxy& __rcvr,
+    ::cuda::std::span<::cuda::std::byte> __storage) noexcept final override
+  {
+    NV_IF_ELSE_TARGET(NV_IS_HOST, (__schedule_bulk(__rcvr, false, __shape, __storage);), (::cuda::std::terminate();))
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API auto query(get_forward_progress_guarantee_t) const noexcept
+    -> forward_progress_guarantee final override
+  {
+    return forward_progress_guarantee::parallel;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API bool __equal_to(const void*, ::cuda::std::__type_info_ref) final override
+  {
+    // A thread pool is only ever compared through its task_scheduler.
+    return false;
+  }
+
+  //! Pushes a task to the deque of the calling worker, or to the injection queue if the
+  //! caller is not a worker of this pool, and wakes up an idle worker.
+  //!
+  //! @throws std::bad_alloc if the deque of the worker has to grow and cannot.
+  _CCCL_HOST_API void __push(__pool_task* __task)
+  {
+    if (__current_worker_ != nullptr && __current_worker_->__pool_ == this)
+    {
+      __current_worker_->__deque_.push(__task);
+    }
+    else
+    {
+      __injection_queue_.push(__task);
+    }
+    __notify();
+  }
+
+private:
+  _CCCL_HOST_API void __schedule(receiver_proxy& __rcvr, ::cuda::std::span<::cuda::std::byte> __storage) noexcept
+  {
+    const bool __in_situ         = __storage.size() >= sizeof(__pool_schedule_task);
+    __pool_schedule_task* __task = nullptr;
+    _CCCL_TRY
+    {
+      __task = __in_situ ? ::new (__storage.data()) __pool_schedule_task{__rcvr, true}
+                         : new __pool_schedule_task{__rcvr, false};
+      __push(__task);
+    }
+    _CCCL_CATCH_ALL
+    {
+      if (__task != nullptr && !__in_situ)
+      {
+        delete __task;
+      }
+      __rcvr.set_error(execution::current_exception());
+    }
+  }
+
+  _CCCL_HOST_API void __schedule_bulk(
+    bulk_item_receiver_proxy& __rcvr,
+    bool __chunked,
+    size_t __shape,
+    ::cuda::std::span<::cuda::std::byte> __storage) noexcept
+  {
+    if (__shape == 0)
+    {
+      __rcvr.set_value();
+      return;
+    }
+    __pool_bulk_state* __state = nullptr;
+    _CCCL_TRY
+    {
+      __state = __pool_bulk_state::__make(
+        *this, __rcvr, __chunked, __shape, __thread_count_ * __chunks_per_thread_, __storage);
+      auto& __root  = __state->__tasks_[0];
+      __root.__end_ = __state->__chunk_count_;
+      __push(&__root);
+    }
+    _CCCL_CATCH_ALL
+    {
+      if (__state != nullptr)
+      {
+        __state->__destroy();
+      }
+      __rcvr.set_error(execution::current_exception());
+    }
+  }
+
+  // Pairs with the fence in __run: either the idle worker finds the new task, or we see
+  // that it is about to sleep and wake it up.
+  _CCCL_HOST_API void __notify() noexcept
+  {
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    if (__sleepers_.load(::cuda::std::memory_order_relaxed) != 0)
+    {
+      __epoch_.fetch_add(1, ::cuda::std::memory_order_relaxed);
+      __epoch_.notify_one();
+    }
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto __find_work(__pool_worker& __worker) noexcept -> __pool_task*
+  {
+    if (auto* __task = __worker.__deque_.pop())
+    {
+      return __task;
+    }
+
+    // Move the injected tasks to our deque, from where the other workers can steal them:
+    auto __injected = __injection_queue_.pop_all();
+    if (!__injected.empty())
+    {
+      auto* __task = __injected.pop_front();
+      while (!__injected.empty())
+      {
+        auto* __next = __injected.pop_front();
+        _CCCL_TRY
+        {
+          __worker.__deque_.push(__next);
+        }
+        _CCCL_CATCH_ALL
+        {
+          // The deque cannot grow, so the rest of the tasks stay in the injection queue:
+          __injection_queue_.push(__next);
+          while (!__injected.empty())
+          {
+            __injection_queue_.push(__injected.pop_front());
+          }
+        }
+      }
+      __notify();
+      return __task;
+    }
+
+    // Steal from the other workers, starting at a random one:
+    __worker.__rng_ ^= __worker.__rng_ << 13;
+    __worker.__rng_ ^= __worker.__rng_ >> 17;
+    __worker.__rng_ ^= __worker.__rng_ << 5;
+    const size_t __first = __worker.__rng_ % __thread_count_;
+    for (size_t __i = 0; __i < __thread_count_; ++__i)
+    {
+      auto& __victim = __workers_[(__first + __i) % __thread_count_];
+      if (&__victim == &__worker)
+      {
+        continue;
+      }
+      if (auto* __task = __victim.__deque_.steal())
+      {
+        return __task;
+      }
+    }
+    return nullptr;
+  }
+
+  _CCCL_HOST_API void __run(__pool_worker& __worker) noexcept
+  {
+    __current_worker_ = &__worker;
+    while (true)
+    {
+      if (auto* __task = __find_work(__worker))
+      {
+        __task->__execute();
+        continue;
+      }
+
+      const auto __epoch = __epoch_.load(::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_add(1, ::cuda::std::memory_order_seq_cst);
+      if (auto* __task = __find_work(__worker))
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        __task->__execute();
+        continue;
+      }
+      if (__stopping_.load(::cuda::std::memory_order_acquire))
+      {
+        __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+        break;
+      }
+      __epoch_.wait(__epoch, ::cuda::std::memory_order_acquire);
+      __sleepers_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    }
+    __current_worker_ = nullptr;
+  }
+
+  _CCCL_HOST_API static void __pin([[maybe_unused]] __pool_worker& __worker) noexcept
+  {
+#if _CCCL_OS(LINUX)
+    ::cpu_set_t __allowed;
+    CPU_ZERO(&__allowed);
+    if (::sched_getaffinity(0, sizeof(__allowed), &__allowed) != 0 || CPU_COUNT(&__allowed) == 0)
+    {
+      return;
+    }
+    size_t __target = __worker.__index_ % static_cast<size_t>(CPU_COUNT(&__allowed));
+    for (int __cpu = 0; __cpu < CPU_SETSIZE; ++__cpu)
+    {
+      if (CPU_ISSET(__cpu, &__allowed) && __target-- == 0)
+      {
+        ::cpu_set_t __set;
+        CPU_ZERO(&__set);
+        CPU_SET(__cpu, &__set);
+        ::pthread_setaffinity_np(__worker.__thread_.native_handle(), sizeof(__set), &__set);
+        return;
+      }
+    }
+#endif // _CCCL_OS(LINUX)
+  }
+
+  static inline thread_local __pool_worker* __current_worker_ = nullptr;
+
+  size_t __thread_count_;
+  size_t __chunks_per_thread_;
+  ::std::unique_ptr<__pool_worker[]> __workers_;
+  __atomic_intrusive_queue<&__pool_task::__next_> __injection_queue_{};
+  alignas(64) ::cuda::std::atomic<::cuda::std::uint32_t> __epoch_{0};
+  ::cuda::std::atomic<::cuda::std::uint32_t> __sleepers_{0};
+  ::cuda::std::atomic<bool> __stopping_{false};
+};
+
+// Splits the chunks off the back of the range until one is left, so that idle workers
+// steal the largest ranges first.
+_CCCL_HOST_API inline void __pool_bulk_task::__execute_impl(__pool_task* __task) noexcept
+{
+  auto* __self         = static_cast<__pool_bulk_task*>(__task);
+  auto& __state        = *__self->__state_;
+  const size_t __begin = static_cast<size_t>(__self - __state.__tasks_);
+  size_t __end         = __self->__end_;
+  while (__end - __begin > 1)
+  {
+    const size_t __middle             = __begin + (__end - __begin) / 2;
+    __state.__tasks_[__middle].__end_ = __end;
+    _CCCL_TRY
+    {
+      __state.__pool_.__push(&__state.__tasks_[__middle]);
+    }
+    _CCCL_CATCH_ALL
+    {
+      // The deque cannot grow, so this thread runs the rest of the range itself:
+      break;
+    }
+    __end = __middle;
+  }
+
+  // The last chunk may complete the operation and destroy the state:
+  for (size_t __chunk = __begin; __chunk < __end; ++__chunk)
+  {
+    __state.__run_chunk(__chunk);
+  }
+}
+} // namespace __detail
+
+//! @brief A pool of worker threads which execute work with work stealing.
+//!
+//! The scheduler of a thread pool is a @c task_scheduler. @c bulk_chunked and
+//! @c bulk_unchunked operations which complete on it are split into chunks, which the
+//! workers run in parallel. Operations whose stop token is stopped before they run
+//! complete with @c set_stopped.
+//!
+//! The destructor waits for all scheduled work to finish. Work must not be scheduled on a
+//! thread pool after it is destroyed.
+class _CCCL_TYPE_VISIBILITY_DEFAULT thread_pool : __immovable
+{
+public:
+  _CCCL_HOST_API explicit thread_pool(thread_pool_options __options = {})
+      : __backend_(experimental::__make_shared<__detail::__thread_pool_backend>(__options))
+  {}
+
+  _CCCL_HOST_API explicit thread_pool(size_t __thread_count)
+      : thread_pool(thread_pool_options{__thread_count})
+  {}
+
+  _CCCL_HOST_API ~thread_pool()
+  {
+    join();
+  }
+
+  //! Waits for all scheduled work to finish and stops the workers.
+  _CCCL_HOST_API void join() noexcept
+  {
+    __backend_->join();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto get_scheduler() const noexcept -> task_scheduler
+  {
+    return task_scheduler{__detail::__backend_ptr_t{__backend_}};
+  }
+
+  [[nodiscard]] _CCCL_HOST_API auto thread_count() const noexcept -> size_t
+  {
+    return __backend_->thread_count();
+  }
+
+private:
+  __shared_ptr<__detail::__thread_pool_backend> __backend_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_THREAD_POOL
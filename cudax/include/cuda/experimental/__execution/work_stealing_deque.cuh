@@ -0,0 +1,192 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef __CUDAX_EXECUTION_WORK_STEALING_DEQUE
+#define __CUDAX_EXECUTION_WORK_STEALING_DEQUE
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__utility/immovable.h>
+#include <cuda/std/__utility/exchange.h>
+#include <cuda/std/atomic>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cuda/experimental/__execution/prologue.cuh>
+
+namespace cuda::experimental::execution
+{
+//! @brief A Chase-Lev work-stealing deque of pointers.
+//!
+//! The owning thread pushes and pops items at the bottom. Any other thread can steal
+//! items from the top. The ring buffer grows when it is full. Buffers that were replaced
+//! are kept alive until the deque is destroyed, because a thief may still read from them.
+//!
+//! See "Correct and Efficient Work-Stealing for Weak Memory Models", Le et al., PPoPP 2013.
+template <class _Tp>
+class _CCCL_TYPE_VISIBILITY_DEFAULT __work_stealing_deque : __immovable
+{
+  struct __ring_buffer
+  {
+    _CCCL_HOST_API explicit __ring_buffer(::cuda::std::int64_t __capacity, __ring_buffer* __prev)
+        : __mask_(__capacity - 1)
+        , __items_(new ::cuda::std::atomic<_Tp*>[static_cast<::cuda::std::size_t>(__capacity)])
+        , __prev_(__prev)
+    {}
+
+    _CCCL_HOST_API ~__ring_buffer()
+    {
+      delete[] __items_;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __capacity() const noexcept -> ::cuda::std::int64_t
+    {
+      return __mask_ + 1;
+    }
+
+    [[nodiscard]] _CCCL_HOST_API auto __get(::cuda::std::int64_t __i) const noexcept -> _Tp*
+    {
+      return __items_[__i & __mask_].load(::cuda::std::memory_order_relaxed);
+    }
+
+    _CCCL_HOST_API void __put(::cuda::std::int64_t __i, _Tp* __item) noexcept
+    {
+      __items_[__i & __mask_].store(__item, ::cuda::std::memory_order_relaxed);
+    }
+
+    ::cuda::std::int64_t __mask_;
+    ::cuda::std::atomic<_Tp*>* __items_;
+    __ring_buffer* __prev_;
+  };
+
+public:
+  _CCCL_HOST_API explicit __work_stealing_deque(::cuda::std::int64_t __capacity = 256)
+      : __buffer_(new __ring_buffer(__capacity, nullptr))
+  {
+    _CCCL_ASSERT(__capacity > 0 && (__capacity & (__capacity - 1)) == 0, "the capacity must be a power of two");
+  }
+
+  _CCCL_HOST_API ~__work_stealing_deque()
+  {
+    auto* __buffer = __buffer_.load(::cuda::std::memory_order_relaxed);
+    while (__buffer != nullptr)
+    {
+      delete ::cuda::std::exchange(__buffer, __buffer->__prev_);
+    }
+  }
+
+  //! Pushes an item at the bottom. Only the owning thread may call this.
+  _CCCL_HOST_API void push(_Tp* __item)
+  {
+    const auto __bottom = __bottom_.load(::cuda::std::memory_order_relaxed);
+    const auto __top    = __top_.load(::cuda::std::memory_order_acquire);
+    auto* __buffer      = __buffer_.load(::cuda::std::memory_order_relaxed);
+    if (__bottom - __top > __buffer->__capacity() - 1)
+    {
+      __buffer = __grow(__buffer, __top, __bottom);
+    }
+    __buffer->__put(__bottom, __item);
+    __bottom_.store(__bottom + 1, ::cuda::std::memory_order_release);
+  }
+
+  //! Pops the most recently pushed item, or returns nullptr if the deque is empty. Only
+  //! the owning thread may call this.
+  [[nodiscard]] _CCCL_HOST_API auto pop() noexcept -> _Tp*
+  {
+    const auto __bottom = __bottom_.load(::cuda::std::memory_order_relaxed) - 1;
+    auto* __buffer      = __buffer_.load(::cuda::std::memory_order_relaxed);
+    __bottom_.store(__bottom, ::cuda::std::memory_order_relaxed);
+    ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+    auto __top = __top_.load(::cuda::std::memory_order_relaxed);
+
+    _Tp* __item = nullptr;
+    if (__top <= __bottom)
+    {
+      __item = __buffer->__get(__bottom);
+      if (__top == __bottom)
+      {
+        // This is the last item, so we race with the thieves for it:
+        if (!__top_.compare_exchange_strong(
+              __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+        {
+          __item = nullptr;
+        }
+        __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+      }
+    }
+    else
+    {
+      __bottom_.store(__bottom + 1, ::cuda::std::memory_order_relaxed);
+    }
+    return __item;
+  }
+
+  //! Steals the least recently pushed item, or returns nullptr if the deque is empty. Any
+  //! thread may call this. A steal that loses a race with another thread tries again, so
+  //! nullptr always means that the deque was observed empty.
+  [[nodiscard]] _CCCL_HOST_API auto steal() noexcept -> _Tp*
+  {
+    while (true)
+    {
+      auto __top = __top_.load(::cuda::std::memory_order_acquire);
+      ::cuda::std::atomic_thread_fence(::cuda::std::memory_order_seq_cst);
+      const auto __bottom = __bottom_.load(::cuda::std::memory_order_acquire);
+      if (__top >= __bottom)
+      {
+        return nullptr;
+      }
+
+      auto* __item = __buffer_.load(::cuda::std::memory_order_acquire)->__get(__top);
+      if (__top_.compare_exchange_strong(
+            __top, __top + 1, ::cuda::std::memory_order_seq_cst, ::cuda::std::memory_order_relaxed))
+      {
+        return __item;
+      }
+    }
+  }
+
+  //! Returns true if the deque was observed empty. The result is only a hint when other
+  //! threads access the deque concurrently.
+  [[nodiscard]] _CCCL_HOST_API auto empty() const noexcept -> bool
+  {
+    return __bottom_.load(::cuda::std::memory_order_relaxed) <= __top_.load(::cuda::std::memory_order_relaxed);
+  }
+
+private:
+  _CCCL_HOST_API auto __grow(__ring_buffer* __old, ::cuda::std::int64_t __top, ::cuda::std::int64_t __bottom)
+    -> __ring_buffer*
+  {
+    auto* __new = new __ring_buffer(2 * __old->__capacity(), __old);
+    for (auto __i = __top; __i < __bottom; ++__i)
+    {
+      __new->__put(__i, __old->__get(__i));
+    }
+    __buffer_.store(__new, ::cuda::std::memory_order_release);
+    return __new;
+  }
+
+  // The owner and the thieves write to different cache lines:
+  alignas(64) ::cuda::std::atomic<::cuda::std::int64_t> __top_{0};
+  alignas(64) ::cuda::std::atomic<::cuda::std::int64_t> __bottom_{0};
+  ::cuda::std::atomic<__ring_buffer*> __buffer_;
+};
+} // namespace cuda::experimental::execution
+
+#include <cuda/experimental/__execution/epilogue.cuh>
+
+#endif // __CUDAX_EXECUTION_WORK_STEALING_DEQUE
@@ -0,0 +1,251 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Temporary nvcc workaround __host__ __device__ dtor conflict in cuda::buffer
+#if defined(__CUDACC__)
+#  pragma nv_diag_suppress 20011
+#endif // defined(__CUDACC__)
+
+#include <cuda/functional>
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/memory_resource>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/functional>
+#include <cuda/std/type_traits>
+#include <cuda/stream>
+
+#include <cuda/experimental/__cuco/capacity.cuh>
+#include <cuda/experimental/__cuco/fixed_capacity_map.cuh>
+
+#include <algorithm>
+#include <atomic>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include <testing.cuh>
+
+namespace cudax = cuda::experimental;
+
+template <int N>
+using int_c = ::cuda::std::integral_constant<int, N>;
+
+using key_types     = c2h::type_list<::cuda::std::int32_t, ::cuda::std::int64_t>;
+using cg_sizes      = c2h::type_list<int_c<1>, int_c<4>>;
+using bucket_sizes  = c2h::type_list<int_c<1>, int_c<2>>;
+using probing_kinds = c2h::type_list<int_c<0>, int_c<1>>; // 0 = linear probing, 1 = double hashing
+
+constexpr int payload_offset = 7;
+
+// Memory resource handing out pageable host memory, which is not device accessible
+struct host_memory_resource
+{
+  void* allocate_sync(::cuda::std::size_t bytes, ::cuda::std::size_t alignment)
+  {
+    return ::operator new(bytes, ::std::align_val_t{alignment});
+  }
+
+  void deallocate_sync(void* ptr, ::cuda::std::size_t, ::cuda::std::size_t alignment) noexcept
+  {
+    ::operator delete(ptr, ::std::align_val_t{alignment});
+  }
+
+  bool operator==(const host_memory_resource&) const noexcept
+  {
+    return true;
+  }
+
+  bool operator!=(const host_memory_resource&) const noexcept
+  {
+    return false;
+  }
+
+  friend constexpr void get_property(const host_memory_resource&, ::cuda::mr::host_accessible) noexcept {}
+};
+
+template <class Pair>
+struct iota_pair
+{
+  __host__ __device__ Pair operator()(int i) const noexcept
+  {
+    return Pair{static_cast<typename Pair::first_type>(i), static_cast<typename Pair::second_type>(i + payload_offset)};
+  }
+};
+
+template <class Key, int CgSize, int BucketSize, int Probing, class MemoryResource>
+using map_type = cudax::cuco::fixed_capacity_map<
+  Key,
+  Key,
+  ::cuda::std::dynamic_extent,
+  ::cuda::thread_scope_system,
+  ::cuda::std::equal_to<Key>,
+  ::cuda::std::conditional_t<Probing == 0,
+                             cudax::cuco::linear_probing<CgSize, ::cuda::hash<Key>>,
+                             cudax::cuco::double_hashing<CgSize, ::cuda::hash<Key>>>,
+  BucketSize,
+  MemoryResource>;
+
+C2H_TEST("fixed_capacity_map host memory", "[container]", key_types, cg_sizes, bucket_sizes, probing_kinds)
+{
+  using key_type                             = c2h::get<0, TestType>;
+  [[maybe_unused]] constexpr int cg_size     = c2h::get<1, TestType>::value;
+  [[maybe_unused]] constexpr int bucket_size = c2h::get<2, TestType>::value;
+  [[maybe_unused]] constexpr int probing     = c2h::get<3, TestType>::value;
+  using map        = map_type<key_type, cg_size, bucket_size, probing, host_memory_resource>;
+  using value_type = typename map::value_type;
+
+  // Large enough to be split across several host threads
+  constexpr int num_keys      = 100'000;
+  constexpr key_type sentinel = key_type{-1};
+
+  ::cuda::stream stream{::cuda::device_ref{0}};
+  map m{stream,
+        host_memory_resource{},
+        static_cast<::cuda::std::size_t>(num_keys * 2),
+        cudax::cuco::empty_key{sentinel},
+        cudax::cuco::empty_value{sentinel}};
+
+  const auto pairs = ::cuda::transform_iterator(::cuda::counting_iterator<int>{0}, iota_pair<value_type>{});
+
+  SECTION("Stream overloads run on host threads")
+  {
+    REQUIRE(m.insert(stream, pairs, pairs + num_keys) == num_keys);
+    REQUIRE(m.insert(stream, pairs, pairs + num_keys) == 0);
+
+    ::std::vector<key_type> found(2 * num_keys);
+    m.find(stream,
+           ::cuda::counting_iterator<key_type>{0},
+           ::cuda::counting_iterator<key_type>{2 * num_keys},
+           found.begin());
+    for (int i = 0; i < 2 * num_keys; ++i)
+    {
+      REQUIRE(found[i] == (i < num_keys ? static_cast<key_type>(i + payload_offset) : sentinel));
+    }
+
+    ::std::vector<key_type> keys(num_keys);
+    ::std::vector<key_type> values(num_keys);
+    const auto [keys_end, values_end] = m.retrieve_all(stream, keys.begin(), values.begin());
+    REQUIRE(keys_end == keys.end());
+    REQUIRE(values_end == values.end());
+
+    m.clear(stream);
+    REQUIRE(!m.contains(key_type{0}));
+  }
+
+  SECTION("Bulk host overloads")
+  {
+    REQUIRE(m.insert(pairs, pairs + num_keys) == num_keys);
+
+    ::std::vector<char> contained(2 * num_keys);
+    m.contains(
+      ::cuda::counting_iterator<key_type>{0}, ::cuda::counting_iterator<key_type>{2 * num_keys}, contained.begin());
+    for (int i = 0; i < 2 * num_keys; ++i)
+    {
+      REQUIRE(static_cast<bool>(contained[i]) == (i < num_keys));
+    }
+
+    ::std::vector<key_type> found(num_keys);
+    m.find_if(::cuda::counting_iterator<key_type>{0},
+              ::cuda::counting_iterator<key_type>{num_keys},
+              ::cuda::counting_iterator<int>{0},
+              [](int i) {
+                return i % 2 == 0;
+              },
+              found.begin());
+    for (int i = 0; i < num_keys; ++i)
+    {
+      REQUIRE(found[i] == (i % 2 == 0 ? static_cast<key_type>(i + payload_offset) : sentinel));
+    }
+  }
+
+  SECTION("Concurrent inserts and lookups from host threads")
+  {
+    constexpr int num_threads = 4;
+    ::std::atomic<int> num_inserted{0};
+    ::std::atomic<bool> all_found{true};
+
+    ::std::vector<::std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back([&, t] {
+        // Every thread inserts every key, in a different order
+        for (int i = 0; i < num_keys; ++i)
+        {
+          const int key = (i + t * (num_keys / num_threads)) % num_keys;
+          if (m.insert(value_type{static_cast<key_type>(key), static_cast<key_type>(key + payload_offset)}))
+          {
+            ++num_inserted;
+          }
+          const auto slot = m.find(static_cast<key_type>(key));
+          if (slot == m.end() || slot->second != static_cast<key_type>(key + payload_offset))
+          {
+            all_found = false;
+          }
+        }
+      });
+    }
+    for (auto& thread : threads)
+    {
+      thread.join();
+    }
+
+    REQUIRE(num_inserted == num_keys);
+    REQUIRE(all_found);
+    REQUIRE(m.find(static_cast<key_type>(-2)) == m.end());
+  }
+}
+
+#if _CCCL_CTK_AT_LEAST(12, 9) // Pinned memory resource is only supported with CTK 12.9 and later
+C2H_TEST(
+  "fixed_capacity_map host inserts are found on the device", "[container]", cg_sizes, bucket_sizes, probing_kinds)
+{
+  using key_type                             = ::cuda::std::int32_t;
+  [[maybe_unused]] constexpr int cg_size     = c2h::get<0, TestType>::value;
+  [[maybe_unused]] constexpr int bucket_size = c2h::get<1, TestType>::value;
+  [[maybe_unused]] constexpr int probing     = c2h::get<2, TestType>::value;
+  using map        = map_type<key_type, cg_size, bucket_size, probing, ::cuda::pinned_memory_pool_ref>;
+  using value_type = typename map::value_type;
+
+  constexpr int num_keys      = 10'000;
+  constexpr key_type sentinel = key_type{-1};
+
+  ::cuda::stream stream{::cuda::device_ref{0}};
+  auto mr = ::cuda::pinned_default_memory_pool();
+  map m{stream,
+        mr,
+        static_cast<::cuda::std::size_t>(num_keys * 2),
+        cudax::cuco::empty_key{sentinel},
+        cudax::cuco::empty_value{sentinel}};
+
+  // Insert on the host, look up on the device
+  const auto pairs = ::cuda::transform_iterator(::cuda::counting_iterator<int>{0}, iota_pair<value_type>{});
+  REQUIRE(m.insert(pairs, pairs + num_keys) == num_keys);
+
+  auto found = ::cuda::make_buffer<key_type>(stream, mr, num_keys, key_type{0});
+  m.find(
+    stream, ::cuda::counting_iterator<key_type>{0}, ::cuda::counting_iterator<key_type>{num_keys}, found.begin());
+  REQUIRE(::std::all_of(::cuda::counting_iterator<int>{0},
+                        ::cuda::counting_iterator<int>{num_keys},
+                        [&](int i) {
+                          return found.data()[i] == static_cast<key_type>(i + payload_offset);
+                        }));
+
+  // Insert on the device, look up on the host
+  m.clear(stream);
+  REQUIRE(m.insert(stream, pairs, pairs + num_keys) == num_keys);
+  for (int i = 0; i < num_keys; ++i)
+  {
+    REQUIRE(m.contains(static_cast<key_type>(i)));
+  }
+  REQUIRE(m.insert(pairs, pairs + num_keys) == 0);
+}
+#endif // _CCCL_CTK_AT_LEAST(12, 9)
@@ -0,0 +1,175 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// Temporary nvcc workaround __host__ __device__ dtor conflict in cuda::buffer
+#if defined(__CUDACC__)
+#  pragma nv_diag_suppress 20011
+#endif // defined(__CUDACC__)
+
+#include <cuda/iterator>
+#include <cuda/memory_pool>
+#include <cuda/memory_resource>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+#include <cuda/stream>
+
+#include <cuda/experimental/__cuco/hyperloglog.cuh>
+
+#include <new>
+#include <numeric>
+#include <vector>
+
+#include <testing.cuh>
+
+#include <c2h/catch2_test_helper.h>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+
+namespace cudax = cuda::experimental;
+
+// Memory resource handing out pageable host memory, which is not device accessible
+struct host_memory_resource
+{
+  void* allocate_sync(::cuda::std::size_t bytes, ::cuda::std::size_t alignment)
+  {
+    return ::operator new(bytes, ::std::align_val_t{alignment});
+  }
+
+  void deallocate_sync(void* ptr, ::cuda::std::size_t, ::cuda::std::size_t alignment) noexcept
+  {
+    ::operator delete(ptr, ::std::align_val_t{alignment});
+  }
+
+  bool operator==(const host_memory_resource&) const noexcept
+  {
+    return true;
+  }
+
+  bool operator!=(const host_memory_resource&) const noexcept
+  {
+    return false;
+  }
+
+  friend constexpr void get_property(const host_memory_resource&, ::cuda::mr::host_accessible) noexcept {}
+};
+
+using test_types = c2h::type_list<::cuda::std::int32_t, ::cuda::std::int64_t>;
+
+C2H_TEST("HyperLogLog host memory", "[hyperloglog]", test_types)
+{
+  using T                   = c2h::get<0, TestType>;
+  using host_estimator_type = cudax::cuco::hyperloglog<T, host_memory_resource>;
+
+  const int hll_precision = GENERATE(4, 10, 12, 18);
+  // Large enough to be split across several host threads
+  constexpr ::cuda::std::size_t num_items = 1 << 20;
+  const typename host_estimator_type::precision precision{hll_precision};
+
+  CAPTURE(hll_precision);
+
+  constexpr double tolerance_factor        = 2.5;
+  const double relative_standard_deviation = 1.04 / std::sqrt(static_cast<double>(1ull << hll_precision));
+
+  ::std::vector<T> items(num_items);
+  ::std::iota(items.begin(), items.end(), T{0});
+
+  ::cuda::stream stream{::cuda::device_ref{0}};
+  host_estimator_type estimator{stream, host_memory_resource{}, precision};
+  REQUIRE(estimator.estimate() == 0);
+
+  SECTION("Host operations")
+  {
+    estimator.add(items.begin(), items.end());
+    const auto estimate = estimator.estimate();
+
+    const double relative_error = std::abs((estimate / static_cast<double>(num_items)) - 1.0);
+    REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
+
+    // Adding the same items again should not affect the result
+    estimator.add(items.data(), items.data() + num_items / 2);
+    REQUIRE(estimator.estimate() == estimate);
+
+    // Merging disjoint halves gives the estimate of the whole
+    host_estimator_type first_half{stream, host_memory_resource{}, precision};
+    host_estimator_type second_half{stream, host_memory_resource{}, precision};
+    first_half.add(items.begin(), items.begin() + num_items / 2);
+    second_half.add(items.begin() + num_items / 2, items.end());
+    first_half.merge(second_half);
+    REQUIRE(first_half.estimate() == estimate);
+
+    estimator.clear();
+    REQUIRE(estimator.estimate() == 0);
+  }
+
+  SECTION("Stream operations run on host threads")
+  {
+    estimator.add(stream, items.begin(), items.end());
+    const auto estimate = estimator.estimate(stream);
+    REQUIRE(estimator.estimate() == estimate);
+
+    estimator.clear(stream);
+    REQUIRE(estimator.estimate(stream) == 0);
+  }
+
+  SECTION("Host and device sketches are identical")
+  {
+    using device_estimator_type = cudax::cuco::hyperloglog<T>;
+
+    auto mr            = ::cuda::device_default_memory_pool(::cuda::device_ref{0});
+    const auto counter = ::cuda::counting_iterator<T>{0};
+    device_estimator_type device_estimator{stream, mr, precision};
+    device_estimator.add(stream, counter, counter + num_items);
+    estimator.add(counter, counter + num_items);
+
+    REQUIRE(device_estimator.serialized_bytes() == estimator.serialized_bytes());
+    ::std::vector<::cuda::std::byte> host_bytes(estimator.serialized_bytes());
+    ::std::vector<::cuda::std::byte> device_bytes(device_estimator.serialized_bytes());
+    estimator.serialize(host_bytes);
+    device_estimator.serialize(stream, device_bytes);
+    REQUIRE(host_bytes == device_bytes);
+    REQUIRE_THAT(device_estimator.estimate(stream), Catch::Matchers::WithinRel(estimator.estimate(), 1e-10));
+
+    // Sketches cross between host and device storage in both directions
+    host_estimator_type host_copy{stream, host_memory_resource{}, precision};
+    host_copy.merge(stream, device_estimator);
+    REQUIRE(host_copy.estimate() == estimator.estimate());
+
+    device_estimator.clear(stream);
+    device_estimator.merge_serialized(stream, host_bytes);
+    device_estimator.serialize(stream, device_bytes);
+    REQUIRE(host_bytes == device_bytes);
+  }
+}
+
+C2H_TEST("HyperLogLog serialized sketch validation", "[hyperloglog]")
+{
+  using estimator_type = cudax::cuco::hyperloglog<::cuda::std::int32_t, host_memory_resource>;
+
+  ::cuda::stream stream{::cuda::device_ref{0}};
+  estimator_type estimator{stream, host_memory_resource{}, estimator_type::precision{8}};
+  estimator_type other{stream, host_memory_resource{}, estimator_type::precision{10}};
+  const auto counter = ::cuda::counting_iterator<::cuda::std::int32_t>{0};
+  other.add(counter, counter + 1000);
+
+  ::std::vector<::cuda::std::byte> bytes(other.serialized_bytes());
+  REQUIRE(bytes.size() == 8 + (1 << 10));
+  const ::cuda::std::span<::cuda::std::byte> all_bytes{bytes};
+  REQUIRE_THROWS_AS(other.serialize(all_bytes.first(bytes.size() - 1)), ::std::invalid_argument);
+  other.serialize(bytes);
+
+  // Different sketch sizes cannot be merged
+  REQUIRE_THROWS_AS(estimator.merge_serialized(bytes), ::std::invalid_argument);
+
+  // Truncated or foreign input is rejected
+  REQUIRE_THROWS_AS(other.merge_serialized(all_bytes.first(bytes.size() - 1)), ::std::invalid_argument);
+  bytes[0] = ::cuda::std::byte{0};
+  REQUIRE_THROWS_AS(other.merge_serialized(bytes), ::std::invalid_argument);
+}
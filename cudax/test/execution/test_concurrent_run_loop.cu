@@ -0,0 +1,137 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "testing.cuh"
+
+namespace ex = cuda::experimental::execution;
+
+#if !_CCCL_DEVICE_COMPILATION()
+
+namespace
+{
+C2H_TEST("concurrent_run_loop is a scheduler context", "[scheduler][concurrent_run_loop]")
+{
+  ex::concurrent_run_loop loop;
+  auto sched = loop.get_scheduler();
+  STATIC_CHECK(ex::scheduler<decltype(sched)>);
+  CHECK(sched == loop.get_scheduler());
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+}
+
+C2H_TEST("concurrent_run_loop runs work on several threads", "[scheduler][concurrent_run_loop]")
+{
+  constexpr int producers = 4;
+  constexpr int consumers = 4;
+  constexpr int count     = 5000;
+
+  ex::concurrent_run_loop loop;
+  auto sched = loop.get_scheduler();
+  ::std::atomic<int> counter{0};
+
+  ::std::vector<::std::thread> threads;
+  for (int i = 0; i < consumers; ++i)
+  {
+    threads.emplace_back([&] {
+      loop.run();
+    });
+  }
+
+  ::std::vector<::std::thread> senders;
+  for (int i = 0; i < producers; ++i)
+  {
+    senders.emplace_back([&] {
+      for (int j = 0; j < count; ++j)
+      {
+        ex::start_detached(ex::schedule(sched) | ex::then([&] {
+                             ++counter;
+                           }));
+      }
+    });
+  }
+
+  for (auto& thread : senders)
+  {
+    thread.join();
+  }
+  loop.finish();
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+  CHECK(counter == producers * count);
+}
+
+C2H_TEST("concurrent_run_loop preserves the order of work from one producer", "[scheduler][concurrent_run_loop]")
+{
+  constexpr int producers = 3;
+  constexpr int count     = 1000;
+
+  ex::concurrent_run_loop loop;
+  auto sched = loop.get_scheduler();
+  ::std::vector<int> order[producers];
+
+  ::std::vector<::std::thread> senders;
+  for (int i = 0; i < producers; ++i)
+  {
+    senders.emplace_back([&, i] {
+      for (int j = 0; j < count; ++j)
+      {
+        ex::start_detached(ex::schedule(sched) | ex::then([&, i, j] {
+                             order[i].push_back(j);
+                           }));
+      }
+    });
+  }
+  for (auto& thread : senders)
+  {
+    thread.join();
+  }
+
+  // With a single consumer thread, the work runs in the order it was dequeued:
+  loop.finish();
+  loop.run();
+
+  for (auto& seq : order)
+  {
+    REQUIRE(seq.size() == count);
+    for (int j = 0; j < count; ++j)
+    {
+      CHECK(seq[j] == j);
+    }
+  }
+}
+
+C2H_TEST("concurrent_run_loop can drive sync_wait work from another thread", "[scheduler][concurrent_run_loop]")
+{
+  ex::concurrent_run_loop loop;
+  ::std::thread worker{[&] {
+    loop.run();
+  }};
+
+  auto sndr  = ex::starts_on(loop.get_scheduler(), ex::just(42) | ex::then([](int i) {
+                                                    return ::std::pair{i, ::std::this_thread::get_id()};
+                                                  }));
+  auto [res] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(res.first == 42);
+  CHECK(res.second == worker.get_id());
+
+  loop.finish();
+  worker.join();
+}
+} // namespace
+
+#endif // !_CCCL_DEVICE_COMPILATION()
@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of CUDA Experimental in CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/experimental/execution.cuh>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "testing.cuh"
+
+namespace ex = cuda::experimental::execution;
+
+#if !_CCCL_DEVICE_COMPILATION()
+
+namespace
+{
+C2H_TEST("thread_pool starts work on a worker thread", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  CHECK(pool.thread_count() == 4);
+
+  auto sched = pool.get_scheduler();
+  STATIC_CHECK(cuda::std::is_same_v<decltype(sched), ex::task_scheduler>);
+  CHECK(ex::get_forward_progress_guarantee(sched) == ex::forward_progress_guarantee::parallel);
+  CHECK(sched == pool.get_scheduler());
+
+  auto sndr  = ex::starts_on(sched, ex::just() | ex::then([] {
+                                     return ::std::this_thread::get_id();
+                                    }));
+  auto [tid] = ex::sync_wait(cuda::std::move(sndr)).value();
+  CHECK(tid != ::std::this_thread::get_id());
+}
+
+C2H_TEST("thread_pool runs work scheduled from its workers", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{ex::thread_pool_options{3, true}};
+  auto sched = pool.get_scheduler();
+
+  constexpr int count = 1000;
+  ::std::atomic<int> counter{0};
+  {
+    auto sndr = ex::starts_on(sched, ex::just() | ex::then([&] {
+                                       for (int i = 0; i < count; ++i)
+                                       {
+                                         ex::start_detached(ex::starts_on(sched, ex::just() | ex::then([&] {
+                                                                                   ++counter;
+                                                                                 })));
+                                       }
+                                     }));
+    ex::sync_wait(cuda::std::move(sndr));
+  }
+  pool.join();
+  CHECK(counter == count);
+}
+
+C2H_TEST("thread_pool runs every index of a bulk operation once", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{4};
+  auto sched = pool.get_scheduler();
+
+  for (int shape : {0, 1, 7, 1000, 100000})
+  {
+    // Catch2 assertions are not thread safe, so the workers only record the indices they ran
+    ::std::vector<::std::atomic<int>> hits(shape);
+    auto sndr  = ex::on(sched, ex::just(42) | ex::bulk(ex::par, shape, [&](int i, int value) {
+                                 hits[i] += value;
+                               }));
+    auto [val] = ex::sync_wait(cuda::std::move(sndr)).value();
+    CHECK(val == 42);
+    for (auto& hit : hits)
+    {
+      CHECK(hit == 42);
+    }
+  }
+}
+
+C2H_TEST("thread_pool splits a chunked bulk operation into disjoint chunks", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{ex::thread_pool_options{4, false, 2}};
+  auto sched = pool.get_scheduler();
+
+  constexpr int shape = 10000;
+  ::std::vector<::std::atomic<int>> hits(shape);
+  ::std::atomic<int> chunks{0};
+  auto sndr = ex::on(sched, ex::just() | ex::bulk_chunked(ex::par, shape, [&](int begin, int end) {
+                              ++chunks;
+                              for (int i = begin; i < end; ++i)
+                              {
+                                ++hits[i];
+                              }
+                            }));
+  ex::sync_wait(cuda::std::move(sndr));
+  CHECK(chunks <= 8);
+  for (auto& hit : hits)
+  {
+    CHECK(hit == 1);
+  }
+}
+
+C2H_TEST("thread_pool completes stopped work with set_stopped", "[scheduler][thread_pool]")
+{
+  ex::thread_pool pool{2};
+  auto sched = pool.get_scheduler();
+
+  ex::inplace_stop_source source;
+  source.request_stop();
+  auto sndr   = ex::write_env(ex::schedule(sched), ex::prop{ex::get_stop_token, source.get_token()});
+  auto result = ex::sync_wait(cuda::std::move(sndr));
+  CHECK(!result.has_value());
+}
+} // namespace
+
+#endif // !_CCCL_DEVICE_COMPILATION()
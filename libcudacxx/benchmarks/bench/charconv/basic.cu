@@ -0,0 +1,220 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <thrust/device_vector.h>
+
+#include <cuda/std/bit>
+#include <cuda/std/charconv>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <charconv>
+#include <vector>
+
+#include <nvbench/nvbench.cuh>
+#include <nvbench/range.cuh>
+
+// The maximum length of the shortest representation of a float or double, including the sign.
+static constexpr int max_chars = 32;
+
+// Generates values with random bit patterns, skipping infinities and NaNs.
+template <typename T>
+__host__ __device__ T make_value(cuda::std::uint64_t i)
+{
+  using bits_t = cuda::std::conditional_t<sizeof(T) == 4, cuda::std::uint32_t, cuda::std::uint64_t>;
+
+  // splitmix64
+  cuda::std::uint64_t z = i + 0x9e3779b97f4a7c15ull;
+  z                     = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+  z                     = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+  z                     = z ^ (z >> 31);
+
+  const T value = cuda::std::bit_cast<T>(static_cast<bits_t>(z));
+  return cuda::std::isfinite(value) ? value : static_cast<T>(i);
+}
+
+template <typename T>
+__global__ void to_chars_kernel(cuda::std::size_t n, char* out)
+{
+  const cuda::std::size_t idx = static_cast<cuda::std::size_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+  if (idx < n)
+  {
+    char* first = out + idx * max_chars;
+    const auto r = cuda::std::to_chars(first, first + max_chars, make_value<T>(idx));
+    if (r.ptr != first + max_chars)
+    {
+      *r.ptr = '\0';
+    }
+  }
+}
+
+template <typename T>
+__global__ void from_chars_kernel(cuda::std::size_t n, const char* in, T* out)
+{
+  const cuda::std::size_t idx = static_cast<cuda::std::size_t>(blockDim.x) * blockIdx.x + threadIdx.x;
+  if (idx < n)
+  {
+    const char* first = in + idx * max_chars;
+    const char* last  = first;
+    while (last != first + max_chars && *last != '\0')
+    {
+      ++last;
+    }
+    (void) cuda::std::from_chars(first, last, out[idx]);
+  }
+}
+
+template <typename T>
+void to_chars_device(nvbench::state& state, nvbench::type_list<T>)
+{
+  constexpr int block_size = 256;
+  const auto n             = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+  const auto grid_size     = static_cast<unsigned>((n + block_size - 1) / block_size);
+
+  thrust::device_vector<char> out(n * max_chars);
+
+  state.add_element_count(n);
+  state.add_global_memory_writes<char>(n * max_chars);
+
+  state.exec([&](nvbench::launch& launch) {
+    to_chars_kernel<T><<<grid_size, block_size, 0, launch.get_stream()>>>(n, thrust::raw_pointer_cast(out.data()));
+  });
+}
+
+template <typename T>
+void from_chars_device(nvbench::state& state, nvbench::type_list<T>)
+{
+  constexpr int block_size = 256;
+  const auto n             = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+  const auto grid_size     = static_cast<unsigned>((n + block_size - 1) / block_size);
+
+  thrust::device_vector<char> in(n * max_chars);
+  thrust::device_vector<T> out(n);
+  to_chars_kernel<T><<<grid_size, block_size>>>(n, thrust::raw_pointer_cast(in.data()));
+
+  state.add_element_count(n);
+  state.add_global_memory_reads<char>(n * max_chars);
+  state.add_global_memory_writes<T>(n);
+
+  state.exec([&](nvbench::launch& launch) {
+    from_chars_kernel<T><<<grid_size, block_size, 0, launch.get_stream()>>>(
+      n, thrust::raw_pointer_cast(in.data()), thrust::raw_pointer_cast(out.data()));
+  });
+}
+
+struct cuda_std_tag
+{
+  template <typename T>
+  static std::to_chars_result to_chars(char* first, char* last, T value)
+  {
+    const auto r = cuda::std::to_chars(first, last, value);
+    return {r.ptr, static_cast<std::errc>(r.ec)};
+  }
+
+  template <typename T>
+  static std::from_chars_result from_chars(const char* first, const char* last, T& value)
+  {
+    const auto r = cuda::std::from_chars(first, last, value);
+    return {r.ptr, static_cast<std::errc>(r.ec)};
+  }
+};
+
+struct std_tag
+{
+  template <typename T>
+  static std::to_chars_result to_chars(char* first, char* last, T value)
+  {
+    return std::to_chars(first, last, value);
+  }
+
+  template <typename T>
+  static std::from_chars_result from_chars(const char* first, const char* last, T& value)
+  {
+    return std::from_chars(first, last, value);
+  }
+};
+
+template <typename Impl, typename T>
+void to_chars_host(nvbench::state& state, nvbench::type_list<Impl, T>)
+{
+  const auto n = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+
+  std::vector<T> in(n);
+  for (cuda::std::size_t i = 0; i < n; ++i)
+  {
+    in[i] = make_value<T>(i);
+  }
+  std::vector<char> out(n * max_chars);
+
+  state.add_element_count(n);
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (cuda::std::size_t i = 0; i < n; ++i)
+    {
+      char* first = out.data() + i * max_chars;
+      Impl::to_chars(first, first + max_chars, in[i]);
+    }
+    timer.stop();
+  });
+}
+
+template <typename Impl, typename T>
+void from_chars_host(nvbench::state& state, nvbench::type_list<Impl, T>)
+{
+  const auto n = static_cast<cuda::std::size_t>(state.get_int64("Elements"));
+
+  std::vector<char> in(n * max_chars);
+  std::vector<cuda::std::size_t> lengths(n);
+  for (cuda::std::size_t i = 0; i < n; ++i)
+  {
+    char* first = in.data() + i * max_chars;
+    const auto r = std_tag::to_chars(first, first + max_chars, make_value<T>(i));
+    lengths[i]   = static_cast<cuda::std::size_t>(r.ptr - first);
+  }
+  std::vector<T> out(n);
+
+  state.add_element_count(n);
+
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch&, auto& timer) {
+    timer.start();
+    for (cuda::std::size_t i = 0; i < n; ++i)
+    {
+      const char* first = in.data() + i * max_chars;
+      Impl::from_chars(first, first + lengths[i], out[i]);
+    }
+    timer.stop();
+  });
+}
+
+using value_types = nvbench::type_list<float, double>;
+using impl_types  = nvbench::type_list<cuda_std_tag, std_tag>;
+
+NVBENCH_BENCH_TYPES(to_chars_device, NVBENCH_TYPE_AXES(value_types))
+  .set_name("to_chars_device")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+NVBENCH_BENCH_TYPES(from_chars_device, NVBENCH_TYPE_AXES(value_types))
+  .set_name("from_chars_device")
+  .set_type_axes_names({"T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 24, 4));
+
+NVBENCH_BENCH_TYPES(to_chars_host, NVBENCH_TYPE_AXES(impl_types, value_types))
+  .set_name("to_chars_host")
+  .set_type_axes_names({"Impl", "T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 20, 4));
+
+NVBENCH_BENCH_TYPES(from_chars_host, NVBENCH_TYPE_AXES(impl_types, value_types))
+  .set_name("from_chars_host")
+  .set_type_axes_names({"Impl", "T{ct}"})
+  .add_int64_power_of_two_axis("Elements", nvbench::range(16, 20, 4));
@@ -0,0 +1,195 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA___BARRIER_TREE_BARRIER_H
+#define _CUDA___BARRIER_TREE_BARRIER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if !_CCCL_COMPILER(NVRTC)
+
+#  include <cuda/std/__barrier/empty_completion.h>
+#  include <cuda/std/__limits/numeric_limits.h>
+#  include <cuda/std/__memory/unique_ptr.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+_CCCL_DIAG_PUSH
+_CCCL_DIAG_SUPPRESS_MSVC(4324) // structure was padded due to alignment specifier
+
+// A small number that is distinct for every host thread, which spreads the threads over the leaves of the tree
+[[nodiscard]] _CCCL_HOST_API inline ::cuda::std::size_t __tree_barrier_thread_index() noexcept
+{
+  static ::cuda::std::atomic<::cuda::std::size_t> __next{0};
+  thread_local const ::cuda::std::size_t __index = __next.fetch_add(1, ::cuda::std::memory_order_relaxed);
+  return __index;
+}
+
+//! @brief A host barrier with the interface of `cuda::std::barrier`, whose arrivals are combined in a tree.
+//!
+//! `cuda::std::barrier` counts the arrivals of a phase in a single atomic variable, whose cache line moves between all
+//! arriving threads. Here, the arrivals meet in pairs at the nodes of a binary tree instead, one cache line per node.
+//! The second thread to arrive at a node continues to its parent, the first one is done, and the thread that
+//! completes the root runs the completion function and starts the next phase. Waiting threads block on the phase,
+//! which is written once per phase. Thus the latency of a phase grows logarithmically with the number of threads.
+//!
+//! The tree is allocated for the expected count passed to the constructor. The barrier can only be used by host
+//! threads.
+//!
+//! @tparam _CompletionF The function object run at the end of every phase
+template <class _CompletionF = ::cuda::std::__empty_completion>
+class tree_barrier
+{
+  using __phase_t = ::cuda::std::uint8_t;
+
+  // The tickets of a node, one for every round of the tree. A ticket holds the phase before the first thread arrives,
+  // the phase plus one after that, and the phase plus two, the next phase, after the second thread arrives.
+  struct alignas(64) __node
+  {
+    ::cuda::std::atomic<__phase_t> __tickets[64];
+  };
+
+  ::cuda::std::ptrdiff_t __expected_;
+  ::cuda::std::unique_ptr<__node[]> __nodes_;
+  ::cuda::std::atomic<::cuda::std::ptrdiff_t> __expected_adjustment_{0};
+  _CompletionF __completion_;
+  alignas(64) ::cuda::std::atomic<__phase_t> __phase_{0};
+
+  // Arrives at the tree in __old_phase and returns whether this arrival completes the phase
+  [[nodiscard]] _CCCL_HOST_API bool __arrive_tree(__phase_t __old_phase) noexcept
+  {
+    const __phase_t __half_step = static_cast<__phase_t>(__old_phase + 1);
+    const __phase_t __full_step = static_cast<__phase_t>(__old_phase + 2);
+
+    ::cuda::std::size_t __current_expected = static_cast<::cuda::std::size_t>(__expected_);
+    if (__current_expected <= 1)
+    {
+      return true;
+    }
+    ::cuda::std::size_t __current = ::cuda::__tree_barrier_thread_index() % ((__current_expected + 1) >> 1);
+    for (int __round = 0;; ++__round)
+    {
+      const ::cuda::std::size_t __end_node  = (__current_expected + 1) >> 1;
+      const ::cuda::std::size_t __last_node = __end_node - 1;
+      for (;; ++__current)
+      {
+        if (__current == __end_node)
+        {
+          __current = 0;
+        }
+        auto& __ticket     = __nodes_[__current].__tickets[__round];
+        __phase_t __expect = __old_phase;
+        if (__current == __last_node && (__current_expected & 1))
+        {
+          // the last node of an odd round has a single thread, which continues right away
+          if (__ticket.compare_exchange_strong(__expect, __full_step, ::cuda::std::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        else if (__ticket.compare_exchange_strong(__expect, __half_step, ::cuda::std::memory_order_acq_rel))
+        {
+          // the first thread at the node is done
+          return false;
+        }
+        else if (__expect == __half_step)
+        {
+          // the second thread at the node continues to the parent
+          if (__ticket.compare_exchange_strong(__expect, __full_step, ::cuda::std::memory_order_acq_rel))
+          {
+            break;
+          }
+        }
+        // the node is taken, so try the next one
+      }
+      __current_expected = __last_node + 1;
+      if (__current_expected <= 1)
+      {
+        // this thread arrived at the root
+        return true;
+      }
+      __current >>= 1;
+    }
+  }
+
+public:
+  using arrival_token = __phase_t;
+
+  _CCCL_HOST_API explicit tree_barrier(::cuda::std::ptrdiff_t __expected, _CompletionF __completion = _CompletionF())
+      : __expected_(__expected)
+      , __nodes_(new __node[static_cast<::cuda::std::size_t>((__expected + 1) >> 1)]())
+      , __completion_(::cuda::std::move(__completion))
+  {
+    _CCCL_ASSERT(__expected >= 0, "Cannot initialize barrier with negative arrival count");
+  }
+
+  tree_barrier(const tree_barrier&)            = delete;
+  tree_barrier& operator=(const tree_barrier&) = delete;
+
+  /*discard*/ _CCCL_HOST_API arrival_token arrive(::cuda::std::ptrdiff_t __update = 1)
+  {
+    _CCCL_ASSERT(__update > 0, "The update must be positive");
+    const __phase_t __old_phase = __phase_.load(::cuda::std::memory_order_relaxed);
+    for (; __update; --__update)
+    {
+      if (__arrive_tree(__old_phase))
+      {
+        __completion_();
+        __expected_ += __expected_adjustment_.load(::cuda::std::memory_order_relaxed);
+        __expected_adjustment_.store(0, ::cuda::std::memory_order_relaxed);
+        __phase_.store(static_cast<__phase_t>(__old_phase + 2), ::cuda::std::memory_order_release);
+        __phase_.notify_all();
+      }
+    }
+    return __old_phase;
+  }
+  _CCCL_HOST_API void wait(arrival_token&& __old_phase) const
+  {
+    __phase_.wait(__old_phase, ::cuda::std::memory_order_acquire);
+  }
+  _CCCL_HOST_API void arrive_and_wait()
+  {
+    wait(arrive());
+  }
+  _CCCL_HOST_API void arrive_and_drop()
+  {
+    __expected_adjustment_.fetch_sub(1, ::cuda::std::memory_order_relaxed);
+    (void) arrive();
+  }
+
+  [[nodiscard]] _CCCL_HOST_API static constexpr ::cuda::std::ptrdiff_t max() noexcept
+  {
+    return ::cuda::std::numeric_limits<::cuda::std::ptrdiff_t>::max();
+  }
+};
+
+_CCCL_DIAG_POP
+
+_CCCL_END_NAMESPACE_CUDA
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // !_CCCL_COMPILER(NVRTC)
+
+#endif // _CUDA___BARRIER_TREE_BARRIER_H
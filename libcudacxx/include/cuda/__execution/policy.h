@@ -20,7 +20,7 @@
 #  pragma system_header
 #endif // no system header
 
-#if _CCCL_HAS_BACKEND_CUDA()
+#if _CCCL_HAS_PSTL_BACKEND()
 
 #  include <cuda/std/__execution/policy.h>
 
@@ -28,16 +28,36 @@
 
 _CCCL_BEGIN_NAMESPACE_CUDA_EXECUTION
 
+#  if _CCCL_HAS_BACKEND_CUDA()
 using __cub_parallel_unsequenced_policy =
   ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
     static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel_unsequenced),
     ::cuda::std::execution::__execution_backend::__cuda>()>;
 _CCCL_GLOBAL_CONSTANT __cub_parallel_unsequenced_policy gpu{};
+#  endif // _CCCL_HAS_BACKEND_CUDA()
+
+#  if _CCCL_HAS_BACKEND_OMP()
+//! @brief Runs the parallel algorithms on the host, with OpenMP
+using __omp_parallel_unsequenced_policy =
+  ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
+    static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel_unsequenced),
+    ::cuda::std::execution::__execution_backend::__omp>()>;
+_CCCL_GLOBAL_CONSTANT __omp_parallel_unsequenced_policy omp{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+//! @brief Runs the parallel algorithms on the host, with TBB
+using __tbb_parallel_unsequenced_policy =
+  ::cuda::std::execution::__execution_policy_base<::cuda::std::execution::__with_backend<
+    static_cast<uint32_t>(::cuda::std::execution::__execution_policy::__parallel_unsequenced),
+    ::cuda::std::execution::__execution_backend::__tbb>()>;
+_CCCL_GLOBAL_CONSTANT __tbb_parallel_unsequenced_policy tbb{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
 
 _CCCL_END_NAMESPACE_CUDA_EXECUTION
 
 #  include <cuda/std/__cccl/epilogue.h>
 
-#endif // _CCCL_HAS_BACKEND_CUDA()
+#endif // _CCCL_HAS_PSTL_BACKEND()
 
 #endif // _CUDA___EXECUTION_POLICY_H
@@ -22,6 +22,7 @@
 #endif // no system header
 
 #include <cuda/__functional/hash/murmurhash3.h>
+#include <cuda/__functional/hash/xxh3.h>
 #include <cuda/__functional/hash/xxhash.h>
 #include <cuda/std/__type_traits/always_false.h>
 
@@ -36,7 +37,9 @@ enum class hash_algorithm
   xxhash_64,
   murmurhash3_32,
   murmurhash3_x86_128,
-  murmurhash3_x64_128
+  murmurhash3_x64_128,
+  xxh3_64,
+  xxh3_128
 };
 
 //! @brief A hash function class specialized for different hash algorithms.
@@ -70,6 +73,15 @@ public:
   using ::cuda::__murmurhash3_32<_Key>::operator();
 };
 
+template <typename _Key>
+class hash<_Key, hash_algorithm::xxh3_64> : private ::cuda::__xxh3_64<_Key>
+{
+public:
+  using ::cuda::__xxh3_64<_Key>::__xxh3_64;
+  using ::cuda::__xxh3_64<_Key>::operator();
+  using ::cuda::__xxh3_64<_Key>::hash_each;
+};
+
 #if _CCCL_HAS_INT128()
 
 template <typename _Key>
@@ -88,6 +100,14 @@ public:
   using ::cuda::__murmurhash3_x64_128<_Key>::operator();
 };
 
+template <typename _Key>
+class hash<_Key, hash_algorithm::xxh3_128> : private ::cuda::__xxh3_128<_Key>
+{
+public:
+  using ::cuda::__xxh3_128<_Key>::__xxh3_128;
+  using ::cuda::__xxh3_128<_Key>::operator();
+};
+
 #else // _CCCL_HAS_INT128()
 
 template <typename _Key>
@@ -104,6 +124,52 @@ class hash<_Key, hash_algorithm::murmurhash3_x64_128>
                 "cuda::hash with hash_algorithm::murmurhash3_x64_128 requires compiler support for __int128");
 };
 
+template <typename _Key>
+class hash<_Key, hash_algorithm::xxh3_128>
+{
+  static_assert(::cuda::std::__always_false_v<_Key>,
+                "cuda::hash with hash_algorithm::xxh3_128 requires compiler support for __int128");
+};
+
+#endif // _CCCL_HAS_INT128()
+
+//! @brief The state of a hash function over an input that arrives in several pieces.
+//!
+//! The digest of all pieces equals the hash value of their concatenation computed by `cuda::hash`.
+//!
+//! @tparam _Algorithm The hash algorithm to use, either `hash_algorithm::xxh3_64` or `hash_algorithm::xxh3_128`
+template <hash_algorithm _Algorithm>
+class hash_state
+{
+  static_assert(_Algorithm == hash_algorithm::xxh3_64 || _Algorithm == hash_algorithm::xxh3_128,
+                "cuda::hash_state is only available for hash_algorithm::xxh3_64 and hash_algorithm::xxh3_128");
+  // xxh3_128 is specialized below if the compiler supports __int128
+  static_assert(_Algorithm != hash_algorithm::xxh3_128,
+                "cuda::hash_state with hash_algorithm::xxh3_128 requires compiler support for __int128");
+};
+
+template <>
+class hash_state<hash_algorithm::xxh3_64> : private ::cuda::__xxh3_64_state
+{
+public:
+  using ::cuda::__xxh3_64_state::__xxh3_64_state;
+  using ::cuda::__xxh3_64_state::digest;
+  using ::cuda::__xxh3_64_state::reset;
+  using ::cuda::__xxh3_64_state::update;
+};
+
+#if _CCCL_HAS_INT128()
+
+template <>
+class hash_state<hash_algorithm::xxh3_128> : private ::cuda::__xxh3_128_state
+{
+public:
+  using ::cuda::__xxh3_128_state::__xxh3_128_state;
+  using ::cuda::__xxh3_128_state::digest;
+  using ::cuda::__xxh3_128_state::reset;
+  using ::cuda::__xxh3_128_state::update;
+};
+
 #endif // _CCCL_HAS_INT128()
 
 _CCCL_END_NAMESPACE_CUDA
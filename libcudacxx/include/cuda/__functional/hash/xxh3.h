@@ -0,0 +1,923 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+/*
+ * `__xxh3_64` and `__xxh3_128` implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _CUDA___FUNCTIONAL_HASH_XXH3_H
+#define _CUDA___FUNCTIONAL_HASH_XXH3_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/__functional/hash/utils.h>
+#include <cuda/std/__bit/bit_cast.h>
+#include <cuda/std/__bit/byteswap.h>
+#include <cuda/std/__bit/rotl.h>
+#include <cuda/std/__cstring/memcpy.h>
+#include <cuda/std/__simd/specializations/host_vector.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/array>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA
+
+inline constexpr ::cuda::std::uint32_t __xxh3_prime32_1 = 0x9e3779b1u;
+inline constexpr ::cuda::std::uint32_t __xxh3_prime32_2 = 0x85ebca77u;
+inline constexpr ::cuda::std::uint32_t __xxh3_prime32_3 = 0xc2b2ae3du;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime64_1 = 11400714785074694791ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime64_2 = 14029467366897019727ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime64_3 = 1609587929392839161ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime64_4 = 9650029242287828579ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime64_5 = 2870177450012600261ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime_mx1 = 0x165667919e3779f9ull;
+inline constexpr ::cuda::std::uint64_t __xxh3_prime_mx2 = 0x9fb21c651e98df25ull;
+
+//! Size of the secret, and number of bytes of the secret consumed per stripe
+inline constexpr ::cuda::std::size_t __xxh3_secret_size         = 192;
+inline constexpr ::cuda::std::size_t __xxh3_secret_consume_rate = 8;
+//! Inputs are consumed in 64-byte stripes, and the accumulators are scrambled after every block of stripes
+inline constexpr ::cuda::std::size_t __xxh3_stripe_len = 64;
+inline constexpr ::cuda::std::size_t __xxh3_stripes_per_block =
+  (__xxh3_secret_size - __xxh3_stripe_len) / __xxh3_secret_consume_rate;
+inline constexpr ::cuda::std::size_t __xxh3_block_len = __xxh3_stripe_len * __xxh3_stripes_per_block;
+//! Longest input hashed without the accumulators
+inline constexpr ::cuda::std::size_t __xxh3_midsize_max = 240;
+//! Size of the input buffer of a streaming state
+inline constexpr ::cuda::std::size_t __xxh3_buffer_size = 256;
+
+//! @brief The default XXH3 secret, from which the secrets of seeded long inputs are derived.
+_CCCL_GLOBAL_CONSTANT unsigned char __xxh3_default_secret[__xxh3_secret_size] = {
+  0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+  0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+  0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+  0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+  0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+  0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+  0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+  0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+  0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+  0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+  0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+  0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+
+//! @brief The 128-bit XXH3 result as two 64-bit halves.
+struct __xxh3_128_result
+{
+  ::cuda::std::uint64_t __low;
+  ::cuda::std::uint64_t __high;
+};
+
+//! @brief Loads a little-endian `_Tp` from an unaligned byte pointer.
+//!
+//! Constant evaluation assembles the value byte by byte, while runtime loads go through `__load_chunk`.
+template <typename _Tp, typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp __xxh3_read(const _Byte* __ptr) noexcept
+{
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    return ::cuda::__load_chunk<_Tp>(reinterpret_cast<const ::cuda::std::byte*>(__ptr), 0);
+  }
+  _Tp __value = 0;
+  for (::cuda::std::size_t __i = 0; __i < sizeof(_Tp); ++__i)
+  {
+    __value |= static_cast<_Tp>(static_cast<unsigned char>(__ptr[__i])) << (8 * __i);
+  }
+  return __value;
+}
+
+//! @brief Copies `__count` bytes, usable in constant evaluation.
+template <typename _Byte>
+_CCCL_HOST_DEVICE_API constexpr void
+__xxh3_copy(::cuda::std::byte* __dst, const _Byte* __src, ::cuda::std::size_t __count) noexcept
+{
+  _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+  {
+    if (__count > 0)
+    {
+      ::cuda::std::memcpy(__dst, __src, __count);
+    }
+    return;
+  }
+  for (::cuda::std::size_t __i = 0; __i < __count; ++__i)
+  {
+    __dst[__i] = static_cast<::cuda::std::byte>(__src[__i]);
+  }
+}
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __xxh3_128_result
+__xxh3_mul128(::cuda::std::uint64_t __lhs, ::cuda::std::uint64_t __rhs) noexcept
+{
+  return {__lhs * __rhs, ::cuda::mul_hi(__lhs, __rhs)};
+}
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_mul128_fold64(::cuda::std::uint64_t __lhs, ::cuda::std::uint64_t __rhs) noexcept
+{
+  const auto __product = ::cuda::__xxh3_mul128(__lhs, __rhs);
+  return __product.__low ^ __product.__high;
+}
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_xorshift(::cuda::std::uint64_t __h, int __shift) noexcept
+{
+  return __h ^ (__h >> __shift);
+}
+
+//! @brief The XXH64 finalizer, used by inputs of at most 3 bytes.
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_xxh64_avalanche(::cuda::std::uint64_t __h) noexcept
+{
+  __h ^= __h >> 33;
+  __h *= __xxh3_prime64_2;
+  __h ^= __h >> 29;
+  __h *= __xxh3_prime64_3;
+  __h ^= __h >> 32;
+  return __h;
+}
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t __xxh3_avalanche(::cuda::std::uint64_t __h) noexcept
+{
+  __h = ::cuda::__xxh3_xorshift(__h, 37);
+  __h *= __xxh3_prime_mx1;
+  return ::cuda::__xxh3_xorshift(__h, 32);
+}
+
+//! @brief The finalizer of inputs of 4 to 8 bytes, which is stronger than `__xxh3_avalanche`.
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_rrmxmx(::cuda::std::uint64_t __h, ::cuda::std::uint64_t __len) noexcept
+{
+  __h ^= ::cuda::std::rotl(__h, 49) ^ ::cuda::std::rotl(__h, 24);
+  __h *= __xxh3_prime_mx2;
+  __h ^= (__h >> 35) + __len;
+  __h *= __xxh3_prime_mx2;
+  return ::cuda::__xxh3_xorshift(__h, 28);
+}
+
+template <typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_mix16(const _Byte* __in, const unsigned char* __secret, ::cuda::std::uint64_t __seed) noexcept
+{
+  const auto __lo = ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in);
+  const auto __hi = ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in + 8);
+  return ::cuda::__xxh3_mul128_fold64(__lo ^ (::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret) + __seed),
+                                      __hi ^ (::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret + 8) - __seed));
+}
+
+template <typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __xxh3_128_result __xxh3_mix32(
+  __xxh3_128_result __acc,
+  const _Byte* __in1,
+  const _Byte* __in2,
+  const unsigned char* __secret,
+  ::cuda::std::uint64_t __seed) noexcept
+{
+  __acc.__low += ::cuda::__xxh3_mix16(__in1, __secret, __seed);
+  __acc.__low ^=
+    ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in2) + ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in2 + 8);
+  __acc.__high += ::cuda::__xxh3_mix16(__in2, __secret + 16, __seed);
+  __acc.__high ^=
+    ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in1) + ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in1 + 8);
+  return __acc;
+}
+
+//! @brief The eight accumulators of inputs longer than `__xxh3_midsize_max`.
+using __xxh3_accumulators = ::cuda::std::array<::cuda::std::uint64_t, 8>;
+
+inline constexpr __xxh3_accumulators __xxh3_initial_accumulators = {
+  __xxh3_prime32_3,
+  __xxh3_prime64_1,
+  __xxh3_prime64_2,
+  __xxh3_prime64_3,
+  __xxh3_prime64_4,
+  __xxh3_prime32_2,
+  __xxh3_prime64_5,
+  __xxh3_prime32_1};
+
+template <typename _Byte>
+_CCCL_HOST_DEVICE_API constexpr void
+__xxh3_accumulate_stripe(__xxh3_accumulators& __acc, const _Byte* __in, const unsigned char* __secret) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __acc.size(); ++__i)
+  {
+    const auto __data = ::cuda::__xxh3_read<::cuda::std::uint64_t>(__in + 8 * __i);
+    const auto __key  = __data ^ ::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret + 8 * __i);
+    __acc[__i ^ 1] += __data;
+    __acc[__i] += (__key & 0xffffffffu) * (__key >> 32);
+  }
+}
+
+template <typename _Byte>
+_CCCL_HOST_DEVICE_API constexpr void __xxh3_accumulate(
+  __xxh3_accumulators& __acc,
+  const _Byte* __in,
+  const unsigned char* __secret,
+  ::cuda::std::size_t __num_stripes) noexcept
+{
+  for (::cuda::std::size_t __stripe = 0; __stripe < __num_stripes; ++__stripe)
+  {
+    ::cuda::__xxh3_accumulate_stripe(
+      __acc, __in + __stripe * __xxh3_stripe_len, __secret + __stripe * __xxh3_secret_consume_rate);
+  }
+}
+
+_CCCL_HOST_DEVICE_API constexpr void __xxh3_scramble(__xxh3_accumulators& __acc, const unsigned char* __secret) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __acc.size(); ++__i)
+  {
+    const auto __key = ::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret + 8 * __i);
+    __acc[__i]       = (::cuda::__xxh3_xorshift(__acc[__i], 47) ^ __key) * __xxh3_prime32_1;
+  }
+}
+
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t __xxh3_merge_accumulators(
+  const __xxh3_accumulators& __acc, const unsigned char* __secret, ::cuda::std::uint64_t __start) noexcept
+{
+  auto __result = __start;
+  for (::cuda::std::size_t __i = 0; __i < 4; ++__i)
+  {
+    __result += ::cuda::__xxh3_mul128_fold64(
+      __acc[2 * __i] ^ ::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret + 16 * __i),
+      __acc[2 * __i + 1] ^ ::cuda::__xxh3_read<::cuda::std::uint64_t>(__secret + 16 * __i + 8));
+  }
+  return ::cuda::__xxh3_avalanche(__result);
+}
+
+//! @brief Merges the accumulators into the low half of the hash, which is the whole 64-bit hash.
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t __xxh3_merge_low(
+  const __xxh3_accumulators& __acc, const unsigned char* __secret, ::cuda::std::uint64_t __len) noexcept
+{
+  return ::cuda::__xxh3_merge_accumulators(__acc, __secret + 11, __len * __xxh3_prime64_1);
+}
+
+//! @brief Merges the accumulators into the high half of the 128-bit hash.
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t __xxh3_merge_high(
+  const __xxh3_accumulators& __acc, const unsigned char* __secret, ::cuda::std::uint64_t __len) noexcept
+{
+  return ::cuda::__xxh3_merge_accumulators(
+    __acc, __secret + __xxh3_secret_size - sizeof(__xxh3_accumulators) - 11, ~(__len * __xxh3_prime64_2));
+}
+
+//! @brief Derives the secret of inputs longer than `__xxh3_midsize_max` from a non-zero seed.
+_CCCL_HOST_DEVICE_API constexpr void
+__xxh3_init_secret(unsigned char (&__secret)[__xxh3_secret_size], ::cuda::std::uint64_t __seed) noexcept
+{
+  for (::cuda::std::size_t __i = 0; __i < __xxh3_secret_size; __i += 8)
+  {
+    auto __word = ::cuda::__xxh3_read<::cuda::std::uint64_t>(__xxh3_default_secret + __i);
+    __word      = (__i % 16 == 0) ? __word + __seed : __word - __seed;
+    for (::cuda::std::size_t __b = 0; __b < 8; ++__b)
+    {
+      __secret[__i + __b] = static_cast<unsigned char>(__word >> (8 * __b));
+    }
+  }
+}
+
+//! @brief Accumulates all stripes of an input longer than `__xxh3_midsize_max`, including the overlapping last one.
+template <typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __xxh3_accumulators
+__xxh3_hash_long(const _Byte* __in, ::cuda::std::size_t __len, const unsigned char* __secret) noexcept
+{
+  auto __acc               = __xxh3_initial_accumulators;
+  const auto __num_blocks  = (__len - 1) / __xxh3_block_len;
+  const auto __scramble_at = __secret + __xxh3_secret_size - __xxh3_stripe_len;
+  for (::cuda::std::size_t __block = 0; __block < __num_blocks; ++__block)
+  {
+    ::cuda::__xxh3_accumulate(__acc, __in + __block * __xxh3_block_len, __secret, __xxh3_stripes_per_block);
+    ::cuda::__xxh3_scramble(__acc, __scramble_at);
+  }
+
+  const auto __num_stripes = ((__len - 1) - __num_blocks * __xxh3_block_len) / __xxh3_stripe_len;
+  ::cuda::__xxh3_accumulate(__acc, __in + __num_blocks * __xxh3_block_len, __secret, __num_stripes);
+  ::cuda::__xxh3_accumulate_stripe(__acc, __in + __len - __xxh3_stripe_len, __scramble_at - 7);
+  return __acc;
+}
+
+//! @brief Computes the 64-bit XXH3 hash of `[__in, __in + __len)`.
+template <typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t
+__xxh3_64_hash(const _Byte* __in, ::cuda::std::size_t __len, ::cuda::std::uint64_t __seed) noexcept
+{
+  using ::cuda::__xxh3_read;
+  using ::cuda::std::uint32_t;
+  using ::cuda::std::uint64_t;
+  const unsigned char* __secret = __xxh3_default_secret;
+
+  if (__len == 0)
+  {
+    return ::cuda::__xxh3_xxh64_avalanche(
+      __seed ^ (__xxh3_read<uint64_t>(__secret + 56) ^ __xxh3_read<uint64_t>(__secret + 64)));
+  }
+  if (__len <= 3)
+  {
+    const auto __c1       = static_cast<uint32_t>(static_cast<unsigned char>(__in[0]));
+    const auto __c2       = static_cast<uint32_t>(static_cast<unsigned char>(__in[__len >> 1]));
+    const auto __c3       = static_cast<uint32_t>(static_cast<unsigned char>(__in[__len - 1]));
+    const uint32_t __comb = (__c1 << 16) | (__c2 << 24) | __c3 | (static_cast<uint32_t>(__len) << 8);
+    const uint64_t __flip = (__xxh3_read<uint32_t>(__secret) ^ __xxh3_read<uint32_t>(__secret + 4)) + __seed;
+    return ::cuda::__xxh3_xxh64_avalanche(__comb ^ __flip);
+  }
+  if (__len <= 8)
+  {
+    __seed ^= static_cast<uint64_t>(::cuda::std::byteswap(static_cast<uint32_t>(__seed))) << 32;
+    const uint64_t __in1  = __xxh3_read<uint32_t>(__in);
+    const uint64_t __in2  = __xxh3_read<uint32_t>(__in + __len - 4);
+    const uint64_t __flip = (__xxh3_read<uint64_t>(__secret + 8) ^ __xxh3_read<uint64_t>(__secret + 16)) - __seed;
+    return ::cuda::__xxh3_rrmxmx((__in2 + (__in1 << 32)) ^ __flip, __len);
+  }
+  if (__len <= 16)
+  {
+    const uint64_t __flip1 = (__xxh3_read<uint64_t>(__secret + 24) ^ __xxh3_read<uint64_t>(__secret + 32)) + __seed;
+    const uint64_t __flip2 = (__xxh3_read<uint64_t>(__secret + 40) ^ __xxh3_read<uint64_t>(__secret + 48)) - __seed;
+    const uint64_t __lo    = __xxh3_read<uint64_t>(__in) ^ __flip1;
+    const uint64_t __hi    = __xxh3_read<uint64_t>(__in + __len - 8) ^ __flip2;
+    return ::cuda::__xxh3_avalanche(
+      __len + ::cuda::std::byteswap(__lo) + __hi + ::cuda::__xxh3_mul128_fold64(__lo, __hi));
+  }
+  if (__len <= 128)
+  {
+    uint64_t __acc = __len * __xxh3_prime64_1;
+    if (__len > 32)
+    {
+      if (__len > 64)
+      {
+        if (__len > 96)
+        {
+          __acc += ::cuda::__xxh3_mix16(__in + 48, __secret + 96, __seed);
+          __acc += ::cuda::__xxh3_mix16(__in + __len - 64, __secret + 112, __seed);
+        }
+        __acc += ::cuda::__xxh3_mix16(__in + 32, __secret + 64, __seed);
+        __acc += ::cuda::__xxh3_mix16(__in + __len - 48, __secret + 80, __seed);
+      }
+      __acc += ::cuda::__xxh3_mix16(__in + 16, __secret + 32, __seed);
+      __acc += ::cuda::__xxh3_mix16(__in + __len - 32, __secret + 48, __seed);
+    }
+    __acc += ::cuda::__xxh3_mix16(__in, __secret, __seed);
+    __acc += ::cuda::__xxh3_mix16(__in + __len - 16, __secret + 16, __seed);
+    return ::cuda::__xxh3_avalanche(__acc);
+  }
+  if (__len <= __xxh3_midsize_max)
+  {
+    uint64_t __acc = __len * __xxh3_prime64_1;
+    for (::cuda::std::size_t __i = 0; __i < 8; ++__i)
+    {
+      __acc += ::cuda::__xxh3_mix16(__in + 16 * __i, __secret + 16 * __i, __seed);
+    }
+    __acc = ::cuda::__xxh3_avalanche(__acc);
+    for (::cuda::std::size_t __i = 8; __i < __len / 16; ++__i)
+    {
+      __acc += ::cuda::__xxh3_mix16(__in + 16 * __i, __secret + 16 * (__i - 8) + 3, __seed);
+    }
+    __acc += ::cuda::__xxh3_mix16(__in + __len - 16, __secret + 136 - 17, __seed);
+    return ::cuda::__xxh3_avalanche(__acc);
+  }
+
+  unsigned char __seeded_secret[__xxh3_secret_size]{};
+  if (__seed != 0)
+  {
+    ::cuda::__xxh3_init_secret(__seeded_secret, __seed);
+    __secret = __seeded_secret;
+  }
+  return ::cuda::__xxh3_merge_low(::cuda::__xxh3_hash_long(__in, __len, __secret), __secret, __len);
+}
+
+//! @brief Computes the 128-bit XXH3 hash of `[__in, __in + __len)`.
+template <typename _Byte>
+[[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __xxh3_128_result
+__xxh3_128_hash(const _Byte* __in, ::cuda::std::size_t __len, ::cuda::std::uint64_t __seed) noexcept
+{
+  using ::cuda::__xxh3_read;
+  using ::cuda::std::uint32_t;
+  using ::cuda::std::uint64_t;
+  const unsigned char* __secret = __xxh3_default_secret;
+
+  if (__len == 0)
+  {
+    return {
+      ::cuda::__xxh3_xxh64_avalanche(
+        __seed ^ __xxh3_read<uint64_t>(__secret + 64) ^ __xxh3_read<uint64_t>(__secret + 72)),
+      ::cuda::__xxh3_xxh64_avalanche(
+        __seed ^ __xxh3_read<uint64_t>(__secret + 80) ^ __xxh3_read<uint64_t>(__secret + 88))};
+  }
+  if (__len <= 3)
+  {
+    const auto __c1        = static_cast<uint32_t>(static_cast<unsigned char>(__in[0]));
+    const auto __c2        = static_cast<uint32_t>(static_cast<unsigned char>(__in[__len >> 1]));
+    const auto __c3        = static_cast<uint32_t>(static_cast<unsigned char>(__in[__len - 1]));
+    const uint32_t __combl = (__c1 << 16) | (__c2 << 24) | __c3 | (static_cast<uint32_t>(__len) << 8);
+    const uint32_t __combh = ::cuda::std::rotl(::cuda::std::byteswap(__combl), 13);
+    const uint64_t __flipl = (__xxh3_read<uint32_t>(__secret) ^ __xxh3_read<uint32_t>(__secret + 4)) + __seed;
+    const uint64_t __fliph = (__xxh3_read<uint32_t>(__secret + 8) ^ __xxh3_read<uint32_t>(__secret + 12)) - __seed;
+    return {::cuda::__xxh3_xxh64_avalanche(__combl ^ __flipl), ::cuda::__xxh3_xxh64_avalanche(__combh ^ __fliph)};
+  }
+  if (__len <= 8)
+  {
+    __seed ^= static_cast<uint64_t>(::cuda::std::byteswap(static_cast<uint32_t>(__seed))) << 32;
+    const uint64_t __lo   = __xxh3_read<uint32_t>(__in);
+    const uint64_t __hi   = __xxh3_read<uint32_t>(__in + __len - 4);
+    const uint64_t __flip = (__xxh3_read<uint64_t>(__secret + 16) ^ __xxh3_read<uint64_t>(__secret + 24)) + __seed;
+    // Shifting the length keeps the multiplier odd
+    auto __m = ::cuda::__xxh3_mul128((__lo + (__hi << 32)) ^ __flip, __xxh3_prime64_1 + (__len << 2));
+    __m.__high += __m.__low << 1;
+    __m.__low ^= __m.__high >> 3;
+    __m.__low = ::cuda::__xxh3_xorshift(__m.__low, 35);
+    __m.__low *= __xxh3_prime_mx2;
+    __m.__low  = ::cuda::__xxh3_xorshift(__m.__low, 28);
+    __m.__high = ::cuda::__xxh3_avalanche(__m.__high);
+    return __m;
+  }
+  if (__len <= 16)
+  {
+    const uint64_t __flipl = (__xxh3_read<uint64_t>(__secret + 32) ^ __xxh3_read<uint64_t>(__secret + 40)) - __seed;
+    const uint64_t __fliph = (__xxh3_read<uint64_t>(__secret + 48) ^ __xxh3_read<uint64_t>(__secret + 56)) + __seed;
+    const uint64_t __lo    = __xxh3_read<uint64_t>(__in);
+    uint64_t __hi          = __xxh3_read<uint64_t>(__in + __len - 8);
+    auto __m               = ::cuda::__xxh3_mul128(__lo ^ __hi ^ __flipl, __xxh3_prime64_1);
+    // The length lands in the middle of the 128-bit product, so that the multiplication below mixes it into both halves
+    __m.__low += static_cast<uint64_t>(__len - 1) << 54;
+    __hi ^= __fliph;
+    __m.__high += __hi + (__hi & 0xffffffffu) * (__xxh3_prime32_2 - 1);
+    __m.__low ^= ::cuda::std::byteswap(__m.__high);
+
+    auto __h = ::cuda::__xxh3_mul128(__m.__low, __xxh3_prime64_2);
+    __h.__high += __m.__high * __xxh3_prime64_2;
+    return {::cuda::__xxh3_avalanche(__h.__low), ::cuda::__xxh3_avalanche(__h.__high)};
+  }
+  if (__len <= __xxh3_midsize_max)
+  {
+    __xxh3_128_result __acc{__len * __xxh3_prime64_1, 0};
+    if (__len <= 128)
+    {
+      if (__len > 32)
+      {
+        if (__len > 64)
+        {
+          if (__len > 96)
+          {
+            __acc = ::cuda::__xxh3_mix32(__acc, __in + 48, __in + __len - 64, __secret + 96, __seed);
+          }
+          __acc = ::cuda::__xxh3_mix32(__acc, __in + 32, __in + __len - 48, __secret + 64, __seed);
+        }
+        __acc = ::cuda::__xxh3_mix32(__acc, __in + 16, __in + __len - 32, __secret + 32, __seed);
+      }
+      __acc = ::cuda::__xxh3_mix32(__acc, __in, __in + __len - 16, __secret, __seed);
+    }
+    else
+    {
+      ::cuda::std::size_t __i = 32;
+      for (; __i < 160; __i += 32)
+      {
+        __acc = ::cuda::__xxh3_mix32(__acc, __in + __i - 32, __in + __i - 16, __secret + __i - 32, __seed);
+      }
+      __acc.__low  = ::cuda::__xxh3_avalanche(__acc.__low);
+      __acc.__high = ::cuda::__xxh3_avalanche(__acc.__high);
+      // The last 32 bytes are mixed twice if the length is a multiple of 32
+      for (__i = 160; __i <= __len; __i += 32)
+      {
+        __acc = ::cuda::__xxh3_mix32(__acc, __in + __i - 32, __in + __i - 16, __secret + 3 + __i - 160, __seed);
+      }
+      __acc = ::cuda::__xxh3_mix32(__acc, __in + __len - 16, __in + __len - 32, __secret + 136 - 17 - 16, 0 - __seed);
+    }
+    const uint64_t __low  = __acc.__low + __acc.__high;
+    const uint64_t __high = __acc.__low * __xxh3_prime64_1 + __acc.__high * __xxh3_prime64_4
+                          + (__len - __seed) * __xxh3_prime64_2;
+    return {::cuda::__xxh3_avalanche(__low), 0 - ::cuda::__xxh3_avalanche(__high)};
+  }
+
+  unsigned char __seeded_secret[__xxh3_secret_size]{};
+  if (__seed != 0)
+  {
+    ::cuda::__xxh3_init_secret(__seeded_secret, __seed);
+    __secret = __seeded_secret;
+  }
+  const auto __acc = ::cuda::__xxh3_hash_long(__in, __len, __secret);
+  return {::cuda::__xxh3_merge_low(__acc, __secret, __len), ::cuda::__xxh3_merge_high(__acc, __secret, __len)};
+}
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+//! @brief Hashes every key of 4 or 8 bytes into `__out` with `::cuda::__xxh3_64_hash`, a host vector of keys at a time.
+//!
+//! Keys of 4 to 8 bytes are hashed from one 64-bit word, so all lanes follow the same path. The keys that do not fill a
+//! host vector are hashed one at a time.
+template <typename _Key>
+_CCCL_HOST_API void __xxh3_64_hash_each_host(
+  const _Key* __keys, ::cuda::std::size_t __n, ::cuda::std::uint64_t* __out, ::cuda::std::uint64_t __seed) noexcept
+{
+  using ::cuda::std::uint32_t;
+  using ::cuda::std::uint64_t;
+  using __vector         = ::cuda::std::simd::__host_vector_t<uint64_t>;
+  constexpr auto __lanes = static_cast<::cuda::std::size_t>(::cuda::std::simd::__host_vector<uint64_t>::__lanes);
+  constexpr uint64_t __len = sizeof(_Key);
+  static_assert(__len == 4 || __len == 8, "Only keys of 4 or 8 bytes are hashed in host vectors");
+
+  const uint64_t __mixed_seed =
+    __seed ^ (static_cast<uint64_t>(::cuda::std::byteswap(static_cast<uint32_t>(__seed))) << 32);
+  const uint64_t __flip = (::cuda::__xxh3_read<uint64_t>(__xxh3_default_secret + 8)
+                           ^ ::cuda::__xxh3_read<uint64_t>(__xxh3_default_secret + 16))
+                        - __mixed_seed;
+
+  const auto __full        = __n - __n % __lanes;
+  ::cuda::std::size_t __i = 0;
+  for (; __i < __full; __i += __lanes)
+  {
+    __vector __h;
+    if constexpr (__len == 4)
+    {
+      // The first and the last four bytes are the same word
+      using __narrow_vector = typename ::cuda::std::simd::__host_vector<uint32_t, __lanes * sizeof(uint32_t)>::__type;
+      __narrow_vector __words;
+      ::cuda::std::memcpy(&__words, __keys + __i, sizeof(__words));
+      const auto __wide = __builtin_convertvector(__words, __vector);
+      __h               = __wide + (__wide << 32);
+    }
+    else
+    {
+      ::cuda::std::memcpy(&__h, __keys + __i, sizeof(__h));
+      __h = (__h >> 32) + (__h << 32);
+    }
+    __h ^= __flip;
+    __h ^= ((__h << 49) | (__h >> 15)) ^ ((__h << 24) | (__h >> 40));
+    __h *= __xxh3_prime_mx2;
+    __h ^= (__h >> 35) + __len;
+    __h *= __xxh3_prime_mx2;
+    __h ^= __h >> 28;
+    ::cuda::std::memcpy(__out + __i, &__h, sizeof(__h));
+  }
+  for (; __i < __n; ++__i)
+  {
+    __out[__i] = ::cuda::__xxh3_64_hash(reinterpret_cast<const ::cuda::std::byte*>(__keys + __i), sizeof(_Key), __seed);
+  }
+}
+
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+//! @brief A `__xxh3_64` hash function to hash the given argument on host and device.
+//!
+//! @tparam _Key The type of the values to hash
+template <typename _Key>
+struct __xxh3_64
+{
+  //! @brief Constructs a XXH3_64 hash function with the given `seed`.
+  //!
+  //! @param __seed A custom number to randomize the resulting hash value
+  _CCCL_HOST_DEVICE_API constexpr explicit __xxh3_64(::cuda::std::uint64_t __seed = 0)
+      : __seed_{__seed}
+  {}
+
+  //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
+  //!
+  //! @param __key The input argument to hash
+  //! @return The resulting hash value for `__key`
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t operator()(const _Key& __key) const noexcept
+  {
+    // Materialize a copy so the device compiler can use wide loads.
+    const auto __bytes = ::cuda::std::bit_cast<::cuda::std::array<::cuda::std::byte, sizeof(_Key)>>(__key);
+    return ::cuda::__xxh3_64_hash(__bytes.data(), sizeof(_Key), __seed_);
+  }
+
+  //! @brief Returns a hash value for its argument, as a value of type `::cuda::std::uint64_t`.
+  //!
+  //! @tparam _Extent The extent type
+  //! @param __keys span of keys to hash
+  //! @return The resulting hash value
+  template <::cuda::std::size_t _Extent>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API ::cuda::std::uint64_t
+  operator()(::cuda::std::span<_Key, _Extent> __keys) const noexcept
+  {
+    return ::cuda::__xxh3_64_hash(::cuda::std::as_bytes(__keys).data(), __keys.size_bytes(), __seed_);
+  }
+
+  //! @brief Hashes every key of `__keys` on its own, `__out[i]` is the hash value of `__keys[i]`.
+  //!
+  //! On host, keys of 4 and 8 bytes are hashed a host vector at a time if host vectors hold at least four keys. With
+  //! fewer lanes, the emulated 64-bit multiplications are slower than hashing one key at a time.
+  //!
+  //! @param __keys The keys to hash
+  //! @param __out The resulting hash values, at least as many as `__keys`
+  _CCCL_HOST_DEVICE_API void
+  hash_each(::cuda::std::span<const _Key> __keys, ::cuda::std::span<::cuda::std::uint64_t> __out) const noexcept
+  {
+    _CCCL_ASSERT(__out.size() >= __keys.size(), "cuda::hash::hash_each: output is smaller than the input");
+#if _CCCL_HAS_SIMD_HOST_VECTOR() && _CCCL_SIMD_HOST_VECTOR_BYTES() >= 32
+    if constexpr (sizeof(_Key) == 4 || sizeof(_Key) == 8)
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (::cuda::__xxh3_64_hash_each_host(__keys.data(), __keys.size(), __out.data(), __seed_); return;))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR() && _CCCL_SIMD_HOST_VECTOR_BYTES() >= 32
+    for (::cuda::std::size_t __i = 0; __i < __keys.size(); ++__i)
+    {
+      __out[__i] = (*this)(__keys[__i]);
+    }
+  }
+
+private:
+  ::cuda::std::uint64_t __seed_;
+};
+
+#if _CCCL_HAS_INT128()
+
+//! @brief A `__xxh3_128` hash function to hash the given argument on host and device.
+//!
+//! @tparam _Key The type of the values to hash
+template <typename _Key>
+struct __xxh3_128
+{
+  //! @brief Constructs a XXH3_128 hash function with the given `seed`.
+  //!
+  //! @param __seed A custom number to randomize the resulting hash value
+  _CCCL_HOST_DEVICE_API constexpr explicit __xxh3_128(::cuda::std::uint64_t __seed = 0)
+      : __seed_{__seed}
+  {}
+
+  //! @brief Returns a hash value for its argument, as a value of type `__uint128_t`.
+  //!
+  //! @param __key The input argument to hash
+  //! @return The resulting hash value for `__key`
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __uint128_t operator()(const _Key& __key) const noexcept
+  {
+    // Materialize a copy so the device compiler can use wide loads.
+    const auto __bytes = ::cuda::std::bit_cast<::cuda::std::array<::cuda::std::byte, sizeof(_Key)>>(__key);
+    return __to_uint128(::cuda::__xxh3_128_hash(__bytes.data(), sizeof(_Key), __seed_));
+  }
+
+  //! @brief Returns a hash value for its argument, as a value of type `__uint128_t`.
+  //!
+  //! @tparam _Extent The extent type
+  //! @param __keys span of keys to hash
+  //! @return The resulting hash value
+  template <::cuda::std::size_t _Extent>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API __uint128_t operator()(::cuda::std::span<_Key, _Extent> __keys) const noexcept
+  {
+    return __to_uint128(::cuda::__xxh3_128_hash(::cuda::std::as_bytes(__keys).data(), __keys.size_bytes(), __seed_));
+  }
+
+private:
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr __uint128_t __to_uint128(__xxh3_128_result __h) noexcept
+  {
+    return (static_cast<__uint128_t>(__h.__high) << 64) | __h.__low;
+  }
+
+  ::cuda::std::uint64_t __seed_;
+};
+
+#endif // _CCCL_HAS_INT128()
+
+//! @brief Streaming XXH3 state, which hashes an input that arrives in several pieces.
+//!
+//! Inputs are buffered until a stripe can be accumulated, the digest of a short input hashes the buffer.
+class __xxh3_state
+{
+public:
+  //! @brief Constructs an empty state with the given `seed`.
+  //!
+  //! @param __seed A custom number to randomize the resulting hash value
+  _CCCL_HOST_DEVICE_API constexpr explicit __xxh3_state(::cuda::std::uint64_t __seed = 0) noexcept
+      : __seed_{__seed}
+  {
+    ::cuda::__xxh3_init_secret(__secret_, __seed);
+  }
+
+  //! @brief Discards all input, the state hashes a new input with the same seed.
+  _CCCL_HOST_DEVICE_API constexpr void reset() noexcept
+  {
+    __acc_            = __xxh3_initial_accumulators;
+    __total_len_      = 0;
+    __buffered_       = 0;
+    __stripes_so_far_ = 0;
+  }
+
+  //! @brief Appends the object representation of `__data` to the input.
+  //!
+  //! @tparam _Tp The type of the elements
+  //! @tparam _Extent The extent type
+  //! @param __data The next piece of the input
+  template <typename _Tp, ::cuda::std::size_t _Extent>
+  _CCCL_HOST_DEVICE_API constexpr void update(::cuda::std::span<_Tp, _Extent> __data) noexcept
+  {
+    if constexpr (::cuda::std::is_same_v<::cuda::std::remove_cv_t<_Tp>, ::cuda::std::byte>)
+    {
+      __update(__data.data(), __data.size());
+    }
+    else
+    {
+      __update(::cuda::std::as_bytes(__data).data(), __data.size_bytes());
+    }
+  }
+
+protected:
+  //! @brief Returns the accumulators of an input longer than `__xxh3_midsize_max`, leaving the state unchanged.
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __xxh3_accumulators __digest_long() const noexcept
+  {
+    auto __acc                      = __acc_;
+    const ::cuda::std::byte* __last = __buffer_;
+    ::cuda::std::byte __last_stripe[__xxh3_stripe_len]{};
+    if (__buffered_ >= __xxh3_stripe_len)
+    {
+      auto __stripes_so_far = __stripes_so_far_;
+      __consume_stripes(__acc, __stripes_so_far, __buffer_, (__buffered_ - 1) / __xxh3_stripe_len);
+      __last = __buffer_ + __buffered_ - __xxh3_stripe_len;
+    }
+    else
+    {
+      // The last stripe starts in the previous contents of the buffer
+      const auto __catchup = __xxh3_stripe_len - __buffered_;
+      ::cuda::__xxh3_copy(__last_stripe, __buffer_ + __xxh3_buffer_size - __catchup, __catchup);
+      ::cuda::__xxh3_copy(__last_stripe + __catchup, __buffer_, __buffered_);
+      __last = __last_stripe;
+    }
+    ::cuda::__xxh3_accumulate_stripe(__acc, __last, __secret_ + __xxh3_secret_size - __xxh3_stripe_len - 7);
+    return __acc;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool __is_long() const noexcept
+  {
+    return __total_len_ > __xxh3_midsize_max;
+  }
+
+  __xxh3_accumulators __acc_            = __xxh3_initial_accumulators;
+  ::cuda::std::uint64_t __total_len_    = 0;
+  ::cuda::std::uint64_t __seed_         = 0;
+  ::cuda::std::size_t __buffered_       = 0;
+  ::cuda::std::size_t __stripes_so_far_ = 0;
+  unsigned char __secret_[__xxh3_secret_size]{};
+  ::cuda::std::byte __buffer_[__xxh3_buffer_size]{};
+
+private:
+  //! @brief Accumulates `__num_stripes` stripes, scrambling whenever a block of stripes is complete.
+  _CCCL_HOST_DEVICE_API constexpr const ::cuda::std::byte* __consume_stripes(
+    __xxh3_accumulators& __acc,
+    ::cuda::std::size_t& __stripes_so_far,
+    const ::cuda::std::byte* __in,
+    ::cuda::std::size_t __num_stripes) const noexcept
+  {
+    const unsigned char* __secret = __secret_ + __stripes_so_far * __xxh3_secret_consume_rate;
+    if (__num_stripes >= __xxh3_stripes_per_block - __stripes_so_far)
+    {
+      auto __stripes = __xxh3_stripes_per_block - __stripes_so_far;
+      do
+      {
+        ::cuda::__xxh3_accumulate(__acc, __in, __secret, __stripes);
+        ::cuda::__xxh3_scramble(__acc, __secret_ + __xxh3_secret_size - __xxh3_stripe_len);
+        __in += __stripes * __xxh3_stripe_len;
+        __num_stripes -= __stripes;
+        __stripes = __xxh3_stripes_per_block;
+        __secret  = __secret_;
+      } while (__num_stripes >= __xxh3_stripes_per_block);
+      __stripes_so_far = 0;
+    }
+    if (__num_stripes > 0)
+    {
+      ::cuda::__xxh3_accumulate(__acc, __in, __secret, __num_stripes);
+      __in += __num_stripes * __xxh3_stripe_len;
+      __stripes_so_far += __num_stripes;
+    }
+    return __in;
+  }
+
+  _CCCL_HOST_DEVICE_API constexpr void __update(const ::cuda::std::byte* __in, ::cuda::std::size_t __len) noexcept
+  {
+    __total_len_ += __len;
+    if (__len <= __xxh3_buffer_size - __buffered_)
+    {
+      ::cuda::__xxh3_copy(__buffer_ + __buffered_, __in, __len);
+      __buffered_ += __len;
+      return;
+    }
+
+    const auto __end = __in + __len;
+    if (__buffered_ > 0)
+    {
+      const auto __fill = __xxh3_buffer_size - __buffered_;
+      ::cuda::__xxh3_copy(__buffer_ + __buffered_, __in, __fill);
+      __in += __fill;
+      __consume_stripes(__acc_, __stripes_so_far_, __buffer_, __xxh3_buffer_size / __xxh3_stripe_len);
+      __buffered_ = 0;
+    }
+    // The last stripe of the input is always kept in the buffer, so that the digest can process it after the padding
+    if (static_cast<::cuda::std::size_t>(__end - __in) > __xxh3_buffer_size)
+    {
+      const auto __num_stripes = static_cast<::cuda::std::size_t>(__end - 1 - __in) / __xxh3_stripe_len;
+      __in                     = __consume_stripes(__acc_, __stripes_so_far_, __in, __num_stripes);
+      ::cuda::__xxh3_copy(
+        __buffer_ + __xxh3_buffer_size - __xxh3_stripe_len, __in - __xxh3_stripe_len, __xxh3_stripe_len);
+    }
+    __buffered_ = static_cast<::cuda::std::size_t>(__end - __in);
+    ::cuda::__xxh3_copy(__buffer_, __in, __buffered_);
+  }
+};
+
+//! @brief Streaming `__xxh3_64` state.
+class __xxh3_64_state : private __xxh3_state
+{
+public:
+  using __xxh3_state::__xxh3_state;
+  using __xxh3_state::reset;
+  using __xxh3_state::update;
+
+  //! @brief Returns the hash value of all input since construction or the last `reset`.
+  //!
+  //! The state is unchanged and can take more input afterwards.
+  //!
+  //! @return The resulting hash value, as `__xxh3_64` computes it for the whole input
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr ::cuda::std::uint64_t digest() const noexcept
+  {
+    if (__is_long())
+    {
+      return ::cuda::__xxh3_merge_low(__digest_long(), __secret_, __total_len_);
+    }
+    return ::cuda::__xxh3_64_hash(__buffer_, static_cast<::cuda::std::size_t>(__total_len_), __seed_);
+  }
+};
+
+#if _CCCL_HAS_INT128()
+
+//! @brief Streaming `__xxh3_128` state.
+class __xxh3_128_state : private __xxh3_state
+{
+public:
+  using __xxh3_state::__xxh3_state;
+  using __xxh3_state::reset;
+  using __xxh3_state::update;
+
+  //! @brief Returns the hash value of all input since construction or the last `reset`.
+  //!
+  //! The state is unchanged and can take more input afterwards.
+  //!
+  //! @return The resulting hash value, as `__xxh3_128` computes it for the whole input
+  [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __uint128_t digest() const noexcept
+  {
+    __xxh3_128_result __h{};
+    if (__is_long())
+    {
+      const auto __acc = __digest_long();
+      __h = {::cuda::__xxh3_merge_low(__acc, __secret_, __total_len_),
+             ::cuda::__xxh3_merge_high(__acc, __secret_, __total_len_)};
+    }
+    else
+    {
+      __h = ::cuda::__xxh3_128_hash(__buffer_, static_cast<::cuda::std::size_t>(__total_len_), __seed_);
+    }
+    return (static_cast<__uint128_t>(__h.__high) << 64) | __h.__low;
+  }
+};
+
+#endif // _CCCL_HAS_INT128()
+
+_CCCL_END_NAMESPACE_CUDA
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA___FUNCTIONAL_HASH_XXH3_H
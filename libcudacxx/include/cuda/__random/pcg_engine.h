@@ -29,6 +29,7 @@
 #include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/array>
+#include <cuda/std/cstddef>
 #include <cuda/std/cstdint>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -304,6 +305,55 @@ public:
     __x_                        = __x_ * __mult + __plus;
   }
 
+  //! @brief Write the next `__n` values to `__first`, equivalent to `__n` calls to `operator()`.
+  //!
+  //! The values are produced by four interleaved LCGs that each advance four steps at a time, so the
+  //! multiplications of the lanes do not depend on each other and overlap in the pipeline.
+  //! @param __first The beginning of the output range.
+  //! @param __n Number of values to produce.
+  template <class _OutputIt>
+  _CCCL_HOST_DEVICE_API constexpr void __generate(_OutputIt __first, ::cuda::std::size_t __n) noexcept
+  {
+    if (__n >= 4)
+    {
+      // lane __i produces the values __i, 4 + __i, 8 + __i, ...
+      __pcg64_uint128_t __s0 = __x_ * __multiplier + __increment;
+      __pcg64_uint128_t __s1 = __s0 * __multiplier + __increment;
+      __pcg64_uint128_t __s2 = __s1 * __multiplier + __increment;
+      __pcg64_uint128_t __s3 = __s2 * __multiplier + __increment;
+
+      const auto [__mult, __plus] = __power_mod(4);
+      while (true)
+      {
+        *__first = __output_transform(__s0);
+        ++__first;
+        *__first = __output_transform(__s1);
+        ++__first;
+        *__first = __output_transform(__s2);
+        ++__first;
+        *__first = __output_transform(__s3);
+        ++__first;
+
+        __n -= 4;
+        if (__n < 4)
+        {
+          break;
+        }
+
+        __s0 = __s0 * __mult + __plus;
+        __s1 = __s1 * __mult + __plus;
+        __s2 = __s2 * __mult + __plus;
+        __s3 = __s3 * __mult + __plus;
+      }
+      __x_ = __s3;
+    }
+
+    for (; __n > 0; --__n, ++__first)
+    {
+      *__first = (*this)();
+    }
+  }
+
   //! @brief Equality comparison for two engines.
   //! @return True if both engines have identical internal state.
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr friend bool
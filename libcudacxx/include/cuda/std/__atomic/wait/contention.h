@@ -0,0 +1,160 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___ATOMIC_WAIT_CONTENTION_H
+#define _CUDA_STD___ATOMIC_WAIT_CONTENTION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+// Host threads block in the kernel while waiting on an atomic, instead of polling it
+#if _CCCL_OS(LINUX) && !_CCCL_COMPILER(NVRTC) && !defined(CCCL_DISABLE_ATOMIC_WAIT_FUTEX)
+#  define _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX() 1
+#else // ^^^ Linux ^^^ / vvv other platforms vvv
+#  define _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX() 0
+#endif // ^^^ other platforms ^^^
+
+#if _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+
+#  include <cuda/std/__atomic/functions/host.h>
+#  include <cuda/std/__atomic/order.h>
+#  include <cuda/std/__atomic/types/reference.h>
+#  include <cuda/std/__chrono/duration.h>
+#  include <cuda/std/climits>
+#  include <cuda/std/cstddef>
+#  include <cuda/std/cstdint>
+
+#  include <unistd.h>
+
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <time.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief Blocks until \p __addr is woken up, as long as it still holds \p __expected. A zero \p __timeout blocks
+//! without a time limit. Spurious wake ups are possible
+_CCCL_HOST_API inline void
+__cccl_futex_wait(uint32_t const volatile* __addr, uint32_t __expected, ::cuda::std::chrono::nanoseconds __timeout)
+{
+  const auto __s = ::cuda::std::chrono::duration_cast<::cuda::std::chrono::seconds>(__timeout);
+  timespec __ts{};
+  __ts.tv_sec  = static_cast<time_t>(__s.count());
+  __ts.tv_nsec = static_cast<decltype(__ts.tv_nsec)>((__timeout - __s).count());
+  ::syscall(SYS_futex,
+            const_cast<uint32_t*>(__addr),
+            FUTEX_WAIT_PRIVATE,
+            __expected,
+            __timeout == ::cuda::std::chrono::nanoseconds::zero() ? nullptr : &__ts,
+            nullptr,
+            0);
+}
+
+_CCCL_HOST_API inline void __cccl_futex_wake(uint32_t const volatile* __addr, int __count)
+{
+  ::syscall(SYS_futex, const_cast<uint32_t*>(__addr), FUTEX_WAKE_PRIVATE, __count, nullptr, nullptr, 0);
+}
+
+//! Waiters register in one of the buckets of a hashed contention table, so that notifying an atomic nobody waits on
+//! does not enter the kernel. Atomics which are not 4 bytes wide cannot be waited on with a futex, so their waiters
+//! sleep on the version counter of their bucket, which every notification of the bucket increments.
+struct alignas(64) __atomic_contention_bucket
+{
+  uint32_t __waiters;
+  uint32_t __version;
+};
+
+inline constexpr size_t __atomic_contention_table_size = 256;
+
+// The table has default visibility, so that all shared objects of a process use the same one
+_CCCL_PUBLIC_HOST_API inline __atomic_contention_bucket* __atomic_contention_table() noexcept
+{
+  static __atomic_contention_bucket __table[__atomic_contention_table_size]{};
+  return __table;
+}
+
+_CCCL_HOST_API inline __atomic_contention_bucket& __atomic_contention_bucket_for(void const volatile* __addr) noexcept
+{
+  const auto __bits = reinterpret_cast<uintptr_t>(__addr);
+  return __atomic_contention_table()[((__bits >> 2) ^ (__bits >> 10)) % __atomic_contention_table_size];
+}
+
+// The object an atomic storage refers to, which is what waiters and notifiers have to agree upon
+template <typename _Tp>
+_CCCL_HOST_API void const volatile* __atomic_wait_object(_Tp const volatile* __a) noexcept
+{
+  return __a;
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void const volatile* __atomic_wait_object(__atomic_ref_storage<_Tp> const volatile* __a) noexcept
+{
+  return __a->get();
+}
+
+template <typename _Tp>
+inline constexpr size_t __atomic_wait_object_size_v = sizeof(_Tp);
+
+template <typename _Tp>
+inline constexpr size_t __atomic_wait_object_size_v<__atomic_ref_storage<_Tp>> = sizeof(_Tp);
+
+// 4 byte atomics, including the 4 byte words which hold 1 and 2 byte atomics, are waited on directly
+template <typename _Tp>
+inline constexpr bool __atomic_wait_is_futex_v = __atomic_wait_object_size_v<_Tp> == sizeof(uint32_t);
+
+template <typename _Tp>
+_CCCL_HOST_API uint32_t const volatile*
+__atomic_wait_futex(_Tp const volatile* __a, __atomic_contention_bucket& __bucket) noexcept
+{
+  if constexpr (__atomic_wait_is_futex_v<_Tp>)
+  {
+    return static_cast<uint32_t const volatile*>(::cuda::std::__atomic_wait_object(__a));
+  }
+  else
+  {
+    return &__bucket.__version;
+  }
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void __atomic_notify_futex(_Tp const volatile* __a, bool __all) noexcept
+{
+  auto& __bucket = ::cuda::std::__atomic_contention_bucket_for(::cuda::std::__atomic_wait_object(__a));
+  if constexpr (!__atomic_wait_is_futex_v<_Tp>)
+  {
+    // Releases the new value of the atomic to the waiters which see the new version
+    ::cuda::std::__atomic_fetch_add_host(&__bucket.__version, uint32_t{1}, memory_order_release);
+  }
+  // Pairs with the fence of the waiter: either the waiter sees the new value or we see the waiter
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+  if (::cuda::std::__atomic_load_host(&__bucket.__waiters, memory_order_relaxed) != 0)
+  {
+    // Waiters on a version counter may wait on other atomics of the same bucket, so all of them are woken
+    const bool __wake_all = __all || !__atomic_wait_is_futex_v<_Tp>;
+    ::cuda::std::__cccl_futex_wake(::cuda::std::__atomic_wait_futex(__a, __bucket), __wake_all ? INT_MAX : 1);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+
+#endif // _CUDA_STD___ATOMIC_WAIT_CONTENTION_H
@@ -21,9 +21,12 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__atomic/order.h>
 #include <cuda/std/__atomic/scopes.h>
+#include <cuda/std/__atomic/wait/contention.h>
 #include <cuda/std/__atomic/wait/polling.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/cstring>
 
 #include <cuda/std/__cccl/prologue.h>
@@ -32,35 +35,96 @@ _CCCL_BEGIN_NAMESPACE_CUDA_STD
 
 extern "C" _CCCL_DEVICE void __atomic_try_wait_unsupported_before_SM_70__();
 
+template <typename _Tp>
+_CCCL_HOST_DEVICE_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+{
+#if _CCCL_CUDA_COMPILATION()
+  return __lhs == __rhs;
+#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
+  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
+#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+}
+
+#if _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_futex(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+  // Atomics of system scope may be written by a GPU or by another process, which cannot wake us up. Those waits time
+  // out and check the value again, backing off like the polling wait
+  constexpr bool __timed = is_same_v<_Sco, __thread_scope_system_tag>;
+  constexpr ::cuda::std::chrono::nanoseconds __max_timeout = ::cuda::std::chrono::milliseconds(1);
+  ::cuda::std::chrono::nanoseconds __timeout =
+    __timed ? ::cuda::std::chrono::microseconds(16) : ::cuda::std::chrono::nanoseconds::zero();
+
+  auto& __bucket     = ::cuda::std::__atomic_contention_bucket_for(::cuda::std::__atomic_wait_object(__a));
+  const auto __futex = ::cuda::std::__atomic_wait_futex(__a, __bucket);
+  ::cuda::std::__atomic_fetch_add_host(&__bucket.__waiters, uint32_t{1}, memory_order_relaxed);
+  // Pairs with the fence of the notifier: either we see the new value or the notifier sees us
+  ::cuda::std::__atomic_thread_fence_host(memory_order_seq_cst);
+  while (true)
+  {
+    const uint32_t __old = ::cuda::std::__atomic_load_host(__futex, memory_order_acquire);
+    if (!::cuda::std::__nonatomic_compare_equal(__atomic_load_dispatch(__a, __order, _Sco{}), __val))
+    {
+      break;
+    }
+    ::cuda::std::__cccl_futex_wait(__futex, __old, __timeout);
+    if constexpr (__timed)
+    {
+      __timeout = (::cuda::std::min) (__timeout * 2, __max_timeout);
+    }
+  }
+  ::cuda::std::__atomic_fetch_sub_host(&__bucket.__waiters, uint32_t{1}, memory_order_relaxed);
+}
+#endif // _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+
+template <typename _Tp, typename _Sco>
+_CCCL_HOST_API void __atomic_try_wait_slow_host(
+  _Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
+{
+#if _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+  ::cuda::std::__atomic_try_wait_slow_futex(__a, __val, __order, _Sco{});
+#else // ^^^ _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX() ^^^ / vvv !_LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX() vvv
+  ::cuda::std::__atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+#endif // ^^^ !_LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX() ^^^
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void __atomic_notify_host([[maybe_unused]] _Tp const volatile* __a, [[maybe_unused]] bool __all)
+{
+#if _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+  ::cuda::std::__atomic_notify_futex(__a, __all);
+#endif // _LIBCUDACXX_HAS_ATOMIC_WAIT_FUTEX()
+}
+
 template <typename _Tp, typename _Sco>
 _CCCL_HOST_DEVICE_API inline void
 __atomic_try_wait_slow(_Tp const volatile* __a, __atomic_underlying_remove_cv_t<_Tp> __val, memory_order __order, _Sco)
 {
   NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
-                     , NV_IS_HOST, __atomic_try_wait_slow_fallback(__a, __val, __order, _Sco{});
+                     , NV_IS_HOST, __atomic_try_wait_slow_host(__a, __val, __order, _Sco{});
                      , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_one(_Tp const volatile*, _Sco)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_one([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, false);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
-_CCCL_HOST_DEVICE_API inline void __atomic_notify_all(_Tp const volatile*, _Sco)
-{
-  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70, , NV_IS_HOST, , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
-}
-
-template <typename _Tp>
-_CCCL_HOST_DEVICE_API inline bool __nonatomic_compare_equal(_Tp const& __lhs, _Tp const& __rhs)
+_CCCL_HOST_DEVICE_API inline void __atomic_notify_all([[maybe_unused]] _Tp const volatile* __a, _Sco)
 {
-#if _CCCL_CUDA_COMPILATION()
-  return __lhs == __rhs;
-#else // ^^^ _CCCL_CUDA_COMPILATION() ^^^ / vvv !_CCCL_CUDA_COMPILATION() vvv
-  return ::cuda::std::memcmp(&__lhs, &__rhs, sizeof(_Tp)) == 0;
-#endif // ^^^ !_CCCL_CUDA_COMPILATION() ^^^
+  NV_DISPATCH_TARGET(NV_PROVIDES_SM_70,
+                     ,
+                     NV_IS_HOST,
+                     __atomic_notify_host(__a, true);
+                     , NV_ANY_TARGET, __atomic_try_wait_unsupported_before_SM_70__(););
 }
 
 template <typename _Tp, typename _Sco>
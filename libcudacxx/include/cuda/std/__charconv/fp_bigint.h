@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FP_BIGINT_H
+#define _CUDA_STD___CHARCONV_FP_BIGINT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! @brief A fixed capacity unsigned big integer for the exact floating-point conversions.
+//!
+//! Only the operations needed by to_chars and from_chars are provided. The capacity must be
+//! large enough for every intermediate value; overflowing it is a logic error.
+template <int _Words>
+struct __fp_bigint
+{
+  uint32_t __words_[_Words]{}; // least significant word first
+  int __size_ = 0; // number of used words, the most significant one is non-zero
+
+  _CCCL_HIDE_FROM_ABI constexpr __fp_bigint() noexcept = default;
+
+  _CCCL_API constexpr explicit __fp_bigint(uint64_t __v) noexcept
+  {
+    while (__v != 0)
+    {
+      __words_[__size_++] = static_cast<uint32_t>(__v);
+      __v >>= 32;
+    }
+  }
+
+  [[nodiscard]] _CCCL_API constexpr bool __is_zero() const noexcept
+  {
+    return __size_ == 0;
+  }
+
+  _CCCL_API constexpr void __mul_add_small(uint32_t __mul, uint32_t __add) noexcept
+  {
+    uint64_t __carry = __add;
+    for (int __i = 0; __i < __size_; ++__i)
+    {
+      const uint64_t __p = uint64_t{__words_[__i]} * __mul + __carry;
+      __words_[__i]      = static_cast<uint32_t>(__p);
+      __carry            = __p >> 32;
+    }
+    if (__carry != 0)
+    {
+      _CCCL_ASSERT(__size_ < _Words, "__fp_bigint overflow");
+      __words_[__size_++] = static_cast<uint32_t>(__carry);
+    }
+  }
+
+  _CCCL_API constexpr void __mul_pow5(int __n) noexcept
+  {
+    constexpr uint32_t __pow5_13 = 1220703125; // the largest power of 5 that fits in 32 bits
+    constexpr uint32_t __small_pow5[13]{1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125, 9765625, 48828125, 244140625};
+    for (; __n >= 13; __n -= 13)
+    {
+      __mul_add_small(__pow5_13, 0);
+    }
+    if (__n > 0)
+    {
+      __mul_add_small(__small_pow5[__n], 0);
+    }
+  }
+
+  _CCCL_API constexpr void __shl(int __n) noexcept
+  {
+    if (__size_ == 0 || __n == 0)
+    {
+      return;
+    }
+    const int __words = __n / 32;
+    const int __bits  = __n % 32;
+    _CCCL_ASSERT(__size_ + __words + (__bits != 0) <= _Words, "__fp_bigint overflow");
+    if (__bits != 0)
+    {
+      uint32_t __carry = 0;
+      for (int __i = 0; __i < __size_; ++__i)
+      {
+        const uint32_t __w = __words_[__i];
+        __words_[__i]      = (__w << __bits) | __carry;
+        __carry            = __w >> (32 - __bits);
+      }
+      if (__carry != 0)
+      {
+        __words_[__size_++] = __carry;
+      }
+    }
+    if (__words != 0)
+    {
+      for (int __i = __size_ - 1; __i >= 0; --__i)
+      {
+        __words_[__i + __words] = __words_[__i];
+      }
+      for (int __i = 0; __i < __words; ++__i)
+      {
+        __words_[__i] = 0;
+      }
+      __size_ += __words;
+    }
+  }
+
+  _CCCL_API constexpr void __mul_pow10(int __n) noexcept
+  {
+    __mul_pow5(__n);
+    __shl(__n);
+  }
+
+  //! Returns -1, 0 or 1 if *this is less than, equal to or greater than __other.
+  [[nodiscard]] _CCCL_API constexpr int __compare(const __fp_bigint& __other) const noexcept
+  {
+    if (__size_ != __other.__size_)
+    {
+      return __size_ < __other.__size_ ? -1 : 1;
+    }
+    for (int __i = __size_ - 1; __i >= 0; --__i)
+    {
+      if (__words_[__i] != __other.__words_[__i])
+      {
+        return __words_[__i] < __other.__words_[__i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  //! Subtracts __other, which must not be larger than *this.
+  _CCCL_API constexpr void __sub(const __fp_bigint& __other) noexcept
+  {
+    uint32_t __borrow = 0;
+    for (int __i = 0; __i < __size_; ++__i)
+    {
+      const uint64_t __rhs = uint64_t{(__i < __other.__size_) ? __other.__words_[__i] : 0u} + __borrow;
+      __borrow             = __words_[__i] < __rhs;
+      __words_[__i]        = static_cast<uint32_t>(__words_[__i] - __rhs);
+    }
+    while (__size_ > 0 && __words_[__size_ - 1] == 0)
+    {
+      --__size_;
+    }
+  }
+
+  //! Replaces *this with *this % __div and returns *this / __div, which must be less than 10.
+  [[nodiscard]] _CCCL_API constexpr int __divmod_digit(const __fp_bigint& __div) noexcept
+  {
+    int __q = 0;
+    while (__compare(__div) >= 0)
+    {
+      __sub(__div);
+      ++__q;
+    }
+    return __q;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FP_BIGINT_H
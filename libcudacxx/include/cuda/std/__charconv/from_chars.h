@@ -23,11 +23,11 @@
 #include <cuda/__cmath/neg.h>
 #include <cuda/__cmath/uabs.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/from_chars_fp.h>
 #include <cuda/std/__charconv/from_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
 #include <cuda/std/__limits/numeric_limits.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -155,13 +155,23 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr from_chars_result
 from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt = chars_format::general) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::from_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  _CCCL_ASSERT(::cuda::std::__fp_is_valid_chars_format(__fmt), "invalid chars_format");
+  if constexpr (is_same_v<_Tp, long double>)
+  {
+    static_assert(__fp_format_of_v<long double> == __fp_format::__binary64,
+                  "cuda::std::from_chars supports long double only when it has the same format as double");
+    double __value_tmp{};
+    const auto __ret = ::cuda::std::__fp_from_chars(__first, __last, __value_tmp, __fmt);
+    if (__ret.ec == errc{})
+    {
+      __value = __value_tmp;
+    }
+    return __ret;
+  }
+  else
+  {
+    return ::cuda::std::__fp_from_chars(__first, __last, __value, __fmt);
+  }
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
@@ -0,0 +1,633 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
+#define _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/fp_bigint.h>
+#include <cuda/std/__charconv/fp_tables.h>
+#include <cuda/std/__charconv/from_chars_result.h>
+#include <cuda/std/__charconv/to_chars_fp.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Correctly rounded decimal to binary32 and binary64 conversion.
+//
+// The first 19 significant digits are converted with the algorithm of Daniel Lemire, "Number
+// Parsing at a Gigabyte per Second", Software: Practice and Experience 51(8), 2021, which is
+// exact for them. When there are more digits and the result differs between the truncated
+// digits and the truncated digits plus one, all the digits are compared with the halfway point
+// between the two candidates.
+
+//! Properties of the decimal to binary conversion.
+template <class _Tp>
+struct __fp_parse_traits
+{
+  static constexpr bool __is_double = __fp_charconv_traits<_Tp>::__format == __fp_format::__binary64;
+
+  // Exact powers of ten for the fast path of Clinger.
+  static constexpr int __max_exact_pow10    = __is_double ? 22 : 10;
+  static constexpr uint64_t __max_exact_int = uint64_t{1} << (__fp_charconv_traits<_Tp>::__mant_bits + 1);
+
+  // Decimal exponents outside of [__min_pow10, __max_pow10] always round to zero or infinity.
+  static constexpr int __min_pow10 = __is_double ? -342 : -65;
+  static constexpr int __max_pow10 = __is_double ? 308 : 38;
+
+  // Exponents for which a product can be an exact tie.
+  static constexpr int __min_round_to_even = __is_double ? -4 : -17;
+  static constexpr int __max_round_to_even = __is_double ? 23 : 10;
+
+  // The number of significant digits that decide the rounding of any input, plus one for the
+  // digits that are dropped, and the big integer size to compare them with a halfway point.
+  static constexpr int __max_digits = __is_double ? 769 : 115;
+  static constexpr int __words      = __is_double ? 96 : 24;
+};
+
+_CCCL_GLOBAL_CONSTANT double __fp_exact_pow10[23] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+[[nodiscard]] _CCCL_API constexpr bool __fp_is_digit(char __c) noexcept
+{
+  return '0' <= __c && __c <= '9';
+}
+
+[[nodiscard]] _CCCL_API constexpr int __fp_hex_digit(char __c) noexcept
+{
+  if ('0' <= __c && __c <= '9')
+  {
+    return __c - '0';
+  }
+  if ('a' <= __c && __c <= 'f')
+  {
+    return __c - 'a' + 10;
+  }
+  if ('A' <= __c && __c <= 'F')
+  {
+    return __c - 'A' + 10;
+  }
+  return -1;
+}
+
+[[nodiscard]] _CCCL_API constexpr char __fp_to_lower(char __c) noexcept
+{
+  return ('A' <= __c && __c <= 'Z') ? static_cast<char>(__c - 'A' + 'a') : __c;
+}
+
+//! Returns true if [__first, __last) starts with __str, ignoring case.
+[[nodiscard]] _CCCL_API constexpr bool
+__fp_starts_with_icase(const char* __first, const char* __last, const char* __str, int __n) noexcept
+{
+  if (__last - __first < __n)
+  {
+    return false;
+  }
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    if (::cuda::std::__fp_to_lower(__first[__i]) != __str[__i])
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//! Parses an optionally signed exponent. Returns __first if there is no valid exponent.
+[[nodiscard]] _CCCL_API constexpr const char*
+__fp_parse_exponent(const char* __first, const char* __last, int& __exp) noexcept
+{
+  const char* __it = __first;
+  bool __negative  = false;
+  if (__it != __last && (*__it == '+' || *__it == '-'))
+  {
+    __negative = *__it == '-';
+    ++__it;
+  }
+  if (__it == __last || !::cuda::std::__fp_is_digit(*__it))
+  {
+    return __first;
+  }
+  int __value = 0;
+  for (; __it != __last && ::cuda::std::__fp_is_digit(*__it); ++__it)
+  {
+    // Any exponent beyond this overflows or underflows regardless of the digits.
+    if (__value < 100000000)
+    {
+      __value = __value * 10 + (*__it - '0');
+    }
+  }
+  __exp = __negative ? -__value : __value;
+  return __it;
+}
+
+//! The significant digits of a decimal number as parsed from the input.
+struct __fp_decimal_digits
+{
+  uint64_t __w_; // the first 19 significant digits
+  int __exp10_; // the decimal exponent of the last digit in __w_
+  bool __truncated_; // true if non-zero digits were dropped from __w_
+  const char* __digits_first_; // the digits and decimal point, without leading zeros
+  const char* __digits_last_;
+  bool __digits_fraction_; // true if __digits_first_ is past the decimal point
+  int __exp_; // the decimal exponent of the digit before __digits_first_
+};
+
+//! A binary floating-point value with the biased exponent __power2_ and the mantissa bits
+//! __mantissa_, without the implicit bit.
+struct __fp_adjusted_mantissa
+{
+  uint64_t __mantissa_;
+  int __power2_;
+
+  [[nodiscard]] _CCCL_API friend constexpr bool
+  operator==(const __fp_adjusted_mantissa& __lhs, const __fp_adjusted_mantissa& __rhs) noexcept
+  {
+    return __lhs.__mantissa_ == __rhs.__mantissa_ && __lhs.__power2_ == __rhs.__power2_;
+  }
+};
+
+//! The Eisel-Lemire algorithm: the correctly rounded value of __w * 10^__q.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __fp_adjusted_mantissa __fp_eisel_lemire(int __q, uint64_t __w) noexcept
+{
+  using _Traits               = __fp_charconv_traits<_Tp>;
+  using _Parse                = __fp_parse_traits<_Tp>;
+  constexpr int __mant_bits   = _Traits::__mant_bits;
+  constexpr int __inf_power   = (1 << _Traits::__exp_bits) - 1;
+  constexpr int __min_exp     = -_Traits::__bias;
+  constexpr uint64_t __hidden = uint64_t{1} << __mant_bits;
+
+  if (__w == 0 || __q < _Parse::__min_pow10)
+  {
+    return {0, 0};
+  }
+  if (__q > _Parse::__max_pow10)
+  {
+    return {0, __inf_power};
+  }
+
+  const int __lz = ::cuda::std::countl_zero(__w);
+  __w <<= __lz;
+
+  // The 128 most significant bits of __w * 5^__q. The second half of the multiplier is only
+  // needed if the bits below the mantissa of the first product are all ones.
+  const auto& __pow5          = __fp_pow5_128[__q - __fp_pow5_128_min_exp];
+  uint64_t __high             = ::cuda::mul_hi(__w, __pow5[0]);
+  uint64_t __low              = __w * __pow5[0];
+  constexpr uint64_t __precision_mask = ~uint64_t{0} >> (__mant_bits + 3);
+  if ((__high & __precision_mask) == __precision_mask)
+  {
+    const uint64_t __second_high = ::cuda::mul_hi(__w, __pow5[1]);
+    __low += __second_high;
+    __high += (__second_high > __low);
+  }
+
+  const int __upper_bit = static_cast<int>(__high >> 63);
+  const int __shift     = __upper_bit + 64 - __mant_bits - 3;
+  uint64_t __mantissa   = __high >> __shift;
+  // floor(log2(10^__q)) + 63 is the exponent of the product of normalized __w and 5^__q.
+  int __power2 = (((152170 + 65536) * __q) >> 16) + 63 + __upper_bit - __lz - __min_exp;
+
+  if (__power2 <= 0)
+  {
+    // Subnormal. A tie is not possible for these exponents.
+    if (-__power2 + 1 >= 64)
+    {
+      return {0, 0};
+    }
+    __mantissa >>= -__power2 + 1;
+    __mantissa += __mantissa & 1;
+    __mantissa >>= 1;
+    return {__mantissa, (__mantissa < __hidden) ? 0 : 1};
+  }
+
+  // An exact tie rounds to even, unless it only looks like one because 5^__q was truncated.
+  if (__low <= 1 && __q >= _Parse::__min_round_to_even && __q <= _Parse::__max_round_to_even
+      && (__mantissa & 3) == 1 && (__mantissa << __shift) == __high)
+  {
+    __mantissa &= ~uint64_t{1};
+  }
+  __mantissa += __mantissa & 1;
+  __mantissa >>= 1;
+  if (__mantissa >= (__hidden << 1))
+  {
+    __mantissa = __hidden;
+    ++__power2;
+  }
+  __mantissa &= ~__hidden;
+  if (__power2 >= __inf_power)
+  {
+    return {0, __inf_power};
+  }
+  return {__mantissa, __power2};
+}
+
+//! Compares all the digits of __dec with the halfway point between __am and the next value.
+//! Returns -1, 0 or 1 if the decimal number is less than, equal to or greater than it.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr int
+__fp_compare_halfway(const __fp_decimal_digits& __dec, const __fp_adjusted_mantissa& __am) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  using _Parse  = __fp_parse_traits<_Tp>;
+
+  // The decimal value is __digits * 10^__e10, with a trailing 1 for the dropped digits.
+  __fp_bigint<_Parse::__words> __lhs{};
+  int __e10        = __dec.__exp_;
+  int __count      = 0;
+  bool __fraction  = __dec.__digits_fraction_;
+  bool __truncated = false;
+  for (const char* __it = __dec.__digits_first_; __it != __dec.__digits_last_; ++__it)
+  {
+    if (*__it == '.')
+    {
+      __fraction = true;
+      continue;
+    }
+    if (__count < _Parse::__max_digits - 1)
+    {
+      if (__count > 0 || *__it != '0')
+      {
+        __lhs.__mul_add_small(10, static_cast<uint32_t>(*__it - '0'));
+        ++__count;
+      }
+      __e10 -= __fraction;
+    }
+    else
+    {
+      __truncated = __truncated || *__it != '0';
+      __e10 += !__fraction;
+    }
+  }
+  if (__truncated)
+  {
+    __lhs.__mul_add_small(10, 1);
+    --__e10;
+  }
+
+  // The halfway point is (2 * m + 1) * 2^(e2 - 1):
+  const bool __normal  = __am.__power2_ != 0;
+  const uint64_t __m   = __am.__mantissa_ | (uint64_t{__normal} << _Traits::__mant_bits);
+  const int __e2       = __am.__power2_ - !!__normal - _Traits::__bias - _Traits::__mant_bits + 1;
+  __fp_bigint<_Parse::__words> __rhs{2 * __m + 1};
+
+  int __lhs_pow2 = 0;
+  int __rhs_pow2 = __e2 - 1;
+  if (__e10 >= 0)
+  {
+    __lhs.__mul_pow5(__e10);
+    __lhs_pow2 += __e10;
+  }
+  else
+  {
+    __rhs.__mul_pow5(-__e10);
+    __rhs_pow2 -= __e10;
+  }
+  if (__lhs_pow2 >= __rhs_pow2)
+  {
+    __lhs.__shl(__lhs_pow2 - __rhs_pow2);
+  }
+  else
+  {
+    __rhs.__shl(__rhs_pow2 - __lhs_pow2);
+  }
+  return __lhs.__compare(__rhs);
+}
+
+//! Converts the digits to the nearest binary value.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __fp_adjusted_mantissa
+__fp_decimal_to_binary(const __fp_decimal_digits& __dec) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  auto __am = ::cuda::std::__fp_eisel_lemire<_Tp>(__dec.__exp10_, __dec.__w_);
+  if (!__dec.__truncated_)
+  {
+    return __am;
+  }
+
+  // The value is in (__w, __w + 1) * 10^__exp10. If both ends round to the same value, so does
+  // everything in between. Otherwise, the upper one rounded to the value after __am.
+  const auto __am_up = ::cuda::std::__fp_eisel_lemire<_Tp>(__dec.__exp10_, __dec.__w_ + 1);
+  if (__am == __am_up)
+  {
+    return __am;
+  }
+
+  const int __cmp = ::cuda::std::__fp_compare_halfway<_Tp>(__dec, __am);
+  if (__cmp > 0 || (__cmp == 0 && (__am.__mantissa_ & 1) != 0))
+  {
+    ++__am.__mantissa_;
+    if (__am.__mantissa_ >> _Traits::__mant_bits != 0)
+    {
+      __am.__mantissa_ = 0;
+      ++__am.__power2_;
+    }
+  }
+  return __am;
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr _Tp __fp_from_parts(bool __negative, uint64_t __bits) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  using _Up     = typename _Traits::__storage_t;
+  const auto __sign = static_cast<_Up>(static_cast<_Up>(__negative) << (_Traits::__mant_bits + _Traits::__exp_bits));
+  return ::cuda::std::__fp_from_storage<_Tp>(static_cast<_Up>(__sign | static_cast<_Up>(__bits)));
+}
+
+//! Parses inf, infinity, nan and nan(chars), ignoring case. Returns __first if there is none.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr const char*
+__fp_parse_special(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  using _Traits            = __fp_charconv_traits<_Tp>;
+  constexpr uint64_t __inf = uint64_t{(1u << _Traits::__exp_bits) - 1} << _Traits::__mant_bits;
+  if (::cuda::std::__fp_starts_with_icase(__first, __last, "inf", 3))
+  {
+    __value = ::cuda::std::__fp_from_parts<_Tp>(__negative, __inf);
+    return __first + (::cuda::std::__fp_starts_with_icase(__first, __last, "infinity", 8) ? 8 : 3);
+  }
+  if (::cuda::std::__fp_starts_with_icase(__first, __last, "nan", 3))
+  {
+    __value = ::cuda::std::__fp_from_parts<_Tp>(__negative, __inf | (uint64_t{1} << (_Traits::__mant_bits - 1)));
+    const char* __it = __first + 3;
+    if (__it != __last && *__it == '(')
+    {
+      const char* __end = __it + 1;
+      while (__end != __last
+             && (::cuda::std::__fp_is_digit(*__end) || ('a' <= *__end && *__end <= 'z')
+                 || ('A' <= *__end && *__end <= 'Z') || *__end == '_'))
+      {
+        ++__end;
+      }
+      if (__end != __last && *__end == ')')
+      {
+        __it = __end + 1;
+      }
+    }
+    return __it;
+  }
+  return __first;
+}
+
+//! Rounds __m * 2^__e2, with __sticky set if non-zero bits were dropped from __m, to the
+//! nearest value. Returns the bits of the result.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr uint64_t __fp_round_binary(uint64_t __m, int __e2, bool __sticky) noexcept
+{
+  using _Traits             = __fp_charconv_traits<_Tp>;
+  constexpr int __mant_bits = _Traits::__mant_bits;
+  constexpr int __inf_power = (1 << _Traits::__exp_bits) - 1;
+
+  const int __lz = ::cuda::std::countl_zero(__m);
+  __m <<= __lz;
+  __e2 -= __lz;
+
+  // The leading bit is now bit 63, with weight 2^(__e2 + 63):
+  int __power2 = __e2 + 63 + _Traits::__bias;
+  int __shift  = 63 - __mant_bits;
+  if (__power2 <= 0)
+  {
+    __shift += 1 - __power2;
+    __power2 = 0;
+  }
+  if (__shift > 64)
+  {
+    return 0;
+  }
+  const uint64_t __keep = (__shift == 64) ? 0 : __m >> __shift;
+  const uint64_t __rest = (__shift == 64) ? __m : __m & ((uint64_t{1} << __shift) - 1);
+  const uint64_t __half = uint64_t{1} << (__shift - 1);
+
+  uint64_t __result = __keep;
+  if (__rest > __half || (__rest == __half && (__sticky || (__keep & 1) != 0)))
+  {
+    ++__result;
+  }
+  // A carry out of the mantissa increments the exponent:
+  if (__power2 != 0)
+  {
+    __result += (uint64_t(__power2) << __mant_bits) - (uint64_t{1} << __mant_bits);
+  }
+  constexpr uint64_t __inf = uint64_t{__inf_power} << __mant_bits;
+  return (__power2 >= __inf_power || __result > __inf) ? __inf : __result;
+}
+
+//! Parses hexadecimal digits with an optional binary exponent, without a 0x prefix.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__fp_from_chars_hex(const char* __first, const char* __last, bool __negative, _Tp& __value) noexcept
+{
+  uint64_t __m     = 0;
+  int __e2         = 0;
+  bool __sticky    = false;
+  bool __any       = false;
+  bool __fraction  = false;
+  const char* __it = __first;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__fraction)
+    {
+      __fraction = true;
+      continue;
+    }
+    const int __d = ::cuda::std::__fp_hex_digit(*__it);
+    if (__d < 0)
+    {
+      break;
+    }
+    __any = true;
+    if (__m >> 60 == 0)
+    {
+      __m = (__m << 4) | static_cast<uint64_t>(__d);
+      __e2 -= 4 * __fraction;
+    }
+    else
+    {
+      __sticky = __sticky || __d != 0;
+      __e2 += 4 * !__fraction;
+    }
+  }
+  if (!__any)
+  {
+    return {__first, errc::invalid_argument};
+  }
+  if (__it != __last && (*__it == 'p' || *__it == 'P'))
+  {
+    int __exp       = 0;
+    const char* __e = ::cuda::std::__fp_parse_exponent(__it + 1, __last, __exp);
+    if (__e != __it + 1)
+    {
+      __it = __e;
+      __e2 += __exp;
+    }
+  }
+
+  uint64_t __bits = 0;
+  if (__m != 0)
+  {
+    using _Traits = __fp_charconv_traits<_Tp>;
+    // Clamp the exponent so that the rounding arithmetic cannot overflow:
+    __e2   = (__e2 > 100000) ? 100000 : ((__e2 < -100000) ? -100000 : __e2);
+    __bits = ::cuda::std::__fp_round_binary<_Tp>(__m, __e2, __sticky);
+    if (__bits == 0 || __bits == uint64_t{(1u << _Traits::__exp_bits) - 1} << _Traits::__mant_bits)
+    {
+      return {__it, errc::result_out_of_range};
+    }
+  }
+  __value = ::cuda::std::__fp_from_parts<_Tp>(__negative, __bits);
+  return {__it, errc{}};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr from_chars_result
+__fp_from_chars(const char* __first, const char* __last, _Tp& __value, chars_format __fmt) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  using _Parse  = __fp_parse_traits<_Tp>;
+
+  _CCCL_ASSERT(__first <= __last, "input range must be a valid range");
+
+  const char* __it     = __first;
+  const bool __negative = __it != __last && *__it == '-';
+  __it += __negative;
+
+  const char* __special = ::cuda::std::__fp_parse_special(__it, __last, __negative, __value);
+  if (__special != __it)
+  {
+    return {__special, errc{}};
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    const auto __result = ::cuda::std::__fp_from_chars_hex(__it, __last, __negative, __value);
+    return {(__result.ec == errc::invalid_argument) ? __first : __result.ptr, __result.ec};
+  }
+
+  // Leading zeros do not count towards the 19 significant digits.
+  __fp_decimal_digits __dec{};
+  bool __any      = false;
+  bool __fraction = false;
+  int __count     = 0;
+  for (; __it != __last && *__it == '0'; ++__it)
+  {
+    __any = true;
+  }
+  if (__it != __last && *__it == '.')
+  {
+    __fraction = true;
+    for (++__it; __it != __last && *__it == '0'; ++__it)
+    {
+      __any = true;
+      --__dec.__exp10_;
+    }
+  }
+  __dec.__digits_first_    = __it;
+  __dec.__digits_fraction_ = __fraction;
+  __dec.__exp_             = __dec.__exp10_;
+  for (; __it != __last; ++__it)
+  {
+    if (*__it == '.' && !__fraction)
+    {
+      __fraction = true;
+      continue;
+    }
+    if (!::cuda::std::__fp_is_digit(*__it))
+    {
+      break;
+    }
+    __any = true;
+    if (__count < 19)
+    {
+      __dec.__w_ = __dec.__w_ * 10 + static_cast<uint64_t>(*__it - '0');
+      __dec.__exp10_ -= __fraction;
+      ++__count;
+    }
+    else
+    {
+      __dec.__truncated_ = __dec.__truncated_ || *__it != '0';
+      __dec.__exp10_ += !__fraction;
+    }
+  }
+  __dec.__digits_last_ = __it;
+  if (!__any)
+  {
+    return {__first, errc::invalid_argument};
+  }
+
+  if (__fmt != chars_format::fixed)
+  {
+    int __exp          = 0;
+    const bool __has_e = __it != __last && (*__it == 'e' || *__it == 'E');
+    const char* __e    = __has_e ? ::cuda::std::__fp_parse_exponent(__it + 1, __last, __exp) : __it + 1;
+    if (__e != __it + 1)
+    {
+      __it = __e;
+      __dec.__exp10_ += __exp;
+      __dec.__exp_ += __exp;
+    }
+    else if (__fmt == chars_format::scientific)
+    {
+      return {__first, errc::invalid_argument};
+    }
+  }
+
+  if (__dec.__w_ == 0)
+  {
+    __value = ::cuda::std::__fp_from_parts<_Tp>(__negative, 0);
+    return {__it, errc{}};
+  }
+
+  // The fast path of Clinger: both __w_ and the power of ten are exact, so one correctly
+  // rounded operation gives the result.
+  if (!__dec.__truncated_ && __dec.__w_ <= _Parse::__max_exact_int && __dec.__exp10_ >= -_Parse::__max_exact_pow10
+      && __dec.__exp10_ <= _Parse::__max_exact_pow10)
+  {
+    const auto __w   = static_cast<_Tp>(__dec.__w_);
+    const auto __p10 = static_cast<_Tp>(__fp_exact_pow10[(__dec.__exp10_ < 0) ? -__dec.__exp10_ : __dec.__exp10_]);
+    const _Tp __abs  = (__dec.__exp10_ < 0) ? __w / __p10 : __w * __p10;
+    __value          = __negative ? -__abs : __abs;
+    return {__it, errc{}};
+  }
+
+  const auto __am = ::cuda::std::__fp_decimal_to_binary<_Tp>(__dec);
+  if (__am.__power2_ == (1 << _Traits::__exp_bits) - 1 || (__am.__power2_ == 0 && __am.__mantissa_ == 0))
+  {
+    return {__it, errc::result_out_of_range};
+  }
+  __value = ::cuda::std::__fp_from_parts<_Tp>(
+    __negative, (static_cast<uint64_t>(__am.__power2_) << _Traits::__mant_bits) | __am.__mantissa_);
+  return {__it, errc{}};
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_FROM_CHARS_FP_H
@@ -0,0 +1,447 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_RYU_H
+#define _CUDA_STD___CHARCONV_RYU_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/mul_hi.h>
+#include <cuda/std/__charconv/fp_tables.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Shortest round-trip decimal representation of binary32 and binary64 values.
+//
+// This is the Ryu algorithm of Ulf Adams, "Ryu: Fast Float-to-String Conversion", PLDI 2018.
+// Both formats share the 128-bit multiplier tables in fp_tables.h; binary32 uses their upper
+// 64 bits.
+
+//! The decimal value __mantissa_ * 10^__exponent_.
+struct __fp_decimal
+{
+  uint64_t __mantissa_;
+  int __exponent_;
+};
+
+// ceil(log2(5^__e)) for __e in [1, 3528], and 1 for __e == 0.
+[[nodiscard]] _CCCL_API constexpr int __ryu_pow5_bits(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 1217359u) >> 19) + 1;
+}
+
+// floor(log10(2^__e)) for __e in [0, 1650].
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow2(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 78913u) >> 18);
+}
+
+// floor(log10(5^__e)) for __e in [0, 2620].
+[[nodiscard]] _CCCL_API constexpr int __ryu_log10_pow5(int __e) noexcept
+{
+  return static_cast<int>((static_cast<uint32_t>(__e) * 732923u) >> 20);
+}
+
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow5(_Up __v, int __p) noexcept
+{
+  int __count = 0;
+  while (__v % 5 == 0)
+  {
+    __v /= 5;
+    ++__count;
+  }
+  return __count >= __p;
+}
+
+template <class _Up>
+[[nodiscard]] _CCCL_API constexpr bool __ryu_multiple_of_pow2(_Up __v, int __p) noexcept
+{
+  return (__v & ((_Up{1} << __p) - 1)) == 0;
+}
+
+// Computes (__m * (__mul_hi * 2^64 + __mul_lo)) >> __j for __j in [64, 127].
+[[nodiscard]] _CCCL_API constexpr uint64_t
+__ryu_mul_shift64(uint64_t __m, uint64_t __mul_hi, uint64_t __mul_lo, int __j) noexcept
+{
+  const uint64_t __b0_hi = ::cuda::mul_hi(__m, __mul_lo);
+  const uint64_t __b2_lo = __m * __mul_hi;
+  const uint64_t __b2_hi = ::cuda::mul_hi(__m, __mul_hi);
+  const uint64_t __lo    = __b0_hi + __b2_lo;
+  const uint64_t __hi    = __b2_hi + (__lo < __b0_hi);
+  const int __shift      = __j - 64;
+  return (__shift == 0) ? __lo : ((__hi << (64 - __shift)) | (__lo >> __shift));
+}
+
+// Computes (__m * __factor) >> __shift for __shift in [32, 95].
+[[nodiscard]] _CCCL_API constexpr uint32_t __ryu_mul_shift32(uint32_t __m, uint64_t __factor, int __shift) noexcept
+{
+  const uint64_t __bits0 = uint64_t{__m} * static_cast<uint32_t>(__factor);
+  const uint64_t __bits1 = uint64_t{__m} * static_cast<uint32_t>(__factor >> 32);
+  const uint64_t __sum   = (__bits0 >> 32) + __bits1;
+  return static_cast<uint32_t>(__sum >> (__shift - 32));
+}
+
+[[nodiscard]] _CCCL_API constexpr __fp_decimal __ryu_d2d(uint64_t __ieee_mantissa, uint32_t __ieee_exponent) noexcept
+{
+  constexpr int __mantissa_bits = 52;
+  constexpr int __bias          = 1023;
+  constexpr int __pow5_bitcount = 125;
+
+  int __e2{};
+  uint64_t __m2{};
+  if (__ieee_exponent == 0)
+  {
+    // Subtract 2 so that the bounds computation has 2 additional bits.
+    __e2 = 1 - __bias - __mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  }
+  else
+  {
+    __e2 = static_cast<int>(__ieee_exponent) - __bias - __mantissa_bits - 2;
+    __m2 = (uint64_t{1} << __mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  // Step 2: Determine the interval of valid decimal representations.
+  const uint64_t __mv       = 4 * __m2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+
+  // Step 3: Convert to a decimal power base using 128-bit arithmetic.
+  uint64_t __vr{};
+  uint64_t __vp{};
+  uint64_t __vm{};
+  int __e10{};
+  bool __vm_is_trailing_zeros = false;
+  bool __vr_is_trailing_zeros = false;
+  if (__e2 >= 0)
+  {
+    const int __q    = ::cuda::std::__ryu_log10_pow2(__e2) - (__e2 > 3);
+    __e10            = __q;
+    const int __k    = __pow5_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    const int __i    = -__e2 + __q + __k;
+    const auto& __mul = __fp_pow5_inv_125[__q];
+    __vr              = ::cuda::std::__ryu_mul_shift64(4 * __m2, __mul[0], __mul[1], __i);
+    __vp              = ::cuda::std::__ryu_mul_shift64(4 * __m2 + 2, __mul[0], __mul[1], __i);
+    __vm              = ::cuda::std::__ryu_mul_shift64(4 * __m2 - 1 - __mm_shift, __mul[0], __mul[1], __i);
+    if (__q <= 21)
+    {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv - 1 - __mm_shift, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__ryu_multiple_of_pow5(__mv + 2, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2) - (-__e2 > 1);
+    __e10         = __q + __e2;
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - __pow5_bitcount;
+    const int __j = __q - __k;
+    // The Ryu multiplier is the 128-bit power of 5 shifted right by 3 bits:
+    const auto& __pow5     = __fp_pow5_128[__i - __fp_pow5_128_min_exp];
+    const uint64_t __mul_hi = __pow5[0] >> 3;
+    const uint64_t __mul_lo = (__pow5[0] << 61) | (__pow5[1] >> 3);
+    __vr                    = ::cuda::std::__ryu_mul_shift64(4 * __m2, __mul_hi, __mul_lo, __j);
+    __vp                    = ::cuda::std::__ryu_mul_shift64(4 * __m2 + 2, __mul_hi, __mul_lo, __j);
+    __vm                    = ::cuda::std::__ryu_mul_shift64(4 * __m2 - 1 - __mm_shift, __mul_hi, __mul_lo, __j);
+    if (__q <= 1)
+    {
+      // {vr,vp,vm} is trailing zeros if {mv,mp,mm} has at least q trailing 0 bits. mv = 4 * m2,
+      // so it always has at least two trailing 0 bits.
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        // mm = mv - 1 - mm_shift, so it has 1 trailing 0 bit iff mm_shift == 1.
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        // mp = mv + 2, so it always has at least one trailing 0 bit.
+        --__vp;
+      }
+    }
+    else if (__q < 63)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow2(__mv, __q);
+    }
+  }
+
+  // Step 4: Find the shortest decimal representation in the interval of valid representations.
+  int __removed                = 0;
+  uint32_t __last_removed_digit = 0;
+  uint64_t __output{};
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    // General case, which happens rarely (~0.7%).
+    while (__vp / 10 > __vm / 10)
+    {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = static_cast<uint32_t>(__vr % 10);
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    if (__vm_is_trailing_zeros)
+    {
+      while (__vm % 10 == 0)
+      {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = static_cast<uint32_t>(__vr % 10);
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+        ++__removed;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+    {
+      // Round even if the exact number is .....50..0.
+      __last_removed_digit = 4;
+    }
+    // Take vr + 1 if vr is outside bounds or we need to round up.
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  }
+  else
+  {
+    // Specialized for the common case (~99.3%).
+    bool __round_up = false;
+    if (__vp / 100 > __vm / 100)
+    {
+      // Remove two digits at a time (~86.2%).
+      __round_up = __vr % 100 >= 50;
+      __vr /= 100;
+      __vp /= 100;
+      __vm /= 100;
+      __removed += 2;
+    }
+    while (__vp / 10 > __vm / 10)
+    {
+      __round_up = __vr % 10 >= 5;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    __output = __vr + (__vr == __vm || __round_up);
+  }
+  return {__output, __e10 + __removed};
+}
+
+[[nodiscard]] _CCCL_API constexpr __fp_decimal __ryu_f2d(uint32_t __ieee_mantissa, uint32_t __ieee_exponent) noexcept
+{
+  constexpr int __mantissa_bits     = 23;
+  constexpr int __bias              = 127;
+  constexpr int __pow5_inv_bitcount = 125 - 64;
+  constexpr int __pow5_bitcount     = 125 - 64;
+
+  // The binary32 multipliers are the upper 64 bits of the binary64 ones. The inverse ones are
+  // floor(2^x / 5^y) + 1, so the truncated value needs the + 1 again.
+  auto __mul_pow5_inv_div_pow2 = [](uint32_t __m, int __q, int __j) {
+    return ::cuda::std::__ryu_mul_shift32(__m, __fp_pow5_inv_125[__q][0] + 1, __j);
+  };
+  auto __mul_pow5_div_pow2 = [](uint32_t __m, int __i, int __j) {
+    return ::cuda::std::__ryu_mul_shift32(__m, __fp_pow5_128[__i - __fp_pow5_128_min_exp][0] >> 3, __j);
+  };
+
+  int __e2{};
+  uint32_t __m2{};
+  if (__ieee_exponent == 0)
+  {
+    __e2 = 1 - __bias - __mantissa_bits - 2;
+    __m2 = __ieee_mantissa;
+  }
+  else
+  {
+    __e2 = static_cast<int>(__ieee_exponent) - __bias - __mantissa_bits - 2;
+    __m2 = (1u << __mantissa_bits) | __ieee_mantissa;
+  }
+  const bool __accept_bounds = (__m2 & 1) == 0;
+
+  const uint32_t __mv       = 4 * __m2;
+  const uint32_t __mp       = 4 * __m2 + 2;
+  const uint32_t __mm_shift = __ieee_mantissa != 0 || __ieee_exponent <= 1;
+  const uint32_t __mm       = 4 * __m2 - 1 - __mm_shift;
+
+  uint32_t __vr{};
+  uint32_t __vp{};
+  uint32_t __vm{};
+  int __e10{};
+  bool __vm_is_trailing_zeros   = false;
+  bool __vr_is_trailing_zeros   = false;
+  uint32_t __last_removed_digit = 0;
+  if (__e2 >= 0)
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow2(__e2);
+    __e10         = __q;
+    const int __k = __pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q) - 1;
+    const int __i = -__e2 + __q + __k;
+    __vr          = __mul_pow5_inv_div_pow2(__mv, __q, __i);
+    __vp          = __mul_pow5_inv_div_pow2(__mp, __q, __i);
+    __vm          = __mul_pow5_inv_div_pow2(__mm, __q, __i);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      // We need to know one removed digit even if we are not going to loop below.
+      const int __l        = __pow5_inv_bitcount + ::cuda::std::__ryu_pow5_bits(__q - 1) - 1;
+      __last_removed_digit = __mul_pow5_inv_div_pow2(__mv, __q - 1, -__e2 + __q - 1 + __l) % 10;
+    }
+    if (__q <= 9)
+    {
+      // Only one of mp, mv, and mm can be a multiple of 5, if any.
+      if (__mv % 5 == 0)
+      {
+        __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mv, __q);
+      }
+      else if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow5(__mm, __q);
+      }
+      else
+      {
+        __vp -= ::cuda::std::__ryu_multiple_of_pow5(__mp, __q);
+      }
+    }
+  }
+  else
+  {
+    const int __q = ::cuda::std::__ryu_log10_pow5(-__e2);
+    __e10         = __q + __e2;
+    const int __i = -__e2 - __q;
+    const int __k = ::cuda::std::__ryu_pow5_bits(__i) - __pow5_bitcount;
+    int __j       = __q - __k;
+    __vr          = __mul_pow5_div_pow2(__mv, __i, __j);
+    __vp          = __mul_pow5_div_pow2(__mp, __i, __j);
+    __vm          = __mul_pow5_div_pow2(__mm, __i, __j);
+    if (__q != 0 && (__vp - 1) / 10 <= __vm / 10)
+    {
+      __j                  = __q - 1 - (::cuda::std::__ryu_pow5_bits(__i + 1) - __pow5_bitcount);
+      __last_removed_digit = __mul_pow5_div_pow2(__mv, __i + 1, __j) % 10;
+    }
+    if (__q <= 1)
+    {
+      __vr_is_trailing_zeros = true;
+      if (__accept_bounds)
+      {
+        __vm_is_trailing_zeros = __mm_shift == 1;
+      }
+      else
+      {
+        --__vp;
+      }
+    }
+    else if (__q < 31)
+    {
+      __vr_is_trailing_zeros = ::cuda::std::__ryu_multiple_of_pow2(__mv, __q - 1);
+    }
+  }
+
+  int __removed = 0;
+  uint32_t __output{};
+  if (__vm_is_trailing_zeros || __vr_is_trailing_zeros)
+  {
+    // General case, which happens rarely (~4.0%).
+    while (__vp / 10 > __vm / 10)
+    {
+      __vm_is_trailing_zeros &= __vm % 10 == 0;
+      __vr_is_trailing_zeros &= __last_removed_digit == 0;
+      __last_removed_digit = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    if (__vm_is_trailing_zeros)
+    {
+      while (__vm % 10 == 0)
+      {
+        __vr_is_trailing_zeros &= __last_removed_digit == 0;
+        __last_removed_digit = __vr % 10;
+        __vr /= 10;
+        __vp /= 10;
+        __vm /= 10;
+        ++__removed;
+      }
+    }
+    if (__vr_is_trailing_zeros && __last_removed_digit == 5 && __vr % 2 == 0)
+    {
+      // Round even if the exact number is .....50..0.
+      __last_removed_digit = 4;
+    }
+    __output = __vr + ((__vr == __vm && (!__accept_bounds || !__vm_is_trailing_zeros)) || __last_removed_digit >= 5);
+  }
+  else
+  {
+    // Specialized for the common case (~96.0%).
+    while (__vp / 10 > __vm / 10)
+    {
+      __last_removed_digit = __vr % 10;
+      __vr /= 10;
+      __vp /= 10;
+      __vm /= 10;
+      ++__removed;
+    }
+    __output = __vr + (__vr == __vm || __last_removed_digit >= 5);
+  }
+  return {__output, __e10 + __removed};
+}
+
+// Integers in [1, 2^53) are printed exactly; this skips the 128-bit arithmetic and always
+// produces the shortest digits because every such integer is representable.
+[[nodiscard]] _CCCL_API constexpr bool
+__ryu_d2d_small_int(uint64_t __ieee_mantissa, uint32_t __ieee_exponent, __fp_decimal& __result) noexcept
+{
+  const uint64_t __m2 = (uint64_t{1} << 52) | __ieee_mantissa;
+  const int __e2      = static_cast<int>(__ieee_exponent) - 1023 - 52;
+  if (__e2 > 0 || __e2 < -52)
+  {
+    return false;
+  }
+  const uint64_t __mask = (uint64_t{1} << -__e2) - 1;
+  if ((__m2 & __mask) != 0)
+  {
+    return false;
+  }
+  __result = {__m2 >> -__e2, 0};
+  while (__result.__mantissa_ % 10 == 0)
+  {
+    __result.__mantissa_ /= 10;
+    ++__result.__exponent_;
+  }
+  return true;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_RYU_H
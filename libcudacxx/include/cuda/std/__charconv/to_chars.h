@@ -26,10 +26,10 @@
 #include <cuda/__cmath/uabs.h>
 #include <cuda/std/__bit/countl.h>
 #include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/to_chars_fp.h>
 #include <cuda/std/__charconv/to_chars_result.h>
 #include <cuda/std/__concepts/concept_macros.h>
 #include <cuda/std/__cstddef/types.h>
-#include <cuda/std/__type_traits/always_false.h>
 #include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/is_floating_point.h>
 #include <cuda/std/__type_traits/is_integer.h>
@@ -198,16 +198,27 @@ to_chars(char* __first, char* __last, char __value, int __base = 10) noexcept
 
 _CCCL_API constexpr to_chars_result to_chars(char*, char*, bool, int = 10) noexcept = delete;
 
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__to_chars_fp(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
+{
+  if constexpr (is_same_v<_Tp, long double>)
+  {
+    static_assert(__fp_format_of_v<long double> == __fp_format::__binary64,
+                  "cuda::std::to_chars supports long double only when it has the same format as double");
+    return ::cuda::std::__fp_to_chars(__first, __last, static_cast<double>(__value), __fmt, __prec);
+  }
+  else
+  {
+    return ::cuda::std::__fp_to_chars(__first, __last, __value, __fmt, __prec);
+  }
+}
+
 _CCCL_TEMPLATE(class _Tp)
 _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result to_chars(char* __first, char* __last, _Tp __value) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  return {};
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, chars_format{}, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -215,13 +226,8 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  return {};
+  _CCCL_ASSERT(::cuda::std::__fp_is_valid_chars_format(__fmt), "invalid chars_format");
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, -1);
 }
 
 _CCCL_TEMPLATE(class _Tp)
@@ -229,14 +235,9 @@ _CCCL_REQUIRES(is_floating_point_v<_Tp>)
 [[nodiscard]] _CCCL_API constexpr to_chars_result
 to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __prec) noexcept
 {
-  static_assert(::cuda::std::__always_false_v<_Tp>,
-                "cuda::std::to_chars for floating point types is not yet implemented");
-  (void) __first;
-  (void) __last;
-  (void) __value;
-  (void) __fmt;
-  (void) __prec;
-  return {};
+  _CCCL_ASSERT(::cuda::std::__fp_is_valid_chars_format(__fmt), "invalid chars_format");
+  // A negative precision behaves like the default precision of printf.
+  return ::cuda::std::__to_chars_fp(__first, __last, __value, __fmt, (__prec < 0) ? 6 : __prec);
 }
 
 _CCCL_END_NAMESPACE_CUDA_STD
@@ -0,0 +1,735 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___CHARCONV_TO_CHARS_FP_H
+#define _CUDA_STD___CHARCONV_TO_CHARS_FP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/__bit/countl.h>
+#include <cuda/std/__charconv/chars_format.h>
+#include <cuda/std/__charconv/fp_bigint.h>
+#include <cuda/std/__charconv/ryu.h>
+#include <cuda/std/__charconv/to_chars_result.h>
+#include <cuda/std/__floating_point/format.h>
+#include <cuda/std/__floating_point/properties.h>
+#include <cuda/std/__floating_point/storage.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+//! Properties of the floating-point types supported by to_chars and from_chars.
+template <class _Tp>
+struct __fp_charconv_traits
+{
+  static constexpr __fp_format __format = __fp_format_of_v<_Tp>;
+  static_assert(__format == __fp_format::__binary32 || __format == __fp_format::__binary64,
+                "cuda::std::to_chars and cuda::std::from_chars support only binary32 and binary64 floating-point types");
+
+  using __storage_t = __fp_storage_t<__format>;
+
+  static constexpr int __mant_bits = __fp_mant_nbits_v<__format>;
+  static constexpr int __exp_bits  = __fp_exp_nbits_v<__format>;
+  static constexpr int __bias      = __fp_exp_bias_v<__format>;
+
+  // The number of significant decimal digits for which rounding the shortest representation
+  // gives the same result as rounding the exact value. 10^-n must be larger than 2^-mant_bits.
+  static constexpr int __fast_digits = (__format == __fp_format::__binary64) ? 15 : 6;
+
+  // The largest number of significant decimal digits in the exact value, plus one.
+  static constexpr int __max_exact_digits = (__format == __fp_format::__binary64) ? 768 : 113;
+
+  // The size in 32-bit words of the big integers for the exact conversions.
+  static constexpr int __exact_words = (__format == __fp_format::__binary64) ? 40 : 10;
+};
+
+[[nodiscard]] _CCCL_API constexpr bool __fp_is_valid_chars_format(chars_format __fmt) noexcept
+{
+  return __fmt == chars_format::scientific || __fmt == chars_format::fixed || __fmt == chars_format::general
+      || __fmt == chars_format::hex;
+}
+
+//! A finite floating-point value split into its sign, biased exponent and mantissa bits.
+struct __fp_parts
+{
+  bool __negative_;
+  uint32_t __exponent_;
+  uint64_t __mantissa_;
+};
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __fp_parts __fp_split(_Tp __value) noexcept
+{
+  using _Traits       = __fp_charconv_traits<_Tp>;
+  const auto __bits   = ::cuda::std::__fp_get_storage(__value);
+  const auto __nbits  = _Traits::__mant_bits + _Traits::__exp_bits;
+  const auto __mask_m = (typename _Traits::__storage_t{1} << _Traits::__mant_bits) - 1;
+  const auto __mask_e = (typename _Traits::__storage_t{1} << _Traits::__exp_bits) - 1;
+  return {static_cast<bool>(__bits >> __nbits),
+          static_cast<uint32_t>((__bits >> _Traits::__mant_bits) & __mask_e),
+          static_cast<uint64_t>(__bits & __mask_m)};
+}
+
+_CCCL_GLOBAL_CONSTANT char __fp_digit_pairs[] = "00010203040506070809"
+                                                "10111213141516171819"
+                                                "20212223242526272829"
+                                                "30313233343536373839"
+                                                "40414243444546474849"
+                                                "50515253545556575859"
+                                                "60616263646566676869"
+                                                "70717273747576777879"
+                                                "80818283848586878889"
+                                                "90919293949596979899";
+
+//! Writes the decimal digits of __v so that they end right before __last.
+_CCCL_API constexpr char* __fp_write_digits_backward(char* __last, uint64_t __v) noexcept
+{
+  while (__v >= 100)
+  {
+    const auto __r = static_cast<int>(__v % 100);
+    __v /= 100;
+    __last -= 2;
+    __last[0] = __fp_digit_pairs[2 * __r];
+    __last[1] = __fp_digit_pairs[2 * __r + 1];
+  }
+  if (__v >= 10)
+  {
+    __last -= 2;
+    __last[0] = __fp_digit_pairs[2 * __v];
+    __last[1] = __fp_digit_pairs[2 * __v + 1];
+  }
+  else
+  {
+    *--__last = static_cast<char>('0' + __v);
+  }
+  return __last;
+}
+
+_CCCL_API constexpr char* __fp_fill(char* __first, int __n, char __c) noexcept
+{
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    *__first++ = __c;
+  }
+  return __first;
+}
+
+_CCCL_API constexpr char* __fp_copy(char* __first, const char* __src, int __n) noexcept
+{
+  for (int __i = 0; __i < __n; ++__i)
+  {
+    *__first++ = __src[__i];
+  }
+  return __first;
+}
+
+[[nodiscard]] _CCCL_API constexpr int __fp_exponent_length(int __exp) noexcept
+{
+  const int __abs = (__exp < 0) ? -__exp : __exp;
+  return 2 + ((__abs >= 100) ? 3 : 2);
+}
+
+//! Writes e[+-]XX with at least two exponent digits. The caller checked the capacity.
+_CCCL_API constexpr char* __fp_write_exponent(char* __first, int __exp, char __e = 'e') noexcept
+{
+  *__first++ = __e;
+  *__first++ = (__exp < 0) ? '-' : '+';
+  const int __abs = (__exp < 0) ? -__exp : __exp;
+  if (__abs >= 100)
+  {
+    *__first++ = static_cast<char>('0' + __abs / 100);
+  }
+  const int __r = __abs % 100;
+  *__first++    = __fp_digit_pairs[2 * __r];
+  *__first++    = __fp_digit_pairs[2 * __r + 1];
+  return __first;
+}
+
+//! Writes the significant digits [__digits, __digits + __n) with the decimal exponent __exp of
+//! the first digit in scientific notation, followed by zeros up to __n_min digits.
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_write_scientific(char* __first, char* __last, const char* __digits, int __n, int __exp, int __n_min = 0) noexcept
+{
+  const int __nd     = (__n < __n_min) ? __n_min : __n;
+  const int __length = __nd + (__nd > 1) + __fp_exponent_length(__exp);
+  if (__last - __first < __length)
+  {
+    return {__last, errc::value_too_large};
+  }
+  *__first++ = __digits[0];
+  if (__nd > 1)
+  {
+    *__first++ = '.';
+    __first    = ::cuda::std::__fp_copy(__first, __digits + 1, __n - 1);
+    __first    = ::cuda::std::__fp_fill(__first, __nd - __n, '0');
+  }
+  return {::cuda::std::__fp_write_exponent(__first, __exp), errc{}};
+}
+
+//! Writes the significant digits [__digits, __digits + __n) with the decimal exponent __exp of
+//! the first digit in fixed notation, with at least __frac_min fractional digits.
+[[nodiscard]] _CCCL_API constexpr to_chars_result __fp_write_fixed(
+  char* __first, char* __last, const char* __digits, int __n, int __exp, int __frac_min = 0) noexcept
+{
+  // The number of fractional digits the significant digits need:
+  const int __frac_sig = (__n - 1 - __exp > 0) ? __n - 1 - __exp : 0;
+  const int __frac     = (__frac_sig < __frac_min) ? __frac_min : __frac_sig;
+  const int __int_len  = (__exp >= 0) ? __exp + 1 : 1;
+  const int __length   = __int_len + ((__frac > 0) ? __frac + 1 : 0);
+  if (__last - __first < __length)
+  {
+    return {__last, errc::value_too_large};
+  }
+  if (__exp >= 0)
+  {
+    const int __int_digits = (__n < __exp + 1) ? __n : __exp + 1;
+    __first                = ::cuda::std::__fp_copy(__first, __digits, __int_digits);
+    __first                = ::cuda::std::__fp_fill(__first, __exp + 1 - __int_digits, '0');
+    __digits += __int_digits;
+    __n -= __int_digits;
+    if (__frac > 0)
+    {
+      *__first++ = '.';
+      __first    = ::cuda::std::__fp_copy(__first, __digits, __n);
+      __first    = ::cuda::std::__fp_fill(__first, __frac - __n, '0');
+    }
+  }
+  else
+  {
+    *__first++ = '0';
+    if (__frac > 0)
+    {
+      *__first++ = '.';
+      __first    = ::cuda::std::__fp_fill(__first, -__exp - 1, '0');
+      __first    = ::cuda::std::__fp_copy(__first, __digits, __n);
+      __first    = ::cuda::std::__fp_fill(__first, __frac - __n - (-__exp - 1), '0');
+    }
+  }
+  return {__first, errc{}};
+}
+
+//! The shortest decimal representation of a positive finite value, without trailing zeros.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr __fp_decimal __fp_shortest(const __fp_parts& __parts) noexcept
+{
+  __fp_decimal __result{};
+  if constexpr (__fp_charconv_traits<_Tp>::__format == __fp_format::__binary64)
+  {
+    if (!::cuda::std::__ryu_d2d_small_int(__parts.__mantissa_, __parts.__exponent_, __result))
+    {
+      __result = ::cuda::std::__ryu_d2d(__parts.__mantissa_, __parts.__exponent_);
+    }
+  }
+  else
+  {
+    __result = ::cuda::std::__ryu_f2d(static_cast<uint32_t>(__parts.__mantissa_), __parts.__exponent_);
+  }
+  while (__result.__mantissa_ % 10 == 0)
+  {
+    __result.__mantissa_ /= 10;
+    ++__result.__exponent_;
+  }
+  return __result;
+}
+
+// Exact decimal expansion of m * 2^e2.
+//
+// The value is kept as the fraction __r_ / __s_ * 10^__k_ with __r_ / __s_ in [0.1, 1). Each
+// digit multiplies __r_ by 10 and divides by __s_. This is slower than Ryu, but gives the
+// correctly rounded digits for any precision.
+template <int _Words>
+struct __fp_exact_digits
+{
+  __fp_bigint<_Words> __r_;
+  __fp_bigint<_Words> __s_;
+  int __k_;
+
+  _CCCL_API constexpr __fp_exact_digits(uint64_t __m, int __e2) noexcept
+      : __r_{__m}
+      , __s_{1}
+      , __k_{}
+  {
+    if (__e2 >= 0)
+    {
+      __r_.__shl(__e2);
+    }
+    else
+    {
+      __s_.__shl(-__e2);
+    }
+
+    // The value is in [2^(__bits - 1), 2^__bits), so 10^(__k_ - 1) <= value < 10^(__k_ + 1):
+    const int __bits = 64 - ::cuda::std::countl_zero(__m) + __e2;
+    const int __l    = (__bits - 1) * 78913;
+    __k_             = ((__l >= 0) ? __l >> 18 : -((-__l + (1 << 18) - 1) >> 18)) + 1;
+    if (__k_ >= 0)
+    {
+      __s_.__mul_pow10(__k_);
+    }
+    else
+    {
+      __r_.__mul_pow10(-__k_);
+    }
+    if (__r_.__compare(__s_) >= 0)
+    {
+      __s_.__mul_add_small(10, 0);
+      ++__k_;
+    }
+  }
+
+  //! Writes the next __n digits. Returns the pointer past the last written digit.
+  _CCCL_API constexpr char* __generate(char* __first, int __n) noexcept
+  {
+    for (int __i = 0; __i < __n; ++__i)
+    {
+      if (__r_.__is_zero())
+      {
+        return ::cuda::std::__fp_fill(__first, __n - __i, '0');
+      }
+      __r_.__mul_add_small(10, 0);
+      *__first++ = static_cast<char>('0' + __r_.__divmod_digit(__s_));
+    }
+    return __first;
+  }
+
+  //! Compares the remaining digits with one half. Only meaningful once, at the end.
+  [[nodiscard]] _CCCL_API constexpr int __compare_half() noexcept
+  {
+    __r_.__shl(1);
+    return __r_.__compare(__s_);
+  }
+};
+
+//! Adds one to the decimal number in [__first, __last), skipping the decimal point. Returns
+//! true if the carry propagated out of the first digit, which leaves all digits '0'.
+_CCCL_API constexpr bool __fp_increment_digits(char* __first, char* __last) noexcept
+{
+  while (__last != __first)
+  {
+    --__last;
+    if (*__last == '.')
+    {
+      continue;
+    }
+    if (*__last != '9')
+    {
+      ++*__last;
+      return false;
+    }
+    *__last = '0';
+  }
+  return true;
+}
+
+//! Rounds the digits in [__first, __last) half to even, given the comparison of the dropped
+//! part with one half. Returns true if the carry propagated out of the first digit.
+template <int _Words>
+_CCCL_API constexpr bool __fp_round_digits(__fp_exact_digits<_Words>& __exact, char* __first, char* __last) noexcept
+{
+  const int __cmp = __exact.__compare_half();
+  if (__cmp < 0)
+  {
+    return false;
+  }
+  if (__cmp == 0)
+  {
+    const char* __it = __last;
+    while (__it != __first && *(__it - 1) == '.')
+    {
+      --__it;
+    }
+    // No digit means that the last kept digit is an implicit zero:
+    if (__it == __first || (*(__it - 1) - '0') % 2 == 0)
+    {
+      return false;
+    }
+  }
+  return ::cuda::std::__fp_increment_digits(__first, __last);
+}
+
+//! Returns the decimal digits of a positive finite value, rounded to __n significant digits.
+//! __digits must have room for min(__n, __max_exact_digits) digits; the remaining ones are
+//! zero. Returns the number of digits written and sets __exp to the exponent of the first one.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr int
+__fp_significant_digits(const __fp_parts& __parts, int __n, char* __digits, int& __exp) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  const auto __shortest = ::cuda::std::__fp_shortest<_Tp>(__parts);
+  const int __olength   = ::cuda::ilog10(__shortest.__mantissa_) + 1;
+  if (__parts.__exponent_ != 0 && __olength <= __n && __n <= _Traits::__fast_digits)
+  {
+    // The shortest representation of a normal value is closer to it than half a unit in the
+    // last of the __n digits, so it rounds to itself.
+    ::cuda::std::__fp_write_digits_backward(__digits + __olength, __shortest.__mantissa_);
+    __exp = __shortest.__exponent_ + __olength - 1;
+    return __olength;
+  }
+
+  const bool __normal = __parts.__exponent_ != 0;
+  const uint64_t __m  = __parts.__mantissa_ | (uint64_t{__normal} << _Traits::__mant_bits);
+  const int __e2 = static_cast<int>(__parts.__exponent_) - !!__normal - _Traits::__bias - _Traits::__mant_bits + 1;
+
+  __fp_exact_digits<_Traits::__exact_words> __exact{__m, __e2};
+  const int __nd = (__n < _Traits::__max_exact_digits) ? __n : _Traits::__max_exact_digits;
+  __exact.__generate(__digits, __nd);
+  __exp = __exact.__k_ - 1;
+  if (::cuda::std::__fp_round_digits(__exact, __digits, __digits + __nd))
+  {
+    __digits[0] = '1';
+    ++__exp;
+  }
+  return __nd;
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars_scientific_precision(char* __first, char* __last, const __fp_parts& __parts, int __precision) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  const int __n = __precision + 1;
+  if (__parts.__exponent_ == 0 && __parts.__mantissa_ == 0)
+  {
+    constexpr char __zero = '0';
+    return ::cuda::std::__fp_write_scientific(__first, __last, &__zero, 1, 0, __n);
+  }
+
+  if (__last - __first < __n + (__n > 1) + 4)
+  {
+    return {__last, errc::value_too_large};
+  }
+  char __digits[_Traits::__max_exact_digits]{};
+  int __exp{};
+  const int __nd    = (__n < _Traits::__max_exact_digits) ? __n : _Traits::__max_exact_digits;
+  const int __count = ::cuda::std::__fp_significant_digits<_Tp>(__parts, __nd, __digits, __exp);
+  return ::cuda::std::__fp_write_scientific(__first, __last, __digits, __count, __exp, __n);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars_fixed_precision(char* __first, char* __last, const __fp_parts& __parts, int __precision) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  constexpr char __zero = '0';
+  if (__parts.__exponent_ == 0 && __parts.__mantissa_ == 0)
+  {
+    return ::cuda::std::__fp_write_fixed(__first, __last, &__zero, 1, 0, __precision);
+  }
+
+  // Fast path: the shortest representation has no more digits than requested.
+  const auto __shortest = ::cuda::std::__fp_shortest<_Tp>(__parts);
+  const int __olength   = ::cuda::ilog10(__shortest.__mantissa_) + 1;
+  const int __exp10     = __shortest.__exponent_ + __olength - 1;
+  if (__parts.__exponent_ != 0 && -__shortest.__exponent_ <= __precision
+      && __exp10 + 1 + __precision <= _Traits::__fast_digits)
+  {
+    char __digits[20]{};
+    ::cuda::std::__fp_write_digits_backward(__digits + __olength, __shortest.__mantissa_);
+    return ::cuda::std::__fp_write_fixed(__first, __last, __digits, __olength, __exp10, __precision);
+  }
+
+  const bool __normal = __parts.__exponent_ != 0;
+  const uint64_t __m  = __parts.__mantissa_ | (uint64_t{__normal} << _Traits::__mant_bits);
+  const int __e2 = static_cast<int>(__parts.__exponent_) - !!__normal - _Traits::__bias - _Traits::__mant_bits + 1;
+  __fp_exact_digits<_Traits::__exact_words> __exact{__m, __e2};
+
+  // value = 0.d1d2d3... * 10^k, so there are k integer digits:
+  const int __k      = __exact.__k_;
+  const int __length = ((__k > 0) ? __k : 1) + ((__precision > 0) ? __precision + 1 : 0);
+  if (__last - __first < __length)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  char* __it = __first;
+  if (__k > 0)
+  {
+    __it = __exact.__generate(__it, __k);
+    if (__precision > 0)
+    {
+      *__it++ = '.';
+      __it    = __exact.__generate(__it, __precision);
+    }
+  }
+  else
+  {
+    *__it++ = '0';
+    if (__precision > 0)
+    {
+      *__it++          = '.';
+      const int __lead = (-__k < __precision) ? -__k : __precision;
+      __it             = ::cuda::std::__fp_fill(__it, __lead, '0');
+      __it             = __exact.__generate(__it, __precision - __lead);
+    }
+  }
+
+  // Digits at positions below 10^-precision are dropped. If they are all below the written
+  // ones, the value is less than half a unit in the last place:
+  if (__k + __precision >= 0 && ::cuda::std::__fp_round_digits(__exact, __first, __it))
+  {
+    // Only reachable with __k > 0; a leading '0' absorbs the carry otherwise.
+    if (__last - __first < __length + 1)
+    {
+      return {__last, errc::value_too_large};
+    }
+    for (char* __p = __it; __p != __first; --__p)
+    {
+      *__p = *(__p - 1);
+    }
+    *__first = '1';
+    ++__it;
+    if (__precision > 0)
+    {
+      // Move the decimal point back to its place:
+      __first[__k + 1] = '.';
+      __first[__k]     = '0';
+    }
+  }
+  return {__it, errc{}};
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars_general_precision(char* __first, char* __last, const __fp_parts& __parts, int __precision) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  constexpr char __zero = '0';
+  if (__parts.__exponent_ == 0 && __parts.__mantissa_ == 0)
+  {
+    return ::cuda::std::__fp_write_fixed(__first, __last, &__zero, 1, 0);
+  }
+
+  const int __p = (__precision == 0) ? 1 : __precision;
+  char __digits[_Traits::__max_exact_digits]{};
+  int __exp{};
+  int __n = ::cuda::std::__fp_significant_digits<_Tp>(__parts, __p, __digits, __exp);
+  while (__n > 1 && __digits[__n - 1] == '0')
+  {
+    --__n;
+  }
+
+  // The style of printf's %g conversion:
+  if (__exp < __p && __exp >= -4)
+  {
+    return ::cuda::std::__fp_write_fixed(__first, __last, __digits, __n, __exp);
+  }
+  return ::cuda::std::__fp_write_scientific(__first, __last, __digits, __n, __exp);
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars_hex(char* __first, char* __last, const __fp_parts& __parts, int __precision) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  // The mantissa is padded to a whole number of hex digits:
+  constexpr int __hex_digits = (_Traits::__mant_bits + 3) / 4;
+  constexpr int __pad        = 4 * __hex_digits - _Traits::__mant_bits;
+
+  uint64_t __mant = __parts.__mantissa_ << __pad;
+  int __lead      = (__parts.__exponent_ != 0) ? 1 : 0;
+  int __exp       = 0;
+  if (__parts.__exponent_ != 0)
+  {
+    __exp = static_cast<int>(__parts.__exponent_) - _Traits::__bias;
+  }
+  else if (__parts.__mantissa_ != 0)
+  {
+    __exp = 1 - _Traits::__bias;
+  }
+
+  int __n = __hex_digits;
+  if (__precision < 0)
+  {
+    // Shortest: drop trailing zero digits.
+    while (__n > 0 && (__mant & 0xf) == 0)
+    {
+      __mant >>= 4;
+      --__n;
+    }
+  }
+  else if (__precision < __hex_digits)
+  {
+    // Round half to even at the requested digit:
+    const int __drop      = 4 * (__hex_digits - __precision);
+    const uint64_t __rest = __mant & ((uint64_t{1} << __drop) - 1);
+    const uint64_t __half = uint64_t{1} << (__drop - 1);
+    __mant >>= __drop;
+    __n = __precision;
+
+    const bool __odd = (__n > 0) ? (__mant & 1) != 0 : (__lead & 1) != 0;
+    if (__rest > __half || (__rest == __half && __odd))
+    {
+      ++__mant;
+      if (__mant >> (4 * __n) != 0)
+      {
+        __mant = 0;
+        ++__lead;
+      }
+    }
+  }
+
+  const int __frac   = (__precision < 0) ? __n : __precision;
+  const int __abs    = (__exp < 0) ? -__exp : __exp;
+  const int __elen   = ::cuda::ilog10(__abs | 1) + 1;
+  const int __length = 1 + ((__frac > 0) ? __frac + 1 : 0) + 2 + __elen;
+  if (__last - __first < __length)
+  {
+    return {__last, errc::value_too_large};
+  }
+
+  *__first++ = static_cast<char>('0' + __lead);
+  if (__frac > 0)
+  {
+    *__first++ = '.';
+    for (int __i = __n - 1; __i >= 0; --__i)
+    {
+      const auto __d = static_cast<int>((__mant >> (4 * __i)) & 0xf);
+      *__first++     = static_cast<char>((__d < 10) ? '0' + __d : 'a' + __d - 10);
+    }
+    __first = ::cuda::std::__fp_fill(__first, __frac - __n, '0');
+  }
+  *__first++ = 'p';
+  *__first++ = (__exp < 0) ? '-' : '+';
+  __first += __elen;
+  ::cuda::std::__fp_write_digits_backward(__first, static_cast<uint64_t>(__abs));
+  return {__first, errc{}};
+}
+
+//! Fixed notation with the shortest digits. Integers at or above 2^mantissa_bits are printed
+//! exactly, as printf would, instead of padding the shortest digits with zeros.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars_fixed_shortest(char* __first, char* __last, const __fp_parts& __parts, const __fp_decimal& __dec) noexcept
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+  if (static_cast<int>(__parts.__exponent_) - _Traits::__bias - _Traits::__mant_bits >= 0)
+  {
+    return ::cuda::std::__fp_to_chars_fixed_precision<_Tp>(__first, __last, __parts, 0);
+  }
+  char __digits[20]{};
+  const int __olength = ::cuda::ilog10(__dec.__mantissa_) + 1;
+  ::cuda::std::__fp_write_digits_backward(__digits + __olength, __dec.__mantissa_);
+  return ::cuda::std::__fp_write_fixed(__first, __last, __digits, __olength, __dec.__exponent_ + __olength - 1);
+}
+
+//! Converts a floating-point value. A __precision of -1 requests the shortest representation,
+//! and a __fmt of 0 requests the shorter of fixed and scientific notation.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr to_chars_result
+__fp_to_chars(char* __first, char* __last, _Tp __value, chars_format __fmt, int __precision) noexcept
+{
+  _CCCL_ASSERT(__first <= __last, "output range must be a valid range");
+
+  const auto __parts = ::cuda::std::__fp_split(__value);
+  if (__parts.__negative_)
+  {
+    if (__first == __last)
+    {
+      return {__last, errc::value_too_large};
+    }
+    *__first++ = '-';
+  }
+
+  if (__parts.__exponent_ == (1u << __fp_charconv_traits<_Tp>::__exp_bits) - 1)
+  {
+    if (__last - __first < 3)
+    {
+      return {__last, errc::value_too_large};
+    }
+    const char* __str = (__parts.__mantissa_ == 0) ? "inf" : "nan";
+    return {::cuda::std::__fp_copy(__first, __str, 3), errc{}};
+  }
+
+  if (__fmt == chars_format::hex)
+  {
+    return ::cuda::std::__fp_to_chars_hex<_Tp>(__first, __last, __parts, __precision);
+  }
+
+  if (__precision >= 0)
+  {
+    switch (__fmt)
+    {
+      case chars_format::scientific:
+        return ::cuda::std::__fp_to_chars_scientific_precision<_Tp>(__first, __last, __parts, __precision);
+      case chars_format::fixed:
+        return ::cuda::std::__fp_to_chars_fixed_precision<_Tp>(__first, __last, __parts, __precision);
+      default:
+        return ::cuda::std::__fp_to_chars_general_precision<_Tp>(__first, __last, __parts, __precision);
+    }
+  }
+
+  if (__parts.__exponent_ == 0 && __parts.__mantissa_ == 0)
+  {
+    constexpr char __zero = '0';
+    if (__fmt == chars_format::scientific)
+    {
+      return ::cuda::std::__fp_write_scientific(__first, __last, &__zero, 1, 0);
+    }
+    return ::cuda::std::__fp_write_fixed(__first, __last, &__zero, 1, 0);
+  }
+
+  const auto __dec    = ::cuda::std::__fp_shortest<_Tp>(__parts);
+  const int __olength = ::cuda::ilog10(__dec.__mantissa_) + 1;
+  const int __exp     = __dec.__exponent_ + __olength - 1;
+
+  bool __scientific = false;
+  switch (__fmt)
+  {
+    case chars_format::scientific:
+      __scientific = true;
+      break;
+    case chars_format::fixed:
+      break;
+    case chars_format::general:
+      // The style of printf's %g conversion with the default precision of 6:
+      __scientific = __exp < -4 || __exp >= 6;
+      break;
+    default: {
+      // The shorter of the two, preferring fixed:
+      const int __sci_length = __olength + (__olength > 1) + ::cuda::std::__fp_exponent_length(__exp);
+      const int __fixed_length = (__dec.__exponent_ >= 0) ? __olength + __dec.__exponent_
+                               : (__exp >= 0)             ? __olength + 1
+                                                          : __olength + 1 - __exp;
+      __scientific = __sci_length < __fixed_length;
+      break;
+    }
+  }
+
+  if (!__scientific)
+  {
+    return ::cuda::std::__fp_to_chars_fixed_shortest<_Tp>(__first, __last, __parts, __dec);
+  }
+  char __digits[20]{};
+  ::cuda::std::__fp_write_digits_backward(__digits + __olength, __dec.__mantissa_);
+  return ::cuda::std::__fp_write_scientific(__first, __last, __digits, __olength, __exp);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___CHARCONV_TO_CHARS_FP_H
@@ -0,0 +1,269 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___FORMAT_FORMAT_FP_H
+#define _CUDA_STD___FORMAT_FORMAT_FP_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__charconv/to_chars.h>
+#include <cuda/std/__format/format_integral.h>
+#include <cuda/std/__format/format_spec_parser.h>
+#include <cuda/std/__format/output_utils.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/__utility/to_underlying.h>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Needs to be a functor for tile mode
+struct __fmt_fp_to_upper
+{
+  [[nodiscard]] _CCCL_API constexpr char _CCCL_STATIC_CALL_OPERATOR(char __c) noexcept
+  {
+    return ('a' <= __c && __c <= 'z') ? static_cast<char>(__c - 'a' + 'A') : __c;
+  }
+};
+
+//! Helper to determine the buffer size to output a floating-point value.
+template <class _Tp>
+struct __fmt_fp_buffer_traits
+{
+  using _Traits = __fp_charconv_traits<_Tp>;
+
+  // The number of fractional digits of the smallest subnormal value.
+  static constexpr int __max_fixed_precision = _Traits::__bias + _Traits::__mant_bits - 1;
+  // The number of significant digits of the value with the longest exact representation.
+  static constexpr int __max_scientific_precision = _Traits::__max_exact_digits - 1;
+  // The number of hexadecimal digits of the mantissa.
+  static constexpr int __max_hex_precision = (_Traits::__mant_bits + 3) / 4;
+
+  static constexpr int __size = 1 // Reserve space for the sign.
+                              + (_Traits::__bias + 1) * 30103 / 100000 + 1 // The integer digits of the largest value.
+                              + 1 // Reserve space for the decimal point.
+                              + __max_fixed_precision // The fractional digits.
+                              + 6; // Reserve space for an exponent.
+};
+
+//! Writes [__first, __exp), a decimal point, __zeros zeros and [__exp, __last) with the
+//! required padding.
+template <class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_HOST_DEVICE_API _OutIt __fmt_write_fp(
+  const char* __first,
+  const char* __exp,
+  const char* __last,
+  bool __point,
+  size_t __zeros,
+  _OutIt __out_it,
+  __fmt_parsed_spec<_CharT> __specs,
+  bool __upper)
+{
+  const size_t __size = static_cast<size_t>(__last - __first) + __point + __zeros;
+
+  __fmt_padding_size_result __padding{0, 0};
+  if (__size < __specs.__width_)
+  {
+    __padding = ::cuda::std::__fmt_padding_size(__size, __specs.__width_, __fmt_spec_alignment{__specs.__alignment_});
+  }
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__before_, __specs.__fill_);
+  if (__upper)
+  {
+    __out_it = ::cuda::std::__fmt_transform(__first, __exp, ::cuda::std::move(__out_it), __fmt_fp_to_upper{});
+  }
+  else
+  {
+    __out_it = ::cuda::std::__fmt_copy(__first, __exp, ::cuda::std::move(__out_it));
+  }
+  if (__point)
+  {
+    __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), 1, _CharT{'.'});
+  }
+  __out_it = ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __zeros, _CharT{'0'});
+  if (__upper)
+  {
+    __out_it = ::cuda::std::__fmt_transform(__exp, __last, ::cuda::std::move(__out_it), __fmt_fp_to_upper{});
+  }
+  else
+  {
+    __out_it = ::cuda::std::__fmt_copy(__exp, __last, ::cuda::std::move(__out_it));
+  }
+  return ::cuda::std::__fmt_fill(::cuda::std::move(__out_it), __padding.__after_, __specs.__fill_);
+}
+
+template <class _Tp, class _CharT, class _OutIt>
+[[nodiscard]] _CCCL_HOST_DEVICE_API _OutIt
+__fmt_format_fp(_Tp __value, _OutIt __out_it, __fmt_parsed_spec<_CharT> __specs)
+{
+  using _Buffer = __fmt_fp_buffer_traits<_Tp>;
+  char __buffer[_Buffer::__size];
+
+  const auto __parts    = ::cuda::std::__fp_split(__value);
+  const bool __finite   = __parts.__exponent_ != (1u << __fp_charconv_traits<_Tp>::__exp_bits) - 1;
+  const bool __negative = __parts.__negative_;
+  if (__negative)
+  {
+    __value = -__value;
+  }
+  char* __first = ::cuda::std::__fmt_insert_sign(__buffer, __negative, __fmt_spec_sign{__specs.__std_.__sign_});
+
+  // Precisions beyond the exact value only add zeros, which are written separately.
+  int __precision = __specs.__precision_;
+  int __max_precision{};
+  chars_format __fmt{};
+  bool __general = false;
+  bool __upper   = false;
+  switch (__specs.__std_.__type_)
+  {
+    case __fmt_spec_type::__default:
+      __fmt           = (__precision >= 0) ? chars_format::general : chars_format{};
+      __general       = __precision >= 0;
+      __max_precision = _Buffer::__max_scientific_precision;
+      break;
+    case __fmt_spec_type::__hexfloat_upper_case:
+      __upper = true;
+      [[fallthrough]];
+    case __fmt_spec_type::__hexfloat_lower_case:
+      __fmt           = chars_format::hex;
+      __max_precision = _Buffer::__max_hex_precision;
+      break;
+    case __fmt_spec_type::__scientific_upper_case:
+      __upper = true;
+      [[fallthrough]];
+    case __fmt_spec_type::__scientific_lower_case:
+      __fmt           = chars_format::scientific;
+      __max_precision = _Buffer::__max_scientific_precision;
+      break;
+    case __fmt_spec_type::__fixed_upper_case:
+      __upper = true;
+      [[fallthrough]];
+    case __fmt_spec_type::__fixed_lower_case:
+      __fmt           = chars_format::fixed;
+      __max_precision = _Buffer::__max_fixed_precision;
+      break;
+    case __fmt_spec_type::__general_upper_case:
+      __upper = true;
+      [[fallthrough]];
+    case __fmt_spec_type::__general_lower_case:
+      __fmt           = chars_format::general;
+      __general       = true;
+      __max_precision = _Buffer::__max_scientific_precision;
+      break;
+    default:
+      _CCCL_UNREACHABLE();
+  }
+
+  size_t __zeros = 0;
+  if (__precision > __max_precision && !__general)
+  {
+    __zeros     = static_cast<size_t>(__precision - __max_precision);
+    __precision = __max_precision;
+  }
+
+  to_chars_result __r{};
+  if (__fmt == chars_format{})
+  {
+    __r = ::cuda::std::to_chars(__first, __buffer + _Buffer::__size, __value);
+  }
+  else if (__precision < 0)
+  {
+    __r = ::cuda::std::to_chars(__first, __buffer + _Buffer::__size, __value, __fmt);
+  }
+  else
+  {
+    __r = ::cuda::std::to_chars(__first, __buffer + _Buffer::__size, __value, __fmt, __precision);
+  }
+  _CCCL_ASSERT(__r.ec == errc(0), "Internal buffer too small");
+  char* __last = __r.ptr;
+
+  char* __exp  = __last;
+  bool __point = false;
+  if (__finite)
+  {
+    const char __exp_char = (__fmt == chars_format::hex) ? 'p' : 'e';
+    bool __has_point      = false;
+    for (char* __it = __first; __it != __last; ++__it)
+    {
+      __has_point = __has_point || *__it == '.';
+      if (*__it == __exp_char)
+      {
+        __exp = __it;
+        break;
+      }
+    }
+
+    if (__specs.__std_.__alternate_form_)
+    {
+      __point = !__has_point;
+      if (__general)
+      {
+        // The alternate form keeps the trailing zeros of the general format.
+        const int __p  = (__specs.__precision_ == 0) ? 1 : __specs.__precision_;
+        int __digits   = 0;
+        int __leading  = 0;
+        bool __nonzero = false;
+        for (char* __it = __first; __it != __exp; ++__it)
+        {
+          if (*__it == '.')
+          {
+            continue;
+          }
+          __nonzero = __nonzero || *__it != '0';
+          __leading += !__nonzero;
+          ++__digits;
+        }
+        const int __significant = __nonzero ? __digits - __leading : __digits;
+        __zeros                 = (__significant < __p) ? static_cast<size_t>(__p - __significant) : 0;
+      }
+    }
+  }
+  else
+  {
+    __zeros = 0;
+  }
+
+  if (__fmt_spec_alignment{__specs.__alignment_} == __fmt_spec_alignment::__zero_padding)
+  {
+    if (__finite)
+    {
+      // The sign is written before the zero padding.
+      __out_it                  = ::cuda::std::__fmt_copy(__buffer, __first, ::cuda::std::move(__out_it));
+      __specs.__fill_.__data[0] = _CharT{'0'};
+      __specs.__width_ -= ::cuda::std::min(static_cast<uint32_t>(__first - __buffer), __specs.__width_);
+    }
+    else
+    {
+      __first = __buffer;
+    }
+    __specs.__alignment_ = ::cuda::std::to_underlying(__fmt_spec_alignment::__right);
+  }
+  else
+  {
+    __first = __buffer;
+  }
+
+  return ::cuda::std::__fmt_write_fp(
+    __first, __exp, __last, __point, __zeros, ::cuda::std::move(__out_it), __specs, __upper);
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___FORMAT_FORMAT_FP_H
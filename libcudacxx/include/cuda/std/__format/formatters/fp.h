@@ -20,8 +20,10 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__format/format_fp.h>
 #include <cuda/std/__format/format_spec_parser.h>
 #include <cuda/std/__format/formatter.h>
+#include <cuda/std/__type_traits/is_same.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -59,9 +61,16 @@ struct __fmt_formatter_fp
   template <class _Tp, class _FmtCtx>
   _CCCL_HOST_DEVICE_API typename _FmtCtx::iterator format(_Tp __value, _FmtCtx& __ctx) const
   {
-    _CCCL_ASSERT(false, "formatter</*floating-point-type*/>::format() is not implemented");
-    (void) __value;
-    return __ctx.out();
+    const auto __specs = __parser_.__get_parsed_std_spec(__ctx);
+    if constexpr (is_same_v<_Tp, long double>)
+    {
+      // to_chars supports only the binary32 and binary64 formats.
+      return ::cuda::std::__fmt_format_fp(static_cast<double>(__value), __ctx.out(), __specs);
+    }
+    else
+    {
+      return ::cuda::std::__fmt_format_fp(__value, __ctx.out(), __specs);
+    }
   }
 
   __fmt_spec_parser<_CharT> __parser_; //!< The parser for format specifications.
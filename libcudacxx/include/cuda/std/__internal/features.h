@@ -115,6 +115,32 @@
 #define _CCCL_HAS_SIMD_8BIT() \
   ((_CCCL_HAS_SIMD_8BIT_PTX() || _CCCL_HAS_SIMD_8BIT_INTRINSICS()) && !_CCCL_TILE_COMPILATION())
 
+// Host simd operations use the vector extensions of GCC and clang, which lower to SSE/AVX2/AVX-512 and NEON
+#if (_CCCL_COMPILER(GCC) || _CCCL_COMPILER(CLANG)) && !_CCCL_DEVICE_COMPILATION()   \
+  && (_CCCL_HOST_ARCH(X86_64) || _CCCL_HOST_ARCH(ARM64))                            \
+  && _CCCL_ENDIAN_NATIVE() == _CCCL_ENDIAN_LITTLE() && !defined(CCCL_DISABLE_SIMD_HOST_VECTOR)
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 1
+#else // ^^^ has host vector extensions ^^^ / vvv no host vector extensions vvv
+#  define _CCCL_HAS_SIMD_HOST_VECTOR() 0
+#endif // ^^^ no host vector extensions ^^^
+
+// Width in bytes of the widest host vector register enabled by the compiler flags
+#if defined(__AVX512F__)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 64
+#elif defined(__AVX2__)
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 32
+#else // ^^^ __AVX2__ ^^^ / vvv SSE2 or NEON vvv
+#  define _CCCL_SIMD_HOST_VECTOR_BYTES() 16
+#endif // ^^^ SSE2 or NEON ^^^
+
+// Width in bytes of the native simd ABI. CUDA compilations use the widest GPU memory access, so that host and device
+// code agree on the size of vec<T>
+#if _CCCL_CUDA_COMPILATION() || _CCCL_COMPILER(NVRTC)
+#  define _CCCL_SIMD_NATIVE_BYTES() 16
+#else // ^^^ CUDA compilation ^^^ / vvv host compilation vvv
+#  define _CCCL_SIMD_NATIVE_BYTES() _CCCL_SIMD_HOST_VECTOR_BYTES()
+#endif // ^^^ host compilation ^^^
+
 // Third party libraries
 
 #if (__has_include(<dlpack/dlpack.h>) || __has_include(<dlpack.h>)) && \
@@ -24,10 +24,30 @@
 #include <cuda/std/__cccl/prologue.h>
 
 #define _CCCL_HAS_BACKEND_CUDA() _CCCL_CUDA_COMPILATION() && !_CCCL_COMPILER(NVRTC)
-#define _CCCL_HAS_BACKEND_OMP()  0
-#define _CCCL_HAS_BACKEND_TBB()  0
 
-#define _CCCL_HAS_PSTL_BACKEND() (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+#ifdef _CCCL_DOXYGEN_INVOKED // Only parse this during doxygen passes:
+//! When this macro is defined, the parallel algorithms can run on the host with OpenMP through cuda::execution::omp
+#  define CCCL_ENABLE_OMP_BACKEND
+//! When this macro is defined, the parallel algorithms can run on the host with TBB through cuda::execution::tbb
+#  define CCCL_ENABLE_TBB_BACKEND
+#endif // _CCCL_DOXYGEN_INVOKED
+
+// The host backends are opt-in, because they require the user to link against the respective runtime library. Without
+// OpenMP support in the compiler, the OpenMP backend runs serially.
+#if defined(CCCL_ENABLE_OMP_BACKEND) && _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_OMP() 1
+#else // ^^^ CCCL_ENABLE_OMP_BACKEND ^^^ / vvv !CCCL_ENABLE_OMP_BACKEND vvv
+#  define _CCCL_HAS_BACKEND_OMP() 0
+#endif // !CCCL_ENABLE_OMP_BACKEND
+
+#if defined(CCCL_ENABLE_TBB_BACKEND) && _CCCL_HOSTED() && !_CCCL_COMPILER(NVRTC)
+#  define _CCCL_HAS_BACKEND_TBB() 1
+#else // ^^^ CCCL_ENABLE_TBB_BACKEND ^^^ / vvv !CCCL_ENABLE_TBB_BACKEND vvv
+#  define _CCCL_HAS_BACKEND_TBB() 0
+#endif // !CCCL_ENABLE_TBB_BACKEND
+
+#define _CCCL_HAS_HOST_PSTL_BACKEND() (_CCCL_HAS_BACKEND_OMP() || _CCCL_HAS_BACKEND_TBB())
+#define _CCCL_HAS_PSTL_BACKEND()      (_CCCL_HAS_BACKEND_CUDA() || _CCCL_HAS_HOST_PSTL_BACKEND())
 
 #include <cuda/std/__cccl/epilogue.h>
 
@@ -0,0 +1,485 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_BLAS1_H
+#define _CUDA_STD___LINALG_BLAS1_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__linalg/conjugated.h>
+#include <cuda/std/__linalg/execution.h>
+#include <cuda/std/__linalg/transposed.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__type_traits/is_integral.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/limits>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! Invokes __fn with every multidimensional index of __obj, iterating along the contiguous dimension of the
+//! standard layouts in the innermost loop.
+template <class _Obj, class _Fn>
+_CCCL_API constexpr void __for_each_index(const _Obj& __obj, _Fn __fn)
+{
+  using _Index = typename _Obj::index_type;
+  if constexpr (_Obj::rank() == 1)
+  {
+    for (_Index __i = 0; __i < __obj.extent(0); ++__i)
+    {
+      __fn(__i);
+    }
+  }
+  else if constexpr (is_same_v<typename _Obj::layout_type, layout_left>)
+  {
+    for (_Index __j = 0; __j < __obj.extent(1); ++__j)
+    {
+      for (_Index __i = 0; __i < __obj.extent(0); ++__i)
+      {
+        __fn(__i, __j);
+      }
+    }
+  }
+  else
+  {
+    for (_Index __i = 0; __i < __obj.extent(0); ++__i)
+    {
+      for (_Index __j = 0; __j < __obj.extent(1); ++__j)
+      {
+        __fn(__i, __j);
+      }
+    }
+  }
+}
+
+template <class _Obj1, class _Obj2>
+_CCCL_API constexpr void __check_same_extents(const _Obj1& __x, const _Obj2& __y)
+{
+  static_assert(_Obj1::rank() == _Obj2::rank(), "cuda::std::linalg: the arguments must have the same rank");
+  static_assert(__compatible_static_extents<typename _Obj1::extents_type, 0, typename _Obj2::extents_type, 0>,
+                "cuda::std::linalg: the arguments must have the same extents");
+  _CCCL_ASSERT(static_cast<size_t>(__x.extent(0)) == static_cast<size_t>(__y.extent(0)),
+               "cuda::std::linalg: the arguments must have the same extents");
+  if constexpr (_Obj1::rank() == 2)
+  {
+    static_assert(__compatible_static_extents<typename _Obj1::extents_type, 1, typename _Obj2::extents_type, 1>,
+                  "cuda::std::linalg: the arguments must have the same extents");
+    _CCCL_ASSERT(static_cast<size_t>(__x.extent(1)) == static_cast<size_t>(__y.extent(1)),
+                 "cuda::std::linalg: the arguments must have the same extents");
+  }
+}
+
+//! Computes __init + sum of __v1(__i) * __v2(__i) for __i in [__first, __last) with four independent partial sums,
+//! so that the compiler can vectorize the loop.
+template <class _InVec1, class _InVec2, class _Scalar, class _Index>
+[[nodiscard]] _CCCL_API constexpr _Scalar
+__dot_range(const _InVec1& __v1, const _InVec2& __v2, _Scalar __init, _Index __first, _Index __last)
+{
+  _Scalar __sum[4]{};
+  _Index __i = __first;
+  for (; __i + 4 <= __last; __i += 4)
+  {
+    __sum[0] += __v1(__i) * __v2(__i);
+    __sum[1] += __v1(__i + 1) * __v2(__i + 1);
+    __sum[2] += __v1(__i + 2) * __v2(__i + 2);
+    __sum[3] += __v1(__i + 3) * __v2(__i + 3);
+  }
+  for (; __i < __last; ++__i)
+  {
+    __sum[0] += __v1(__i) * __v2(__i);
+  }
+  return __init + ((__sum[0] + __sum[1]) + (__sum[2] + __sum[3]));
+}
+
+//! The smallest number of elements worth handing to a separate thread in the parallel reductions
+inline constexpr size_t __min_reduction_chunk = 4096;
+//! The largest number of partial results of the parallel reductions
+inline constexpr size_t __max_reduction_chunks = 64;
+
+//! Accumulates the two norm of a sequence of values as __scale_ * sqrt(__ssq_), like LAPACK's xLASSQ, to avoid undue
+//! overflow and underflow.
+template <class _Scalar>
+struct __two_norm_accumulator
+{
+  _Scalar __scale_;
+  _Scalar __ssq_;
+
+  _CCCL_API constexpr explicit __two_norm_accumulator(_Scalar __init)
+      : __scale_{__abs_if_needed(__init)}
+      , __ssq_{(__scale_ == _Scalar{}) ? _Scalar{} : _Scalar{1}}
+  {}
+
+  template <class _Tp>
+  _CCCL_API constexpr void __add_component(const _Tp& __component)
+  {
+    const _Scalar __abs = __abs_if_needed(__component);
+    if (__abs == _Scalar{})
+    {
+      return;
+    }
+    if (__scale_ < __abs)
+    {
+      const _Scalar __ratio = __scale_ / __abs;
+      __ssq_                = _Scalar{1} + __ssq_ * __ratio * __ratio;
+      __scale_              = __abs;
+    }
+    else
+    {
+      const _Scalar __ratio = __abs / __scale_;
+      __ssq_ += __ratio * __ratio;
+    }
+  }
+
+  template <class _Tp>
+  _CCCL_API constexpr void __add(const _Tp& __value)
+  {
+    __add_component(__real_if_needed(__value));
+    __add_component(__imag_if_needed(__value));
+  }
+
+  [[nodiscard]] _CCCL_API constexpr _Scalar __result() const
+  {
+    using ::cuda::std::sqrt;
+    return __scale_ * sqrt(__ssq_);
+  }
+};
+
+template <class _InVec1, class _InVec2>
+using __dot_result_t =
+  decltype(::cuda::std::declval<typename _InVec1::value_type>() * ::cuda::std::declval<typename _InVec2::value_type>());
+
+template <class _InVec1, class _InVec2>
+using __dotc_result_t = decltype(conj_if_needed(::cuda::std::declval<typename _InVec1::value_type>())
+                                 * ::cuda::std::declval<typename _InVec2::value_type>());
+} // namespace __detail
+
+// [linalg.algs.blas1.copy]
+_CCCL_TEMPLATE(class _InObj, class _OutObj)
+_CCCL_REQUIRES(__detail::__in_object<_InObj> _CCCL_AND __detail::__out_object<_OutObj>)
+_CCCL_API constexpr void copy(_InObj __x, _OutObj __y)
+{
+  __detail::__check_same_extents(__x, __y);
+  __detail::__for_each_index(__y, [&](auto... __idx) {
+    __y(__idx...) = __x(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.swap]
+_CCCL_TEMPLATE(class _InOutObj1, class _InOutObj2)
+_CCCL_REQUIRES(__detail::__inout_object<_InOutObj1> _CCCL_AND __detail::__inout_object<_InOutObj2>)
+_CCCL_API constexpr void swap_elements(_InOutObj1 __x, _InOutObj2 __y)
+{
+  __detail::__check_same_extents(__x, __y);
+  __detail::__for_each_index(__x, [&](auto... __idx) {
+    typename _InOutObj1::value_type __tmp = __x(__idx...);
+    __x(__idx...)                         = __y(__idx...);
+    __y(__idx...)                         = __tmp;
+  });
+}
+
+// [linalg.algs.blas1.scal]
+_CCCL_TEMPLATE(class _Scalar, class _InOutObj)
+_CCCL_REQUIRES(__detail::__inout_object<_InOutObj>)
+_CCCL_API constexpr void scale(_Scalar __alpha, _InOutObj __x)
+{
+  __detail::__for_each_index(__x, [&](auto... __idx) {
+    __x(__idx...) = __alpha * __x(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.add]
+_CCCL_TEMPLATE(class _InObj1, class _InObj2, class _OutObj)
+_CCCL_REQUIRES(__detail::__in_object<_InObj1> _CCCL_AND __detail::__in_object<_InObj2> _CCCL_AND
+                 __detail::__out_object<_OutObj>)
+_CCCL_API constexpr void add(_InObj1 __x, _InObj2 __y, _OutObj __z)
+{
+  __detail::__check_same_extents(__x, __z);
+  __detail::__check_same_extents(__y, __z);
+  __detail::__for_each_index(__z, [&](auto... __idx) {
+    __z(__idx...) = __x(__idx...) + __y(__idx...);
+  });
+}
+
+// [linalg.algs.blas1.dot]
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dot(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  __detail::__check_same_extents(__v1, __v2);
+  return __detail::__dot_range(__v1, __v2, __init, typename _InVec1::index_type{0}, __v1.extent(0));
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dot(_InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dot(__v1, __v2, __detail::__dot_result_t<_InVec1, _InVec2>{});
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr _Scalar dotc(_InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  return ::cuda::std::linalg::dot(::cuda::std::linalg::conjugated(__v1), __v2, __init);
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_API constexpr auto dotc(_InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dotc(__v1, __v2, __detail::__dotc_result_t<_InVec1, _InVec2>{});
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API _Scalar
+dot([[maybe_unused]] const _Policy& __policy, _InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  using _Executor = __detail::__linalg_executor<_Policy>;
+  using _Index    = typename _InVec1::index_type;
+
+  __detail::__check_same_extents(__v1, __v2);
+  const size_t __n          = static_cast<size_t>(__v1.extent(0));
+  const size_t __num_chunks = (::cuda::std::min) (
+    (::cuda::std::min) (__n / __detail::__min_reduction_chunk + 1, _Executor::__concurrency()),
+    __detail::__max_reduction_chunks);
+  if (__num_chunks <= 1)
+  {
+    return __detail::__dot_range(__v1, __v2, __init, _Index{0}, __v1.extent(0));
+  }
+
+  _Scalar __partials[__detail::__max_reduction_chunks]{};
+  _Executor::__parallel_for(__num_chunks, [&](ptrdiff_t __chunk) {
+    const auto __first  = static_cast<_Index>(__n * static_cast<size_t>(__chunk) / __num_chunks);
+    const auto __last   = static_cast<_Index>(__n * static_cast<size_t>(__chunk + 1) / __num_chunks);
+    __partials[__chunk] = __detail::__dot_range(__v1, __v2, _Scalar{}, __first, __last);
+  });
+  for (size_t __chunk = 0; __chunk < __num_chunks; ++__chunk)
+  {
+    __init += __partials[__chunk];
+  }
+  return __init;
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API auto dot(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dot(__policy, __v1, __v2, __detail::__dot_result_t<_InVec1, _InVec2>{});
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2, class _Scalar)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API _Scalar dotc(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2, _Scalar __init)
+{
+  return ::cuda::std::linalg::dot(__policy, ::cuda::std::linalg::conjugated(__v1), __v2, __init);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InVec1, class _InVec2)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2>)
+[[nodiscard]] _CCCL_HOST_API auto dotc(const _Policy& __policy, _InVec1 __v1, _InVec2 __v2)
+{
+  return ::cuda::std::linalg::dotc(__policy, __v1, __v2, __detail::__dotc_result_t<_InVec1, _InVec2>{});
+}
+
+#endif // _CCCL_HOSTED()
+
+// [linalg.algs.blas1.nrm2]
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr _Scalar vector_two_norm(_InVec __v, _Scalar __init)
+{
+  if constexpr (is_integral_v<_Scalar>)
+  {
+    using ::cuda::std::sqrt;
+    _Scalar __sum = __init * __init;
+    for (typename _InVec::index_type __i = 0; __i < __v.extent(0); ++__i)
+    {
+      const auto __abs = __detail::__abs_if_needed(__v(__i));
+      __sum += __abs * __abs;
+    }
+    return static_cast<_Scalar>(sqrt(__sum));
+  }
+  else
+  {
+    __detail::__two_norm_accumulator<_Scalar> __acc{__init};
+    for (typename _InVec::index_type __i = 0; __i < __v.extent(0); ++__i)
+    {
+      __acc.__add(__v(__i));
+    }
+    return __acc.__result();
+  }
+}
+
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr auto vector_two_norm(_InVec __v)
+{
+  using _Scalar = decltype(__detail::__abs_if_needed(::cuda::std::declval<typename _InVec::value_type>()));
+  return ::cuda::std::linalg::vector_two_norm(__v, _Scalar{});
+}
+
+// [linalg.algs.blas1.asum]
+_CCCL_TEMPLATE(class _InVec, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr _Scalar vector_abs_sum(_InVec __v, _Scalar __init)
+{
+  for (typename _InVec::index_type __i = 0; __i < __v.extent(0); ++__i)
+  {
+    __init += __detail::__abs_sum_magnitude(__v(__i));
+  }
+  return __init;
+}
+
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr typename _InVec::value_type vector_abs_sum(_InVec __v)
+{
+  return ::cuda::std::linalg::vector_abs_sum(__v, typename _InVec::value_type{});
+}
+
+// [linalg.algs.blas1.iamax]
+_CCCL_TEMPLATE(class _InVec)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec>)
+[[nodiscard]] _CCCL_API constexpr typename _InVec::extents_type::index_type vector_idx_abs_max(_InVec __v)
+{
+  using _Index = typename _InVec::extents_type::index_type;
+  if (__v.extent(0) == 0)
+  {
+    return numeric_limits<_Index>::max();
+  }
+
+  _Index __max_idx = 0;
+  auto __max_val   = __detail::__abs_sum_magnitude(__v(0));
+  for (_Index __i = 1; __i < __v.extent(0); ++__i)
+  {
+    const auto __val = __detail::__abs_sum_magnitude(__v(__i));
+    if (__max_val < __val)
+    {
+      __max_idx = __i;
+      __max_val = __val;
+    }
+  }
+  return __max_idx;
+}
+
+// [linalg.algs.blas1.matfrobnorm]
+_CCCL_TEMPLATE(class _InMat, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr _Scalar matrix_frob_norm(_InMat __a, _Scalar __init)
+{
+  if constexpr (is_integral_v<_Scalar>)
+  {
+    using ::cuda::std::sqrt;
+    _Scalar __sum = __init * __init;
+    __detail::__for_each_index(__a, [&](auto... __idx) {
+      const auto __abs = __detail::__abs_if_needed(__a(__idx...));
+      __sum += __abs * __abs;
+    });
+    return static_cast<_Scalar>(sqrt(__sum));
+  }
+  else
+  {
+    __detail::__two_norm_accumulator<_Scalar> __acc{__init};
+    __detail::__for_each_index(__a, [&](auto... __idx) {
+      __acc.__add(__a(__idx...));
+    });
+    return __acc.__result();
+  }
+}
+
+_CCCL_TEMPLATE(class _InMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr auto matrix_frob_norm(_InMat __a)
+{
+  using _Scalar = decltype(__detail::__abs_if_needed(::cuda::std::declval<typename _InMat::value_type>()));
+  return ::cuda::std::linalg::matrix_frob_norm(__a, _Scalar{});
+}
+
+// [linalg.algs.blas1.matonenorm]
+_CCCL_TEMPLATE(class _InMat, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr _Scalar matrix_one_norm(_InMat __a, _Scalar __init)
+{
+  using _Index = typename _InMat::index_type;
+  if (__a.extent(0) == 0 || __a.extent(1) == 0)
+  {
+    return __init;
+  }
+
+  _Scalar __max{};
+  for (_Index __j = 0; __j < __a.extent(1); ++__j)
+  {
+    _Scalar __sum{};
+    for (_Index __i = 0; __i < __a.extent(0); ++__i)
+    {
+      __sum += __detail::__abs_if_needed(__a(__i, __j));
+    }
+    __max = (__j == 0 || __max < __sum) ? __sum : __max;
+  }
+  return __init + __max;
+}
+
+_CCCL_TEMPLATE(class _InMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr auto matrix_one_norm(_InMat __a)
+{
+  using _Scalar = decltype(__detail::__abs_if_needed(::cuda::std::declval<typename _InMat::value_type>()));
+  return ::cuda::std::linalg::matrix_one_norm(__a, _Scalar{});
+}
+
+// [linalg.algs.blas1.matinfnorm]
+_CCCL_TEMPLATE(class _InMat, class _Scalar)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr _Scalar matrix_inf_norm(_InMat __a, _Scalar __init)
+{
+  return ::cuda::std::linalg::matrix_one_norm(::cuda::std::linalg::transposed(__a), __init);
+}
+
+_CCCL_TEMPLATE(class _InMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat>)
+[[nodiscard]] _CCCL_API constexpr auto matrix_inf_norm(_InMat __a)
+{
+  using _Scalar = decltype(__detail::__abs_if_needed(::cuda::std::declval<typename _InMat::value_type>()));
+  return ::cuda::std::linalg::matrix_inf_norm(__a, _Scalar{});
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_BLAS1_H
@@ -0,0 +1,427 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_BLAS2_H
+#define _CUDA_STD___LINALG_BLAS2_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/blas1.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/conj_if_needed.h>
+#include <cuda/std/__linalg/execution.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! Returns whether the elements of a row of __a are closer in memory than the elements of a column.
+template <class _InMat>
+[[nodiscard]] _CCCL_API constexpr bool __prefers_row_access(const _InMat& __a) noexcept
+{
+  if constexpr (is_same_v<typename _InMat::layout_type, layout_right>)
+  {
+    return true;
+  }
+  else if constexpr (is_same_v<typename _InMat::layout_type, layout_left>)
+  {
+    return false;
+  }
+  else if constexpr (_InMat::is_always_strided())
+  {
+    return __a.stride(1) <= __a.stride(0);
+  }
+  else
+  {
+    return true;
+  }
+}
+
+template <class _InMat, class _InVec, class _OutVec>
+_CCCL_API constexpr void __check_matrix_vector_extents(const _InMat& __a, const _InVec& __x, const _OutVec& __y)
+{
+  static_assert(__compatible_static_extents<typename _InMat::extents_type, 1, typename _InVec::extents_type, 0>,
+                "cuda::std::linalg: the number of columns of A must match the extent of x");
+  static_assert(__compatible_static_extents<typename _InMat::extents_type, 0, typename _OutVec::extents_type, 0>,
+                "cuda::std::linalg: the number of rows of A must match the extent of y");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__x.extent(0)),
+               "cuda::std::linalg: the number of columns of A must match the extent of x");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__y.extent(0)),
+               "cuda::std::linalg: the number of rows of A must match the extent of y");
+}
+
+//! Number of rows or columns of A that the matrix-vector kernels process at once
+inline constexpr int __gemv_tile = 4;
+
+//! Computes __y(__i) = __z(__i) + (A x)(__i) for __i in [__first, __last), or without __z if _Update is false.
+//!
+//! Matrices stored by rows take four dot products at once, sharing the loads of x. Matrices stored by columns
+//! accumulate four columns at once into y, which is read and written once per four columns.
+template <bool _Update, class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_API constexpr void __matrix_vector_product_rows(
+  const _InMat& __a,
+  const _InVec1& __x,
+  const _InVec2& __z,
+  const _OutVec& __y,
+  typename _OutVec::index_type __first,
+  typename _OutVec::index_type __last)
+{
+  using _Index = typename _OutVec::index_type;
+  using _Acc   = typename _OutVec::value_type;
+  const auto __n = static_cast<_Index>(__a.extent(1));
+
+  auto __init = [&](_Index __i) {
+    if constexpr (_Update)
+    {
+      return static_cast<_Acc>(__z(__i));
+    }
+    else
+    {
+      return _Acc{};
+    }
+  };
+
+  if (__prefers_row_access(__a))
+  {
+    _Index __i = __first;
+    for (; __i + __gemv_tile <= __last; __i += __gemv_tile)
+    {
+      _Acc __acc[__gemv_tile]{};
+      for (_Index __j = 0; __j < __n; ++__j)
+      {
+        const _Acc __xj = __x(__j);
+        for (int __r = 0; __r < __gemv_tile; ++__r)
+        {
+          __acc[__r] += __a(__i + __r, __j) * __xj;
+        }
+      }
+      for (int __r = 0; __r < __gemv_tile; ++__r)
+      {
+        __y(__i + __r) = __init(__i + __r) + __acc[__r];
+      }
+    }
+    for (; __i < __last; ++__i)
+    {
+      _Acc __acc{};
+      for (_Index __j = 0; __j < __n; ++__j)
+      {
+        __acc += __a(__i, __j) * __x(__j);
+      }
+      __y(__i) = __init(__i) + __acc;
+    }
+  }
+  else
+  {
+    for (_Index __i = __first; __i < __last; ++__i)
+    {
+      __y(__i) = __init(__i);
+    }
+    _Index __j = 0;
+    for (; __j + __gemv_tile <= __n; __j += __gemv_tile)
+    {
+      _Acc __xj[__gemv_tile]{};
+      for (int __c = 0; __c < __gemv_tile; ++__c)
+      {
+        __xj[__c] = __x(__j + __c);
+      }
+      for (_Index __i = __first; __i < __last; ++__i)
+      {
+        _Acc __acc = __y(__i);
+        for (int __c = 0; __c < __gemv_tile; ++__c)
+        {
+          __acc += __a(__i, __j + __c) * __xj[__c];
+        }
+        __y(__i) = __acc;
+      }
+    }
+    for (; __j < __n; ++__j)
+    {
+      const _Acc __xj = __x(__j);
+      for (_Index __i = __first; __i < __last; ++__i)
+      {
+        __y(__i) += __a(__i, __j) * __xj;
+      }
+    }
+  }
+}
+
+//! The smallest number of multiply-adds worth handing to a separate thread
+inline constexpr size_t __min_parallel_work = size_t{1} << 16;
+
+#if _CCCL_HOSTED()
+
+template <bool _Update, class _Policy, class _InMat, class _InVec1, class _InVec2, class _OutVec>
+_CCCL_HOST_API void
+__matrix_vector_product_parallel(const _InMat& __a, const _InVec1& __x, const _InVec2& __z, const _OutVec& __y)
+{
+  using _Executor = __linalg_executor<_Policy>;
+  using _Index    = typename _OutVec::index_type;
+
+  const size_t __m    = static_cast<size_t>(__a.extent(0));
+  const size_t __work = __m * static_cast<size_t>(__a.extent(1));
+  // Every chunk holds a multiple of __gemv_tile rows, so that only the last one has a partial tile
+  const size_t __max_chunks = (__m + __gemv_tile - 1) / __gemv_tile;
+  const size_t __num_chunks =
+    (::cuda::std::min) ((::cuda::std::min) (__work / __min_parallel_work + 1, _Executor::__concurrency()),
+                        __max_chunks);
+
+  if (__num_chunks <= 1)
+  {
+    __matrix_vector_product_rows<_Update>(__a, __x, __z, __y, _Index{0}, static_cast<_Index>(__m));
+    return;
+  }
+
+  const size_t __tiles_per_chunk = (__max_chunks + __num_chunks - 1) / __num_chunks;
+  const size_t __rows_per_chunk  = __tiles_per_chunk * __gemv_tile;
+  _Executor::__parallel_for((__m + __rows_per_chunk - 1) / __rows_per_chunk, [&](ptrdiff_t __chunk) {
+    const size_t __first = static_cast<size_t>(__chunk) * __rows_per_chunk;
+    const size_t __last  = (::cuda::std::min) (__first + __rows_per_chunk, __m);
+    __matrix_vector_product_rows<_Update>(
+      __a, __x, __z, __y, static_cast<_Index>(__first), static_cast<_Index>(__last));
+  });
+}
+
+#endif // _CCCL_HOSTED()
+
+//! Computes __y = A __y in place for a triangular A.
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec>
+_CCCL_API constexpr void __triangular_matrix_vector_product_in_place(const _InMat& __a, const _InOutVec& __y)
+{
+  using _Index                    = typename _InOutVec::index_type;
+  using _Acc                      = typename _InOutVec::value_type;
+  constexpr bool __explicit_diag  = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+  const auto __n                  = static_cast<_Index>(__y.extent(0));
+
+  // Every element of y only depends on the elements that are overwritten after it.
+  if constexpr (is_same_v<_Triangle, upper_triangle_t>)
+  {
+    for (_Index __i = 0; __i < __n; ++__i)
+    {
+      _Acc __acc = __explicit_diag ? _Acc(__a(__i, __i) * __y(__i)) : _Acc(__y(__i));
+      for (_Index __j = __i + 1; __j < __n; ++__j)
+      {
+        __acc += __a(__i, __j) * __y(__j);
+      }
+      __y(__i) = __acc;
+    }
+  }
+  else
+  {
+    for (_Index __i = __n; __i-- > 0;)
+    {
+      _Acc __acc = __explicit_diag ? _Acc(__a(__i, __i) * __y(__i)) : _Acc(__y(__i));
+      for (_Index __j = 0; __j < __i; ++__j)
+      {
+        __acc += __a(__i, __j) * __y(__j);
+      }
+      __y(__i) = __acc;
+    }
+  }
+}
+
+//! Solves A x = __b in place for a triangular A.
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec>
+_CCCL_API constexpr void __triangular_matrix_vector_solve_in_place(const _InMat& __a, const _InOutVec& __b)
+{
+  using _Index                   = typename _InOutVec::index_type;
+  using _Acc                     = typename _InOutVec::value_type;
+  constexpr bool __explicit_diag = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+  constexpr bool __upper         = is_same_v<_Triangle, upper_triangle_t>;
+  const auto __n                 = static_cast<_Index>(__b.extent(0));
+
+  if (__prefers_row_access(__a))
+  {
+    // Substitution by rows: every element is the dot product of a row of A with the elements solved before it.
+    for (_Index __k = 0; __k < __n; ++__k)
+    {
+      const _Index __i   = __upper ? __n - 1 - __k : __k;
+      const _Index __beg = __upper ? __i + 1 : 0;
+      const _Index __end = __upper ? __n : __i;
+      _Acc __acc         = __b(__i);
+      for (_Index __j = __beg; __j < __end; ++__j)
+      {
+        __acc -= __a(__i, __j) * __b(__j);
+      }
+      if constexpr (__explicit_diag)
+      {
+        __acc = __acc / __a(__i, __i);
+      }
+      __b(__i) = __acc;
+    }
+  }
+  else
+  {
+    // Substitution by columns: every solved element is eliminated from the remaining ones.
+    for (_Index __k = 0; __k < __n; ++__k)
+    {
+      const _Index __j = __upper ? __n - 1 - __k : __k;
+      if constexpr (__explicit_diag)
+      {
+        __b(__j) = __b(__j) / __a(__j, __j);
+      }
+      const _Acc __bj    = __b(__j);
+      const _Index __beg = __upper ? 0 : __j + 1;
+      const _Index __end = __upper ? __j : __n;
+      for (_Index __i = __beg; __i < __end; ++__i)
+      {
+        __b(__i) -= __a(__i, __j) * __bj;
+      }
+    }
+  }
+}
+
+template <class _InMat, class _Triangle, class _DiagonalStorage>
+_CCCL_API constexpr void __check_triangular(const _InMat& __a)
+{
+  static_assert(__is_triangle_v<_Triangle>, "cuda::std::linalg: Triangle must be upper_triangle_t or lower_triangle_t");
+  static_assert(__is_diagonal_v<_DiagonalStorage>,
+                "cuda::std::linalg: DiagonalStorage must be implicit_unit_diagonal_t or explicit_diagonal_t");
+  static_assert(__compatible_static_extents<typename _InMat::extents_type, 0, typename _InMat::extents_type, 1>,
+                "cuda::std::linalg: A must be square");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__a.extent(1)),
+               "cuda::std::linalg: A must be square");
+}
+} // namespace __detail
+
+// [linalg.algs.blas2.gemv]
+_CCCL_TEMPLATE(class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec> _CCCL_AND
+                 __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __a, _InVec __x, _OutVec __y)
+{
+  using _Index = typename _OutVec::index_type;
+  __detail::__check_matrix_vector_extents(__a, __x, __y);
+  __detail::__matrix_vector_product_rows<false>(__a, __x, __y, __y, _Index{0}, static_cast<_Index>(__y.extent(0)));
+}
+
+_CCCL_TEMPLATE(class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec1> _CCCL_AND
+                 __detail::__in_vector<_InVec2> _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void matrix_vector_product(_InMat __a, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  using _Index = typename _OutVec::index_type;
+  __detail::__check_matrix_vector_extents(__a, __x, __z);
+  __detail::__check_same_extents(__y, __z);
+  __detail::__matrix_vector_product_rows<true>(__a, __x, __y, __z, _Index{0}, static_cast<_Index>(__z.extent(0)));
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _InVec, class _OutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__in_vector<_InVec> _CCCL_AND __detail::__out_vector<_OutVec>)
+_CCCL_HOST_API void matrix_vector_product([[maybe_unused]] const _Policy& __policy, _InMat __a, _InVec __x, _OutVec __y)
+{
+  __detail::__check_matrix_vector_extents(__a, __x, __y);
+  __detail::__matrix_vector_product_parallel<false, _Policy>(__a, __x, __y, __y);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _InVec1, class _InVec2, class _OutVec)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2> _CCCL_AND
+                   __detail::__out_vector<_OutVec>)
+_CCCL_HOST_API void
+matrix_vector_product([[maybe_unused]] const _Policy& __policy, _InMat __a, _InVec1 __x, _InVec2 __y, _OutVec __z)
+{
+  __detail::__check_matrix_vector_extents(__a, __x, __z);
+  __detail::__check_same_extents(__y, __z);
+  __detail::__matrix_vector_product_parallel<true, _Policy>(__a, __x, __y, __z);
+}
+
+#endif // _CCCL_HOSTED()
+
+// [linalg.algs.blas2.trmv]
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec> _CCCL_AND
+                 __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void
+triangular_matrix_vector_product(_InMat __a, _Triangle, _DiagonalStorage, _InVec __x, _OutVec __y)
+{
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_matrix_vector_extents(__a, __x, __y);
+  ::cuda::std::linalg::copy(__x, __y);
+  __detail::__triangular_matrix_vector_product_in_place<_InMat, _Triangle, _DiagonalStorage>(__a, __y);
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_vector<_InOutVec>)
+_CCCL_API constexpr void triangular_matrix_vector_product(_InMat __a, _Triangle, _DiagonalStorage, _InOutVec __y)
+{
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_matrix_vector_extents(__a, __y, __y);
+  __detail::__triangular_matrix_vector_product_in_place<_InMat, _Triangle, _DiagonalStorage>(__a, __y);
+}
+
+// [linalg.algs.blas2.trsv]
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InVec, class _OutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_vector<_InVec> _CCCL_AND
+                 __detail::__out_vector<_OutVec>)
+_CCCL_API constexpr void
+triangular_matrix_vector_solve(_InMat __a, _Triangle, _DiagonalStorage, _InVec __b, _OutVec __x)
+{
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_matrix_vector_extents(__a, __b, __x);
+  ::cuda::std::linalg::copy(__b, __x);
+  __detail::__triangular_matrix_vector_solve_in_place<_InMat, _Triangle, _DiagonalStorage>(__a, __x);
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutVec)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_vector<_InOutVec>)
+_CCCL_API constexpr void triangular_matrix_vector_solve(_InMat __a, _Triangle, _DiagonalStorage, _InOutVec __b)
+{
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_matrix_vector_extents(__a, __b, __b);
+  __detail::__triangular_matrix_vector_solve_in_place<_InMat, _Triangle, _DiagonalStorage>(__a, __b);
+}
+
+// [linalg.algs.blas2.rank1]
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2> _CCCL_AND
+                 __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void matrix_rank_1_update(_InVec1 __x, _InVec2 __y, _InOutMat __a)
+{
+  __detail::__check_matrix_vector_extents(__a, __y, __x);
+  __detail::__for_each_index(__a, [&](auto __i, auto __j) {
+    __a(__i, __j) += __x(__i) * __y(__j);
+  });
+}
+
+_CCCL_TEMPLATE(class _InVec1, class _InVec2, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_vector<_InVec1> _CCCL_AND __detail::__in_vector<_InVec2> _CCCL_AND
+                 __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void matrix_rank_1_update_c(_InVec1 __x, _InVec2 __y, _InOutMat __a)
+{
+  ::cuda::std::linalg::matrix_rank_1_update(__x, ::cuda::std::linalg::conjugated(__y), __a);
+}
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_BLAS2_H
@@ -0,0 +1,513 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_BLAS3_H
+#define _CUDA_STD___LINALG_BLAS3_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/blas1.h>
+#include <cuda/std/__linalg/blas2.h>
+#include <cuda/std/__linalg/concepts.h>
+#include <cuda/std/__linalg/execution.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__linalg/transposed.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_execution_policy.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+// Blocking of the matrix product: C is split into __gemm_mc x __gemm_nc tiles, which are independent tasks. Every
+// tile accumulates the product over slices of __gemm_kc columns of A, so that the rows of the slice of B stay in
+// cache, in register tiles of __gemm_mr x __gemm_nr elements of C.
+inline constexpr int __gemm_mr = 4;
+inline constexpr int __gemm_nr = 4;
+inline constexpr int __gemm_kc = 256;
+inline constexpr int __gemm_mc = 64;
+inline constexpr int __gemm_nc = 128;
+
+template <class _InMat1, class _InMat2, class _OutMat>
+_CCCL_API constexpr void __check_matrix_product_extents(const _InMat1& __a, const _InMat2& __b, const _OutMat& __c)
+{
+  static_assert(__compatible_static_extents<typename _InMat1::extents_type, 1, typename _InMat2::extents_type, 0>,
+                "cuda::std::linalg: the number of columns of A must match the number of rows of B");
+  static_assert(__compatible_static_extents<typename _InMat1::extents_type, 0, typename _OutMat::extents_type, 0>,
+                "cuda::std::linalg: the number of rows of A must match the number of rows of C");
+  static_assert(__compatible_static_extents<typename _InMat2::extents_type, 1, typename _OutMat::extents_type, 1>,
+                "cuda::std::linalg: the number of columns of B must match the number of columns of C");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__b.extent(0)),
+               "cuda::std::linalg: the number of columns of A must match the number of rows of B");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(0)) == static_cast<size_t>(__c.extent(0)),
+               "cuda::std::linalg: the number of rows of A must match the number of rows of C");
+  _CCCL_ASSERT(static_cast<size_t>(__b.extent(1)) == static_cast<size_t>(__c.extent(1)),
+               "cuda::std::linalg: the number of columns of B must match the number of columns of C");
+}
+
+//! Computes the __gemm_mr x __gemm_nr register tile of C at (__i, __j) over the columns [__k0, __k1) of A.
+//! The slice starting at column 0 overwrites C with __e + A B, or with A B if _Update is false, and the following
+//! slices accumulate into C.
+template <bool _Update, class _InMat1, class _InMat2, class _InMat3, class _OutMat, class _Index>
+_CCCL_API constexpr void __matrix_product_register_tile(
+  const _InMat1& __a,
+  const _InMat2& __b,
+  const _InMat3& __e,
+  const _OutMat& __c,
+  _Index __i,
+  _Index __j,
+  _Index __k0,
+  _Index __k1)
+{
+  using _Acc = typename _OutMat::value_type;
+
+  _Acc __acc[__gemm_mr][__gemm_nr]{};
+  for (_Index __k = __k0; __k < __k1; ++__k)
+  {
+    _Acc __ak[__gemm_mr]{};
+    _Acc __bk[__gemm_nr]{};
+    for (int __r = 0; __r < __gemm_mr; ++__r)
+    {
+      __ak[__r] = __a(__i + __r, __k);
+    }
+    for (int __s = 0; __s < __gemm_nr; ++__s)
+    {
+      __bk[__s] = __b(__k, __j + __s);
+    }
+    for (int __r = 0; __r < __gemm_mr; ++__r)
+    {
+      for (int __s = 0; __s < __gemm_nr; ++__s)
+      {
+        __acc[__r][__s] += __ak[__r] * __bk[__s];
+      }
+    }
+  }
+
+  for (int __r = 0; __r < __gemm_mr; ++__r)
+  {
+    for (int __s = 0; __s < __gemm_nr; ++__s)
+    {
+      if (__k0 != 0)
+      {
+        __c(__i + __r, __j + __s) += __acc[__r][__s];
+      }
+      else if constexpr (_Update)
+      {
+        __c(__i + __r, __j + __s) = __e(__i + __r, __j + __s) + __acc[__r][__s];
+      }
+      else
+      {
+        __c(__i + __r, __j + __s) = __acc[__r][__s];
+      }
+    }
+  }
+}
+
+//! Computes a partial register tile at the bottom or right border of C, like __matrix_product_register_tile.
+template <bool _Update, class _InMat1, class _InMat2, class _InMat3, class _OutMat, class _Index>
+_CCCL_API constexpr void __matrix_product_border_tile(
+  const _InMat1& __a,
+  const _InMat2& __b,
+  const _InMat3& __e,
+  const _OutMat& __c,
+  _Index __i0,
+  _Index __i1,
+  _Index __j0,
+  _Index __j1,
+  _Index __k0,
+  _Index __k1)
+{
+  using _Acc = typename _OutMat::value_type;
+
+  for (_Index __i = __i0; __i < __i1; ++__i)
+  {
+    for (_Index __j = __j0; __j < __j1; ++__j)
+    {
+      _Acc __acc{};
+      for (_Index __k = __k0; __k < __k1; ++__k)
+      {
+        __acc += __a(__i, __k) * __b(__k, __j);
+      }
+      if (__k0 != 0)
+      {
+        __c(__i, __j) += __acc;
+      }
+      else if constexpr (_Update)
+      {
+        __c(__i, __j) = __e(__i, __j) + __acc;
+      }
+      else
+      {
+        __c(__i, __j) = __acc;
+      }
+    }
+  }
+}
+
+//! Computes the elements [__i0, __i1) x [__j0, __j1) of C = E + A B, or of C = A B if _Update is false.
+template <bool _Update, class _InMat1, class _InMat2, class _InMat3, class _OutMat, class _Index>
+_CCCL_API constexpr void __matrix_product_tile(
+  const _InMat1& __a,
+  const _InMat2& __b,
+  const _InMat3& __e,
+  const _OutMat& __c,
+  _Index __i0,
+  _Index __i1,
+  _Index __j0,
+  _Index __j1)
+{
+  const auto __k = static_cast<_Index>(__a.extent(1));
+  if (__k == 0)
+  {
+    __matrix_product_border_tile<_Update>(__a, __b, __e, __c, __i0, __i1, __j0, __j1, _Index{0}, _Index{0});
+    return;
+  }
+
+  const _Index __i_full = __i0 + (__i1 - __i0) / __gemm_mr * __gemm_mr;
+  const _Index __j_full = __j0 + (__j1 - __j0) / __gemm_nr * __gemm_nr;
+  for (_Index __k0 = 0; __k0 < __k; __k0 += __gemm_kc)
+  {
+    const _Index __k1 = (::cuda::std::min) (static_cast<_Index>(__k0 + __gemm_kc), __k);
+    for (_Index __j = __j0; __j < __j_full; __j += __gemm_nr)
+    {
+      for (_Index __i = __i0; __i < __i_full; __i += __gemm_mr)
+      {
+        __matrix_product_register_tile<_Update>(__a, __b, __e, __c, __i, __j, __k0, __k1);
+      }
+    }
+    __matrix_product_border_tile<_Update>(__a, __b, __e, __c, __i_full, __i1, __j0, __j1, __k0, __k1);
+    __matrix_product_border_tile<_Update>(__a, __b, __e, __c, __i0, __i_full, __j_full, __j1, __k0, __k1);
+  }
+}
+
+template <bool _Update, class _InMat1, class _InMat2, class _InMat3, class _OutMat>
+_CCCL_API constexpr void
+__matrix_product(const _InMat1& __a, const _InMat2& __b, const _InMat3& __e, const _OutMat& __c)
+{
+  using _Index   = typename _OutMat::index_type;
+  const auto __m = static_cast<_Index>(__c.extent(0));
+  const auto __n = static_cast<_Index>(__c.extent(1));
+  for (_Index __j0 = 0; __j0 < __n; __j0 += __gemm_nc)
+  {
+    const _Index __j1 = (::cuda::std::min) (static_cast<_Index>(__j0 + __gemm_nc), __n);
+    for (_Index __i0 = 0; __i0 < __m; __i0 += __gemm_mc)
+    {
+      const _Index __i1 = (::cuda::std::min) (static_cast<_Index>(__i0 + __gemm_mc), __m);
+      __matrix_product_tile<_Update>(__a, __b, __e, __c, __i0, __i1, __j0, __j1);
+    }
+  }
+}
+
+#if _CCCL_HOSTED()
+
+template <bool _Update, class _Policy, class _InMat1, class _InMat2, class _InMat3, class _OutMat>
+_CCCL_HOST_API void
+__matrix_product_parallel(const _InMat1& __a, const _InMat2& __b, const _InMat3& __e, const _OutMat& __c)
+{
+  using _Executor = __linalg_executor<_Policy>;
+  using _Index    = typename _OutMat::index_type;
+
+  const size_t __m    = static_cast<size_t>(__c.extent(0));
+  const size_t __n    = static_cast<size_t>(__c.extent(1));
+  const size_t __work = __m * __n * static_cast<size_t>(__a.extent(1));
+  if (__work < __min_parallel_work || _Executor::__concurrency() <= 1)
+  {
+    __matrix_product<_Update>(__a, __b, __e, __c);
+    return;
+  }
+
+  const size_t __row_tiles = (__m + __gemm_mc - 1) / __gemm_mc;
+  const size_t __col_tiles = (__n + __gemm_nc - 1) / __gemm_nc;
+  _Executor::__parallel_for(__row_tiles * __col_tiles, [&](ptrdiff_t __tile) {
+    const size_t __i0 = static_cast<size_t>(__tile) % __row_tiles * __gemm_mc;
+    const size_t __j0 = static_cast<size_t>(__tile) / __row_tiles * __gemm_nc;
+    __matrix_product_tile<_Update>(
+      __a,
+      __b,
+      __e,
+      __c,
+      static_cast<_Index>(__i0),
+      static_cast<_Index>((::cuda::std::min) (__i0 + __gemm_mc, __m)),
+      static_cast<_Index>(__j0),
+      static_cast<_Index>((::cuda::std::min) (__j0 + __gemm_nc, __n)));
+  });
+}
+
+#endif // _CCCL_HOSTED()
+
+//! Number of columns of B that the triangular solve processes at once
+inline constexpr int __trsm_nr = 4;
+
+//! Solves A X = B in place for a triangular A and the columns [__j0, __j0 + _Cols) of B.
+template <int _Cols, class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat, class _Index>
+_CCCL_API constexpr void __triangular_left_solve_columns(const _InMat& __a, const _InOutMat& __b, _Index __j0)
+{
+  using _Acc                     = typename _InOutMat::value_type;
+  constexpr bool __explicit_diag = is_same_v<_DiagonalStorage, explicit_diagonal_t>;
+  constexpr bool __upper         = is_same_v<_Triangle, upper_triangle_t>;
+  const auto __n                 = static_cast<_Index>(__a.extent(0));
+
+  for (_Index __k = 0; __k < __n; ++__k)
+  {
+    const _Index __i   = __upper ? __n - 1 - __k : __k;
+    const _Index __beg = __upper ? __i + 1 : 0;
+    const _Index __end = __upper ? __n : __i;
+
+    _Acc __acc[_Cols]{};
+    for (int __s = 0; __s < _Cols; ++__s)
+    {
+      __acc[__s] = __b(__i, __j0 + __s);
+    }
+    for (_Index __l = __beg; __l < __end; ++__l)
+    {
+      const _Acc __ail = __a(__i, __l);
+      for (int __s = 0; __s < _Cols; ++__s)
+      {
+        __acc[__s] -= __ail * __b(__l, __j0 + __s);
+      }
+    }
+    for (int __s = 0; __s < _Cols; ++__s)
+    {
+      if constexpr (__explicit_diag)
+      {
+        __acc[__s] = __acc[__s] / __a(__i, __i);
+      }
+      __b(__i, __j0 + __s) = __acc[__s];
+    }
+  }
+}
+
+//! Solves A X = B in place for a triangular A and the columns [__j0, __j1) of B.
+template <class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat, class _Index>
+_CCCL_API constexpr void
+__triangular_left_solve_in_place(const _InMat& __a, const _InOutMat& __b, _Index __j0, _Index __j1)
+{
+  _Index __j = __j0;
+  for (; __j + __trsm_nr <= __j1; __j += __trsm_nr)
+  {
+    __triangular_left_solve_columns<__trsm_nr, _InMat, _Triangle, _DiagonalStorage>(__a, __b, __j);
+  }
+  for (; __j < __j1; ++__j)
+  {
+    __triangular_left_solve_columns<1, _InMat, _Triangle, _DiagonalStorage>(__a, __b, __j);
+  }
+}
+
+//! The triangle of A^T is the opposite one of A.
+template <class _Triangle>
+using __transpose_triangle_t =
+  conditional_t<is_same_v<_Triangle, upper_triangle_t>, lower_triangle_t, upper_triangle_t>;
+
+template <class _InMat, class _InOutMat>
+_CCCL_API constexpr void __check_left_solve_extents(const _InMat& __a, const _InOutMat& __b)
+{
+  static_assert(__compatible_static_extents<typename _InMat::extents_type, 1, typename _InOutMat::extents_type, 0>,
+                "cuda::std::linalg: the number of columns of A must match the number of rows of B");
+  _CCCL_ASSERT(static_cast<size_t>(__a.extent(1)) == static_cast<size_t>(__b.extent(0)),
+               "cuda::std::linalg: the number of columns of A must match the number of rows of B");
+}
+
+#if _CCCL_HOSTED()
+
+template <class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat>
+_CCCL_HOST_API void __triangular_left_solve_parallel(const _InMat& __a, const _InOutMat& __b)
+{
+  using _Executor = __linalg_executor<_Policy>;
+  using _Index    = typename _InOutMat::index_type;
+
+  const size_t __n    = static_cast<size_t>(__b.extent(1));
+  const size_t __m    = static_cast<size_t>(__a.extent(0));
+  const size_t __work = __m * __m / 2 * __n;
+  // Every chunk holds a multiple of __trsm_nr columns, so that only the last one has a partial tile
+  const size_t __max_chunks = (__n + __trsm_nr - 1) / __trsm_nr;
+  const size_t __num_chunks =
+    (::cuda::std::min) ((::cuda::std::min) (__work / __min_parallel_work + 1, _Executor::__concurrency()),
+                        __max_chunks);
+
+  if (__num_chunks <= 1)
+  {
+    __triangular_left_solve_in_place<_InMat, _Triangle, _DiagonalStorage>(
+      __a, __b, _Index{0}, static_cast<_Index>(__n));
+    return;
+  }
+
+  const size_t __cols_per_chunk = (__max_chunks + __num_chunks - 1) / __num_chunks * __trsm_nr;
+  _Executor::__parallel_for((__n + __cols_per_chunk - 1) / __cols_per_chunk, [&](ptrdiff_t __chunk) {
+    const size_t __j0 = static_cast<size_t>(__chunk) * __cols_per_chunk;
+    const size_t __j1 = (::cuda::std::min) (__j0 + __cols_per_chunk, __n);
+    __triangular_left_solve_in_place<_InMat, _Triangle, _DiagonalStorage>(
+      __a, __b, static_cast<_Index>(__j0), static_cast<_Index>(__j1));
+  });
+}
+
+#endif // _CCCL_HOSTED()
+} // namespace __detail
+
+// [linalg.algs.blas3.gemm]
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __a, _InMat2 __b, _OutMat __c)
+{
+  __detail::__check_matrix_product_extents(__a, __b, __c);
+  __detail::__matrix_product<false>(__a, __b, __c, __c);
+}
+
+_CCCL_TEMPLATE(class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat1> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__in_matrix<_InMat3> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void matrix_product(_InMat1 __a, _InMat2 __b, _InMat3 __e, _OutMat __c)
+{
+  __detail::__check_matrix_product_extents(__a, __b, __c);
+  __detail::__check_same_extents(__e, __c);
+  __detail::__matrix_product<true>(__a, __b, __e, __c);
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InMat1, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat1> _CCCL_AND
+                 __detail::__in_matrix<_InMat2> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_HOST_API void matrix_product([[maybe_unused]] const _Policy& __policy, _InMat1 __a, _InMat2 __b, _OutMat __c)
+{
+  __detail::__check_matrix_product_extents(__a, __b, __c);
+  __detail::__matrix_product_parallel<false, _Policy>(__a, __b, __c, __c);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat1, class _InMat2, class _InMat3, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat1> _CCCL_AND
+                 __detail::__in_matrix<_InMat2> _CCCL_AND __detail::__in_matrix<_InMat3> _CCCL_AND
+                   __detail::__out_matrix<_OutMat>)
+_CCCL_HOST_API void
+matrix_product([[maybe_unused]] const _Policy& __policy, _InMat1 __a, _InMat2 __b, _InMat3 __e, _OutMat __c)
+{
+  __detail::__check_matrix_product_extents(__a, __b, __c);
+  __detail::__check_same_extents(__e, __c);
+  __detail::__matrix_product_parallel<true, _Policy>(__a, __b, __e, __c);
+}
+
+#endif // _CCCL_HOSTED()
+
+// [linalg.algs.blas3.trsm]
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void triangular_matrix_matrix_left_solve(_InMat __a, _Triangle, _DiagonalStorage, _InOutMat __b)
+{
+  using _Index = typename _InOutMat::index_type;
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_left_solve_extents(__a, __b);
+  __detail::__triangular_left_solve_in_place<_InMat, _Triangle, _DiagonalStorage>(
+    __a, __b, _Index{0}, static_cast<_Index>(__b.extent(1)));
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void
+triangular_matrix_matrix_left_solve(_InMat __a, _Triangle __t, _DiagonalStorage __d, _InMat2 __b, _OutMat __x)
+{
+  ::cuda::std::linalg::copy(__b, __x);
+  ::cuda::std::linalg::triangular_matrix_matrix_left_solve(__a, __t, __d, __x);
+}
+
+//! X A = B is solved as A^T X^T = B^T.
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__inout_matrix<_InOutMat>)
+_CCCL_API constexpr void
+triangular_matrix_matrix_right_solve(_InMat __a, _Triangle, _DiagonalStorage __d, _InOutMat __b)
+{
+  ::cuda::std::linalg::triangular_matrix_matrix_left_solve(
+    ::cuda::std::linalg::transposed(__a),
+    __detail::__transpose_triangle_t<_Triangle>{},
+    __d,
+    ::cuda::std::linalg::transposed(__b));
+}
+
+_CCCL_TEMPLATE(class _InMat, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(__detail::__in_matrix<_InMat> _CCCL_AND __detail::__in_matrix<_InMat2> _CCCL_AND
+                 __detail::__out_matrix<_OutMat>)
+_CCCL_API constexpr void
+triangular_matrix_matrix_right_solve(_InMat __a, _Triangle __t, _DiagonalStorage __d, _InMat2 __b, _OutMat __x)
+{
+  ::cuda::std::linalg::copy(__b, __x);
+  ::cuda::std::linalg::triangular_matrix_matrix_right_solve(__a, __t, __d, __x);
+}
+
+#if _CCCL_HOSTED()
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__inout_matrix<_InOutMat>)
+_CCCL_HOST_API void triangular_matrix_matrix_left_solve(
+  [[maybe_unused]] const _Policy& __policy, _InMat __a, _Triangle, _DiagonalStorage, _InOutMat __b)
+{
+  __detail::__check_triangular<_InMat, _Triangle, _DiagonalStorage>(__a);
+  __detail::__check_left_solve_extents(__a, __b);
+  __detail::__triangular_left_solve_parallel<_Policy, _InMat, _Triangle, _DiagonalStorage>(__a, __b);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__in_matrix<_InMat2> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_HOST_API void triangular_matrix_matrix_left_solve(
+  const _Policy& __policy, _InMat __a, _Triangle __t, _DiagonalStorage __d, _InMat2 __b, _OutMat __x)
+{
+  ::cuda::std::linalg::copy(__b, __x);
+  ::cuda::std::linalg::triangular_matrix_matrix_left_solve(__policy, __a, __t, __d, __x);
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InOutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__inout_matrix<_InOutMat>)
+_CCCL_HOST_API void triangular_matrix_matrix_right_solve(
+  const _Policy& __policy, _InMat __a, _Triangle, _DiagonalStorage __d, _InOutMat __b)
+{
+  ::cuda::std::linalg::triangular_matrix_matrix_left_solve(
+    __policy,
+    ::cuda::std::linalg::transposed(__a),
+    __detail::__transpose_triangle_t<_Triangle>{},
+    __d,
+    ::cuda::std::linalg::transposed(__b));
+}
+
+_CCCL_TEMPLATE(class _Policy, class _InMat, class _Triangle, class _DiagonalStorage, class _InMat2, class _OutMat)
+_CCCL_REQUIRES(is_execution_policy_v<_Policy> _CCCL_AND __detail::__in_matrix<_InMat> _CCCL_AND
+                 __detail::__in_matrix<_InMat2> _CCCL_AND __detail::__out_matrix<_OutMat>)
+_CCCL_HOST_API void triangular_matrix_matrix_right_solve(
+  const _Policy& __policy, _InMat __a, _Triangle __t, _DiagonalStorage __d, _InMat2 __b, _OutMat __x)
+{
+  ::cuda::std::linalg::copy(__b, __x);
+  ::cuda::std::linalg::triangular_matrix_matrix_right_solve(__policy, __a, __t, __d, __x);
+}
+
+#endif // _CCCL_HOSTED()
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_BLAS3_H
@@ -0,0 +1,172 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_CONCEPTS_H
+#define _CUDA_STD___LINALG_CONCEPTS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cmath/abs.h>
+#include <cuda/std/__concepts/concept_macros.h>
+#include <cuda/std/__linalg/tags.h>
+#include <cuda/std/__type_traits/is_arithmetic.h>
+#include <cuda/std/__type_traits/is_assignable.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__type_traits/is_unsigned.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/complex>
+#include <cuda/std/mdspan>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! The rank of an mdspan, or 0 for any other type, so that the concepts below do not need short-circuiting.
+template <class _Tp>
+inline constexpr size_t __mdspan_rank_v = 0;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline constexpr size_t __mdspan_rank_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>> = _Extents::rank();
+
+template <class _Tp>
+inline constexpr bool __is_mdspan_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline constexpr bool __is_mdspan_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>> = true;
+
+//! Whether the elements of an mdspan are assignable and never alias each other
+template <class _Tp>
+inline constexpr bool __is_writable_mdspan_v = false;
+
+template <class _ElementType, class _Extents, class _Layout, class _Accessor>
+inline constexpr bool __is_writable_mdspan_v<mdspan<_ElementType, _Extents, _Layout, _Accessor>> =
+  is_assignable_v<typename _Accessor::reference, _ElementType>
+  && mdspan<_ElementType, _Extents, _Layout, _Accessor>::is_always_unique();
+
+// [linalg.helpers.concepts]
+template <class _Tp>
+_CCCL_CONCEPT __in_vector = __is_mdspan_v<_Tp> && __mdspan_rank_v<_Tp> == 1;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_vector = __in_vector<_Tp> && __is_writable_mdspan_v<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_vector = __out_vector<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_matrix = __is_mdspan_v<_Tp> && __mdspan_rank_v<_Tp> == 2;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_matrix = __in_matrix<_Tp> && __is_writable_mdspan_v<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_matrix = __out_matrix<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __in_object = __in_vector<_Tp> || __in_matrix<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __out_object = __out_vector<_Tp> || __out_matrix<_Tp>;
+
+template <class _Tp>
+_CCCL_CONCEPT __inout_object = __out_object<_Tp>;
+
+template <class _Tp>
+inline constexpr bool __is_triangle_v = is_same_v<_Tp, upper_triangle_t> || is_same_v<_Tp, lower_triangle_t>;
+
+template <class _Tp>
+inline constexpr bool __is_diagonal_v = is_same_v<_Tp, implicit_unit_diagonal_t> || is_same_v<_Tp, explicit_diagonal_t>;
+
+//! Checks at compile time that two static extents can be equal.
+template <class _Ext1, size_t _Rank1, class _Ext2, size_t _Rank2>
+inline constexpr bool __compatible_static_extents =
+  _Ext1::static_extent(_Rank1) == dynamic_extent || _Ext2::static_extent(_Rank2) == dynamic_extent
+  || _Ext1::static_extent(_Rank1) == _Ext2::static_extent(_Rank2);
+
+// [linalg.scaled.abs], [linalg.scaled.real], [linalg.scaled.imag] for the algorithms that need them
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_if_needed(const _Tp& __t)
+{
+  if constexpr (is_unsigned_v<_Tp>)
+  {
+    return __t;
+  }
+  else if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return ::cuda::std::abs(__t);
+  }
+  else
+  {
+    using ::cuda::std::abs;
+    return abs(__t);
+  }
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __real_if_needed(const _Tp& __t)
+{
+  if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return __t;
+  }
+  else
+  {
+    using ::cuda::std::real;
+    return real(__t);
+  }
+}
+
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __imag_if_needed(const _Tp& __t)
+{
+  if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return _Tp{};
+  }
+  else
+  {
+    using ::cuda::std::imag;
+    return imag(__t);
+  }
+}
+
+//! The magnitude used by vector_abs_sum and vector_idx_abs_max: |x| for real values and |re(x)| + |im(x)| else.
+template <class _Tp>
+[[nodiscard]] _CCCL_API constexpr auto __abs_sum_magnitude(const _Tp& __t)
+{
+  if constexpr (is_arithmetic_v<_Tp>)
+  {
+    return __abs_if_needed(__t);
+  }
+  else
+  {
+    return __abs_if_needed(__real_if_needed(__t)) + __abs_if_needed(__imag_if_needed(__t));
+  }
+}
+} // namespace __detail
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_CONCEPTS_H
@@ -0,0 +1,113 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_EXECUTION_H
+#define _CUDA_STD___LINALG_EXECUTION_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HOSTED()
+
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__type_traits/is_execution_policy.h>
+#  include <cuda/std/cstddef>
+
+#  if _CCCL_HAS_BACKEND_OMP()
+#    include <cuda/std/__pstl/omp/executor.h>
+#  endif // _CCCL_HAS_BACKEND_OMP()
+#  if _CCCL_HAS_BACKEND_TBB()
+#    include <cuda/std/__pstl/tbb/executor.h>
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+namespace __detail
+{
+//! @brief Runs the work of a linalg algorithm called with an execution policy
+//!
+//! The algorithms split their work into independent tasks, which run on the host backend selected by @tparam _Policy.
+//! Policies without a host backend run the tasks serially on the calling thread.
+template <class _Policy>
+struct __linalg_executor
+{
+  static constexpr ::cuda::std::execution::__execution_backend __backend = _Policy::__get_backend();
+
+#  if _CCCL_HAS_BACKEND_CUDA()
+  static_assert(__backend != ::cuda::std::execution::__execution_backend::__cuda,
+                "cuda::std::linalg algorithms do not support the CUDA backend");
+#  endif // _CCCL_HAS_BACKEND_CUDA()
+
+  //! @brief Returns the number of threads the tasks can be spread over
+  [[nodiscard]] _CCCL_HOST_API static size_t __concurrency() noexcept
+  {
+#  if _CCCL_HAS_BACKEND_OMP()
+    if constexpr (__backend == ::cuda::std::execution::__execution_backend::__omp)
+    {
+      return ::cuda::std::execution::__pstl_omp_executor::__concurrency();
+    }
+#  endif // _CCCL_HAS_BACKEND_OMP()
+#  if _CCCL_HAS_BACKEND_TBB()
+    if constexpr (__backend == ::cuda::std::execution::__execution_backend::__tbb)
+    {
+      return ::cuda::std::execution::__pstl_tbb_executor::__concurrency();
+    }
+#  endif // _CCCL_HAS_BACKEND_TBB()
+    return 1;
+  }
+
+  //! @brief Invokes @p __fn(__i) for every @p __i in [0, @p __n), potentially concurrently
+  template <class _Fn>
+  _CCCL_HOST_API static void __parallel_for(size_t __n, _Fn __fn)
+  {
+    if (__n > 1 && __concurrency() > 1)
+    {
+#  if _CCCL_HAS_BACKEND_OMP()
+      if constexpr (__backend == ::cuda::std::execution::__execution_backend::__omp)
+      {
+        ::cuda::std::execution::__pstl_omp_executor::__parallel_for(static_cast<ptrdiff_t>(__n), __fn);
+        return;
+      }
+#  endif // _CCCL_HAS_BACKEND_OMP()
+#  if _CCCL_HAS_BACKEND_TBB()
+      if constexpr (__backend == ::cuda::std::execution::__execution_backend::__tbb)
+      {
+        ::cuda::std::execution::__pstl_tbb_executor::__parallel_for(static_cast<ptrdiff_t>(__n), __fn);
+        return;
+      }
+#  endif // _CCCL_HAS_BACKEND_TBB()
+    }
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __fn(static_cast<ptrdiff_t>(__i));
+    }
+  }
+};
+} // namespace __detail
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HOSTED()
+
+#endif // _CUDA_STD___LINALG_EXECUTION_H
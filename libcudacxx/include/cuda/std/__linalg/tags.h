@@ -0,0 +1,71 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___LINALG_TAGS_H
+#define _CUDA_STD___LINALG_TAGS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+namespace linalg
+{
+struct column_major_t
+{
+  _CCCL_HIDE_FROM_ABI explicit column_major_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT column_major_t column_major{};
+
+struct row_major_t
+{
+  _CCCL_HIDE_FROM_ABI explicit row_major_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT row_major_t row_major{};
+
+struct upper_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit upper_triangle_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT upper_triangle_t upper_triangle{};
+
+struct lower_triangle_t
+{
+  _CCCL_HIDE_FROM_ABI explicit lower_triangle_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT lower_triangle_t lower_triangle{};
+
+struct implicit_unit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit implicit_unit_diagonal_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT implicit_unit_diagonal_t implicit_unit_diagonal{};
+
+struct explicit_diagonal_t
+{
+  _CCCL_HIDE_FROM_ABI explicit explicit_diagonal_t() = default;
+};
+_CCCL_GLOBAL_CONSTANT explicit_diagonal_t explicit_diagonal{};
+} // end namespace linalg
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___LINALG_TAGS_H
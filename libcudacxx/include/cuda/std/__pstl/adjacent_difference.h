@@ -38,6 +38,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/adjacent_difference.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_HOST_PSTL_BACKEND()
+#    include <cuda/std/__pstl/host/adjacent_difference.h>
+#  endif // _CCCL_HAS_HOST_PSTL_BACKEND()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -40,6 +40,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/find_if.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_HOST_PSTL_BACKEND()
+#    include <cuda/std/__pstl/host/find_if.h>
+#  endif // _CCCL_HAS_HOST_PSTL_BACKEND()
 
 #  include <cuda/std/__cccl/prologue.h>
 
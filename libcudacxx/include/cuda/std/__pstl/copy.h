@@ -37,6 +37,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/copy_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_HOST_PSTL_BACKEND()
+#    include <cuda/std/__pstl/host/copy_n.h>
+#  endif // _CCCL_HAS_HOST_PSTL_BACKEND()
 
 #  include <cuda/std/__cccl/prologue.h>
 
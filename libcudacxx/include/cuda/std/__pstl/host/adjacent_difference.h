@@ -0,0 +1,94 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+#define _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__numeric/adjacent_difference.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__adjacent_difference, _Executor>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __binary_op)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size        = iter_difference_t<_InputIterator>;
+      const auto __count = ::cuda::std::distance(__first, __last);
+
+      __pstl_host_chunks<_Executor, _Size>{__count}.__for_each([&](_Size, _Size __begin, _Size __end) {
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          if (__i == 0)
+          {
+            __result[__i] = __first[__i];
+          }
+          else
+          {
+            __result[__i] = __binary_op(__first[__i], __first[__i - 1]);
+          }
+        }
+      });
+      return __result + __count;
+    }
+    else
+    {
+      static_assert(
+        __always_false_v<_Policy>,
+        "__pstl_dispatch: host backends of cuda::std::adjacent_difference require at least random access iterators");
+      return ::cuda::std::adjacent_difference(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_ADJACENT_DIFFERENCE_H
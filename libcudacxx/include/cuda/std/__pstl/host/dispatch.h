@@ -0,0 +1,121 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_DISPATCH_H
+#define _CUDA_STD___PSTL_HOST_DISPATCH_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__execution/policy.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/omp/executor.h>
+#  include <cuda/std/__pstl/tbb/executor.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Splits [0, __count) into contiguous chunks of roughly equal size, at most one per thread of @tparam _Executor
+//! If there is more than one chunk, every chunk holds at least two and at least _Executor::__min_chunk_size elements
+template <class _Executor, class _Size>
+class __pstl_host_chunks
+{
+  _Size __count_;
+  _Size __num_chunks_;
+
+  [[nodiscard]] _CCCL_HOST_API static _Size __make_num_chunks(_Size __count) noexcept
+  {
+    constexpr size_t __min_chunk_size = (::cuda::std::max) (_Executor::__min_chunk_size, size_t{2});
+
+    const size_t __max_chunks = (::cuda::std::max) (static_cast<size_t>(__count) / __min_chunk_size, size_t{1});
+    return static_cast<_Size>((::cuda::std::min) (__max_chunks, (::cuda::std::max) (_Executor::__concurrency(), size_t{1})));
+  }
+
+public:
+  _CCCL_HOST_API explicit __pstl_host_chunks(_Size __count) noexcept
+      : __count_{__count}
+      , __num_chunks_{__make_num_chunks(__count)}
+  {}
+
+  //! @brief Returns the number of chunks
+  [[nodiscard]] _CCCL_HOST_API _Size __size() const noexcept
+  {
+    return __num_chunks_;
+  }
+
+  //! @brief Returns the index of the first element of @p __chunk, or the number of elements for @p __chunk == __size()
+  [[nodiscard]] _CCCL_HOST_API _Size __begin(_Size __chunk) const noexcept
+  {
+    // The first __count_ % __num_chunks_ chunks hold one additional element
+    return __chunk * (__count_ / __num_chunks_) + (::cuda::std::min) (__chunk, static_cast<_Size>(__count_ % __num_chunks_));
+  }
+
+  //! @brief Returns the index one past the last element of @p __chunk
+  [[nodiscard]] _CCCL_HOST_API _Size __end(_Size __chunk) const noexcept
+  {
+    return __begin(__chunk + 1);
+  }
+
+  //! @brief Invokes @p __fn(__chunk, __begin(__chunk), __end(__chunk)) for every chunk, potentially concurrently
+  template <class _Fn>
+  _CCCL_HOST_API void __for_each(_Fn __fn) const
+  {
+    auto __chunk_fn = [&](ptrdiff_t __i) {
+      const auto __chunk = static_cast<_Size>(__i);
+      __fn(__chunk, __begin(__chunk), __end(__chunk));
+    };
+    _Executor::__parallel_for(static_cast<ptrdiff_t>(__num_chunks_), __chunk_fn);
+  }
+};
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Implementation of @tparam _Algorithm shared by the host backends, which only differ in the @tparam _Executor
+//! running the chunks of work. If @class __pstl_host_dispatch is not specialized, the host backends cannot dispatch.
+template <__pstl_algorithm _Algorithm, class _Executor>
+struct __pstl_host_dispatch : public __pstl_no_dispatch
+{};
+
+#  if _CCCL_HAS_BACKEND_OMP()
+template <__pstl_algorithm _Algorithm>
+struct __pstl_dispatch<_Algorithm, __execution_backend::__omp>
+    : public __pstl_host_dispatch<_Algorithm, __pstl_omp_executor>
+{};
+#  endif // _CCCL_HAS_BACKEND_OMP()
+
+#  if _CCCL_HAS_BACKEND_TBB()
+template <__pstl_algorithm _Algorithm>
+struct __pstl_dispatch<_Algorithm, __execution_backend::__tbb>
+    : public __pstl_host_dispatch<_Algorithm, __pstl_tbb_executor>
+{};
+#  endif // _CCCL_HAS_BACKEND_TBB()
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_DISPATCH_H
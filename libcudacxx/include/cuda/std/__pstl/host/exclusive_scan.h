@@ -0,0 +1,130 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+#define _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__numeric/exclusive_scan.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__exclusive_scan, _Executor>
+{
+  //! Scans the chunks in three phases: every chunk but the last one is reduced, the reductions are scanned serially
+  //! into the carry of every chunk, starting from the initial value, and every chunk is scanned starting from its carry.
+  template <class _InputIterator, class _Size, class _OutputIterator, class _Tp, class _BinaryOp>
+  _CCCL_HOST_API static void
+  __par_impl(_InputIterator __first, _Size __count, _OutputIterator __result, _Tp __init, _BinaryOp __binary_op)
+  {
+    const __pstl_host_chunks<_Executor, _Size> __chunks{__count};
+    const _Size __num_chunks = __chunks.__size();
+
+    __pstl_host_temporary_buffer<_Tp> __carries_buffer{static_cast<size_t>(__num_chunks)};
+    _Tp* __carries = __carries_buffer.__get();
+
+    // Every chunk holds at least two elements if there is more than one, so its reduction needs no initial value
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      if (__chunk + 1 == __num_chunks)
+      {
+        return;
+      }
+
+      _Tp __sum = __binary_op(__first[__begin], __first[__begin + 1]);
+      for (_Size __i = __begin + 2; __i < __end; ++__i)
+      {
+        __sum = __binary_op(::cuda::std::move(__sum), __first[__i]);
+      }
+      ::cuda::std::__construct_at(__carries + __chunk + 1, ::cuda::std::move(__sum));
+    });
+    ::cuda::std::__construct_at(__carries, ::cuda::std::move(__init));
+    __carries_buffer.__set_size(static_cast<size_t>(__num_chunks));
+
+    for (_Size __chunk = 1; __chunk < __num_chunks; ++__chunk)
+    {
+      __carries[__chunk] = __binary_op(__carries[__chunk - 1], ::cuda::std::move(__carries[__chunk]));
+    }
+
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      _Tp __acc = __carries[__chunk];
+      for (_Size __i = __begin; __i < __end; ++__i)
+      {
+        // Read the input before writing the output, which may be the same sequence
+        _Tp __next    = __binary_op(__acc, __first[__i]);
+        __result[__i] = ::cuda::std::move(__acc);
+        __acc         = ::cuda::std::move(__next);
+      }
+    });
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _Tp __init,
+    _BinaryOp __binary_op)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count = ::cuda::std::distance(__first, __last);
+      __par_impl(::cuda::std::move(__first), __count, __result, ::cuda::std::move(__init), ::cuda::std::move(__binary_op));
+      return __result + __count;
+    }
+    else
+    {
+      static_assert(
+        __always_false_v<_Policy>,
+        "__pstl_dispatch: host backends of cuda::std::exclusive_scan require at least random access iterators");
+      return ::cuda::std::exclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__init),
+        ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_EXCLUSIVE_SCAN_H
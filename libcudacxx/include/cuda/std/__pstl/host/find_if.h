@@ -0,0 +1,102 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_FIND_IF_H
+#define _CUDA_STD___PSTL_HOST_FIND_IF_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/find_if.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/atomic>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__find_if, _Executor>
+{
+  //! The number of elements a chunk searches before checking whether an earlier chunk found a match
+  static constexpr ptrdiff_t __block_size = 256;
+
+  template <class _Policy, class _Iter, class _UnaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Iter
+  _CCCL_STATIC_CALL_OPERATOR([[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _UnaryOp __pred)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      using _Size        = iter_difference_t<_Iter>;
+      const auto __count = ::cuda::std::distance(__first, __last);
+
+      // The index of the first match found so far. Chunks stop searching once a match before them has been found.
+      ::cuda::std::atomic<_Size> __found{__count};
+      __pstl_host_chunks<_Executor, _Size>{__count}.__for_each([&](_Size, _Size __begin, _Size __end) {
+        for (_Size __block = __begin; __block < __end; __block += static_cast<_Size>(__block_size))
+        {
+          if (__found.load(::cuda::std::memory_order_relaxed) < __block)
+          {
+            return;
+          }
+
+          const _Size __block_end = (::cuda::std::min) (__end, static_cast<_Size>(__block + __block_size));
+          for (_Size __i = __block; __i < __block_end; ++__i)
+          {
+            if (__pred(__first[__i]))
+            {
+              _Size __expected = __found.load(::cuda::std::memory_order_relaxed);
+              while (__i < __expected
+                     && !__found.compare_exchange_weak(__expected, __i, ::cuda::std::memory_order_relaxed))
+              {
+              }
+              return;
+            }
+          }
+        }
+      });
+
+      return __first + __found.load(::cuda::std::memory_order_relaxed);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: host backends of cuda::std::find_if require at least random access iterators");
+      return ::cuda::std::find_if(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_FIND_IF_H
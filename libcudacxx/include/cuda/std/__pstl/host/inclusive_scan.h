@@ -0,0 +1,178 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
+#define _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/addressof.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__numeric/inclusive_scan.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__inclusive_scan, _Executor>
+{
+  //! Scans the chunks in three phases: every chunk but the last one is reduced, the reductions are scanned serially
+  //! into the carry of every chunk, and every chunk is scanned starting from its carry. The first chunk has no carry
+  //! unless there is an initial value.
+  template <bool _HasInit, class _AccumT, class _InputIterator, class _Size, class _OutputIterator, class _BinaryOp>
+  _CCCL_HOST_API static void __par_impl(
+    _InputIterator __first, _Size __count, _OutputIterator __result, _BinaryOp __binary_op, _AccumT* __init)
+  {
+    const __pstl_host_chunks<_Executor, _Size> __chunks{__count};
+    const _Size __num_chunks  = __chunks.__size();
+    const _Size __num_carries = _HasInit ? __num_chunks : __num_chunks - 1;
+
+    __pstl_host_temporary_buffer<_AccumT> __carries{static_cast<size_t>(__num_carries)};
+    auto __carry = [&](_Size __chunk) {
+      return __carries.__get() + (_HasInit ? __chunk : __chunk - 1);
+    };
+
+    // Every chunk holds at least two elements if there is more than one, so its reduction needs no initial value
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      if (__chunk + 1 == __num_chunks)
+      {
+        return;
+      }
+
+      _AccumT __sum = __binary_op(__first[__begin], __first[__begin + 1]);
+      for (_Size __i = __begin + 2; __i < __end; ++__i)
+      {
+        __sum = __binary_op(::cuda::std::move(__sum), __first[__i]);
+      }
+      ::cuda::std::__construct_at(__carry(__chunk + 1), ::cuda::std::move(__sum));
+    });
+    if constexpr (_HasInit)
+    {
+      ::cuda::std::__construct_at(__carry(0), ::cuda::std::move(*__init));
+    }
+    __carries.__set_size(static_cast<size_t>(__num_carries));
+
+    for (_Size __chunk = _HasInit ? 1 : 2; __chunk < __num_chunks; ++__chunk)
+    {
+      *__carry(__chunk) = __binary_op(*__carry(__chunk - 1), ::cuda::std::move(*__carry(__chunk)));
+    }
+
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      auto __first_value = [&]() -> _AccumT {
+        if constexpr (!_HasInit)
+        {
+          if (__chunk == 0)
+          {
+            return __first[__begin];
+          }
+        }
+        return __binary_op(*__carry(__chunk), __first[__begin]);
+      };
+
+      _AccumT __acc     = __first_value();
+      __result[__begin] = __acc;
+      for (_Size __i = __begin + 1; __i < __end; ++__i)
+      {
+        __acc         = __binary_op(::cuda::std::move(__acc), __first[__i]);
+        __result[__i] = __acc;
+      }
+    });
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp, class _Tp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __binary_op,
+    _Tp __init)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count = ::cuda::std::distance(__first, __last);
+      __par_impl<true>(
+        ::cuda::std::move(__first), __count, __result, ::cuda::std::move(__binary_op), ::cuda::std::addressof(__init));
+      return __result + __count;
+    }
+    else
+    {
+      static_assert(
+        __always_false_v<_Policy>,
+        "__pstl_dispatch: host backends of cuda::std::inclusive_scan require at least random access iterators");
+      return ::cuda::std::inclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__binary_op),
+        ::cuda::std::move(__init));
+    }
+  }
+
+  template <class _Policy, class _InputIterator, class _OutputIterator, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator __result,
+    _BinaryOp __binary_op)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      const auto __count = ::cuda::std::distance(__first, __last);
+      __par_impl<false, iter_value_t<_InputIterator>>(
+        ::cuda::std::move(__first), __count, __result, ::cuda::std::move(__binary_op), nullptr);
+      return __result + __count;
+    }
+    else
+    {
+      static_assert(
+        __always_false_v<_Policy>,
+        "__pstl_dispatch: host backends of cuda::std::inclusive_scan require at least random access iterators");
+      return ::cuda::std::inclusive_scan(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__binary_op));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_INCLUSIVE_SCAN_H
@@ -0,0 +1,127 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_MERGE_H
+#define _CUDA_STD___PSTL_HOST_MERGE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/max.h>
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__type_traits/common_type.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+//! @brief Returns how many of the first @p __diagonal elements of the stable merge of [__first1, __first1 + __count1)
+//! and [__first2, __first2 + __count2) come from the first sequence
+template <class _InputIterator1, class _InputIterator2, class _Size, class _Compare>
+[[nodiscard]] _CCCL_HOST_API _Size __pstl_host_merge_path(
+  _InputIterator1 __first1, _Size __count1, _InputIterator2 __first2, _Size __count2, _Size __diagonal, _Compare& __comp)
+{
+  _Size __lo = (::cuda::std::max) (_Size{0}, static_cast<_Size>(__diagonal - __count2));
+  _Size __hi = (::cuda::std::min) (__diagonal, __count1);
+  while (__lo < __hi)
+  {
+    const _Size __mid = __lo + (__hi - __lo) / 2;
+    // On ties, the element of the first sequence comes first
+    if (__comp(__first2[__diagonal - 1 - __mid], __first1[__mid]))
+    {
+      __hi = __mid;
+    }
+    else
+    {
+      __lo = __mid + 1;
+    }
+  }
+  return __lo;
+}
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__merge, _Executor>
+{
+  //! Every chunk of the output finds the elements of both inputs it is merged from by a binary search along the merge
+  //! path, and merges them serially
+  template <class _Policy, class _InputIterator1, class _InputIterator2, class _OutputIterator, class _Compare>
+  [[nodiscard]] _CCCL_HOST_API _OutputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator1 __first1,
+    _InputIterator1 __last1,
+    _InputIterator2 __first2,
+    _InputIterator2 __last2,
+    _OutputIterator __result,
+    _Compare __comp)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_InputIterator2>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator>)
+    {
+      using _Size         = common_type_t<iter_difference_t<_InputIterator1>, iter_difference_t<_InputIterator2>>;
+      const auto __count1 = static_cast<_Size>(::cuda::std::distance(__first1, __last1));
+      const auto __count2 = static_cast<_Size>(::cuda::std::distance(__first2, __last2));
+
+      __pstl_host_chunks<_Executor, _Size>{__count1 + __count2}.__for_each([&](_Size, _Size __begin, _Size __end) {
+        const _Size __begin1 =
+          ::cuda::std::execution::__pstl_host_merge_path(__first1, __count1, __first2, __count2, __begin, __comp);
+        const _Size __end1 =
+          ::cuda::std::execution::__pstl_host_merge_path(__first1, __count1, __first2, __count2, __end, __comp);
+        ::cuda::std::merge(__first1 + __begin1,
+                           __first1 + __end1,
+                           __first2 + (__begin - __begin1),
+                           __first2 + (__end - __end1),
+                           __result + __begin,
+                           __comp);
+      });
+      return __result + (__count1 + __count2);
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: host backends of cuda::std::merge require at least random access iterators");
+      return ::cuda::std::merge(
+        ::cuda::std::move(__first1),
+        ::cuda::std::move(__last1),
+        ::cuda::std::move(__first2),
+        ::cuda::std::move(__last2),
+        ::cuda::std::move(__result),
+        ::cuda::std::move(__comp));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_MERGE_H
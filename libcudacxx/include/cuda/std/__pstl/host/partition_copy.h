@@ -0,0 +1,100 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+#define _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/partition_copy.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/select.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/__utility/pair.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__partition_copy, _Executor>
+{
+  template <class _Policy, class _InputIterator, class _OutputIterator1, class _OutputIterator2, class _UnaryPred>
+  [[nodiscard]] _CCCL_HOST_API pair<_OutputIterator1, _OutputIterator2> _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    _OutputIterator1 __result_true,
+    _OutputIterator2 __result_false,
+    _UnaryPred __pred)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator1>
+                  && ::cuda::std::__has_random_access_traversal<_OutputIterator2>)
+    {
+      using _Size        = iter_difference_t<_InputIterator>;
+      const auto __count = ::cuda::std::distance(__first, __last);
+
+      const __pstl_host_selection<_Executor, _Size> __selection{__count, [&](_Size __i) {
+                                                                  return __pred(__first[__i]);
+                                                                }};
+      __selection.__for_each([&](bool __selected, _Size __i, _Size __rank) {
+        if (__selected)
+        {
+          __result_true[__rank] = __first[__i];
+        }
+        else
+        {
+          __result_false[__rank] = __first[__i];
+        }
+      });
+      return pair{__result_true + __selection.__num_selected(),
+                  __result_false + (__count - __selection.__num_selected())};
+    }
+    else
+    {
+      static_assert(
+        __always_false_v<_Policy>,
+        "__pstl_dispatch: host backends of cuda::std::partition_copy require at least random access iterators");
+      return ::cuda::std::partition_copy(
+        ::cuda::std::move(__first),
+        ::cuda::std::move(__last),
+        ::cuda::std::move(__result_true),
+        ::cuda::std::move(__result_false),
+        ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_PARTITION_COPY_H
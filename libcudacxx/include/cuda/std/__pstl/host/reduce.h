@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_REDUCE_H
+#define _CUDA_STD___PSTL_HOST_REDUCE_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/next.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__numeric/reduce.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__reduce, _Executor>
+{
+  template <class _Iter, class _Size, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API static _Tp __par_impl(_Iter __first, _Size __count, _Tp __init, _BinaryOp __func)
+  {
+    const __pstl_host_chunks<_Executor, _Size> __chunks{__count};
+    if (__chunks.__size() == 1)
+    {
+      return ::cuda::std::reduce(__first, __first + __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+
+    // Every chunk holds at least two elements, so its partial result does not need an initial value
+    __pstl_host_temporary_buffer<_Tp> __partials{static_cast<size_t>(__chunks.__size())};
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      _Tp __partial = __func(__first[__begin], __first[__begin + 1]);
+      for (_Size __i = __begin + 2; __i < __end; ++__i)
+      {
+        __partial = __func(::cuda::std::move(__partial), __first[__i]);
+      }
+      ::cuda::std::__construct_at(__partials.__get() + __chunk, ::cuda::std::move(__partial));
+    });
+    __partials.__set_size(static_cast<size_t>(__chunks.__size()));
+
+    for (_Size __chunk = 0; __chunk < __chunks.__size(); ++__chunk)
+    {
+      __init = __func(::cuda::std::move(__init), ::cuda::std::move(__partials.__get()[__chunk]));
+    }
+    return __init;
+  }
+
+  template <class _Policy, class _Iter, class _Size, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy, _Iter __first, _Size __count, _Tp __init, _BinaryOp __func)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_Iter>)
+    {
+      return __par_impl(::cuda::std::move(__first), __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: host backends of cuda::std::reduce require at least random access iterators");
+      return ::cuda::std::reduce(
+        __first, ::cuda::std::next(__first, __count), ::cuda::std::move(__init), ::cuda::std::move(__func));
+    }
+  }
+
+  template <class _Policy, class _Iter, class _Tp, class _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_API _Tp _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy, _Iter __first, _Iter __last, _Tp __init, _BinaryOp __func)
+  {
+    const auto __count = ::cuda::std::distance(__first, __last);
+    return __pstl_host_dispatch{}(
+      __policy, ::cuda::std::move(__first), __count, ::cuda::std::move(__init), ::cuda::std::move(__func));
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_REDUCE_H
@@ -0,0 +1,156 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SELECT_H
+#define _CUDA_STD___PSTL_HOST_SELECT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Selects a subset of the indices [0, __count), and computes the position of every index within the selected
+//! or the rejected ones, as needed by the host backends of copy_if, partition, unique and their variants.
+//! The selection is evaluated once per index, so that the elements can be moved while they are being written out.
+template <class _Executor, class _Size>
+class __pstl_host_selection
+{
+  __pstl_host_chunks<_Executor, _Size> __chunks_;
+  __pstl_host_temporary_buffer<bool> __selected_;
+  // The number of selected indices before the first index of every chunk
+  __pstl_host_temporary_buffer<_Size> __offsets_;
+  _Size __num_selected_ = 0;
+
+public:
+  //! @brief Selects every index @p __i for which @p __select(__i) returns true
+  template <class _Select>
+  _CCCL_HOST_API __pstl_host_selection(_Size __count, _Select __select)
+      : __chunks_{__count}
+      , __selected_{static_cast<size_t>(__count)}
+      , __offsets_{static_cast<size_t>(__chunks_.__size())}
+  {
+    bool* __selected = __selected_.__get();
+    _Size* __offsets = __offsets_.__get();
+
+    __chunks_.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      _Size __num_selected = 0;
+      for (_Size __i = __begin; __i < __end; ++__i)
+      {
+        ::cuda::std::__construct_at(__selected + __i, static_cast<bool>(__select(__i)));
+        __num_selected += __selected[__i] ? 1 : 0;
+      }
+      ::cuda::std::__construct_at(__offsets + __chunk, __num_selected);
+    });
+    __selected_.__set_size(static_cast<size_t>(__count));
+    __offsets_.__set_size(static_cast<size_t>(__chunks_.__size()));
+
+    // There is only one chunk per thread, so a serial scan of the counts is cheaper than another parallel phase
+    for (_Size __chunk = 0; __chunk < __chunks_.__size(); ++__chunk)
+    {
+      const _Size __num_selected = __offsets[__chunk];
+      __offsets[__chunk]         = __num_selected_;
+      __num_selected_ += __num_selected;
+    }
+  }
+
+  //! @brief Returns the number of selected indices
+  [[nodiscard]] _CCCL_HOST_API _Size __num_selected() const noexcept
+  {
+    return __num_selected_;
+  }
+
+  //! @brief Invokes @p __write(__selected, __i, __rank) for every index @p __i, where @p __rank is the number of indices
+  //! before @p __i that were selected if @p __i was selected, or that were rejected otherwise.
+  template <class _Write>
+  _CCCL_HOST_API void __for_each(_Write __write) const
+  {
+    const bool* __selected = __selected_.__get();
+    const _Size* __offsets = __offsets_.__get();
+
+    __chunks_.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      _Size __num_selected = __offsets[__chunk];
+      _Size __num_rejected = __begin - __num_selected;
+      for (_Size __i = __begin; __i < __end; ++__i)
+      {
+        if (__selected[__i])
+        {
+          __write(true, __i, __num_selected++);
+        }
+        else
+        {
+          __write(false, __i, __num_rejected++);
+        }
+      }
+    });
+  }
+};
+
+//! @brief Stably moves the elements of [__first, __first + __count) picked by @p __selection to the front of the range,
+//! through a temporary buffer. If @tparam _KeepRejected is true, the rejected elements are stably moved after them,
+//! otherwise they are left in a valid but unspecified state. Returns the number of selected elements.
+template <bool _KeepRejected, class _Executor, class _Iter, class _Size>
+_CCCL_HOST_API _Size
+__pstl_host_stable_partition(const __pstl_host_selection<_Executor, _Size>& __selection, _Iter __first, _Size __count)
+{
+  using _Tp = iter_value_t<_Iter>;
+
+  const _Size __num_selected = __selection.__num_selected();
+  const _Size __num_moved    = _KeepRejected ? __count : __num_selected;
+
+  __pstl_host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__num_moved)};
+  _Tp* __buf = __buffer.__get();
+
+  __selection.__for_each([&](bool __selected, _Size __i, _Size __rank) {
+    if (__selected)
+    {
+      ::cuda::std::__construct_at(__buf + __rank, ::cuda::std::move(__first[__i]));
+    }
+    else if constexpr (_KeepRejected)
+    {
+      ::cuda::std::__construct_at(__buf + __num_selected + __rank, ::cuda::std::move(__first[__i]));
+    }
+  });
+  __buffer.__set_size(static_cast<size_t>(__num_moved));
+
+  __pstl_host_chunks<_Executor, _Size>{__num_moved}.__for_each([&](_Size, _Size __begin, _Size __end) {
+    for (_Size __i = __begin; __i < __end; ++__i)
+    {
+      __first[__i] = ::cuda::std::move(__buf[__i]);
+    }
+  });
+
+  return __num_selected;
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_SELECT_H
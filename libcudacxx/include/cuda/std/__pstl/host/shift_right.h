@@ -0,0 +1,109 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SHIFT_RIGHT_H
+#define _CUDA_STD___PSTL_HOST_SHIFT_RIGHT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/shift_right.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__shift_right, _Executor>
+{
+  template <class _Policy, class _InputIterator>
+  [[nodiscard]] _CCCL_HOST_API _InputIterator _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy,
+    _InputIterator __first,
+    _InputIterator __last,
+    iter_difference_t<_InputIterator> __num_shifted)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size                  = iter_difference_t<_InputIterator>;
+      using _Tp                    = iter_value_t<_InputIterator>;
+      const auto __count_remaining = static_cast<_Size>(::cuda::std::distance(__first, __last) - __num_shifted);
+      const auto __result          = __first + __num_shifted;
+      const __pstl_host_chunks<_Executor, _Size> __chunks{__count_remaining};
+
+      if (__num_shifted >= __count_remaining)
+      { // There is no overlap between the source and destination, so we can just move
+        __chunks.__for_each([&](_Size, _Size __begin, _Size __end) {
+          for (_Size __i = __begin; __i < __end; ++__i)
+          {
+            __result[__i] = ::cuda::std::move(__first[__i]);
+          }
+        });
+      }
+      else
+      { // Need temporary storage
+        __pstl_host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__count_remaining)};
+        _Tp* __buf = __buffer.__get();
+
+        __chunks.__for_each([&](_Size, _Size __begin, _Size __end) {
+          for (_Size __i = __begin; __i < __end; ++__i)
+          {
+            ::cuda::std::__construct_at(__buf + __i, ::cuda::std::move(__first[__i]));
+          }
+        });
+        __buffer.__set_size(static_cast<size_t>(__count_remaining));
+
+        __chunks.__for_each([&](_Size, _Size __begin, _Size __end) {
+          for (_Size __i = __begin; __i < __end; ++__i)
+          {
+            __result[__i] = ::cuda::std::move(__buf[__i]);
+          }
+        });
+      }
+
+      return __result;
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: host backends of cuda::std::shift_right require at least random access iterators");
+      return ::cuda::std::shift_right(::cuda::std::move(__first), ::cuda::std::move(__last), __num_shifted);
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_SHIFT_RIGHT_H
@@ -0,0 +1,169 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_SORT_H
+#define _CUDA_STD___PSTL_HOST_SORT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__algorithm/merge.h>
+#  include <cuda/std/__algorithm/min.h>
+#  include <cuda/std/__algorithm/sort.h>
+#  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__iterator/distance.h>
+#  include <cuda/std/__iterator/iterator_traits.h>
+#  include <cuda/std/__iterator/move_iterator.h>
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__pstl/dispatch.h>
+#  include <cuda/std/__pstl/host/dispatch.h>
+#  include <cuda/std/__pstl/host/merge.h>
+#  include <cuda/std/__pstl/host/temporary_buffer.h>
+#  include <cuda/std/__type_traits/always_false.h>
+#  include <cuda/std/__utility/move.h>
+#  include <cuda/std/array>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+_CCCL_BEGIN_NAMESPACE_ARCH_DEPENDENT
+
+template <class _Executor>
+struct __pstl_host_dispatch<__pstl_algorithm::__sort, _Executor>
+{
+  //! Merges every pair of adjacent sorted runs of @p __width chunks of @p __source into @p __dest. Every chunk of the
+  //! output is merged independently, after finding its elements in both runs along the merge path. All merge paths are
+  //! searched before any element is moved, so that no search compares moved-from elements.
+  template <class _Size, class _SourceIterator, class _DestIterator, class _BinaryPredicate>
+  _CCCL_HOST_API static void __merge_round(
+    const __pstl_host_chunks<_Executor, _Size>& __chunks,
+    _Size* __splits,
+    _Size __width,
+    _SourceIterator __source,
+    _DestIterator __dest,
+    _BinaryPredicate& __pred)
+  {
+    const auto __runs = [&](_Size __chunk) {
+      const _Size __first_chunk  = __chunk / (2 * __width) * (2 * __width);
+      const _Size __middle_chunk = (::cuda::std::min) (static_cast<_Size>(__first_chunk + __width), __chunks.__size());
+      const _Size __last_chunk = (::cuda::std::min) (static_cast<_Size>(__first_chunk + 2 * __width), __chunks.__size());
+      return ::cuda::std::array<_Size, 3>{
+        __chunks.__begin(__first_chunk), __chunks.__begin(__middle_chunk), __chunks.__begin(__last_chunk)};
+    };
+
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      const auto __run = __runs(__chunk);
+      __splits[2 * __chunk] = ::cuda::std::execution::__pstl_host_merge_path(
+        __source + __run[0], __run[1] - __run[0], __source + __run[1], __run[2] - __run[1], __begin - __run[0], __pred);
+      __splits[2 * __chunk + 1] = ::cuda::std::execution::__pstl_host_merge_path(
+        __source + __run[0], __run[1] - __run[0], __source + __run[1], __run[2] - __run[1], __end - __run[0], __pred);
+    });
+
+    __chunks.__for_each([&](_Size __chunk, _Size __begin, _Size __end) {
+      const auto __run     = __runs(__chunk);
+      const _Size __begin1 = __splits[2 * __chunk];
+      const _Size __end1   = __splits[2 * __chunk + 1];
+      const auto __first1  = ::cuda::std::make_move_iterator(__source + __run[0]);
+      const auto __first2  = ::cuda::std::make_move_iterator(__source + __run[1]);
+      ::cuda::std::merge(__first1 + __begin1,
+                         __first1 + __end1,
+                         __first2 + (__begin - __run[0] - __begin1),
+                         __first2 + (__end - __run[0] - __end1),
+                         __dest + __begin,
+                         __pred);
+    });
+  }
+
+  //! Every chunk is sorted serially, and the sorted chunks are merged pairwise in rounds, which alternate between a
+  //! temporary buffer and the input
+  template <class _Policy, class _InputIterator, class _BinaryPredicate>
+  _CCCL_HOST_API void _CCCL_STATIC_CALL_OPERATOR(
+    [[maybe_unused]] const _Policy& __policy, _InputIterator __first, _InputIterator __last, _BinaryPredicate __pred)
+  {
+    if constexpr (::cuda::std::__has_random_access_traversal<_InputIterator>)
+    {
+      using _Size        = iter_difference_t<_InputIterator>;
+      using _Tp          = iter_value_t<_InputIterator>;
+      const auto __count = ::cuda::std::distance(__first, __last);
+
+      const __pstl_host_chunks<_Executor, _Size> __chunks{__count};
+      if (__chunks.__size() == 1)
+      {
+        ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+        return;
+      }
+
+      // The first round merges from the buffer, so that it only ever needs to hold constructed elements
+      __pstl_host_temporary_buffer<_Tp> __buffer{static_cast<size_t>(__count)};
+      _Tp* __buf = __buffer.__get();
+      __chunks.__for_each([&](_Size, _Size __begin, _Size __end) {
+        ::cuda::std::sort(__first + __begin, __first + __end, __pred);
+        for (_Size __i = __begin; __i < __end; ++__i)
+        {
+          ::cuda::std::__construct_at(__buf + __i, ::cuda::std::move(__first[__i]));
+        }
+      });
+      __buffer.__set_size(static_cast<size_t>(__count));
+
+      // The bounds of the part of the first run merged into every chunk
+      __pstl_host_temporary_buffer<_Size> __splits{2 * static_cast<size_t>(__chunks.__size())};
+
+      bool __in_buffer = true;
+      for (_Size __width = 1; __width < __chunks.__size(); __width *= 2)
+      {
+        if (__in_buffer)
+        {
+          __merge_round(__chunks, __splits.__get(), __width, __buf, __first, __pred);
+        }
+        else
+        {
+          __merge_round(__chunks, __splits.__get(), __width, __first, __buf, __pred);
+        }
+        __in_buffer = !__in_buffer;
+      }
+
+      if (__in_buffer)
+      {
+        __chunks.__for_each([&](_Size, _Size __begin, _Size __end) {
+          for (_Size __i = __begin; __i < __end; ++__i)
+          {
+            __first[__i] = ::cuda::std::move(__buf[__i]);
+          }
+        });
+      }
+    }
+    else
+    {
+      static_assert(__always_false_v<_Policy>,
+                    "__pstl_dispatch: host backends of cuda::std::sort require at least random access iterators");
+      ::cuda::std::sort(::cuda::std::move(__first), ::cuda::std::move(__last), ::cuda::std::move(__pred));
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_ARCH_DEPENDENT
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_SORT_H
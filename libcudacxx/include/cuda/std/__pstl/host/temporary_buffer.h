@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
+#define _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#  include <cuda/std/__memory/construct_at.h>
+#  include <cuda/std/__new/allocate.h>
+#  include <cuda/std/cstddef>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Uninitialized host storage for a number of objects of type @tparam _Tp. The algorithm constructs the objects
+//! it needs, and records how many of them it constructed, so that they are destroyed together with the buffer.
+template <class _Tp>
+class __pstl_host_temporary_buffer
+{
+  _Tp* __ptr_;
+  size_t __capacity_;
+  size_t __size_ = 0;
+
+public:
+  _CCCL_HOST_API explicit __pstl_host_temporary_buffer(size_t __capacity)
+      : __ptr_{static_cast<_Tp*>(::cuda::std::__cccl_allocate(__capacity * sizeof(_Tp), alignof(_Tp)))}
+      , __capacity_{__capacity}
+  {}
+
+  __pstl_host_temporary_buffer(const __pstl_host_temporary_buffer&)            = delete;
+  __pstl_host_temporary_buffer& operator=(const __pstl_host_temporary_buffer&) = delete;
+
+  _CCCL_HOST_API ~__pstl_host_temporary_buffer()
+  {
+    ::cuda::std::__destroy(__ptr_, __ptr_ + __size_);
+    ::cuda::std::__cccl_deallocate(__ptr_, __capacity_ * sizeof(_Tp), alignof(_Tp));
+  }
+
+  [[nodiscard]] _CCCL_HOST_API _Tp* __get() const noexcept
+  {
+    return __ptr_;
+  }
+
+  //! @brief Records that the first @p __size objects of the buffer have been constructed
+  _CCCL_HOST_API void __set_size(size_t __size) noexcept
+  {
+    __size_ = __size;
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_HOST_PSTL_BACKEND()
+
+#endif // _CUDA_STD___PSTL_HOST_TEMPORARY_BUFFER_H
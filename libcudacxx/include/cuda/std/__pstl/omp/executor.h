@@ -0,0 +1,79 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_OMP_EXECUTOR_H
+#define _CUDA_STD___PSTL_OMP_EXECUTOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_OMP()
+
+#  if defined(_OPENMP)
+#    include <omp.h>
+#  endif // _OPENMP
+
+#  include <cuda/std/cstddef>
+
+// The OpenMP pragmas are only emitted when OpenMP is available, otherwise the OpenMP backend runs serially
+#  if defined(_NVHPC_STDPAR_OPENMP) && _NVHPC_STDPAR_OPENMP == 1
+#    define _CCCL_PRAGMA_OMP(_DIRECTIVE) _CCCL_PRAGMA(omp_stdpar _DIRECTIVE)
+#  elif defined(_OPENMP)
+#    define _CCCL_PRAGMA_OMP(_DIRECTIVE) _CCCL_PRAGMA(omp _DIRECTIVE)
+#  else // ^^^ _OPENMP ^^^ / vvv !_OPENMP vvv
+#    define _CCCL_PRAGMA_OMP(_DIRECTIVE)
+#  endif // !_OPENMP
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Runs the chunks of work of the host backend on the threads of an OpenMP parallel region
+struct __pstl_omp_executor
+{
+  //! @brief The smallest number of elements worth handing to a separate thread
+  static constexpr size_t __min_chunk_size = 2048;
+
+  //! @brief Returns the number of threads work can be spread over
+  [[nodiscard]] _CCCL_HOST_API static size_t __concurrency() noexcept
+  {
+#  if defined(_OPENMP)
+    return static_cast<size_t>(::omp_get_max_threads());
+#  else // ^^^ _OPENMP ^^^ / vvv !_OPENMP vvv
+    return 1;
+#  endif // !_OPENMP
+  }
+
+  //! @brief Invokes @p __fn(__i) for every @p __i in [0, @p __n), potentially concurrently
+  template <class _Fn>
+  _CCCL_HOST_API static void __parallel_for(ptrdiff_t __n, _Fn& __fn)
+  {
+    _CCCL_PRAGMA_OMP(parallel for)
+    for (ptrdiff_t __i = 0; __i < __n; ++__i)
+    {
+      __fn(__i);
+    }
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_OMP()
+
+#endif // _CUDA_STD___PSTL_OMP_EXECUTOR_H
@@ -41,6 +41,9 @@
 #  if _CCCL_HAS_BACKEND_CUDA()
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_HOST_PSTL_BACKEND()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#  endif // _CCCL_HAS_HOST_PSTL_BACKEND()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -62,7 +65,7 @@ struct __reverse_fn
       , __count_(__count)
   {}
 
-  _CCCL_DEVICE_API constexpr void operator()(const iter_difference_t<_InputIterator> __index) const noexcept
+  _CCCL_API constexpr void operator()(const iter_difference_t<_InputIterator> __index) const noexcept
   {
     ::cuda::std::iter_swap(__first_ + __index, __last_ + __index);
   }
@@ -49,6 +49,10 @@
 #    include <cuda/std/__pstl/cuda/for_each_n.h>
 #    include <cuda/std/__pstl/cuda/transform.h>
 #  endif // _CCCL_HAS_BACKEND_CUDA()
+#  if _CCCL_HAS_HOST_PSTL_BACKEND()
+#    include <cuda/std/__pstl/host/for_each_n.h>
+#    include <cuda/std/__pstl/host/transform.h>
+#  endif // _CCCL_HAS_HOST_PSTL_BACKEND()
 
 #  include <cuda/std/__cccl/prologue.h>
 
@@ -61,7 +65,7 @@ struct __swap_ranges_iter_swap_fn
   _InputIterator2 __first2;
 
   template <class _DifferenceType>
-  _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
+  _CCCL_API _CCCL_FORCEINLINE constexpr void operator()(const _DifferenceType __index) const
   {
     ::cuda::std::iter_swap(__first1 + __index, __first2 + static_cast<iter_difference_t<_InputIterator2>>(__index));
   }
@@ -70,7 +74,7 @@ struct __swap_ranges_iter_swap_fn
 struct __swap_ranges_transform_fn
 {
   template <class _Tp, class _Up>
-  [[nodiscard]] _CCCL_DEVICE_API _CCCL_FORCEINLINE constexpr auto _CCCL_STATIC_CALL_OPERATOR(_Tp __lhs, _Up __rhs)
+  [[nodiscard]] _CCCL_API _CCCL_FORCEINLINE constexpr auto _CCCL_STATIC_CALL_OPERATOR(_Tp __lhs, _Up __rhs)
   {
     using ::cuda::std::swap;
     swap(__lhs, __rhs);
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___PSTL_TBB_EXECUTOR_H
+#define _CUDA_STD___PSTL_TBB_EXECUTOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_BACKEND_TBB()
+
+#  include <cuda/std/cstddef>
+
+#  include <tbb/parallel_for.h>
+#  include <tbb/task_arena.h>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_EXECUTION
+
+//! @brief Runs the chunks of work of the host backend as TBB tasks in the current task arena
+struct __pstl_tbb_executor
+{
+  //! @brief The smallest number of elements worth handing to a separate task
+  static constexpr size_t __min_chunk_size = 2048;
+
+  //! @brief Returns the number of threads work can be spread over
+  [[nodiscard]] _CCCL_HOST_API static size_t __concurrency() noexcept
+  {
+    return static_cast<size_t>(::tbb::this_task_arena::max_concurrency());
+  }
+
+  //! @brief Invokes @p __fn(__i) for every @p __i in [0, @p __n), potentially concurrently
+  template <class _Fn>
+  _CCCL_HOST_API static void __parallel_for(ptrdiff_t __n, _Fn& __fn)
+  {
+    ::tbb::parallel_for(ptrdiff_t{0}, __n, [&__fn](ptrdiff_t __i) {
+      __fn(__i);
+    });
+  }
+};
+
+_CCCL_END_NAMESPACE_CUDA_STD_EXECUTION
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_BACKEND_TBB()
+
+#endif // _CUDA_STD___PSTL_TBB_EXECUTOR_H
@@ -0,0 +1,63 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_GENERATE_BITS_H
+#define _CUDA_STD___RANDOM_GENERATE_BITS_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__type_traits/void_t.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// Engines that produce many values at once through a member __generate(first, n), like philox_engine and pcg64_engine
+template <class _URng, class = void>
+inline constexpr bool __cccl_random_has_bulk_generate = false;
+template <class _URng>
+inline constexpr bool __cccl_random_has_bulk_generate<
+  _URng,
+  void_t<decltype(::cuda::std::declval<_URng&>().__generate(
+    ::cuda::std::declval<typename _URng::result_type*>(), ::cuda::std::declval<size_t>()))>> = true;
+
+// Writes the next __n values of __g to __first, as if by *__first++ = __g() for each of them
+_CCCL_EXEC_CHECK_DISABLE
+template <class _URng, class _OutputIt>
+_CCCL_HOST_DEVICE_API void __generate_bits(_URng& __g, _OutputIt __first, size_t __n)
+{
+  if constexpr (__cccl_random_has_bulk_generate<_URng>)
+  {
+    __g.__generate(__first, __n);
+  }
+  else
+  {
+    for (size_t __i = 0; __i < __n; ++__i, ++__first)
+    {
+      *__first = __g();
+    }
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_GENERATE_BITS_H
@@ -27,6 +27,7 @@
 #include <cuda/std/__limits/numeric_limits.h>
 #include <cuda/std/__random/is_valid.h>
 #include <cuda/std/__random/uniform_real_distribution.h>
+#include <cuda/std/__random/ziggurat.h>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -135,6 +136,36 @@ public:
     return __up * __p.stddev() + __p.mean();
   }
 
+  // Writes independent values to every element of [__first, __last). On host and with a generator of 32 or 64 bits,
+  // the values are produced in blocks by the ziggurat method, and thus differ from those of operator(). A value saved
+  // by operator() is neither used nor changed.
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API void __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g)
+  {
+    __generate(__first, __last, __g, __p_);
+  }
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API void __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    if constexpr (__ziggurat_supports_urng<_URng>)
+    {
+      NV_IF_TARGET(NV_IS_HOST,
+                   (::cuda::std::__ziggurat_generate<__ziggurat_normal>(
+                      __first,
+                      __last,
+                      __g,
+                      [__mean = __p.mean(), __stddev = __p.stddev()](double __z) {
+                        return static_cast<result_type>(__z) * __stddev + __mean;
+                      });
+                    return;))
+    }
+    for (; __first != __last; ++__first)
+    {
+      *__first = (*this)(__g, __p);
+    }
+  }
+
   // property functions
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr result_type mean() const noexcept
   {
@@ -287,6 +287,97 @@ public:
     }
   }
 
+  //! Writes the next `__n` values of this philox_engine to `__first`, equivalent to `__n` invocations of operator().
+  //! For 32-bit words, the rounds of several consecutive counters are computed side by side, so that the compiler can
+  //! vectorize them.
+  //!
+  //! @param __first The beginning of the output range.
+  //! @param __n The number of random values to produce.
+  template <class _OutputIt>
+  _CCCL_HOST_DEVICE_API constexpr void __generate(_OutputIt __first, size_t __n) noexcept
+  {
+    // Return the values that remain in the output buffer
+    for (; __n > 0 && __j_ != word_count - 1; --__n, ++__first)
+    {
+      *__first = (*this)();
+    }
+
+    // The rounds of 32-bit engines are computed for several counters side by side, in 32-bit lanes whose products the
+    // compiler can vectorize. There are no vector instructions for the high half of 64-bit products.
+    if constexpr (word_size == 32)
+    {
+      constexpr size_t __lanes = 16;
+      for (; __n >= __lanes * word_count; __n -= __lanes * word_count)
+      {
+        // __S[__i][__l] is word __i of the counter of lane __l
+        array<array<uint32_t, __lanes>, word_count> __S = {};
+        for (size_t __l = 0; __l < __lanes; ++__l)
+        {
+          _CCCL_PRAGMA_UNROLL_FULL()
+          for (size_t __i = 0; __i < word_count; ++__i)
+          {
+            __S[__i][__l] = static_cast<uint32_t>(__x_[__i]);
+          }
+          __increment_counter();
+        }
+
+        array<uint32_t, word_count / 2> __K = {};
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __i = 0; __i < word_count / 2; ++__i)
+        {
+          __K[__i] = static_cast<uint32_t>(__k_[__i]);
+        }
+
+        _CCCL_PRAGMA_UNROLL_FULL()
+        for (size_t __j = 0; __j < round_count; ++__j)
+        {
+          // unrolling the lanes would keep the compiler from vectorizing them
+          _CCCL_PRAGMA_UNROLL(1)
+          for (size_t __l = 0; __l < __lanes; ++__l)
+          {
+            if constexpr (word_count == 2)
+            {
+              const uint64_t __p = uint64_t{__S[0][__l]} * static_cast<uint32_t>(multipliers[0]);
+              __S[0][__l]        = static_cast<uint32_t>(__p >> 32) ^ __K[0] ^ __S[1][__l];
+              __S[1][__l]        = static_cast<uint32_t>(__p);
+            }
+            else // word_count == 4
+            {
+              const uint32_t __v1 = __S[1][__l];
+              const uint32_t __v3 = __S[3][__l];
+              const uint64_t __p0 = uint64_t{__S[2][__l]} * static_cast<uint32_t>(multipliers[0]);
+              const uint64_t __p2 = uint64_t{__S[0][__l]} * static_cast<uint32_t>(multipliers[1]);
+              __S[0][__l]         = static_cast<uint32_t>(__p0 >> 32) ^ __K[0] ^ __v1;
+              __S[1][__l]         = static_cast<uint32_t>(__p0);
+              __S[2][__l]         = static_cast<uint32_t>(__p2 >> 32) ^ __K[1] ^ __v3;
+              __S[3][__l]         = static_cast<uint32_t>(__p2);
+            }
+          }
+
+          _CCCL_PRAGMA_UNROLL_FULL()
+          for (size_t __i = 0; __i < word_count / 2; ++__i)
+          {
+            __K[__i] = static_cast<uint32_t>(__K[__i] + round_consts[__i]);
+          }
+        }
+
+        for (size_t __l = 0; __l < __lanes; ++__l)
+        {
+          _CCCL_PRAGMA_UNROLL_FULL()
+          for (size_t __i = 0; __i < word_count; ++__i, ++__first)
+          {
+            *__first = static_cast<result_type>(__S[__i][__l]);
+          }
+        }
+      }
+    }
+
+    for (; __n > 0; --__n, ++__first)
+    {
+      *__first = (*this)();
+    }
+  }
+
   //! This function checks two philox_engines for equality.
   //! @param lhs The first philox_engine to test.
   //! @param rhs The second philox_engine to test.
@@ -205,8 +205,49 @@ public:
   };
 
 private:
+  using _UIntType = conditional_t<sizeof(result_type) <= sizeof(uint32_t), uint32_t, make_unsigned_t<result_type>>;
+
   param_type __p_;
 
+  // the number of values in [a, b], which is 0 if all values of _UIntType are
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _UIntType __range(const param_type& __p) noexcept
+  {
+    return _UIntType(__p.b()) - _UIntType(__p.a()) + _UIntType(1);
+  }
+
+  // the number of random bits to draw for a value of [0, __rp)
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr size_t __engine_bits(_UIntType __rp) noexcept
+  {
+    constexpr size_t __dt = numeric_limits<_UIntType>::digits;
+    if (__rp == 0)
+    {
+      return __dt;
+    }
+    size_t __w = __dt - ::cuda::std::countl_zero(__rp) - 1;
+    if ((__rp & ((numeric_limits<_UIntType>::max)() >> (__dt - __w))) != 0)
+    {
+      ++__w;
+    }
+    return __w;
+  }
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _Eng>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr result_type
+  __draw(_Eng& __e, _UIntType __rp, const param_type& __p) noexcept
+  {
+    if (__rp == 0)
+    {
+      return static_cast<result_type>(__e());
+    }
+    _UIntType __u = __e();
+    while (__u >= __rp)
+    {
+      __u = __e();
+    }
+    return static_cast<result_type>(__u + __p.a());
+  }
+
 public:
   // constructors and reset functions
   constexpr uniform_int_distribution() noexcept = default;
@@ -230,33 +271,44 @@ public:
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr result_type operator()(_URng& __g, const param_type& __p) noexcept
   {
     static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
-    using _UIntType = conditional_t<sizeof(result_type) <= sizeof(uint32_t), uint32_t, make_unsigned_t<result_type>>;
-    const _UIntType __rp = _UIntType(__p.b()) - _UIntType(__p.a()) + _UIntType(1);
+    const _UIntType __rp = __range(__p);
     if (__rp == 1)
     {
       return __p.a();
     }
-    constexpr size_t __dt = numeric_limits<_UIntType>::digits;
 
-    using _Eng = __independent_bits_engine<_URng, _UIntType>;
-    if (__rp == 0)
-    {
-      return static_cast<result_type>(_Eng(__g, __dt)());
-    }
+    __independent_bits_engine<_URng, _UIntType> __e(__g, __engine_bits(__rp));
+    return __draw(__e, __rp, __p);
+  }
 
-    size_t __w = __dt - ::cuda::std::countl_zero(__rp) - 1;
-    if ((__rp & ((numeric_limits<_UIntType>::max)() >> (__dt - __w))) != 0)
+  // Writes the values of successive calls of operator() to every element of [__first, __last), but computes the
+  // number of bits each value needs from the generator only once.
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API constexpr void __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g)
+  {
+    __generate(__first, __last, __g, __p_);
+  }
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API constexpr void
+  __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    const _UIntType __rp = __range(__p);
+    if (__rp == 1)
     {
-      ++__w;
+      for (; __first != __last; ++__first)
+      {
+        *__first = __p.a();
+      }
+      return;
     }
-    _Eng __e(__g, __w);
-    _UIntType __u = __e();
-    while (__u >= __rp)
+
+    __independent_bits_engine<_URng, _UIntType> __e(__g, __engine_bits(__rp));
+    for (; __first != __last; ++__first)
     {
-      __u = __e();
+      *__first = __draw(__e, __rp, __p);
     }
-
-    return static_cast<result_type>(__u + __p.a());
   }
 
   // property functions
@@ -20,11 +20,16 @@
 #  pragma system_header
 #endif // no system header
 
+#include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__host_stdlib/istream>
 #include <cuda/std/__host_stdlib/ostream>
+#include <cuda/std/__iterator/distance.h>
 #include <cuda/std/__limits/numeric_limits.h>
+#include <cuda/std/__random/generate_bits.h>
 #include <cuda/std/__random/generate_canonical.h>
 #include <cuda/std/__random/is_valid.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
 
 #include <cuda/std/__cccl/prologue.h>
 
@@ -106,6 +111,63 @@ public:
          + __p.a();
   }
 
+  // Writes the values of successive calls of operator() to every element of [__first, __last). On host, when every
+  // value takes a single value of a generator of at most 32 bits, the values are converted in blocks. Most hosts lack
+  // vector conversions of 64 bit integers to floating point values, so wider generators would gain nothing.
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API void __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g)
+  {
+    __generate(__first, __last, __g, __p_);
+  }
+  _CCCL_EXEC_CHECK_DISABLE
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_DEVICE_API void __generate(_ForwardIt __first, _ForwardIt __last, _URng& __g, const param_type& __p)
+  {
+    static_assert(__cccl_random_is_valid_urng<_URng>, "URng must meet the UniformRandomBitGenerator requirements");
+    if constexpr (::cuda::std::__generate_canonical_draws<_RealType, numeric_limits<_RealType>::digits, _URng>() == 1
+                  && static_cast<uint64_t>((_URng::max) () - (_URng::min) ()) <= uint64_t{0xffffffff})
+    {
+      NV_IF_TARGET(NV_IS_HOST, (__generate_blocks(__first, __last, __g, __p); return;))
+    }
+    for (; __first != __last; ++__first)
+    {
+      *__first = (*this)(__g, __p);
+    }
+  }
+
+private:
+  // generate_canonical of a single value of the generator, applied to blocks of values. The values of the generator
+  // fit into 32 bits.
+  template <class _ForwardIt, class _URng>
+  _CCCL_HOST_API static void __generate_blocks(_ForwardIt __first, _ForwardIt __last, _URng& __g, const param_type& __p)
+  {
+    constexpr size_t __block_size = 128;
+
+    const _RealType __rp    = static_cast<_RealType>((_URng::max) () - (_URng::min) ()) + _RealType(1);
+    const _RealType __width = __p.b() - __p.a();
+
+    uint32_t __bits[__block_size];
+    _RealType __values[__block_size];
+
+    auto __n = ::cuda::std::distance(__first, __last);
+    while (__n > 0)
+    {
+      const size_t __count = (::cuda::std::min) (__block_size, static_cast<size_t>(__n));
+      ::cuda::std::__generate_bits(__g, __bits, __count);
+      for (size_t __k = 0; __k < __count; ++__k)
+      {
+        const _RealType __canonical = static_cast<_RealType>(__bits[__k] - (_URng::min) ()) / __rp;
+        __values[__k]               = __width * __canonical + __p.a();
+      }
+      for (size_t __k = 0; __k < __count; ++__k, ++__first)
+      {
+        *__first = __values[__k];
+      }
+      __n -= static_cast<decltype(__n)>(__count);
+    }
+  }
+
+public:
   // property functions
   [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr result_type a() const noexcept
   {
@@ -0,0 +1,272 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___RANDOM_ZIGGURAT_H
+#define _CUDA_STD___RANDOM_ZIGGURAT_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__cmath/abs.h>
+#include <cuda/std/__cmath/exponential_functions.h>
+#include <cuda/std/__cmath/logarithms.h>
+#include <cuda/std/__cmath/roots.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__random/generate_bits.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+#include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD
+
+// The ziggurat method of Marsaglia and Tsang, "The Ziggurat Method for Generating Random Variables" (2000), for the
+// decreasing densities of the normal and exponential distributions. The area below the density is covered by 256
+// layers of equal area, and a sample is a random point in a random layer. Most points fall into the part of the layer
+// that is entirely below the density and are accepted with one comparison, which makes the method suitable for
+// producing blocks of values with vector instructions on the host.
+//
+// Every candidate consumes a single 64 bit word, whose low 8 bits choose the layer and whose high 53 bits are the
+// position in the layer. Hence the method is only used with generators that produce 32 or 64 uniformly random bits.
+
+inline constexpr size_t __ziggurat_layers = 256;
+
+// the number of values produced at once, chosen so the intermediate buffers stay in the L1 cache
+inline constexpr size_t __ziggurat_block_size = 128;
+
+template <class _URng>
+inline constexpr bool __ziggurat_urng_is_32_bit =
+  (_URng::min) () == 0 && static_cast<uint64_t>((_URng::max) ()) == uint64_t{0xffffffff};
+template <class _URng>
+inline constexpr bool __ziggurat_urng_is_64_bit =
+  (_URng::min) () == 0 && static_cast<uint64_t>((_URng::max) ()) == ~uint64_t{0};
+template <class _URng>
+inline constexpr bool __ziggurat_supports_urng = __ziggurat_urng_is_32_bit<_URng> || __ziggurat_urng_is_64_bit<_URng>;
+
+// x is the right edge of each layer, starting at the base layer, and f the density at the edges
+struct __ziggurat_table
+{
+  double __x[__ziggurat_layers + 1];
+  double __f[__ziggurat_layers + 1];
+};
+
+// The standard normal distribution, without the normalization of its density
+struct __ziggurat_normal
+{
+  static constexpr bool __symmetric = true;
+  static constexpr double __r       = 3.6541528853610088;
+  static constexpr double __v       = 4.92867323399e-3;
+
+  [[nodiscard]] _CCCL_HOST_API static double __f(double __x) noexcept
+  {
+    return ::cuda::std::exp(-0.5 * __x * __x);
+  }
+  [[nodiscard]] _CCCL_HOST_API static double __f_inv(double __y) noexcept
+  {
+    return ::cuda::std::sqrt(-2.0 * ::cuda::std::log(__y));
+  }
+};
+
+// The exponential distribution with a rate of 1
+struct __ziggurat_exponential
+{
+  static constexpr bool __symmetric = false;
+  static constexpr double __r       = 7.69711747013104972;
+  static constexpr double __v       = 3.949659822581572e-3;
+
+  [[nodiscard]] _CCCL_HOST_API static double __f(double __x) noexcept
+  {
+    return ::cuda::std::exp(-__x);
+  }
+  [[nodiscard]] _CCCL_HOST_API static double __f_inv(double __y) noexcept
+  {
+    return -::cuda::std::log(__y);
+  }
+};
+
+template <class _Shape>
+[[nodiscard]] _CCCL_HOST_API const __ziggurat_table& __ziggurat_table_of() noexcept
+{
+  static const __ziggurat_table __table = [] {
+    __ziggurat_table __t{};
+    __t.__x[0] = _Shape::__v / _Shape::__f(_Shape::__r);
+    __t.__x[1] = _Shape::__r;
+    for (size_t __i = 2; __i < __ziggurat_layers; ++__i)
+    {
+      __t.__x[__i] = _Shape::__f_inv(_Shape::__v / __t.__x[__i - 1] + _Shape::__f(__t.__x[__i - 1]));
+    }
+    __t.__x[__ziggurat_layers] = 0.0;
+    for (size_t __i = 0; __i <= __ziggurat_layers; ++__i)
+    {
+      __t.__f[__i] = _Shape::__f(__t.__x[__i]);
+    }
+    return __t;
+  }();
+  return __table;
+}
+
+template <class _URng>
+[[nodiscard]] _CCCL_HOST_API uint64_t __ziggurat_word(_URng& __g)
+{
+  if constexpr (__ziggurat_urng_is_32_bit<_URng>)
+  {
+    const uint64_t __hi = static_cast<uint64_t>(__g());
+    const uint64_t __lo = static_cast<uint64_t>(__g());
+    return (__hi << 32) | __lo;
+  }
+  else
+  {
+    return static_cast<uint64_t>(__g());
+  }
+}
+
+// fills __words with __n words of 64 random bits
+template <class _URng>
+_CCCL_HOST_API void __ziggurat_words(_URng& __g, uint64_t* __words, size_t __n)
+{
+  if constexpr (__ziggurat_urng_is_32_bit<_URng>)
+  {
+    uint32_t __halves[2 * __ziggurat_block_size];
+    ::cuda::std::__generate_bits(__g, __halves, 2 * __n);
+    for (size_t __i = 0; __i < __n; ++__i)
+    {
+      __words[__i] = (static_cast<uint64_t>(__halves[2 * __i]) << 32) | __halves[2 * __i + 1];
+    }
+  }
+  else
+  {
+    ::cuda::std::__generate_bits(__g, __words, __n);
+  }
+}
+
+// the position of the candidate in its layer, in [-1, 1) for symmetric and in [0, 1) for other densities
+template <class _Shape>
+[[nodiscard]] _CCCL_HOST_API double __ziggurat_position(uint64_t __word) noexcept
+{
+  if constexpr (_Shape::__symmetric)
+  {
+    return static_cast<double>(static_cast<int64_t>(__word) >> 11) * 0x1p-52;
+  }
+  else
+  {
+    return static_cast<double>(__word >> 11) * 0x1p-53;
+  }
+}
+
+// a uniform value in (0, 1)
+template <class _URng>
+[[nodiscard]] _CCCL_HOST_API double __ziggurat_open_uniform(_URng& __g)
+{
+  return (static_cast<double>(::cuda::std::__ziggurat_word(__g) >> 11) + 0.5) * 0x1p-53;
+}
+
+// A value beyond the base layer, on the side of __x
+template <class _Shape, class _URng>
+[[nodiscard]] _CCCL_HOST_API double __ziggurat_tail(_URng& __g, double __x)
+{
+  if constexpr (_Shape::__symmetric)
+  {
+    // Marsaglia, "Generating a variable from the tail of the normal distribution" (1964)
+    double __tx = 0.0;
+    double __ty = 0.0;
+    do
+    {
+      __tx = ::cuda::std::log(::cuda::std::__ziggurat_open_uniform(__g)) / _Shape::__r;
+      __ty = ::cuda::std::log(::cuda::std::__ziggurat_open_uniform(__g));
+    } while (-2.0 * __ty < __tx * __tx);
+    return __x < 0.0 ? __tx - _Shape::__r : _Shape::__r - __tx;
+  }
+  else
+  {
+    // the exponential distribution has no memory
+    return _Shape::__r - ::cuda::std::log(::cuda::std::__ziggurat_open_uniform(__g));
+  }
+}
+
+// Completes a candidate __x of layer __i that was not accepted by the fast test
+template <class _Shape, class _URng>
+[[nodiscard]] _CCCL_HOST_API double __ziggurat_slow(const __ziggurat_table& __t, _URng& __g, size_t __i, double __x)
+{
+  while (true)
+  {
+    if (__i == 0)
+    {
+      return ::cuda::std::__ziggurat_tail<_Shape>(__g, __x);
+    }
+    // the candidate is in the wedge between the rectangle below the density and the layer
+    const double __y = __t.__f[__i + 1] + (__t.__f[__i] - __t.__f[__i + 1]) * ::cuda::std::__ziggurat_open_uniform(__g);
+    if (__y < _Shape::__f(__x))
+    {
+      return __x;
+    }
+
+    const uint64_t __word = ::cuda::std::__ziggurat_word(__g);
+    __i                   = static_cast<size_t>(__word & (__ziggurat_layers - 1));
+    __x                   = ::cuda::std::__ziggurat_position<_Shape>(__word) * __t.__x[__i];
+    if (::cuda::std::abs(__x) < __t.__x[__i + 1])
+    {
+      return __x;
+    }
+  }
+}
+
+// Writes __transform(z) to every element of [__first, __last), where z are independent values of the density of
+// _Shape. Each block of values is produced in two passes: the first computes a candidate for every value and whether it
+// is accepted right away without branches, so that it can be vectorized, and the second resolves the rare candidates
+// that were not.
+template <class _Shape, class _ForwardIt, class _URng, class _Transform>
+_CCCL_HOST_API void __ziggurat_generate(_ForwardIt __first, _ForwardIt __last, _URng& __g, _Transform __transform)
+{
+  const __ziggurat_table& __t = ::cuda::std::__ziggurat_table_of<_Shape>();
+
+  uint64_t __words[__ziggurat_block_size];
+  double __values[__ziggurat_block_size];
+  bool __accepted[__ziggurat_block_size];
+
+  auto __n = ::cuda::std::distance(__first, __last);
+  while (__n > 0)
+  {
+    const size_t __count = (::cuda::std::min) (__ziggurat_block_size, static_cast<size_t>(__n));
+    ::cuda::std::__ziggurat_words(__g, __words, __count);
+
+    for (size_t __k = 0; __k < __count; ++__k)
+    {
+      const size_t __i = static_cast<size_t>(__words[__k] & (__ziggurat_layers - 1));
+      const double __x = ::cuda::std::__ziggurat_position<_Shape>(__words[__k]) * __t.__x[__i];
+      __values[__k]    = __x;
+      __accepted[__k]  = ::cuda::std::abs(__x) < __t.__x[__i + 1];
+    }
+
+    for (size_t __k = 0; __k < __count; ++__k, ++__first)
+    {
+      if (!__accepted[__k])
+      {
+        const size_t __i = static_cast<size_t>(__words[__k] & (__ziggurat_layers - 1));
+        __values[__k]    = ::cuda::std::__ziggurat_slow<_Shape>(__t, __g, __i, __values[__k]);
+      }
+      *__first = __transform(__values[__k]);
+    }
+    __n -= static_cast<decltype(__n)>(__count);
+  }
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD
+
+#include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CUDA_STD___RANDOM_ZIGGURAT_H
@@ -87,6 +87,36 @@ class basic_mask<_Bytes, _Abi, enable_if_t<__is_vectorizable_byte_size_v<_Bytes>
       : __s_{__v}
   {}
 
+  // Mask reductions, dispatched from reductions.h via ADL
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr bool __simd_all_of_impl(const basic_mask& __k) noexcept
+  {
+    return _Impl::__all_of(__k.__s_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr bool __simd_any_of_impl(const basic_mask& __k) noexcept
+  {
+    return _Impl::__any_of(__k.__s_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr __simd_size_type
+  __simd_reduce_count_impl(const basic_mask& __k) noexcept
+  {
+    return _Impl::__count(__k.__s_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr __simd_size_type
+  __simd_reduce_min_index_impl(const basic_mask& __k) noexcept
+  {
+    return _Impl::__min_index(__k.__s_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr __simd_size_type
+  __simd_reduce_max_index_impl(const basic_mask& __k) noexcept
+  {
+    return _Impl::__max_index(__k.__s_);
+  }
+
 public:
   using value_type = bool;
   using abi_type   = _Abi;
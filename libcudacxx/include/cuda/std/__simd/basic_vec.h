@@ -146,6 +146,24 @@ private:
     return basic_vec{_Impl::__max_simd(__lhs.__s_, __rhs.__s_), __storage_tag};
   }
 
+  // Reductions with one of plus<>, multiplies<>, bit_and<>, bit_or<>, or bit_xor<>, dispatched from reductions.h
+  template <typename _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr value_type
+  __simd_reduce_impl(const basic_vec& __x, const _BinaryOp __binary_op) noexcept
+  {
+    return _Impl::__reduce(__x.__s_, __binary_op);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr value_type __simd_reduce_min_impl(const basic_vec& __x) noexcept
+  {
+    return _Impl::__reduce_min(__x.__s_);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API friend constexpr value_type __simd_reduce_max_impl(const basic_vec& __x) noexcept
+  {
+    return _Impl::__reduce_max(__x.__s_);
+  }
+
 public:
   using abi_type = _Abi;
 
@@ -34,6 +34,7 @@
 #include <cuda/std/__simd/basic_mask.h>
 #include <cuda/std/__simd/basic_vec.h>
 #include <cuda/std/__type_traits/always_false.h>
+#include <cuda/std/__type_traits/conditional.h>
 #include <cuda/std/__type_traits/type_identity.h>
 #include <cuda/std/__utility/declval.h>
 
@@ -61,6 +62,18 @@ inline constexpr bool __is_reduce_default_supported_operation_v =
   || __is_bit_or_op_v<_BinaryOp> //
   || __is_bit_xor_op_v<_BinaryOp>;
 
+// The operations of __is_reduce_default_supported_operation_v are associative and commutative, and are reduced with the
+// transparent function object, which is invocable with both elements and host vector registers
+template <typename _BinaryOp>
+using __reduce_default_operation_t =
+  conditional_t<__is_plus_op_v<_BinaryOp>,
+                plus<>,
+                conditional_t<__is_multiplies_op_v<_BinaryOp>,
+                              multiplies<>,
+                              conditional_t<__is_bit_and_op_v<_BinaryOp>,
+                                            bit_and<>,
+                                            conditional_t<__is_bit_or_op_v<_BinaryOp>, bit_or<>, bit_xor<>>>>>;
+
 template <typename _Tp, typename _BinaryOp>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp __default_identity_element() noexcept
 {
@@ -92,13 +105,20 @@ _CCCL_REQUIRES(__reduction_binary_operation<_BinaryOperation, _Tp>)
 reduce(const basic_vec<_Tp, _Abi>& __x,
        _BinaryOperation __binary_op = {}) noexcept(__is_nothrow_reduction_binary_operation_v<_BinaryOperation, _Tp>)
 {
-  vec<_Tp, 1> __result{__x[0]};
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
+  if constexpr (__is_reduce_default_supported_operation_v<_BinaryOperation>)
   {
-    __result = __binary_op(__result, vec<_Tp, 1>{__x[__i]});
+    return __simd_reduce_impl(__x, __reduce_default_operation_t<_BinaryOperation>{}); // ADL
+  }
+  else
+  {
+    vec<_Tp, 1> __result{__x[0]};
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
+    {
+      __result = __binary_op(__result, vec<_Tp, 1>{__x[__i]});
+    }
+    return __result[0];
   }
-  return __result[0];
 }
 
 // We need two overloads:
@@ -143,17 +163,7 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_min(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
-  auto __result = __x[0];
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
-  {
-    const auto __val = __x[__i];
-    if (__val < __result)
-    {
-      __result = __val;
-    }
-  }
-  return __result;
+  return __simd_reduce_min_impl(__x); // ADL
 }
 
 _CCCL_TEMPLATE(typename _Tp, typename _Abi)
@@ -183,17 +193,7 @@ _CCCL_TEMPLATE(typename _Tp, typename _Abi)
 _CCCL_REQUIRES(totally_ordered<_Tp>)
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr _Tp reduce_max(const basic_vec<_Tp, _Abi>& __x) noexcept
 {
-  auto __result = __x[0];
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 1; __i < __x.__size; ++__i)
-  {
-    const auto __val = __x[__i];
-    if (__result < __val)
-    {
-      __result = __val;
-    }
-  }
-  return __result;
+  return __simd_reduce_max_impl(__x); // ADL
 }
 
 _CCCL_TEMPLATE(typename _Tp, typename _Abi)
@@ -222,29 +222,13 @@ reduce_max(const basic_vec<_Tp, _Abi>& __x, const typename basic_vec<_Tp, _Abi>:
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool all_of(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
-  {
-    if (!__k[__i])
-    {
-      return false;
-    }
-  }
-  return true;
+  return __simd_all_of_impl(__k); // ADL
 }
 
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr bool any_of(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
-  {
-    if (__k[__i])
-    {
-      return true;
-    }
-  }
-  return false;
+  return __simd_any_of_impl(__k); // ADL
 }
 
 template <size_t _Bytes, typename _Abi>
@@ -256,13 +240,7 @@ template <size_t _Bytes, typename _Abi>
 template <size_t _Bytes, typename _Abi>
 [[nodiscard]] _CCCL_HOST_DEVICE_API constexpr __simd_size_type reduce_count(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
-  __simd_size_type __count = 0;
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
-  {
-    __count += static_cast<__simd_size_type>(__k[__i]);
-  }
-  return __count;
+  return __simd_reduce_count_impl(__k); // ADL
 }
 
 template <size_t _Bytes, typename _Abi>
@@ -270,15 +248,7 @@ template <size_t _Bytes, typename _Abi>
 reduce_min_index(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
   _CCCL_ASSERT(::cuda::std::simd::any_of(__k), "No bits are set");
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = 0; __i < __k.__size; ++__i)
-  {
-    if (__k[__i])
-    {
-      return __i;
-    }
-  }
-  return __simd_size_type{-1};
+  return __simd_reduce_min_index_impl(__k); // ADL
 }
 
 template <size_t _Bytes, typename _Abi>
@@ -286,15 +256,7 @@ template <size_t _Bytes, typename _Abi>
 reduce_max_index(const basic_mask<_Bytes, _Abi>& __k) noexcept
 {
   _CCCL_ASSERT(::cuda::std::simd::any_of(__k), "No bits are set");
-  _CCCL_PRAGMA_UNROLL_FULL()
-  for (__simd_size_type __i = __k.__size - 1; __i >= 0; --__i)
-  {
-    if (__k[__i])
-    {
-      return __i;
-    }
-  }
-  return __simd_size_type{-1};
+  return __simd_reduce_max_index_impl(__k); // ADL
 }
 
 // Scalar bool overloads
@@ -41,9 +41,9 @@ inline constexpr __simd_operations_kind __simd_operations_kind_v<float, __fixed_
 // Simd operations for fixed_size ABI with float elements and F32x2 fast paths.
 template <__simd_size_type _Np>
 struct __simd_operations<float, __fixed_size<_Np>, __simd_operations_kind::__fixed_size_float>
-    : __fixed_size_operations<float, _Np>
+    : __fixed_size_host_vector_operations<float, _Np>
 {
-  using __base       = __fixed_size_operations<float, _Np>;
+  using __base       = __fixed_size_host_vector_operations<float, _Np>;
   using _SimdStorage = __simd_storage<float, __fixed_size<_Np>>;
 
   _CCCL_HOST_DEVICE_API static constexpr void __increment(_SimdStorage& __s) noexcept
@@ -69,9 +69,10 @@ inline constexpr __simd_operations_kind __simd_operations_kind_v<_Tp, __fixed_si
 
 // Simd operations for fixed_size ABI with small integral element types.
 template <typename _Tp, __simd_size_type _Np>
-struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_small_integral> : __fixed_size_operations<_Tp, _Np>
+struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_small_integral>
+    : __fixed_size_host_vector_operations<_Tp, _Np>
 {
-  using __base           = __fixed_size_operations<_Tp, _Np>;
+  using __base           = __fixed_size_host_vector_operations<_Tp, _Np>;
   using __simd_storage_t = __simd_storage<_Tp, __fixed_size<_Np>>;
 
   // all computation is done on uint32_t, so the alignment must be at least the alignment of uint32_t
@@ -94,7 +95,7 @@ struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_small_integra
       }
       return ::cuda::std::simd::__copy_from_unsigned_storage<__simd_storage_t>(__udata);
     }
-    return __fixed_size_operations<_Tp, _Np>::__bitwise_not(__s);
+    return __base::__bitwise_not(__s);
   }
 
   _CCCL_SIMD_FIXED_SIZE_INTEGRAL_BINARY_BITWISE(__bitwise_and, &)
@@ -190,7 +191,7 @@ struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_small_integra
       }
 #  endif // _CCCL_HAS_SIMD_8BIT()
     }
-    return __fixed_size_operations<_Tp, _Np>::__plus(__lhs, __rhs);
+    return __base::__plus(__lhs, __rhs);
   }
 
   [[nodiscard]]
@@ -26,9 +26,12 @@
 #include <cuda/std/__fwd/simd.h>
 #include <cuda/std/__simd/abi.h>
 #include <cuda/std/__simd/specializations/fixed_size_storage.h>
+#include <cuda/std/__simd/specializations/host_vector.h>
 #include <cuda/std/__type_traits/integral_constant.h>
 #include <cuda/std/__utility/integer_sequence.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
@@ -164,6 +167,101 @@ struct __mask_operations<_Bytes, __fixed_size<_Np>>
     }
     return __result;
   }
+
+  // Reductions (for all_of, any_of, reduce_count, reduce_min_index, and reduce_max_index)
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr bool __any_of(const _MaskStorage& __s) noexcept
+  {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_mask_any_of(__s.__data);))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      if (__s.__data[__i])
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr __simd_size_type __count(const _MaskStorage& __s) noexcept
+  {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_mask_count(__s.__data);))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    __simd_size_type __count = 0;
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      __count += static_cast<__simd_size_type>(__s.__data[__i]);
+    }
+    return __count;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr bool __all_of(const _MaskStorage& __s) noexcept
+  {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_mask_count(__s.__data) == _Np;))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      if (!__s.__data[__i])
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr __simd_size_type __min_index(const _MaskStorage& __s) noexcept
+  {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_mask_min_index(__s.__data);))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 0; __i < _Np; ++__i)
+    {
+      if (__s.__data[__i])
+      {
+        return __i;
+      }
+    }
+    return __simd_size_type{-1};
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr __simd_size_type __max_index(const _MaskStorage& __s) noexcept
+  {
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+    {
+      NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_mask_max_index(__s.__data);))
+    }
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = _Np - 1; __i >= 0; --__i)
+    {
+      if (__s.__data[__i])
+      {
+        return __i;
+      }
+    }
+    return __simd_size_type{-1};
+  }
 };
 
 _CCCL_END_NAMESPACE_CUDA_STD_SIMD
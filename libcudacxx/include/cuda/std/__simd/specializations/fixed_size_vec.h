@@ -24,13 +24,19 @@
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__cmath/fma.h>
+#include <cuda/std/__functional/operations.h>
 #include <cuda/std/__fwd/simd.h>
 #include <cuda/std/__simd/abi.h>
 #include <cuda/std/__simd/specializations/fixed_size_mask.h>
 #include <cuda/std/__simd/specializations/fixed_size_storage.h>
+#include <cuda/std/__simd/specializations/host_vector.h>
 #include <cuda/std/__type_traits/integral_constant.h>
+#include <cuda/std/__type_traits/is_floating_point.h>
+#include <cuda/std/__type_traits/is_integral.h>
 #include <cuda/std/__utility/integer_sequence.h>
 
+#include <nv/target>
+
 #include <cuda/std/__cccl/prologue.h>
 
 _CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
@@ -364,11 +370,208 @@ struct __fixed_size_operations
     }
     return __result;
   }
+
+  // Reductions
+
+  template <typename _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp
+  __reduce(const _SimdStorage& __s, const _BinaryOp __binary_op) noexcept
+  {
+    _Tp __result = __s.__data[0];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 1; __i < _Np; ++__i)
+    {
+      __result = static_cast<_Tp>(__binary_op(__result, __s.__data[__i]));
+    }
+    return __result;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp __reduce_min(const _SimdStorage& __s) noexcept
+  {
+    _Tp __result = __s.__data[0];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 1; __i < _Np; ++__i)
+    {
+      if (__s.__data[__i] < __result)
+      {
+        __result = __s.__data[__i];
+      }
+    }
+    return __result;
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp __reduce_max(const _SimdStorage& __s) noexcept
+  {
+    _Tp __result = __s.__data[0];
+    _CCCL_PRAGMA_UNROLL_FULL()
+    for (__simd_size_type __i = 1; __i < _Np; ++__i)
+    {
+      if (__result < __s.__data[__i])
+      {
+        __result = __s.__data[__i];
+      }
+    }
+    return __result;
+  }
 };
 
-// Default path (no optimizations)
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+#  define _CCCL_SIMD_HOST_VECTOR_UNARY(_NAME, _ENABLED, _OP)                                                 \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage _NAME(const _SimdStorage& __s) noexcept \
+    {                                                                                                         \
+      if constexpr (_ENABLED)                                                                                 \
+      {                                                                                                       \
+        _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                        \
+        {                                                                                                     \
+          NV_IF_TARGET(NV_IS_HOST, ({                                                                         \
+                         _SimdStorage __result;                                                               \
+                         ::cuda::std::simd::__host_vector_transform(__s.__data, __result.__data, _OP{});      \
+                         return __result;                                                                     \
+                       }))                                                                                    \
+        }                                                                                                     \
+      }                                                                                                       \
+      return __base::_NAME(__s);                                                                              \
+    }
+
+#  define _CCCL_SIMD_HOST_VECTOR_BINARY(_NAME, _ENABLED, _OP)                                                        \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _SimdStorage _NAME(                                         \
+      const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept                                                 \
+    {                                                                                                                \
+      if constexpr (_ENABLED)                                                                                        \
+      {                                                                                                              \
+        _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                               \
+        {                                                                                                            \
+          NV_IF_TARGET(NV_IS_HOST, ({                                                                                \
+                         _SimdStorage __result;                                                                      \
+                         ::cuda::std::simd::__host_vector_transform(__lhs.__data, __rhs.__data, __result.__data, _OP{}); \
+                         return __result;                                                                            \
+                       }))                                                                                           \
+        }                                                                                                            \
+      }                                                                                                              \
+      return __base::_NAME(__lhs, __rhs);                                                                            \
+    }
+
+#  define _CCCL_SIMD_HOST_VECTOR_COMPARE(_NAME, _OP)                                                               \
+    [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _MaskStorage _NAME(                                       \
+      const _SimdStorage& __lhs, const _SimdStorage& __rhs) noexcept                                               \
+    {                                                                                                              \
+      if constexpr (__is_host_vectorizable_v<_Tp>)                                                                 \
+      {                                                                                                            \
+        _CCCL_IF_NOT_CONSTEVAL_DEFAULT                                                                             \
+        {                                                                                                          \
+          NV_IF_TARGET(NV_IS_HOST, ({                                                                              \
+                         _MaskStorage __result;                                                                    \
+                         ::cuda::std::simd::__host_vector_compare(__lhs.__data, __rhs.__data, __result.__data, _OP{}); \
+                         return __result;                                                                          \
+                       }))                                                                                         \
+        }                                                                                                          \
+      }                                                                                                            \
+      return __base::_NAME(__lhs, __rhs);                                                                          \
+    }
+
+// Simd operations for fixed_size ABI which process the elements in host vector registers. Integer division, modulo,
+// and fma are left to the scalar loops, which the compiler vectorizes where the instruction set allows it.
+template <typename _Tp, __simd_size_type _Np>
+struct __fixed_size_host_vector_operations : __fixed_size_operations<_Tp, _Np>
+{
+  using __base       = __fixed_size_operations<_Tp, _Np>;
+  using _SimdStorage = typename __base::_SimdStorage;
+  using _MaskStorage = typename __base::_MaskStorage;
+
+  static constexpr bool __vectorize      = __is_host_vectorizable_v<_Tp>;
+  static constexpr bool __vectorize_bits = __vectorize && is_integral_v<_Tp>;
+
+  // Unary operations
+
+  _CCCL_SIMD_HOST_VECTOR_UNARY(__bitwise_not, __vectorize_bits, bit_not<>)
+  _CCCL_SIMD_HOST_VECTOR_UNARY(__unary_minus, __vectorize, negate<>)
+
+  // Binary arithmetic operations
+
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__plus, __vectorize, plus<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__minus, __vectorize, minus<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__multiplies, __vectorize, multiplies<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__divides, __vectorize && is_floating_point_v<_Tp>, divides<>)
+
+  // Min/max operations
+
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__min_simd, __vectorize, __host_vector_min)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__max_simd, __vectorize, __host_vector_max)
+
+  // Comparison operations
+
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__equal_to, equal_to<>)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__not_equal_to, not_equal_to<>)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__less, less<>)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__less_equal, less_equal<>)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__greater, greater<>)
+  _CCCL_SIMD_HOST_VECTOR_COMPARE(__greater_equal, greater_equal<>)
+
+  // Bitwise and shift operations, 8-bit and 16-bit shifts have no vector instructions
+
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__bitwise_and, __vectorize_bits, bit_and<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__bitwise_or, __vectorize_bits, bit_or<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__bitwise_xor, __vectorize_bits, bit_xor<>)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__shift_left, __vectorize_bits && sizeof(_Tp) >= 4, __host_vector_shift_left)
+  _CCCL_SIMD_HOST_VECTOR_BINARY(__shift_right, __vectorize_bits && sizeof(_Tp) >= 4, __host_vector_shift_right)
+
+  // Reductions
+
+  template <typename _BinaryOp>
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp
+  __reduce(const _SimdStorage& __s, const _BinaryOp __binary_op) noexcept
+  {
+    if constexpr (__vectorize)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_vector_reduce(__s.__data, __binary_op);))
+      }
+    }
+    return __base::__reduce(__s, __binary_op);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp __reduce_min(const _SimdStorage& __s) noexcept
+  {
+    if constexpr (__vectorize)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_vector_reduce(__s.__data, __host_vector_min{});))
+      }
+    }
+    return __base::__reduce_min(__s);
+  }
+
+  [[nodiscard]] _CCCL_HOST_DEVICE_API static constexpr _Tp __reduce_max(const _SimdStorage& __s) noexcept
+  {
+    if constexpr (__vectorize)
+    {
+      _CCCL_IF_NOT_CONSTEVAL_DEFAULT
+      {
+        NV_IF_TARGET(NV_IS_HOST, (return ::cuda::std::simd::__host_vector_reduce(__s.__data, __host_vector_max{});))
+      }
+    }
+    return __base::__reduce_max(__s);
+  }
+};
+
+#  undef _CCCL_SIMD_HOST_VECTOR_UNARY
+#  undef _CCCL_SIMD_HOST_VECTOR_BINARY
+#  undef _CCCL_SIMD_HOST_VECTOR_COMPARE
+
+#else // ^^^ _CCCL_HAS_SIMD_HOST_VECTOR() ^^^ / vvv !_CCCL_HAS_SIMD_HOST_VECTOR() vvv
+
+template <typename _Tp, __simd_size_type _Np>
+using __fixed_size_host_vector_operations = __fixed_size_operations<_Tp, _Np>;
+
+#endif // ^^^ !_CCCL_HAS_SIMD_HOST_VECTOR() ^^^
+
+// Default path (host vector registers, no device optimizations)
 template <typename _Tp, __simd_size_type _Np>
-struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_kind::__default> : __fixed_size_operations<_Tp, _Np>
+struct __simd_operations<_Tp, __fixed_size<_Np>, __simd_operations_kind::__default>
+    : __fixed_size_host_vector_operations<_Tp, _Np>
 {};
 
 _CCCL_END_NAMESPACE_CUDA_STD_SIMD
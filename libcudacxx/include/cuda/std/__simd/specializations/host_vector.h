@@ -0,0 +1,307 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
+#define _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
+
+#include <cuda/std/detail/__config>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#if _CCCL_HAS_SIMD_HOST_VECTOR()
+
+#  include <cuda/std/__bit/bit_cast.h>
+#  include <cuda/std/__bit/countl.h>
+#  include <cuda/std/__bit/countr.h>
+#  include <cuda/std/__bit/popcount.h>
+#  include <cuda/std/__cstddef/types.h>
+#  include <cuda/std/__cstring/memcpy.h>
+#  include <cuda/std/__simd/abi.h>
+#  include <cuda/std/__type_traits/conditional.h>
+#  include <cuda/std/__type_traits/is_arithmetic.h>
+#  include <cuda/std/__type_traits/is_integral.h>
+#  include <cuda/std/__type_traits/is_same.h>
+#  include <cuda/std/__type_traits/is_signed.h>
+#  include <cuda/std/__type_traits/make_nbit_int.h>
+#  include <cuda/std/cstdint>
+
+#  include <cuda/std/__cccl/prologue.h>
+
+_CCCL_BEGIN_NAMESPACE_CUDA_STD_SIMD
+
+// Host vector registers for the fixed_size operations. Every helper processes the elements in full registers, and the
+// remaining elements one at a time.
+
+template <typename _Tp>
+inline constexpr bool __is_host_vectorizable_v =
+  (is_integral_v<_Tp> && !is_same_v<_Tp, bool> && sizeof(_Tp) <= sizeof(uint64_t)) || is_same_v<_Tp, float>
+  || is_same_v<_Tp, double>;
+
+// Character types are not valid vector elements, so integral lanes use the fixed width integer of the same signedness
+template <typename _Tp, size_t _Bytes = _CCCL_SIMD_HOST_VECTOR_BYTES()>
+struct __host_vector
+{
+  using __lane_type = conditional_t<is_integral_v<_Tp>, __make_nbit_int_t<sizeof(_Tp) * 8, is_signed_v<_Tp>>, _Tp>;
+  using __type [[__gnu__::__vector_size__(_Bytes)]] = __lane_type;
+
+  static constexpr __simd_size_type __lanes = _Bytes / sizeof(_Tp);
+};
+
+template <typename _Tp>
+using __host_vector_t = typename __host_vector<_Tp>::__type;
+
+template <typename _Tp>
+[[nodiscard]] _CCCL_HOST_API __host_vector_t<_Tp> __host_vector_load(const _Tp* __ptr) noexcept
+{
+  __host_vector_t<_Tp> __v;
+  ::cuda::std::memcpy(&__v, __ptr, sizeof(__v));
+  return __v;
+}
+
+template <typename _Tp>
+_CCCL_HOST_API void __host_vector_store(_Tp* __ptr, const __host_vector_t<_Tp>& __v) noexcept
+{
+  ::cuda::std::memcpy(__ptr, &__v, sizeof(__v));
+}
+
+// Lane-wise __mask ? __lhs : __rhs, where the lanes of __mask are all ones or all zeros
+template <typename _Mask, typename _Up>
+[[nodiscard]] _CCCL_HOST_API _Up __host_vector_select(const _Mask& __mask, const _Up& __lhs, const _Up& __rhs) noexcept
+{
+  if constexpr (is_arithmetic_v<_Up>)
+  {
+    return __mask ? __lhs : __rhs;
+  }
+  else
+  {
+    const auto __lhs_bits = ::cuda::std::bit_cast<_Mask>(__lhs);
+    const auto __rhs_bits = ::cuda::std::bit_cast<_Mask>(__rhs);
+    return ::cuda::std::bit_cast<_Up>((__lhs_bits & __mask) | (__rhs_bits & ~__mask));
+  }
+}
+
+// cuda::std::min and cuda::std::max, on both registers and elements
+struct __host_vector_min
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up& __lhs, const _Up& __rhs) const noexcept
+  {
+    return ::cuda::std::simd::__host_vector_select(__rhs < __lhs, __rhs, __lhs);
+  }
+};
+
+struct __host_vector_max
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API _Up operator()(const _Up& __lhs, const _Up& __rhs) const noexcept
+  {
+    return ::cuda::std::simd::__host_vector_select(__lhs < __rhs, __rhs, __lhs);
+  }
+};
+
+struct __host_vector_shift_left
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(const _Up& __lhs, const _Up& __rhs) const noexcept
+  {
+    return __lhs << __rhs;
+  }
+};
+
+struct __host_vector_shift_right
+{
+  template <typename _Up>
+  [[nodiscard]] _CCCL_HOST_API auto operator()(const _Up& __lhs, const _Up& __rhs) const noexcept
+  {
+    return __lhs >> __rhs;
+  }
+};
+
+template <typename _Tp, __simd_size_type _Np, typename _UnaryOp>
+_CCCL_HOST_API void
+__host_vector_transform(const _Tp (&__data)[_Np], _Tp (&__result)[_Np], const _UnaryOp __unary_op) noexcept
+{
+  constexpr auto __lanes = __host_vector<_Tp>::__lanes;
+  __simd_size_type __i   = 0;
+  for (; __i + __lanes <= _Np; __i += __lanes)
+  {
+    ::cuda::std::simd::__host_vector_store(
+      __result + __i, __unary_op(::cuda::std::simd::__host_vector_load(__data + __i)));
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __result[__i] = static_cast<_Tp>(__unary_op(__data[__i]));
+  }
+}
+
+template <typename _Tp, __simd_size_type _Np, typename _BinaryOp>
+_CCCL_HOST_API void __host_vector_transform(
+  const _Tp (&__lhs)[_Np], const _Tp (&__rhs)[_Np], _Tp (&__result)[_Np], const _BinaryOp __binary_op) noexcept
+{
+  constexpr auto __lanes = __host_vector<_Tp>::__lanes;
+  __simd_size_type __i   = 0;
+  for (; __i + __lanes <= _Np; __i += __lanes)
+  {
+    ::cuda::std::simd::__host_vector_store(
+      __result + __i,
+      __binary_op(::cuda::std::simd::__host_vector_load(__lhs + __i), ::cuda::std::simd::__host_vector_load(__rhs + __i)));
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __result[__i] = static_cast<_Tp>(__binary_op(__lhs[__i], __rhs[__i]));
+  }
+}
+
+// The lanes of a register comparison are all ones or all zeros, and are narrowed to one bool per element
+template <typename _Tp, __simd_size_type _Np, typename _Compare>
+_CCCL_HOST_API void __host_vector_compare(
+  const _Tp (&__lhs)[_Np], const _Tp (&__rhs)[_Np], bool (&__result)[_Np], const _Compare __compare) noexcept
+{
+  constexpr auto __lanes = __host_vector<_Tp>::__lanes;
+  using __bytes_t        = typename __host_vector<int8_t, __lanes>::__type;
+  __simd_size_type __i   = 0;
+  for (; __i + __lanes <= _Np; __i += __lanes)
+  {
+    const auto __mask = __compare(
+      ::cuda::std::simd::__host_vector_load(__lhs + __i), ::cuda::std::simd::__host_vector_load(__rhs + __i));
+    const __bytes_t __bytes = -__builtin_convertvector(__mask, __bytes_t);
+    ::cuda::std::memcpy(__result + __i, &__bytes, sizeof(__bytes));
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __result[__i] = __compare(__lhs[__i], __rhs[__i]);
+  }
+}
+
+// Folds all full registers lane-wise before the lanes of the result, so that the order of the operations differs from
+// a left fold
+template <typename _Tp, __simd_size_type _Np, typename _BinaryOp>
+[[nodiscard]] _CCCL_HOST_API _Tp __host_vector_reduce(const _Tp (&__data)[_Np], const _BinaryOp __binary_op) noexcept
+{
+  constexpr auto __lanes = __host_vector<_Tp>::__lanes;
+  _Tp __result           = __data[0];
+  __simd_size_type __i   = 1;
+  if constexpr (_Np >= 2 * __lanes)
+  {
+    auto __acc = ::cuda::std::simd::__host_vector_load(__data);
+    for (__i = __lanes; __i + __lanes <= _Np; __i += __lanes)
+    {
+      __acc = __binary_op(__acc, ::cuda::std::simd::__host_vector_load(__data + __i));
+    }
+    __result = static_cast<_Tp>(__acc[0]);
+    for (__simd_size_type __j = 1; __j < __lanes; ++__j)
+    {
+      __result = static_cast<_Tp>(__binary_op(__result, static_cast<_Tp>(__acc[__j])));
+    }
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __result = static_cast<_Tp>(__binary_op(__result, __data[__i]));
+  }
+  return __result;
+}
+
+// The mask scans read eight bool elements at a time as one little-endian 64-bit word, in which every true element is a
+// single set bit
+
+[[nodiscard]] _CCCL_HOST_API inline uint64_t __host_mask_word(const bool* __ptr) noexcept
+{
+  uint64_t __word;
+  ::cuda::std::memcpy(&__word, __ptr, sizeof(__word));
+  return __word;
+}
+
+template <__simd_size_type _Np>
+[[nodiscard]] _CCCL_HOST_API bool __host_mask_any_of(const bool (&__data)[_Np]) noexcept
+{
+  uint64_t __any       = 0;
+  __simd_size_type __i = 0;
+  for (; __i + 8 <= _Np; __i += 8)
+  {
+    __any |= ::cuda::std::simd::__host_mask_word(__data + __i);
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __any |= __data[__i];
+  }
+  return __any != 0;
+}
+
+template <__simd_size_type _Np>
+[[nodiscard]] _CCCL_HOST_API __simd_size_type __host_mask_count(const bool (&__data)[_Np]) noexcept
+{
+  __simd_size_type __count = 0;
+  __simd_size_type __i     = 0;
+  for (; __i + 8 <= _Np; __i += 8)
+  {
+    __count += ::cuda::std::popcount(::cuda::std::simd::__host_mask_word(__data + __i));
+  }
+  for (; __i < _Np; ++__i)
+  {
+    __count += __data[__i];
+  }
+  return __count;
+}
+
+template <__simd_size_type _Np>
+[[nodiscard]] _CCCL_HOST_API __simd_size_type __host_mask_min_index(const bool (&__data)[_Np]) noexcept
+{
+  __simd_size_type __i = 0;
+  for (; __i + 8 <= _Np; __i += 8)
+  {
+    if (const auto __word = ::cuda::std::simd::__host_mask_word(__data + __i); __word != 0)
+    {
+      return __i + ::cuda::std::countr_zero(__word) / 8;
+    }
+  }
+  for (; __i < _Np; ++__i)
+  {
+    if (__data[__i])
+    {
+      return __i;
+    }
+  }
+  return __simd_size_type{-1};
+}
+
+template <__simd_size_type _Np>
+[[nodiscard]] _CCCL_HOST_API __simd_size_type __host_mask_max_index(const bool (&__data)[_Np]) noexcept
+{
+  constexpr __simd_size_type __full = _Np / 8 * 8;
+  for (__simd_size_type __i = _Np - 1; __i >= __full; --__i)
+  {
+    if (__data[__i])
+    {
+      return __i;
+    }
+  }
+  for (__simd_size_type __i = __full - 8; __i >= 0; __i -= 8)
+  {
+    if (const auto __word = ::cuda::std::simd::__host_mask_word(__data + __i); __word != 0)
+    {
+      return __i + (63 - ::cuda::std::countl_zero(__word)) / 8;
+    }
+  }
+  return __simd_size_type{-1};
+}
+
+_CCCL_END_NAMESPACE_CUDA_STD_SIMD
+
+#  include <cuda/std/__cccl/epilogue.h>
+
+#endif // _CCCL_HAS_SIMD_HOST_VECTOR()
+
+#endif // _CUDA_STD___SIMD_SPECIALIZATIONS_HOST_VECTOR_H
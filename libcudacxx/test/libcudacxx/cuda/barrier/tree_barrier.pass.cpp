@@ -0,0 +1,143 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: nvrtc
+
+// UNSUPPORTED: force-tile
+// error: asm statement is unsupported in tile code
+
+// <cuda/barrier>
+
+#include <cuda/barrier>
+#include <cuda/std/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+#if !TEST_CUDA_COMPILATION() || !defined(__CUDA_ARCH__)
+#  include <thread>
+#  include <vector>
+
+template <class F>
+void launch(int num_threads, F f)
+{
+  std::vector<std::thread> threads;
+  for (int t = 0; t < num_threads; ++t)
+  {
+    threads.emplace_back(f, t);
+  }
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+}
+
+// every phase runs the completion function once, after all threads arrived and before any thread leaves the phase
+void test_phases(int num_threads)
+{
+  const int phases = 200;
+  cuda::std::atomic<int> arrived{0};
+  int completions = 0;
+
+  auto completion = [&]() noexcept {
+    assert(arrived.load() == num_threads * (completions + 1));
+    ++completions;
+  };
+  cuda::tree_barrier<decltype(completion)> b(num_threads, completion);
+
+  launch(num_threads, [&](int) {
+    for (int phase = 0; phase < phases; ++phase)
+    {
+      arrived.fetch_add(1);
+      b.arrive_and_wait();
+      assert(completions == phase + 1);
+    }
+  });
+  assert(completions == phases);
+}
+
+// arrive and wait are separate, and the token identifies the phase
+void test_arrive_wait(int num_threads)
+{
+  int completions = 0;
+  auto completion = [&]() noexcept {
+    ++completions;
+  };
+  cuda::tree_barrier<decltype(completion)> b(num_threads, completion);
+
+  launch(num_threads, [&](int) {
+    for (int phase = 0; phase < 50; ++phase)
+    {
+      auto token = b.arrive();
+      b.wait(cuda::std::move(token));
+      assert(completions >= phase + 1);
+    }
+  });
+  assert(completions == 50);
+}
+
+// one thread arrives for several, and the others drop out one after another
+void test_update_and_drop(int num_threads)
+{
+  int completions = 0;
+  auto completion = [&]() noexcept {
+    ++completions;
+  };
+  cuda::tree_barrier<decltype(completion)> b(num_threads + 2, completion);
+
+  launch(num_threads, [&](int t) {
+    if (t == 0)
+    {
+      for (int phase = 0; phase < 20 + num_threads; ++phase)
+      {
+        b.wait(b.arrive(3));
+      }
+    }
+    else
+    {
+      for (int phase = 0; phase < 20 + t; ++phase)
+      {
+        b.wait(b.arrive());
+      }
+      b.arrive_and_drop();
+    }
+  });
+  assert(completions == 20 + num_threads);
+}
+
+void test_default_completion()
+{
+  cuda::tree_barrier<> b(1);
+  static_assert(cuda::std::is_same_v<decltype(b.arrive()), cuda::tree_barrier<>::arrival_token>);
+  static_assert(cuda::tree_barrier<>::max() > 0);
+  b.arrive_and_wait();
+  b.wait(b.arrive());
+  b.arrive_and_drop();
+}
+
+void test()
+{
+  test_default_completion();
+  for (int num_threads : {1, 2, 3, 4, 7, 8, 13})
+  {
+    test_phases(num_threads);
+    test_arrive_wait(num_threads);
+    test_update_and_drop(num_threads);
+  }
+}
+#endif // !TEST_CUDA_COMPILATION() || !defined(__CUDA_ARCH__)
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test();))
+  return 0;
+}
@@ -0,0 +1,366 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TEST_CUDA_EXECUTION_EXECUTION_POLICY_HOST_BACKENDS_H
+#define TEST_CUDA_EXECUTION_EXECUTION_POLICY_HOST_BACKENDS_H
+
+#include <cuda/std/algorithm>
+#include <cuda/std/cassert>
+#include <cuda/std/execution>
+#include <cuda/std/functional>
+#include <cuda/std/numeric>
+#include <cuda/std/type_traits>
+
+_CCCL_DIAG_SUPPRESS_GCC("-Wattributes") // __visibility__ attribute ignored
+
+namespace execution = cuda::std::execution;
+
+constexpr int size = 1000;
+
+// Splits every range into many small chunks, and runs them in reverse order, so that the chunked implementations are
+// exercised no matter how many threads the backend under test has
+struct test_executor
+{
+  static constexpr cuda::std::size_t __min_chunk_size = 16;
+
+  static cuda::std::size_t __concurrency() noexcept
+  {
+    return 7;
+  }
+
+  template <class Fn>
+  static void __parallel_for(cuda::std::ptrdiff_t n, Fn& fn)
+  {
+    for (cuda::std::ptrdiff_t i = n; i > 0; --i)
+    {
+      fn(i - 1);
+    }
+  }
+};
+
+template <execution::__pstl_algorithm Algorithm>
+using test_dispatch = execution::__pstl_host_dispatch<Algorithm, test_executor>;
+
+struct is_odd
+{
+  bool operator()(int value) const
+  {
+    return value % 2 != 0;
+  }
+};
+
+void fill_input(int* input)
+{
+  for (int i = 0; i < size; ++i)
+  {
+    input[i] = (i * 7919) % 101;
+  }
+}
+
+template <class Policy>
+void test_policy(const Policy& policy)
+{
+  static_assert(cuda::std::is_execution_policy_v<Policy>);
+
+  int input[size];
+  int output[size];
+  fill_input(input);
+
+  cuda::std::fill(policy, output, output + size, 42);
+  assert(cuda::std::count(policy, output, output + size, 42) == size);
+
+  cuda::std::transform(policy, input, input + size, output, [](int value) {
+    return 2 * value;
+  });
+  assert(cuda::std::reduce(policy, output, output + size) == 2 * cuda::std::reduce(input, input + size));
+
+  cuda::std::sort(policy, input, input + size);
+  assert(cuda::std::is_sorted(input, input + size));
+
+  // big enough to be split into chunks by the executor of the backend itself
+  constexpr int large_size = 1 << 17;
+  static int large[large_size];
+  cuda::std::fill(policy, large, large + large_size, 3);
+  assert(cuda::std::reduce(policy, large, large + large_size) == 3 * large_size);
+
+  cuda::std::transform(policy, large, large + large_size, large, [](int value) {
+    return value - 3;
+  });
+  assert(cuda::std::count(policy, large, large + large_size, 0) == large_size);
+}
+
+template <class Policy>
+void test_reduce_and_scan(const Policy& policy)
+{
+  int input[size];
+  int output[size];
+  int expected[size];
+  fill_input(input);
+
+  assert(test_dispatch<execution::__pstl_algorithm::__reduce>{}(policy, input, size, 5, cuda::std::plus<>{})
+         == cuda::std::reduce(input, input + size, 5));
+
+  assert(test_dispatch<execution::__pstl_algorithm::__transform_reduce>{}(
+           policy,
+           input,
+           size,
+           0L,
+           cuda::std::plus<>{},
+           [](int value) {
+             return 3L * value;
+           })
+         == 3 * cuda::std::reduce(input, input + size, 0L));
+
+  cuda::std::inclusive_scan(input, input + size, expected);
+  assert(test_dispatch<execution::__pstl_algorithm::__inclusive_scan>{}(
+           policy, input, input + size, output, cuda::std::plus<>{})
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  cuda::std::exclusive_scan(input, input + size, expected, 3);
+  assert(test_dispatch<execution::__pstl_algorithm::__exclusive_scan>{}(
+           policy, input, input + size, output, 3, cuda::std::plus<>{})
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  // in place
+  assert(test_dispatch<execution::__pstl_algorithm::__exclusive_scan>{}(
+           policy, input, input + size, input, 3, cuda::std::plus<>{})
+         == input + size);
+  assert(cuda::std::equal(input, input + size, expected));
+}
+
+template <class Policy>
+void test_transform(const Policy& policy)
+{
+  int input[size];
+  int output[size];
+  int expected[size];
+  fill_input(input);
+
+  auto twice = [](int value) {
+    return 2 * value;
+  };
+  cuda::std::transform(input, input + size, expected, twice);
+  assert(test_dispatch<execution::__pstl_algorithm::__transform>{}(policy, input, input + size, output, twice)
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  // elements rejected by the predicate are left untouched
+  cuda::std::fill(output, output + size, -1);
+  assert(test_dispatch<execution::__pstl_algorithm::__transform>{}(policy, input, input + size, output, twice, is_odd{})
+         == output + size);
+  for (int i = 0; i < size; ++i)
+  {
+    assert(output[i] == (is_odd{}(input[i]) ? 2 * input[i] : -1));
+  }
+
+  cuda::std::transform(input, input + size, input, expected, cuda::std::multiplies<>{});
+  assert(test_dispatch<execution::__pstl_algorithm::__transform>{}(
+           policy, input, input + size, input, output, cuda::std::multiplies<>{})
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  cuda::std::fill(output, output + size, -1);
+  assert(test_dispatch<execution::__pstl_algorithm::__copy_n>{}(policy, input, size - 1, output, is_odd{})
+         == output + size - 1);
+  for (int i = 0; i < size - 1; ++i)
+  {
+    assert(output[i] == (is_odd{}(input[i]) ? input[i] : -1));
+  }
+  assert(output[size - 1] == -1);
+
+  cuda::std::copy(input, input + size, output);
+  assert(test_dispatch<execution::__pstl_algorithm::__for_each_n>{}(policy, output, size, [](int& value) {
+           ++value;
+         })
+         == output + size);
+  for (int i = 0; i < size; ++i)
+  {
+    assert(output[i] == input[i] + 1);
+  }
+
+  assert(test_dispatch<execution::__pstl_algorithm::__generate_n>{}(policy, output, size / 2, [] {
+           return 7;
+         })
+         == output + size / 2);
+  assert(cuda::std::count(output, output + size / 2, 7) == size / 2);
+  assert(output[size / 2] == input[size / 2] + 1);
+
+  cuda::std::adjacent_difference(input, input + size, expected);
+  assert(test_dispatch<execution::__pstl_algorithm::__adjacent_difference>{}(
+           policy, input, input + size, output, cuda::std::minus<>{})
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+}
+
+template <class Policy>
+void test_selection(const Policy& policy)
+{
+  int input[size];
+  int output[size];
+  int expected[size];
+  fill_input(input);
+
+  const int num_odd = static_cast<int>(cuda::std::count_if(input, input + size, is_odd{}));
+
+  auto res = test_dispatch<execution::__pstl_algorithm::__copy_if>{}(policy, input, size, output, is_odd{});
+  assert(res == output + num_odd);
+  cuda::std::copy_if(input, input + size, expected, is_odd{});
+  assert(cuda::std::equal(output, output + num_odd, expected));
+
+  cuda::std::copy(input, input + size, output);
+  cuda::std::copy(input, input + size, expected);
+  auto middle =
+    test_dispatch<execution::__pstl_algorithm::__stable_partition>{}(policy, output, output + size, is_odd{});
+  assert(middle == output + num_odd);
+  cuda::std::stable_partition(expected, expected + size, is_odd{});
+  assert(cuda::std::equal(output, output + size, expected));
+
+  // the host backends always partition stably
+  cuda::std::copy(input, input + size, output);
+  middle = test_dispatch<execution::__pstl_algorithm::__partition>{}(policy, output, output + size, is_odd{});
+  assert(middle == output + num_odd);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  int output_false[size];
+  auto ends = test_dispatch<execution::__pstl_algorithm::__partition_copy>{}(
+    policy, input, input + size, output, output_false, is_odd{});
+  assert(ends.first == output + num_odd);
+  assert(ends.second == output_false + (size - num_odd));
+  assert(cuda::std::equal(output, output + num_odd, expected));
+  assert(cuda::std::equal(output_false, output_false + (size - num_odd), expected + num_odd));
+
+  // the predicate of the dispatch selects the elements that are kept
+  cuda::std::copy(input, input + size, output);
+  cuda::std::copy(input, input + size, expected);
+  res = test_dispatch<execution::__pstl_algorithm::__remove_if>{}(policy, output, size, is_odd{});
+  assert(res - output == cuda::std::remove_if(expected, expected + size, cuda::std::not_fn(is_odd{})) - expected);
+  assert(cuda::std::equal(output, res, expected));
+}
+
+template <class Policy>
+void test_unique(const Policy& policy)
+{
+  // runs of equal elements, some of which span the chunks of the test executor
+  int input[size];
+  int output[size];
+  int expected[size];
+  for (int i = 0; i < size; ++i)
+  {
+    input[i] = ((i * i) / 37) % 11;
+  }
+
+  const auto expected_end = cuda::std::unique_copy(input, input + size, expected) - expected;
+
+  auto res = test_dispatch<execution::__pstl_algorithm::__unique_copy>{}(
+    policy, input, input + size, output, cuda::std::equal_to<>{});
+  assert(res - output == expected_end);
+  assert(cuda::std::equal(output, res, expected));
+
+  cuda::std::copy(input, input + size, output);
+  res = test_dispatch<execution::__pstl_algorithm::__unique>{}(policy, output, output + size, cuda::std::equal_to<>{});
+  assert(res - output == expected_end);
+  assert(cuda::std::equal(output, res, expected));
+}
+
+template <class Policy>
+void test_reordering(const Policy& policy)
+{
+  int input[size];
+  int output[size];
+  int expected[size];
+  fill_input(input);
+
+  cuda::std::copy(input, input + size, output);
+  cuda::std::copy(input, input + size, expected);
+  auto res = test_dispatch<execution::__pstl_algorithm::__rotate>{}(policy, output, output + 123, output + size);
+  assert(res - output == cuda::std::rotate(expected, expected + 123, expected + size) - expected);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  cuda::std::rotate_copy(input, input + 321, input + size, expected);
+  assert(test_dispatch<execution::__pstl_algorithm::__rotate_copy>{}(policy, input, input + 321, input + size, output)
+         == output + size);
+  assert(cuda::std::equal(output, output + size, expected));
+
+  // shifts by less and by more than half of the range, so that source and destination overlap or not
+  for (int shift : {1, 123, 600, size - 1})
+  {
+    cuda::std::copy(input, input + size, output);
+    cuda::std::copy(input, input + size, expected);
+    res = test_dispatch<execution::__pstl_algorithm::__shift_left>{}(policy, output, output + size, shift);
+    assert(res == output + (size - shift));
+    assert(cuda::std::shift_left(expected, expected + size, shift) == expected + (size - shift));
+    assert(cuda::std::equal(output, res, expected));
+
+    cuda::std::copy(input, input + size, output);
+    cuda::std::copy(input, input + size, expected);
+    res = test_dispatch<execution::__pstl_algorithm::__shift_right>{}(policy, output, output + size, shift);
+    assert(res == output + shift);
+    assert(cuda::std::shift_right(expected, expected + size, shift) == expected + shift);
+    assert(cuda::std::equal(res, output + size, expected + shift));
+  }
+
+  cuda::std::copy(input, input + size, output);
+  cuda::std::copy(input, input + size, expected);
+  test_dispatch<execution::__pstl_algorithm::__sort>{}(policy, output, output + size, cuda::std::greater<>{});
+  cuda::std::sort(expected, expected + size, cuda::std::greater<>{});
+  assert(cuda::std::equal(output, output + size, expected));
+
+  // merge the sorted halves of the input, ties are taken from the first range
+  cuda::std::sort(input, input + size / 3);
+  cuda::std::sort(input + size / 3, input + size);
+  assert(test_dispatch<execution::__pstl_algorithm::__merge>{}(
+           policy, input, input + size / 3, input + size / 3, input + size, output, cuda::std::less<>{})
+         == output + size);
+  cuda::std::merge(input, input + size / 3, input + size / 3, input + size, expected);
+  assert(cuda::std::equal(output, output + size, expected));
+}
+
+template <class Policy>
+void test_search(const Policy& policy)
+{
+  int input[size];
+  fill_input(input);
+  input[700] = 1000;
+  input[900] = 1000;
+  input[300] = -1;
+  input[500] = -1;
+
+  auto found = test_dispatch<execution::__pstl_algorithm::__find_if>{}(policy, input, input + size, [](int value) {
+    return value > 100;
+  });
+  assert(found == input + 700);
+
+  auto not_found = test_dispatch<execution::__pstl_algorithm::__find_if>{}(policy, input, input + size, [](int value) {
+    return value > 1000;
+  });
+  assert(not_found == input + size);
+
+  // the first of several equal elements is the result
+  assert(test_dispatch<execution::__pstl_algorithm::__min_element>{}(policy, input, input + size, cuda::std::less<>{})
+         == input + 300);
+  assert(test_dispatch<execution::__pstl_algorithm::__max_element>{}(policy, input, input + size, cuda::std::less<>{})
+         == input + 700);
+}
+
+template <class Policy>
+void test(const Policy& policy)
+{
+  test_policy(policy);
+  test_reduce_and_scan(policy);
+  test_transform(policy);
+  test_selection(policy);
+  test_unique(policy);
+  test_reordering(policy);
+  test_search(policy);
+}
+
+#endif // TEST_CUDA_EXECUTION_EXECUTION_POLICY_HOST_BACKENDS_H
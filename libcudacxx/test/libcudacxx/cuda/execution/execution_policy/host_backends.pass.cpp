@@ -0,0 +1,26 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+
+// ADDITIONAL_COMPILE_DEFINITIONS: CCCL_ENABLE_OMP_BACKEND
+
+#include <cuda/std/execution>
+
+#include <nv/target>
+
+#include "host_backends.h"
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, (test(cuda::execution::omp);))
+
+  return 0;
+}
@@ -0,0 +1,50 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/functional>
+#include <cuda/std/cstdint>
+
+#include "hash_test_helper.h"
+#include "literal.h"
+#include "test_macros.h"
+
+TEST_NV_DIAG_SUPPRESS(23) // integer constant is too large
+
+#if _CCCL_HAS_INT128()
+
+TEST_FUNC void test()
+{
+  using namespace test_integer_literals;
+
+  hash_test<cuda::hash_algorithm::xxh3_128> xxh3_128_test;
+
+  xxh3_128_test(static_cast<char>(0), 0xa6cd'5e93'9200'0f6a'c44b'dff4'074e'ecdb_u128, 0);
+  xxh3_128_test(static_cast<char>(42), 0x14c9'ae95'94c4'63c4'79d0'3016'b7ae'ed0d_u128, 0);
+  xxh3_128_test(cuda::std::int32_t(0), 0x2a33'816e'd7e0'c373'dbe5'63c7'3722'0b65_u128, 0);
+  xxh3_128_test(cuda::std::int32_t(0), 0xe570'3e4f'92e5'90a1'9871'214b'43bd'c0ac_u128, 42);
+  xxh3_128_test(cuda::std::int32_t(42), 0x9a45'5182'd724'f034'1ad2'93a7'1185'8e8f_u128, 0);
+  xxh3_128_test(cuda::std::int32_t(123456789), 0xe7e0'e05f'2a15'4f34'a9d2'813b'4719'5fc5_u128, 0);
+  xxh3_128_test(cuda::std::int64_t(0), 0x2c0a'8a99'dc14'7d54'45c3'b49d'0356'65b2_u128, 0);
+  xxh3_128_test(cuda::std::int64_t(0), 0x2cfa'9c76'b300'22ae'd642'fe26'2db8'476f_u128, 42);
+  xxh3_128_test(cuda::std::int64_t(42), 0x9bab'3e2f'55e1'fe86'61c2'164e'8b89'5a45_u128, 0);
+  xxh3_128_test(static_cast<__int128_t>(123456789), 0x406f'b672'1c7e'51be'a1cd'1ee7'1817'3551_u128, 0);
+  xxh3_128_test(large_key<32>(123456789), 0xa2b6'df5d'4787'78fd'3a40'7d13'd9fa'1d67_u128, 0);
+  xxh3_128_test(large_key<100>(123456789), 0x408a'bf41'ca8f'3e97'a90e'91b5'ea26'd036_u128, 42);
+}
+
+#endif // _CCCL_HAS_INT128()
+
+int main(int, char**)
+{
+#if _CCCL_HAS_INT128()
+  test();
+#endif // _CCCL_HAS_INT128()
+  return 0;
+}
@@ -0,0 +1,76 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/functional>
+#include <cuda/std/array>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+
+#include "hash_test_helper.h"
+#include "test_macros.h"
+
+template <typename Key>
+TEST_FUNC void test_hash_each(cuda::std::uint64_t seed)
+{
+  // More keys than the widest host vector, and a remainder that does not fill one
+  cuda::std::array<Key, 37> keys{};
+  for (cuda::std::size_t i = 0; i < keys.size(); ++i)
+  {
+    keys[i] = static_cast<Key>(i * 2654435761u);
+  }
+  cuda::std::array<cuda::std::uint64_t, 37> hashes{};
+
+  const cuda::hash<Key, cuda::hash_algorithm::xxh3_64> hasher{seed};
+  hasher.hash_each(keys, hashes);
+  for (cuda::std::size_t i = 0; i < keys.size(); ++i)
+  {
+    assert(hashes[i] == hasher(keys[i]));
+  }
+}
+
+TEST_FUNC void test()
+{
+  hash_test<cuda::hash_algorithm::xxh3_64> xxh3_64_test;
+
+  xxh3_64_test(static_cast<char>(0), 14144645293874801883ull, 0);
+  xxh3_64_test(static_cast<char>(42), 8777568547874204941ull, 0);
+  xxh3_64_test(static_cast<char>(0), 6697150685477982789ull, 42);
+  xxh3_64_test(static_cast<cuda::std::int32_t>(0), 5238470482016868669ull, 0);
+  xxh3_64_test(static_cast<cuda::std::int32_t>(0), 14325386350854113765ull, 42);
+  xxh3_64_test(static_cast<cuda::std::int32_t>(42), 2392174772787195229ull, 0);
+  xxh3_64_test(static_cast<cuda::std::int32_t>(123456789), 5186869424260940993ull, 0);
+  xxh3_64_test(static_cast<cuda::std::int64_t>(0), 14374147212387527897ull, 0);
+  xxh3_64_test(static_cast<cuda::std::int64_t>(0), 5014318936221084462ull, 42);
+  xxh3_64_test(static_cast<cuda::std::int64_t>(42), 15395265915043915720ull, 0);
+  xxh3_64_test(static_cast<cuda::std::int64_t>(123456789), 2817400364357085909ull, 0);
+#if _CCCL_HAS_INT128()
+  xxh3_64_test(static_cast<__int128_t>(123456789), 7602280935813847626ull, 0);
+#endif
+  xxh3_64_test(large_key<32>(123456789), 9278458725499332637ull, 0);
+  xxh3_64_test(large_key<32>(123456789), 9628152840532442728ull, 42);
+  xxh3_64_test(large_key<100>(123456789), 3675553827678251547ull, 0);
+  xxh3_64_test(large_key<100>(123456789), 12181834252587290678ull, 42);
+
+  static_assert(cuda::hash<cuda::std::int32_t, cuda::hash_algorithm::xxh3_64>{}(42) == 2392174772787195229ull);
+  static_assert(cuda::hash<cuda::std::int64_t, cuda::hash_algorithm::xxh3_64>{42}(0) == 5014318936221084462ull);
+
+  test_hash_each<cuda::std::int16_t>(0);
+  test_hash_each<cuda::std::int32_t>(0);
+  test_hash_each<cuda::std::int32_t>(42);
+  test_hash_each<cuda::std::uint64_t>(0);
+  test_hash_each<cuda::std::uint64_t>(42);
+  test_hash_each<double>(42);
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -0,0 +1,110 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/functional>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+#include <cuda/std/span>
+#include <cuda/std/type_traits>
+
+#include "literal.h"
+#include "test_macros.h"
+
+TEST_NV_DIAG_SUPPRESS(23) // integer constant is too large
+
+constexpr cuda::std::size_t input_size = 1000;
+
+TEST_FUNC constexpr cuda::std::array<cuda::std::byte, input_size> make_input()
+{
+  cuda::std::array<cuda::std::byte, input_size> input{};
+  for (cuda::std::size_t i = 0; i < input.size(); ++i)
+  {
+    input[i] = static_cast<cuda::std::byte>(i * 7);
+  }
+  return input;
+}
+
+// Feeds the first `size` bytes in pieces of `piece` bytes, the last piece may be shorter
+template <class State>
+TEST_FUNC constexpr auto digest_in_pieces(State state, cuda::std::size_t size, cuda::std::size_t piece)
+{
+  const auto input = make_input();
+  for (cuda::std::size_t offset = 0; offset < size; offset += piece)
+  {
+    const auto count = (size - offset < piece) ? size - offset : piece;
+    state.update(cuda::std::span<const cuda::std::byte>{input.data() + offset, count});
+  }
+  return state.digest();
+}
+
+template <cuda::hash_algorithm Algorithm, typename ResultT>
+TEST_FUNC void test_state(cuda::std::size_t size, cuda::std::uint64_t seed, ResultT expected)
+{
+  using state_type  = cuda::hash_state<Algorithm>;
+  using hasher_type = cuda::hash<cuda::std::byte, Algorithm>;
+  using result_type = decltype(cuda::std::declval<const hasher_type&>()(cuda::std::span<cuda::std::byte>{}));
+  static_assert(cuda::std::is_same_v<decltype(cuda::std::declval<const state_type&>().digest()), result_type>);
+
+  // Pieces smaller and larger than a stripe, the internal buffer and a block of stripes
+  for (const cuda::std::size_t piece : {1, 7, 64, 100, 255, 256, 1024})
+  {
+    assert(digest_in_pieces(state_type{seed}, size, piece) == expected);
+  }
+
+  auto input = make_input();
+  const hasher_type hasher{seed};
+  assert(hasher(cuda::std::span<cuda::std::byte>{input.data(), size}) == expected);
+
+  // The digest does not change the state, and reset discards the input
+  state_type state{seed};
+  state.update(cuda::std::span<const cuda::std::byte>{input.data(), size / 2});
+  const auto half = state.digest();
+  assert(state.digest() == half);
+  state.update(cuda::std::span<const cuda::std::byte>{input.data() + size / 2, size - size / 2});
+  assert(state.digest() == expected);
+  state.reset();
+  state.update(cuda::std::span<const cuda::std::byte>{input.data(), size / 2});
+  assert(state.digest() == half);
+
+  // Spans of other types are hashed by their object representation
+  cuda::std::array<cuda::std::uint32_t, 4> words{1, 2, 3, 4};
+  state.reset();
+  state.update(cuda::std::span<cuda::std::uint32_t, 4>{words});
+  const cuda::hash<cuda::std::uint32_t, Algorithm> word_hasher{seed};
+  assert(state.digest() == word_hasher(cuda::std::span<cuda::std::uint32_t>{words}));
+}
+
+TEST_FUNC void test()
+{
+  test_state<cuda::hash_algorithm::xxh3_64>(0, 0, 3244421341483603138ull);
+  test_state<cuda::hash_algorithm::xxh3_64>(100, 0, 7907055600811180334ull);
+  test_state<cuda::hash_algorithm::xxh3_64>(1000, 0, 1201669616488073264ull);
+  test_state<cuda::hash_algorithm::xxh3_64>(0, 42, 12693748630217917650ull);
+  test_state<cuda::hash_algorithm::xxh3_64>(100, 42, 7027429321484700360ull);
+  test_state<cuda::hash_algorithm::xxh3_64>(1000, 42, 8168504687462649234ull);
+
+  static_assert(digest_in_pieces(cuda::hash_state<cuda::hash_algorithm::xxh3_64>{42}, 1000, 100)
+                == 8168504687462649234ull);
+
+#if _CCCL_HAS_INT128()
+  using namespace test_integer_literals;
+  test_state<cuda::hash_algorithm::xxh3_128>(0, 42, 0x16c2'0acd'33f7'af2f'3c1d'09e9'fe24'9164_u128);
+  test_state<cuda::hash_algorithm::xxh3_128>(100, 42, 0xa6dd'2816'b71f'd92a'fe16'f842'f285'945f_u128);
+  test_state<cuda::hash_algorithm::xxh3_128>(1000, 42, 0xe886'2545'306b'c0d7'715c'5bbc'1253'0d92_u128);
+#endif // _CCCL_HAS_INT128()
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -57,6 +57,12 @@ struct hash_result<cuda::hash_algorithm::murmurhash3_32>
   using type = cuda::std::uint32_t;
 };
 
+template <>
+struct hash_result<cuda::hash_algorithm::xxh3_64>
+{
+  using type = cuda::std::uint64_t;
+};
+
 #if _CCCL_HAS_INT128()
 template <>
 struct hash_result<cuda::hash_algorithm::murmurhash3_x86_128>
@@ -69,6 +75,12 @@ struct hash_result<cuda::hash_algorithm::murmurhash3_x64_128>
 {
   using type = __uint128_t;
 };
+
+template <>
+struct hash_result<cuda::hash_algorithm::xxh3_128>
+{
+  using type = __uint128_t;
+};
 #endif // _CCCL_HAS_INT128()
 
 template <cuda::hash_algorithm Algorithm>
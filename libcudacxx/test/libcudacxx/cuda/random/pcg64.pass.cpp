@@ -94,6 +94,28 @@ TEST_HOST_DEVICE_FUNC constexpr bool test_fallback()
 
 #endif // _CCCL_HAS_INT128()
 
+TEST_HOST_DEVICE_FUNC constexpr bool test_generate()
+{
+  // the bulk generation returns the same values as operator(), and leaves the engine in the same state
+  constexpr int counts[] = {0, 1, 3, 4, 5, 8, 31, 100};
+  for (auto count : counts)
+  {
+    cuda::pcg64 e1(42);
+    cuda::pcg64 e2(42);
+    e1.discard(7);
+    e2.discard(7);
+
+    cuda::std::uint64_t values[100] = {};
+    e1.__generate(values, count);
+    for (int i = 0; i < count; ++i)
+    {
+      assert(values[i] == e2());
+    }
+    assert(e1 == e2);
+  }
+  return true;
+}
+
 TEST_HOST_DEVICE_FUNC constexpr bool test_against_reference()
 {
   // reference values obtained from other library implementations
@@ -131,6 +153,7 @@ int main(int, char**)
 #endif // _CCCL_HAS_INT128()
 
   test_engine<cuda::pcg64, 11135645891219275043ul>();
+  test_generate();
   test_against_reference();
   return 0;
 }
@@ -0,0 +1,73 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: libcpp-has-no-threads
+// UNSUPPORTED: pre-sm-70
+
+// UNSUPPORTED: force-tile
+// error: asm statement is unsupported in tile code
+
+// <cuda/atomic>
+
+// Several agents wait on the same atomic and are woken up by a single notify_all
+
+#include <cuda/atomic>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../atomics.types.operations.req/atomic_helpers.h"
+#include "concurrent_agents.h"
+#include "cuda_space_selector.h"
+#include "test_macros.h"
+
+template <class T, template <typename, typename> class Selector, cuda::thread_scope Scope>
+struct TestFn
+{
+  TEST_HOST_DEVICE_FUNC void operator()() const
+  {
+    using A = cuda::atomic<T, Scope>;
+
+    SHARED A* t;
+    execute_on_main_thread([&] {
+      t = (A*) malloc(sizeof(A));
+      new (t) A(T(1));
+      assert(t->load() == T(1));
+    });
+
+    auto agent_notify = LAMBDA()
+    {
+      t->store(T(3));
+      t->notify_all();
+    };
+
+    auto agent_wait = LAMBDA()
+    {
+      t->wait(T(1));
+      assert(t->load() == T(3));
+    };
+
+    concurrent_agents_launch(agent_notify, agent_wait, agent_wait, agent_wait);
+
+    execute_on_main_thread([&] {
+      t->~A();
+      free(t);
+    });
+  }
+};
+
+int main(int, char**)
+{
+  NV_IF_TARGET(NV_IS_HOST, cuda_thread_count = 4;)
+
+  TestEachAtomicType<TestFn, shared_memory_selector, cuda::thread_scope_device>()();
+  TestEachAtomicType<TestFn, shared_memory_selector, cuda::thread_scope_system>()();
+
+  return 0;
+}
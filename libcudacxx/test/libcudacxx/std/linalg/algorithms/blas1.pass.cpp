@@ -0,0 +1,161 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/execution>
+#include <cuda/std/limits>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+namespace linalg = cuda::std::linalg;
+
+using vector_extents = cuda::std::dextents<int, 1>;
+using matrix_extents = cuda::std::dextents<int, 2>;
+
+TEST_FUNC constexpr bool test_vector()
+{
+  cuda::std::array<int, 4> x{1, -2, 3, -4};
+  cuda::std::array<int, 4> y{5, 6, 7, 8};
+  cuda::std::array<int, 4> z{};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), 4);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), 4);
+  cuda::std::mdspan<int, vector_extents> zs(z.data(), 4);
+
+  // copy
+  {
+    linalg::copy(xs, zs);
+    assert(z[0] == 1 && z[1] == -2 && z[2] == 3 && z[3] == -4);
+  }
+  // scale
+  {
+    linalg::scale(3, zs);
+    assert(z[0] == 3 && z[1] == -6 && z[2] == 9 && z[3] == -12);
+  }
+  // add
+  {
+    linalg::add(xs, linalg::scaled(2, ys), zs);
+    assert(z[0] == 11 && z[1] == 10 && z[2] == 17 && z[3] == 12);
+  }
+  // swap_elements
+  {
+    linalg::swap_elements(ys, zs);
+    assert(y[0] == 11 && y[3] == 12);
+    assert(z[0] == 5 && z[3] == 8);
+    linalg::swap_elements(ys, zs);
+  }
+  // dot
+  {
+    assert(linalg::dot(xs, ys) == 5 - 12 + 21 - 32);
+    assert(linalg::dot(xs, ys, 100) == 100 + 5 - 12 + 21 - 32);
+    static_assert(cuda::std::is_same_v<decltype(linalg::dot(xs, ys, 0L)), long>);
+  }
+  // vector_abs_sum
+  {
+    assert(linalg::vector_abs_sum(xs) == 10);
+    assert(linalg::vector_abs_sum(xs, 5) == 15);
+  }
+  // vector_idx_abs_max
+  {
+    assert(linalg::vector_idx_abs_max(xs) == 3);
+    assert(linalg::vector_idx_abs_max(ys) == 3);
+    cuda::std::mdspan<int, vector_extents> empty(x.data(), 0);
+    assert(linalg::vector_idx_abs_max(empty) == cuda::std::numeric_limits<int>::max());
+  }
+  return true;
+}
+
+TEST_FUNC constexpr bool test_matrix_norms()
+{
+  // 1 -2  3
+  // -4 5 -6
+  cuda::std::array<int, 6> a{1, -2, 3, -4, 5, -6};
+  cuda::std::mdspan<int, matrix_extents> right(a.data(), 2, 3);
+  assert(linalg::matrix_one_norm(right) == 9);
+  assert(linalg::matrix_inf_norm(right) == 15);
+
+  // The same data is the transposed matrix in column major order
+  cuda::std::mdspan<int, matrix_extents, cuda::std::layout_left> left(a.data(), 3, 2);
+  assert(linalg::matrix_one_norm(left) == 15);
+  assert(linalg::matrix_inf_norm(left) == 9);
+  return true;
+}
+
+TEST_FUNC void test_two_norm()
+{
+  cuda::std::array<double, 4> x{3.0, -4.0, 12.0, 0.0};
+  cuda::std::mdspan<double, vector_extents> xs(x.data(), 4);
+  assert(linalg::vector_two_norm(xs) == 13.0);
+  assert(linalg::vector_two_norm(xs, 0.0) == 13.0);
+
+  // The scaled accumulation neither overflows nor underflows
+  cuda::std::array<double, 2> big{3e200, 4e200};
+  cuda::std::mdspan<double, vector_extents> bigs(big.data(), 2);
+  assert(cuda::std::abs(linalg::vector_two_norm(bigs) - 5e200) < 1e186);
+
+  cuda::std::array<double, 2> small{3e-200, 4e-200};
+  cuda::std::mdspan<double, vector_extents> smalls(small.data(), 2);
+  assert(cuda::std::abs(linalg::vector_two_norm(smalls) - 5e-200) < 1e-214);
+
+  // Every element of a strided matrix is visited once
+  cuda::std::array<double, 12> a{1.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0, 1.0, 0.0, 1.0, 1.0, 0.0};
+  using mapping = cuda::std::layout_stride::mapping<matrix_extents>;
+  cuda::std::mdspan<double, matrix_extents, cuda::std::layout_stride> strided(
+    a.data(), mapping(matrix_extents(4, 2), cuda::std::array<int, 2>{3, 1}));
+  assert(linalg::matrix_frob_norm(strided) == cuda::std::sqrt(8.0));
+}
+
+TEST_FUNC void test_complex()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 2> x{C{1.0, 2.0}, C{3.0, -1.0}};
+  cuda::std::array<C, 2> y{C{2.0, 0.0}, C{0.0, 1.0}};
+  cuda::std::mdspan<C, vector_extents> xs(x.data(), 2);
+  cuda::std::mdspan<C, vector_extents> ys(y.data(), 2);
+
+  assert(linalg::dot(xs, ys) == x[0] * y[0] + x[1] * y[1]);
+  assert(linalg::dotc(xs, ys) == cuda::std::conj(x[0]) * y[0] + cuda::std::conj(x[1]) * y[1]);
+  assert(linalg::vector_abs_sum(xs) == 7.0);
+  assert(linalg::vector_idx_abs_max(xs) == 1);
+  assert(cuda::std::abs(linalg::vector_two_norm(xs) - cuda::std::sqrt(15.0)) < 1e-14);
+}
+
+TEST_FUNC void test_policy()
+{
+  constexpr int n = 10000;
+  cuda::std::array<float, n> x{};
+  cuda::std::array<float, n> y{};
+  for (int i = 0; i < n; ++i)
+  {
+    x[i] = static_cast<float>(i % 7);
+    y[i] = 2.0f;
+  }
+  cuda::std::mdspan<float, vector_extents> xs(x.data(), n);
+  cuda::std::mdspan<float, vector_extents> ys(y.data(), n);
+
+  const double expected = 2.0 * (n / 7 * 21 + 0 + 1 + 2 + 3);
+  assert(linalg::dot(cuda::std::execution::seq, xs, ys, 0.0) == expected);
+  assert(linalg::dot(cuda::std::execution::par, xs, ys, 0.0) == expected);
+}
+
+int main(int, char**)
+{
+  test_vector();
+  static_assert(test_vector());
+  test_matrix_norms();
+  static_assert(test_matrix_norms());
+  test_two_norm();
+  test_complex();
+  NV_IF_TARGET(NV_IS_HOST, (test_policy();))
+  return 0;
+}
@@ -0,0 +1,318 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/complex>
+#include <cuda/std/execution>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+namespace linalg = cuda::std::linalg;
+
+using vector_extents = cuda::std::dextents<int, 1>;
+using matrix_extents = cuda::std::dextents<int, 2>;
+
+template <class Layout>
+TEST_FUNC constexpr auto make_matrix(int* data, int rows, int cols)
+{
+  if constexpr (cuda::std::is_same_v<Layout, cuda::std::layout_stride>)
+  {
+    // Row major with a padded leading dimension
+    using mapping = cuda::std::layout_stride::mapping<matrix_extents>;
+    return cuda::std::mdspan<int, matrix_extents, Layout>(
+      data, mapping(matrix_extents(rows, cols), cuda::std::array<int, 2>{cols + 1, 1}));
+  }
+  else
+  {
+    return cuda::std::mdspan<int, matrix_extents, Layout>(data, rows, cols);
+  }
+}
+
+template <class Layout>
+TEST_FUNC constexpr bool test_matrix_vector_product()
+{
+  constexpr int rows = 7;
+  constexpr int cols = 5;
+  cuda::std::array<int, rows * (cols + 1)> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), rows, cols);
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      a(i, j) = (i + 1) * (j % 3 - 1) + j;
+    }
+  }
+
+  cuda::std::array<int, cols> x{1, -2, 3, 0, 2};
+  cuda::std::array<int, rows> y{1, 2, 3, 4, 5, 6, 7};
+  cuda::std::array<int, rows> z{};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), cols);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), rows);
+  cuda::std::mdspan<int, vector_extents> zs(z.data(), rows);
+
+  linalg::matrix_vector_product(a, xs, zs);
+  for (int i = 0; i < rows; ++i)
+  {
+    int expected = 0;
+    for (int j = 0; j < cols; ++j)
+    {
+      expected += a(i, j) * x[j];
+    }
+    assert(z[i] == expected);
+  }
+
+  // Updating overload, which may alias y and z
+  linalg::matrix_vector_product(a, xs, ys, ys);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(y[i] == i + 1 + z[i]);
+  }
+
+  // Transposed matrix
+  cuda::std::array<int, cols> w{};
+  cuda::std::mdspan<int, vector_extents> ws(w.data(), cols);
+  linalg::matrix_vector_product(linalg::transposed(a), zs, ws);
+  for (int j = 0; j < cols; ++j)
+  {
+    int expected = 0;
+    for (int i = 0; i < rows; ++i)
+    {
+      expected += a(i, j) * z[i];
+    }
+    assert(w[j] == expected);
+  }
+  return true;
+}
+
+template <class Layout, class Triangle, class Diagonal>
+TEST_FUNC constexpr bool test_triangular()
+{
+  constexpr int n       = 6;
+  constexpr bool upper = cuda::std::is_same_v<Triangle, linalg::upper_triangle_t>;
+  constexpr bool unit  = cuda::std::is_same_v<Diagonal, linalg::implicit_unit_diagonal_t>;
+
+  // The other triangle and, for an implicit unit diagonal, the diagonal hold garbage that must not be read
+  cuda::std::array<int, n * (n + 1)> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      const bool in_triangle = upper ? j > i : j < i;
+      a(i, j)                = in_triangle ? (i + 2 * j) % 5 - 2 : 1000;
+    }
+    if (!unit)
+    {
+      a(i, i) = 1 + i % 2;
+    }
+  }
+  const auto element = [&](int i, int j) {
+    if (i == j)
+    {
+      return unit ? 1 : a(i, i);
+    }
+    return (upper ? j > i : j < i) ? a(i, j) : 0;
+  };
+
+  cuda::std::array<int, n> x{2, -1, 4, 0, 3, -2};
+  cuda::std::array<int, n> y{};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), n);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), n);
+
+  linalg::triangular_matrix_vector_product(a, Triangle{}, Diagonal{}, xs, ys);
+  for (int i = 0; i < n; ++i)
+  {
+    int expected = 0;
+    for (int j = 0; j < n; ++j)
+    {
+      expected += element(i, j) * x[j];
+    }
+    assert(y[i] == expected);
+  }
+
+  // The solve undoes the product
+  if constexpr (unit)
+  {
+    linalg::triangular_matrix_vector_solve(a, Triangle{}, Diagonal{}, ys);
+    for (int i = 0; i < n; ++i)
+    {
+      assert(y[i] == x[i]);
+    }
+  }
+
+  // In place product
+  cuda::std::array<int, n> v = x;
+  cuda::std::mdspan<int, vector_extents> vs(v.data(), n);
+  linalg::triangular_matrix_vector_product(a, Triangle{}, Diagonal{}, vs);
+  linalg::triangular_matrix_vector_product(a, Triangle{}, Diagonal{}, xs, ys);
+  for (int i = 0; i < n; ++i)
+  {
+    assert(v[i] == y[i]);
+  }
+  return true;
+}
+
+template <class Layout>
+TEST_FUNC void test_triangular_solve()
+{
+  constexpr int n = 5;
+  cuda::std::array<int, n * (n + 1)> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      a(i, j) = i == j ? 4 : (i * j) % 3 + 1;
+    }
+  }
+  cuda::std::array<double, n * n> a_double{};
+  cuda::std::mdspan<double, matrix_extents> ad(a_double.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      ad(i, j) = a(i, j);
+    }
+  }
+
+  cuda::std::array<double, n> b{1.0, -2.0, 0.5, 3.0, 4.0};
+  cuda::std::array<double, n> x{};
+  cuda::std::mdspan<double, vector_extents> bs(b.data(), n);
+  cuda::std::mdspan<double, vector_extents> xs(x.data(), n);
+
+  linalg::triangular_matrix_vector_solve(ad, linalg::lower_triangle, linalg::explicit_diagonal, bs, xs);
+  for (int i = 0; i < n; ++i)
+  {
+    double sum = 0.0;
+    for (int j = 0; j <= i; ++j)
+    {
+      sum += ad(i, j) * x[j];
+    }
+    assert(cuda::std::abs(sum - b[i]) < 1e-12);
+  }
+
+  linalg::triangular_matrix_vector_solve(ad, linalg::upper_triangle, linalg::explicit_diagonal, bs, xs);
+  for (int i = 0; i < n; ++i)
+  {
+    double sum = 0.0;
+    for (int j = i; j < n; ++j)
+    {
+      sum += ad(i, j) * x[j];
+    }
+    assert(cuda::std::abs(sum - b[i]) < 1e-12);
+  }
+}
+
+TEST_FUNC constexpr bool test_rank_1_update()
+{
+  cuda::std::array<int, 3> x{1, 2, 3};
+  cuda::std::array<int, 2> y{-1, 4};
+  cuda::std::array<int, 6> a{1, 1, 1, 1, 1, 1};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), 3);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), 2);
+  cuda::std::mdspan<int, matrix_extents> as(a.data(), 3, 2);
+
+  linalg::matrix_rank_1_update(xs, ys, as);
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      assert(as(i, j) == 1 + x[i] * y[j]);
+    }
+  }
+  return true;
+}
+
+TEST_FUNC void test_rank_1_update_c()
+{
+  using C = cuda::std::complex<double>;
+  cuda::std::array<C, 2> x{C{1.0, 1.0}, C{0.0, 2.0}};
+  cuda::std::array<C, 2> y{C{2.0, -1.0}, C{1.0, 0.0}};
+  cuda::std::array<C, 4> a{};
+  cuda::std::mdspan<C, vector_extents> xs(x.data(), 2);
+  cuda::std::mdspan<C, vector_extents> ys(y.data(), 2);
+  cuda::std::mdspan<C, matrix_extents> as(a.data(), 2, 2);
+
+  linalg::matrix_rank_1_update_c(xs, ys, as);
+  for (int i = 0; i < 2; ++i)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      assert(as(i, j) == x[i] * cuda::std::conj(y[j]));
+    }
+  }
+}
+
+template <class Layout>
+TEST_FUNC void test_policy()
+{
+  constexpr int rows = 300;
+  constexpr int cols = 257;
+  cuda::std::array<int, rows * (cols + 1)> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), rows, cols);
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      a(i, j) = (i * 7 + j * 3) % 11 - 5;
+    }
+  }
+  cuda::std::array<int, cols> x{};
+  for (int j = 0; j < cols; ++j)
+  {
+    x[j] = j % 4 - 1;
+  }
+  cuda::std::array<int, rows> y{};
+  cuda::std::array<int, rows> z{};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), cols);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), rows);
+  cuda::std::mdspan<int, vector_extents> zs(z.data(), rows);
+
+  linalg::matrix_vector_product(a, xs, ys);
+  linalg::matrix_vector_product(cuda::std::execution::par, a, xs, zs);
+  assert(y == z);
+  linalg::matrix_vector_product(cuda::std::execution::par_unseq, a, xs, ys, zs);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(z[i] == 2 * y[i]);
+  }
+}
+
+int main(int, char**)
+{
+  test_matrix_vector_product<cuda::std::layout_right>();
+  test_matrix_vector_product<cuda::std::layout_left>();
+  test_matrix_vector_product<cuda::std::layout_stride>();
+  static_assert(test_matrix_vector_product<cuda::std::layout_right>());
+  static_assert(test_matrix_vector_product<cuda::std::layout_left>());
+
+  test_triangular<cuda::std::layout_right, linalg::upper_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular<cuda::std::layout_right, linalg::lower_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular<cuda::std::layout_left, linalg::upper_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular<cuda::std::layout_left, linalg::lower_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular<cuda::std::layout_stride, linalg::upper_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular<cuda::std::layout_stride, linalg::lower_triangle_t, linalg::explicit_diagonal_t>();
+  static_assert(test_triangular<cuda::std::layout_right, linalg::upper_triangle_t, linalg::implicit_unit_diagonal_t>());
+
+  test_triangular_solve<cuda::std::layout_right>();
+  test_triangular_solve<cuda::std::layout_left>();
+
+  test_rank_1_update();
+  static_assert(test_rank_1_update());
+  test_rank_1_update_c();
+
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_policy<cuda::std::layout_right>(); test_policy<cuda::std::layout_left>();
+                test_policy<cuda::std::layout_stride>();))
+  return 0;
+}
@@ -0,0 +1,305 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/cmath>
+#include <cuda/std/execution>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+namespace linalg = cuda::std::linalg;
+
+using matrix_extents = cuda::std::dextents<int, 2>;
+
+template <class Layout, class T>
+TEST_FUNC constexpr auto make_matrix(T* data, int rows, int cols)
+{
+  if constexpr (cuda::std::is_same_v<Layout, cuda::std::layout_stride>)
+  {
+    // Column major with a padded leading dimension
+    using mapping = cuda::std::layout_stride::mapping<matrix_extents>;
+    return cuda::std::mdspan<T, matrix_extents, Layout>(
+      data, mapping(matrix_extents(rows, cols), cuda::std::array<int, 2>{1, rows + 1}));
+  }
+  else
+  {
+    return cuda::std::mdspan<T, matrix_extents, Layout>(data, rows, cols);
+  }
+}
+
+// The sizes are not multiples of the register tile, and k spans several slices of the inner dimension
+template <class LayoutA, class LayoutB, class LayoutC, int M, int N, int K>
+TEST_FUNC constexpr bool test_matrix_product()
+{
+  cuda::std::array<int, (M + 1) * K> a_data{};
+  cuda::std::array<int, (K + 1) * N> b_data{};
+  cuda::std::array<int, (M + 1) * N> c_data{};
+  cuda::std::array<int, (M + 1) * N> e_data{};
+  auto a = make_matrix<LayoutA>(a_data.data(), M, K);
+  auto b = make_matrix<LayoutB>(b_data.data(), K, N);
+  auto c = make_matrix<LayoutC>(c_data.data(), M, N);
+  auto e = make_matrix<LayoutC>(e_data.data(), M, N);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int k = 0; k < K; ++k)
+    {
+      a(i, k) = (i * 3 + k) % 5 - 2;
+    }
+  }
+  for (int k = 0; k < K; ++k)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      b(k, j) = (k + 2 * j) % 7 - 3;
+    }
+  }
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      e(i, j) = i - j;
+    }
+  }
+
+  const auto product = [&](int i, int j) {
+    int sum = 0;
+    for (int k = 0; k < K; ++k)
+    {
+      sum += a(i, k) * b(k, j);
+    }
+    return sum;
+  };
+
+  linalg::matrix_product(a, b, c);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      assert(c(i, j) == product(i, j));
+    }
+  }
+
+  linalg::matrix_product(a, b, e, c);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      assert(c(i, j) == e(i, j) + product(i, j));
+    }
+  }
+
+  // C = C + A B
+  linalg::matrix_product(a, b, c, c);
+  for (int i = 0; i < M; ++i)
+  {
+    for (int j = 0; j < N; ++j)
+    {
+      assert(c(i, j) == e(i, j) + 2 * product(i, j));
+    }
+  }
+  return true;
+}
+
+TEST_FUNC constexpr bool test_matrix_product_transposed()
+{
+  cuda::std::array<int, 6> a{1, 2, 3, 4, 5, 6};
+  cuda::std::array<int, 4> c{};
+  cuda::std::mdspan<int, matrix_extents> as(a.data(), 2, 3);
+  cuda::std::mdspan<int, matrix_extents> cs(c.data(), 2, 2);
+
+  // A A^T
+  linalg::matrix_product(as, linalg::transposed(as), cs);
+  assert(c[0] == 14 && c[1] == 32 && c[2] == 32 && c[3] == 77);
+
+  // Empty inner dimension
+  cuda::std::mdspan<int, matrix_extents> empty_a(a.data(), 2, 0);
+  cuda::std::mdspan<int, matrix_extents> empty_b(a.data(), 0, 2);
+  linalg::matrix_product(empty_a, empty_b, cs);
+  assert(c[0] == 0 && c[1] == 0 && c[2] == 0 && c[3] == 0);
+  return true;
+}
+
+template <class Layout, class Triangle, class Diagonal>
+TEST_FUNC constexpr bool test_triangular_solve()
+{
+  constexpr int n       = 6;
+  constexpr int m       = 7;
+  constexpr bool upper  = cuda::std::is_same_v<Triangle, linalg::upper_triangle_t>;
+  constexpr bool unit   = cuda::std::is_same_v<Diagonal, linalg::implicit_unit_diagonal_t>;
+  constexpr double diag = 4.0;
+
+  // The other triangle and, for an implicit unit diagonal, the diagonal hold garbage that must not be read
+  cuda::std::array<double, n * (n + 1)> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      const bool in_triangle = upper ? j > i : j < i;
+      a(i, j)                = in_triangle ? 0.25 * ((i + 2 * j) % 5 - 2) : 1000.0;
+    }
+    if (!unit)
+    {
+      a(i, i) = diag;
+    }
+  }
+  const auto element = [&](int i, int j) {
+    if (i == j)
+    {
+      return unit ? 1.0 : diag;
+    }
+    return (upper ? j > i : j < i) ? a(i, j) : 0.0;
+  };
+
+  // A X = B
+  {
+    cuda::std::array<double, n * m> b_data{};
+    cuda::std::array<double, (n + 1) * m> x_data{};
+    cuda::std::mdspan<double, matrix_extents> b(b_data.data(), n, m);
+    auto x = make_matrix<Layout>(x_data.data(), n, m);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < m; ++j)
+      {
+        b(i, j) = i * m + j - 10;
+      }
+    }
+
+    linalg::triangular_matrix_matrix_left_solve(a, Triangle{}, Diagonal{}, b, x);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < m; ++j)
+      {
+        double sum = 0.0;
+        for (int k = 0; k < n; ++k)
+        {
+          sum += element(i, k) * x(k, j);
+        }
+        assert(cuda::std::fabs(sum - b(i, j)) < 1e-12);
+      }
+    }
+
+    // In place
+    linalg::triangular_matrix_matrix_left_solve(a, Triangle{}, Diagonal{}, b);
+    for (int i = 0; i < n; ++i)
+    {
+      for (int j = 0; j < m; ++j)
+      {
+        assert(b(i, j) == x(i, j));
+      }
+    }
+  }
+
+  // X A = B
+  {
+    cuda::std::array<double, m * n> b_data{};
+    cuda::std::array<double, (m + 1) * n> x_data{};
+    cuda::std::mdspan<double, matrix_extents> b(b_data.data(), m, n);
+    auto x = make_matrix<Layout>(x_data.data(), m, n);
+    for (int i = 0; i < m; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        b(i, j) = 3 * i - j;
+      }
+    }
+
+    linalg::triangular_matrix_matrix_right_solve(a, Triangle{}, Diagonal{}, b, x);
+    for (int i = 0; i < m; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        double sum = 0.0;
+        for (int k = 0; k < n; ++k)
+        {
+          sum += x(i, k) * element(k, j);
+        }
+        assert(cuda::std::fabs(sum - b(i, j)) < 1e-12);
+      }
+    }
+
+    linalg::triangular_matrix_matrix_right_solve(a, Triangle{}, Diagonal{}, b);
+    for (int i = 0; i < m; ++i)
+    {
+      for (int j = 0; j < n; ++j)
+      {
+        assert(b(i, j) == x(i, j));
+      }
+    }
+  }
+  return true;
+}
+
+template <class Layout>
+TEST_FUNC void test_policy()
+{
+  constexpr int n = 70;
+  cuda::std::array<int, (n + 1) * n> a_data{};
+  cuda::std::array<int, (n + 1) * n> c_data{};
+  cuda::std::array<int, (n + 1) * n> d_data{};
+  auto a = make_matrix<Layout>(a_data.data(), n, n);
+  auto c = make_matrix<Layout>(c_data.data(), n, n);
+  auto d = make_matrix<Layout>(d_data.data(), n, n);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      a(i, j) = i == j ? 1 : (i + j) % 3 - 1;
+    }
+  }
+
+  linalg::matrix_product(a, a, c);
+  linalg::matrix_product(cuda::std::execution::par, a, a, d);
+  assert(c_data == d_data);
+  linalg::matrix_product(cuda::std::execution::par_unseq, a, a, c, d);
+  for (int i = 0; i < n; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(d(i, j) == 2 * c(i, j));
+    }
+  }
+
+  // With a unit diagonal the solve of integers is exact
+  cuda::std::array<int, (n + 1) * n> x_data{};
+  auto x = make_matrix<Layout>(x_data.data(), n, n);
+  linalg::triangular_matrix_matrix_left_solve(
+    cuda::std::execution::par, a, linalg::lower_triangle, linalg::implicit_unit_diagonal, c, x);
+  linalg::triangular_matrix_matrix_left_solve(a, linalg::lower_triangle, linalg::implicit_unit_diagonal, c);
+  assert(c_data == x_data);
+}
+
+int main(int, char**)
+{
+  test_matrix_product<cuda::std::layout_right, cuda::std::layout_right, cuda::std::layout_right, 9, 6, 5>();
+  test_matrix_product<cuda::std::layout_left, cuda::std::layout_left, cuda::std::layout_left, 9, 6, 5>();
+  test_matrix_product<cuda::std::layout_right, cuda::std::layout_left, cuda::std::layout_stride, 5, 9, 7>();
+  test_matrix_product<cuda::std::layout_stride, cuda::std::layout_right, cuda::std::layout_left, 13, 11, 3>();
+  test_matrix_product<cuda::std::layout_right, cuda::std::layout_right, cuda::std::layout_right, 6, 5, 300>();
+  static_assert(
+    test_matrix_product<cuda::std::layout_right, cuda::std::layout_left, cuda::std::layout_stride, 5, 9, 7>());
+  test_matrix_product_transposed();
+  static_assert(test_matrix_product_transposed());
+
+  test_triangular_solve<cuda::std::layout_right, linalg::upper_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular_solve<cuda::std::layout_right, linalg::lower_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular_solve<cuda::std::layout_left, linalg::upper_triangle_t, linalg::implicit_unit_diagonal_t>();
+  test_triangular_solve<cuda::std::layout_left, linalg::lower_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular_solve<cuda::std::layout_stride, linalg::upper_triangle_t, linalg::explicit_diagonal_t>();
+  test_triangular_solve<cuda::std::layout_stride, linalg::lower_triangle_t, linalg::implicit_unit_diagonal_t>();
+  static_assert(test_triangular_solve<cuda::std::layout_left, linalg::lower_triangle_t, linalg::explicit_diagonal_t>());
+
+  NV_IF_TARGET(NV_IS_HOST,
+               (test_policy<cuda::std::layout_right>(); test_policy<cuda::std::layout_left>();
+                test_policy<cuda::std::layout_stride>();))
+  return 0;
+}
@@ -0,0 +1,194 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef TEST_STD_LINALG_ALGORITHMS_HOST_BACKENDS_H
+#define TEST_STD_LINALG_ALGORITHMS_HOST_BACKENDS_H
+
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/execution>
+#include <cuda/std/linalg>
+#include <cuda/std/type_traits>
+
+namespace linalg = cuda::std::linalg;
+
+using vector_extents = cuda::std::dextents<int, 1>;
+using matrix_extents = cuda::std::dextents<int, 2>;
+
+// The problems below are big enough for the algorithms to split their work into several tasks, and the results of the
+// backend are compared to the ones of the serial algorithms. All values are integers, so that the results are exact.
+
+template <class Layout, class T>
+auto make_matrix(T* data, int rows, int cols)
+{
+  if constexpr (cuda::std::is_same_v<Layout, cuda::std::layout_stride>)
+  {
+    // Column major with a padded leading dimension
+    using mapping = cuda::std::layout_stride::mapping<matrix_extents>;
+    return cuda::std::mdspan<T, matrix_extents, Layout>(
+      data, mapping(matrix_extents(rows, cols), cuda::std::array<int, 2>{1, rows + 1}));
+  }
+  else
+  {
+    return cuda::std::mdspan<T, matrix_extents, Layout>(data, rows, cols);
+  }
+}
+
+template <class Policy>
+void test_dot(const Policy& policy)
+{
+  constexpr int n = 100000;
+  static cuda::std::array<int, n> x{};
+  static cuda::std::array<int, n> y{};
+  for (int i = 0; i < n; ++i)
+  {
+    x[i] = i % 7 - 3;
+    y[i] = i % 5 - 2;
+  }
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), n);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), n);
+
+  assert(linalg::dot(policy, xs, ys, 5L) == linalg::dot(xs, ys, 5L));
+  assert(linalg::dot(policy, xs, ys) == linalg::dot(xs, ys));
+}
+
+template <class Layout, class Policy>
+void test_matrix_vector_product(const Policy& policy)
+{
+  constexpr int rows = 513;
+  constexpr int cols = 256;
+  static cuda::std::array<int, (rows + 1) * cols> a_data{};
+  auto a = make_matrix<Layout>(a_data.data(), rows, cols);
+  for (int i = 0; i < rows; ++i)
+  {
+    for (int j = 0; j < cols; ++j)
+    {
+      a(i, j) = (i * 7 + j * 3) % 11 - 5;
+    }
+  }
+  cuda::std::array<int, cols> x{};
+  for (int j = 0; j < cols; ++j)
+  {
+    x[j] = j % 4 - 1;
+  }
+  cuda::std::array<int, rows> y{};
+  cuda::std::array<int, rows> z{};
+  cuda::std::mdspan<int, vector_extents> xs(x.data(), cols);
+  cuda::std::mdspan<int, vector_extents> ys(y.data(), rows);
+  cuda::std::mdspan<int, vector_extents> zs(z.data(), rows);
+
+  linalg::matrix_vector_product(a, xs, ys);
+  linalg::matrix_vector_product(policy, a, xs, zs);
+  assert(y == z);
+
+  // z = y + A x
+  linalg::matrix_vector_product(policy, a, xs, ys, zs);
+  for (int i = 0; i < rows; ++i)
+  {
+    assert(z[i] == 2 * y[i]);
+  }
+}
+
+template <class Layout, class Policy>
+void test_matrix_product(const Policy& policy)
+{
+  // Several tiles in both dimensions of C, none of them full
+  constexpr int m = 160;
+  constexpr int n = 272;
+  constexpr int k = 32;
+  static cuda::std::array<int, (m + 1) * k> a_data{};
+  static cuda::std::array<int, (k + 1) * n> b_data{};
+  static cuda::std::array<int, (m + 1) * n> c_data{};
+  static cuda::std::array<int, (m + 1) * n> d_data{};
+  auto a = make_matrix<Layout>(a_data.data(), m, k);
+  auto b = make_matrix<Layout>(b_data.data(), k, n);
+  auto c = make_matrix<Layout>(c_data.data(), m, n);
+  auto d = make_matrix<Layout>(d_data.data(), m, n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int l = 0; l < k; ++l)
+    {
+      a(i, l) = (i * 3 + l) % 5 - 2;
+    }
+  }
+  for (int l = 0; l < k; ++l)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      b(l, j) = (l + 2 * j) % 7 - 3;
+    }
+  }
+
+  linalg::matrix_product(a, b, c);
+  linalg::matrix_product(policy, a, b, d);
+  assert(c_data == d_data);
+
+  // D = C + A B
+  linalg::matrix_product(policy, a, b, c, d);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      assert(d(i, j) == 2 * c(i, j));
+    }
+  }
+}
+
+template <class Layout, class Policy>
+void test_triangular_solve(const Policy& policy)
+{
+  constexpr int m = 64;
+  constexpr int n = 130;
+  static cuda::std::array<int, (m + 1) * m> a_data{};
+  static cuda::std::array<int, (m + 1) * n> b_data{};
+  static cuda::std::array<int, (m + 1) * n> x_data{};
+  auto a = make_matrix<Layout>(a_data.data(), m, m);
+  auto b = make_matrix<Layout>(b_data.data(), m, n);
+  auto x = make_matrix<Layout>(x_data.data(), m, n);
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < m; ++j)
+    {
+      a(i, j) = (i + j) % 3 - 1;
+    }
+  }
+  for (int i = 0; i < m; ++i)
+  {
+    for (int j = 0; j < n; ++j)
+    {
+      b(i, j) = (i * n + j) % 9 - 4;
+    }
+  }
+
+  // With a unit diagonal the solve of integers is exact
+  linalg::triangular_matrix_matrix_left_solve(
+    policy, a, linalg::lower_triangle, linalg::implicit_unit_diagonal, b, x);
+  linalg::triangular_matrix_matrix_left_solve(a, linalg::lower_triangle, linalg::implicit_unit_diagonal, b);
+  assert(b_data == x_data);
+
+  // In place
+  linalg::triangular_matrix_matrix_left_solve(a, linalg::upper_triangle, linalg::implicit_unit_diagonal, x);
+  linalg::triangular_matrix_matrix_left_solve(policy, a, linalg::upper_triangle, linalg::implicit_unit_diagonal, b);
+  assert(b_data == x_data);
+}
+
+template <class Policy>
+void test(const Policy& policy)
+{
+  test_dot(policy);
+  test_matrix_vector_product<cuda::std::layout_right>(policy);
+  test_matrix_vector_product<cuda::std::layout_left>(policy);
+  test_matrix_product<cuda::std::layout_right>(policy);
+  test_matrix_product<cuda::std::layout_left>(policy);
+  test_matrix_product<cuda::std::layout_stride>(policy);
+  test_triangular_solve<cuda::std::layout_right>(policy);
+  test_triangular_solve<cuda::std::layout_left>(policy);
+}
+
+#endif // TEST_STD_LINALG_ALGORITHMS_HOST_BACKENDS_H
@@ -0,0 +1,31 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+// REQUIRES: openmp
+
+// ADDITIONAL_COMPILE_DEFINITIONS: CCCL_ENABLE_OMP_BACKEND
+// ADDITIONAL_COMPILE_OPTIONS_HOST: -fopenmp
+// ADDITIONAL_LINK_OPTIONS_HOST: -fopenmp
+
+#include <cuda/std/execution>
+
+#include <nv/target>
+
+#include <omp.h>
+
+#include "host_backends.h"
+
+int main(int, char**)
+{
+  // Several threads, so that the algorithms split their work even on a machine with a single core
+  NV_IF_TARGET(NV_IS_HOST, (omp_set_num_threads(4); test(cuda::execution::omp);))
+
+  return 0;
+}
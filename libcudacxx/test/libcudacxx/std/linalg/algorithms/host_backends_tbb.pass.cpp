@@ -0,0 +1,36 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: nvrtc
+// REQUIRES: tbb
+
+// ADDITIONAL_COMPILE_DEFINITIONS: CCCL_ENABLE_TBB_BACKEND
+// ADDITIONAL_LINK_OPTIONS_HOST: -ltbb
+
+#include <cuda/std/execution>
+
+#include <nv/target>
+
+#include <tbb/global_control.h>
+#include <tbb/task_arena.h>
+
+#include "host_backends.h"
+
+int main(int, char**)
+{
+  // Run in an arena of several threads, so that the algorithms split their work even on a machine with a single core
+  NV_IF_TARGET(NV_IS_HOST,
+               (tbb::global_control control(tbb::global_control::max_allowed_parallelism, 4);
+                tbb::task_arena arena(4);
+                arena.execute([] {
+                  test(cuda::execution::tbb);
+                });))
+
+  return 0;
+}
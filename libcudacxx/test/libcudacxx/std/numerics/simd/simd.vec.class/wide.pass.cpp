@@ -0,0 +1,205 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++ in the CUDA C++ Core Libraries,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+// UNSUPPORTED: force-tile
+// error: calling a host device function in tile mode
+
+// <cuda/std/__simd_>
+
+// Operations and reductions of vectors which span several host vector registers and a partial one, compared element
+// by element with the scalar operations
+
+#include <cuda/std/__simd_>
+#include <cuda/std/array>
+#include <cuda/std/cassert>
+#include <cuda/std/type_traits>
+
+#include "../simd_test_utils.h"
+#include "test_macros.h"
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr cuda::std::array<T, N> make_values(int mul, int add, int mod, int offset = 0)
+{
+  cuda::std::array<T, N> arr{};
+  for (int i = 0; i < N; ++i)
+  {
+    arr[i] = static_cast<T>((i * mul + add) % mod + offset);
+  }
+  return arr;
+}
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr void test_arithmetic()
+{
+  using Vec      = simd::basic_vec<T, simd::fixed_size<N>>;
+  const auto lhs = make_values<T, N>(37, 11, 23);
+  const auto rhs = make_values<T, N>(13, 6, 17, 1); // no zeros
+  const Vec a(lhs);
+  const Vec b(rhs);
+
+  const Vec sum        = a + b;
+  const Vec difference = a - b;
+  const Vec product    = a * b;
+  const Vec quotient   = a / b;
+  const Vec negated    = -a;
+  const Vec minimum    = simd::min(a, b);
+  const Vec maximum    = simd::max(a, b);
+  for (int i = 0; i < N; ++i)
+  {
+    assert(sum[i] == static_cast<T>(lhs[i] + rhs[i]));
+    assert(difference[i] == static_cast<T>(lhs[i] - rhs[i]));
+    assert(product[i] == static_cast<T>(lhs[i] * rhs[i]));
+    assert(quotient[i] == static_cast<T>(lhs[i] / rhs[i]));
+    assert(negated[i] == static_cast<T>(-lhs[i]));
+    assert(minimum[i] == (rhs[i] < lhs[i] ? rhs[i] : lhs[i]));
+    assert(maximum[i] == (lhs[i] < rhs[i] ? rhs[i] : lhs[i]));
+  }
+}
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr void test_bitwise()
+{
+  using Vec      = simd::basic_vec<T, simd::fixed_size<N>>;
+  const auto lhs = make_values<T, N>(37, 11, 23);
+  const auto rhs = make_values<T, N>(13, 6, 17);
+  const Vec a(lhs);
+  const Vec b(rhs);
+  const Vec shift(T{3});
+
+  const Vec bit_and     = a & b;
+  const Vec bit_or      = a | b;
+  const Vec bit_xor     = a ^ b;
+  const Vec bit_not     = ~a;
+  const Vec shift_left  = b << shift;
+  const Vec shift_right = b >> shift;
+  for (int i = 0; i < N; ++i)
+  {
+    assert(bit_and[i] == static_cast<T>(lhs[i] & rhs[i]));
+    assert(bit_or[i] == static_cast<T>(lhs[i] | rhs[i]));
+    assert(bit_xor[i] == static_cast<T>(lhs[i] ^ rhs[i]));
+    assert(bit_not[i] == static_cast<T>(~lhs[i]));
+    assert(shift_left[i] == static_cast<T>(rhs[i] << 3));
+    assert(shift_right[i] == static_cast<T>(rhs[i] >> 3));
+  }
+}
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr void test_comparison()
+{
+  using Vec      = simd::basic_vec<T, simd::fixed_size<N>>;
+  const auto lhs = make_values<T, N>(37, 11, 23);
+  const auto rhs = make_values<T, N>(13, 6, 17);
+  const Vec a(lhs);
+  const Vec b(rhs);
+
+  const auto equal         = a == b;
+  const auto not_equal     = a != b;
+  const auto less          = a < b;
+  const auto less_equal    = a <= b;
+  const auto greater       = a > b;
+  const auto greater_equal = a >= b;
+  for (int i = 0; i < N; ++i)
+  {
+    assert(equal[i] == (lhs[i] == rhs[i]));
+    assert(not_equal[i] == (lhs[i] != rhs[i]));
+    assert(less[i] == (lhs[i] < rhs[i]));
+    assert(less_equal[i] == (lhs[i] <= rhs[i]));
+    assert(greater[i] == (lhs[i] > rhs[i]));
+    assert(greater_equal[i] == (lhs[i] >= rhs[i]));
+  }
+}
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr void test_reductions()
+{
+  using Vec         = simd::basic_vec<T, simd::fixed_size<N>>;
+  const auto values = make_values<T, N>(37, 11, 23);
+  const Vec vec(values);
+
+  T sum     = values[0];
+  T minimum = values[0];
+  T maximum = values[0];
+  for (int i = 1; i < N; ++i)
+  {
+    sum     = static_cast<T>(sum + values[i]);
+    minimum = values[i] < minimum ? values[i] : minimum;
+    maximum = maximum < values[i] ? values[i] : maximum;
+  }
+  assert(simd::reduce(vec) == sum);
+  assert(simd::reduce_min(vec) == minimum);
+  assert(simd::reduce_max(vec) == maximum);
+
+  // the value of the sixth element repeats every 23 elements, so that the first and the last set element are in
+  // different words of the larger masks
+  const auto mask = vec == Vec(values[5]);
+  int count       = 0;
+  int first       = -1;
+  int last        = -1;
+  for (int i = 0; i < N; ++i)
+  {
+    if (values[i] == values[5])
+    {
+      first = first < 0 ? i : first;
+      last  = i;
+      ++count;
+    }
+  }
+  assert(simd::reduce_count(mask) == count);
+  assert(simd::any_of(mask));
+  assert(!simd::all_of(mask));
+  assert(simd::reduce_min_index(mask) == first);
+  assert(simd::reduce_max_index(mask) == last);
+  assert(simd::all_of(vec == vec));
+  assert(simd::none_of(vec != vec));
+}
+
+template <typename T, int N>
+TEST_HOST_DEVICE_FUNC constexpr void test_size()
+{
+  test_arithmetic<T, N>();
+  test_comparison<T, N>();
+  test_reductions<T, N>();
+  if constexpr (cuda::std::is_integral_v<T>)
+  {
+    test_bitwise<T, N>();
+  }
+}
+
+template <typename T>
+TEST_HOST_DEVICE_FUNC constexpr void test_type()
+{
+  test_size<T, 17>();
+  test_size<T, 35>();
+  test_size<T, 64>();
+}
+
+TEST_HOST_DEVICE_FUNC constexpr bool test()
+{
+  test_type<int8_t>();
+  test_type<int16_t>();
+  test_type<int32_t>();
+  test_type<int64_t>();
+  test_type<uint8_t>();
+  test_type<uint16_t>();
+  test_type<uint32_t>();
+  test_type<uint64_t>();
+  test_type<char16_t>();
+  test_type<wchar_t>();
+  test_type<float>();
+  test_type<double>();
+  return true;
+}
+
+int main(int, char**)
+{
+  assert(test());
+  static_assert(test());
+  return 0;
+}
@@ -78,11 +78,36 @@ TEST_HOST_DEVICE_FUNC void test_p4037r1_small_types()
   static_assert(D_u().max() == cuda::std::numeric_limits<unsigned char>::max());
 }
 
+// __generate produces the same values as successive calls of operator()
+template <class T, class G>
+TEST_HOST_DEVICE_FUNC void test_generate_matches()
+{
+  using D = cuda::std::uniform_int_distribution<T>;
+  using P = typename D::param_type;
+  for (P param :
+       {P(0, 10), P(-50, 50), P(3, 3), P(cuda::std::numeric_limits<T>::min(), cuda::std::numeric_limits<T>::max())})
+  {
+    D d(param);
+    G g_1{};
+    G g_2{};
+    T values[300];
+    d.__generate(values, values + 300, g_1);
+    for (cuda::std::size_t i = 0; i < 300; ++i)
+    {
+      assert(values[i] == d(g_2));
+    }
+    assert(g_1 == g_2);
+  }
+}
+
 int main(int, char**)
 {
   test<int>();
   test<long>();
   test<short>();
+  test_generate_matches<int, cuda::std::philox4x64>();
+  test_generate_matches<long, cuda::std::philox4x32>();
+  test_generate_matches<short, cuda::std::minstd_rand>();
   test_p4037r1_small_types();
   return 0;
 }
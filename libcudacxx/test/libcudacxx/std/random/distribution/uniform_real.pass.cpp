@@ -58,9 +58,39 @@ TEST_HOST_DEVICE_FUNC void test()
   test_distribution<D, true, G, test_constexpr>(params, uniform_real_cdf<T>{});
 }
 
+// __generate produces the same values as successive calls of operator()
+template <class T, class G>
+TEST_HOST_DEVICE_FUNC void test_generate_matches()
+{
+  using D = cuda::std::uniform_real_distribution<T>;
+  using P = typename D::param_type;
+  for (P param : {P(0, 1), P(-5, 5), P(10, 20)})
+  {
+    for (cuda::std::size_t n :
+         {cuda::std::size_t{0}, cuda::std::size_t{1}, cuda::std::size_t{127}, cuda::std::size_t{300}})
+    {
+      D d(param);
+      G g_1{};
+      G g_2{};
+      T values[300];
+      d.__generate(values, values + n, g_1);
+      for (cuda::std::size_t i = 0; i < n; ++i)
+      {
+        assert(values[i] == d(g_2));
+      }
+      assert(g_1 == g_2);
+    }
+  }
+}
+
 int main(int, char**)
 {
   test<double>();
   test<float>();
+  test_generate_matches<double, cuda::std::philox4x64>();
+  test_generate_matches<double, cuda::std::philox4x32>();
+  test_generate_matches<double, cuda::std::minstd_rand>();
+  test_generate_matches<float, cuda::std::philox4x32>();
+  test_generate_matches<float, cuda::std::minstd_rand>();
   return 0;
 }
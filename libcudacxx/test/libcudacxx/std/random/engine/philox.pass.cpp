@@ -46,6 +46,37 @@ TEST_HOST_DEVICE_FUNC TEST_CONSTEXPR_CXX20 bool test_set_counter()
   return true;
 }
 
+template <typename Engine>
+TEST_HOST_DEVICE_FUNC TEST_CONSTEXPR_CXX20 bool test_generate()
+{
+  using result_type = typename Engine::result_type;
+
+  // the bulk generation returns the same values as operator(), and leaves the engine in the same state,
+  // wherever it starts inside a block and whether or not the count is a multiple of the batch size
+  const int offsets[] = {0, 1, 3, 6};
+  const int counts[]  = {0, 1, 5, 31, 32, 33, 100};
+  for (auto offset : offsets)
+  {
+    for (auto count : counts)
+    {
+      Engine e1(42);
+      Engine e2(42);
+      e1.discard(offset);
+      e2.discard(offset);
+
+      result_type values[100] = {};
+      e1.__generate(values, count);
+      for (int i = 0; i < count; ++i)
+      {
+        assert(values[i] == e2());
+      }
+      assert(e1 == e2);
+      assert(e1() == e2());
+    }
+  }
+  return true;
+}
+
 TEST_HOST_DEVICE_FUNC TEST_CONSTEXPR_CXX20 bool test_against_reference()
 {
   // reference values obtained from other standard library implementations
@@ -87,10 +118,14 @@ TEST_HOST_DEVICE_FUNC TEST_CONSTEXPR_CXX20 bool test()
   test_engine<cuda::std::philox4x64, 3409172418970261260ull>();
   test_set_counter<cuda::std::philox4x32>();
   test_set_counter<cuda::std::philox4x64>();
+  test_generate<cuda::std::philox4x32>();
+  test_generate<cuda::std::philox4x64>();
   test_against_reference();
 #if TEST_STD_VER >= 2020
   static_assert(test_set_counter<cuda::std::philox4x32>());
   static_assert(test_set_counter<cuda::std::philox4x64>());
+  static_assert(test_generate<cuda::std::philox4x32>());
+  static_assert(test_generate<cuda::std::philox4x64>());
   static_assert(test_against_reference());
 #endif
   return true;
@@ -0,0 +1,173 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::size_t len; // the number of characters that are expected to be consumed
+  cuda::std::errc ec;
+  double val;
+};
+
+constexpr auto success_errc = cuda::std::errc{};
+constexpr auto invalid_errc = cuda::std::errc::invalid_argument;
+constexpr auto range_errc   = cuda::std::errc::result_out_of_range;
+
+constexpr auto fmt_sci   = cuda::std::chars_format::scientific;
+constexpr auto fmt_fixed = cuda::std::chars_format::fixed;
+constexpr auto fmt_gen   = cuda::std::chars_format::general;
+constexpr auto fmt_hex   = cuda::std::chars_format::hex;
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 45> get_test_items()
+{
+  return {{
+    // simple values
+    TestItem{"0", fmt_gen, 1, success_errc, 0.0},
+    TestItem{"1", fmt_gen, 1, success_errc, 1.0},
+    TestItem{"-1.5", fmt_gen, 4, success_errc, -1.5},
+    TestItem{"0.1", fmt_gen, 3, success_errc, 0.1},
+    TestItem{".25", fmt_gen, 3, success_errc, 0.25},
+    TestItem{"25.", fmt_gen, 3, success_errc, 25.0},
+    TestItem{"3.141592653589793", fmt_gen, 17, success_errc, 3.141592653589793},
+    TestItem{"123456789012345678901234567890", fmt_gen, 30, success_errc, 123456789012345678901234567890.0},
+    TestItem{"1e23", fmt_gen, 4, success_errc, 1e23},
+    TestItem{"1E-5", fmt_gen, 4, success_errc, 1e-5},
+    TestItem{"1.5e+3x", fmt_gen, 6, success_errc, 1.5e+3},
+    TestItem{"12e", fmt_gen, 2, success_errc, 12.0},
+    TestItem{"12e+", fmt_gen, 2, success_errc, 12.0},
+    // limits
+    TestItem{"1.7976931348623157e308", fmt_gen, 22, success_errc, 1.7976931348623157e308},
+    TestItem{"2.2250738585072014e-308", fmt_gen, 23, success_errc, 2.2250738585072014e-308},
+    TestItem{"4.9406564584124654e-324", fmt_gen, 23, success_errc, 4.9406564584124654e-324},
+    TestItem{"1e309", fmt_gen, 5, range_errc, 0.0},
+    TestItem{"1e-400", fmt_gen, 6, range_errc, 0.0},
+    TestItem{"2.4703282292062327e-324", fmt_gen, 23, range_errc, 0.0},
+    TestItem{"2.4703282292062328e-324", fmt_gen, 23, success_errc, 4.9406564584124654e-324},
+    // halfway cases that need all digits to round correctly
+    TestItem{"9007199254740993", fmt_gen, 16, success_errc, 9007199254740992.0},
+    TestItem{"9007199254740993.0000000000000000000000000001", fmt_gen, 45, success_errc, 9007199254740994.0},
+    TestItem{"9007199254740995", fmt_gen, 16, success_errc, 9007199254740996.0},
+    TestItem{"2.22507385850720113605740979670913197593481954635164564e-308",
+             fmt_gen,
+             60,
+             success_errc,
+             2.2250738585072009e-308},
+    TestItem{"7.2057594037927933e16", fmt_gen, 21, success_errc, 72057594037927936.0},
+    TestItem{"0.000000000000000000000000000000000000000000000000000000000000000000000000000000000001",
+             fmt_gen,
+             86,
+             success_errc,
+             1e-84},
+    // format restrictions
+    TestItem{"1.5e3", fmt_fixed, 3, success_errc, 1.5},
+    TestItem{"1.5e3", fmt_sci, 5, success_errc, 1.5e3},
+    TestItem{"1.5", fmt_sci, 0, invalid_errc, 0.0},
+    // hexadecimal values
+    TestItem{"1.8p1", fmt_hex, 5, success_errc, 3.0},
+    TestItem{"-a.bp-2", fmt_hex, 7, success_errc, -2.671875},
+    TestItem{"20000000000001", fmt_hex, 14, success_errc, 9007199254740992.0},
+    TestItem{"1.fffffffffffffp1023", fmt_hex, 20, success_errc, 1.7976931348623157e308},
+    TestItem{"1p1024", fmt_hex, 6, range_errc, 0.0},
+    TestItem{"0x1p1", fmt_hex, 1, success_errc, 0.0},
+    TestItem{"1p", fmt_hex, 1, success_errc, 1.0},
+    // special values
+    TestItem{"inf", fmt_gen, 3, success_errc, cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"-INFINITY", fmt_gen, 9, success_errc, -cuda::std::numeric_limits<double>::infinity()},
+    TestItem{"infinit", fmt_fixed, 3, success_errc, cuda::std::numeric_limits<double>::infinity()},
+    // invalid values
+    TestItem{"", fmt_gen, 0, invalid_errc, 0.0},
+    TestItem{"+1", fmt_gen, 0, invalid_errc, 0.0},
+    TestItem{"-", fmt_gen, 0, invalid_errc, 0.0},
+    TestItem{".", fmt_gen, 0, invalid_errc, 0.0},
+    TestItem{"e5", fmt_gen, 0, invalid_errc, 0.0},
+    TestItem{"in", fmt_gen, 0, invalid_errc, 0.0},
+  }};
+}
+
+TEST_FUNC constexpr void test_from_chars(const TestItem& item)
+{
+  constexpr double init_val = 42.0;
+
+  const auto len = cuda::std::strlen(item.str);
+
+  double value      = init_val;
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+
+  assert(result.ptr == item.str + item.len);
+  assert(result.ec == item.ec);
+
+  // Check that the value is modified only on success
+  assert(value == ((item.ec == success_errc) ? item.val : init_val));
+}
+
+TEST_FUNC constexpr void test_nan()
+{
+  const char* strs[] = {"nan", "-nan", "NaN(123_abc)", "nan(", "nan(1 2)"};
+  const cuda::std::size_t lens[] = {3, 4, 12, 3, 3};
+
+  for (cuda::std::size_t i = 0; i < 5; ++i)
+  {
+    double value      = 0.0;
+    const auto result = cuda::std::from_chars(strs[i], strs[i] + cuda::std::strlen(strs[i]), value);
+    assert(result.ec == success_errc);
+    assert(result.ptr == strs[i] + lens[i]);
+    assert(value != value);
+  }
+}
+
+TEST_FUNC constexpr void test_signed_zero()
+{
+  const char str[] = "-0.0";
+
+  double value      = 1.0;
+  const auto result = cuda::std::from_chars(str, str + 4, value);
+  assert(result.ec == success_errc);
+  assert(result.ptr == str + 4);
+  assert(value == 0.0 && cuda::std::signbit(value));
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<double&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<double&>())));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  test_nan();
+  test_signed_zero();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,164 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cmath>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  const char* str;
+  cuda::std::chars_format fmt;
+  cuda::std::size_t len; // the number of characters that are expected to be consumed
+  cuda::std::errc ec;
+  float val;
+};
+
+constexpr auto success_errc = cuda::std::errc{};
+constexpr auto invalid_errc = cuda::std::errc::invalid_argument;
+constexpr auto range_errc   = cuda::std::errc::result_out_of_range;
+
+constexpr auto fmt_sci   = cuda::std::chars_format::scientific;
+constexpr auto fmt_fixed = cuda::std::chars_format::fixed;
+constexpr auto fmt_gen   = cuda::std::chars_format::general;
+constexpr auto fmt_hex   = cuda::std::chars_format::hex;
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 44> get_test_items()
+{
+  return {{
+    // simple values
+    TestItem{"0", fmt_gen, 1, success_errc, 0.0f},
+    TestItem{"1", fmt_gen, 1, success_errc, 1.0f},
+    TestItem{"-1.5", fmt_gen, 4, success_errc, -1.5f},
+    TestItem{"0.1", fmt_gen, 3, success_errc, 0.1f},
+    TestItem{".25", fmt_gen, 3, success_errc, 0.25f},
+    TestItem{"25.", fmt_gen, 3, success_errc, 25.0f},
+    TestItem{"3.14159265", fmt_gen, 10, success_errc, 3.14159265f},
+    TestItem{"123456789012345678901234567890", fmt_gen, 30, success_errc, 123456789012345678901234567890.0f},
+    TestItem{"1e10", fmt_gen, 4, success_errc, 1e10f},
+    TestItem{"1E-5", fmt_gen, 4, success_errc, 1e-5f},
+    TestItem{"1.5e+3x", fmt_gen, 6, success_errc, 1.5e+3f},
+    TestItem{"12e", fmt_gen, 2, success_errc, 12.0f},
+    TestItem{"12e+", fmt_gen, 2, success_errc, 12.0f},
+    // limits
+    TestItem{"3.40282347e38", fmt_gen, 13, success_errc, 3.40282347e38f},
+    TestItem{"1.17549435e-38", fmt_gen, 14, success_errc, 1.17549435e-38f},
+    TestItem{"1.40129846e-45", fmt_gen, 14, success_errc, 1.40129846e-45f},
+    TestItem{"1e39", fmt_gen, 4, range_errc, 0.0f},
+    TestItem{"1e-50", fmt_gen, 5, range_errc, 0.0f},
+    TestItem{"7.0064923216240853e-46", fmt_gen, 22, range_errc, 0.0f},
+    TestItem{"7.0064923216240862e-46", fmt_gen, 22, success_errc, 1.40129846e-45f},
+    // halfway cases that need all digits to round correctly
+    TestItem{"16777217", fmt_gen, 8, success_errc, 16777216.0f},
+    TestItem{"16777217.000000000000000000000000000001", fmt_gen, 39, success_errc, 16777218.0f},
+    TestItem{"16777219", fmt_gen, 8, success_errc, 16777220.0f},
+    TestItem{"1.00000005960464477539062499", fmt_gen, 28, success_errc, 1.0f},
+    TestItem{"1.00000005960464477539062501", fmt_gen, 28, success_errc, 1.00000012f},
+    // format restrictions
+    TestItem{"1.5e3", fmt_fixed, 3, success_errc, 1.5f},
+    TestItem{"1.5e3", fmt_sci, 5, success_errc, 1.5e3f},
+    TestItem{"1.5", fmt_sci, 0, invalid_errc, 0.0f},
+    // hexadecimal values
+    TestItem{"1.8p1", fmt_hex, 5, success_errc, 3.0f},
+    TestItem{"-a.bp-2", fmt_hex, 7, success_errc, -2.671875f},
+    TestItem{"1000001", fmt_hex, 7, success_errc, 16777216.0f},
+    TestItem{"1.fffffep127", fmt_hex, 12, success_errc, 3.40282347e38f},
+    TestItem{"1p128", fmt_hex, 5, range_errc, 0.0f},
+    TestItem{"0x1p1", fmt_hex, 1, success_errc, 0.0f},
+    TestItem{"1p", fmt_hex, 1, success_errc, 1.0f},
+    // special values
+    TestItem{"inf", fmt_gen, 3, success_errc, cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"-INFINITY", fmt_gen, 9, success_errc, -cuda::std::numeric_limits<float>::infinity()},
+    TestItem{"infinit", fmt_fixed, 3, success_errc, cuda::std::numeric_limits<float>::infinity()},
+    // invalid values
+    TestItem{"", fmt_gen, 0, invalid_errc, 0.0f},
+    TestItem{"+1", fmt_gen, 0, invalid_errc, 0.0f},
+    TestItem{"-", fmt_gen, 0, invalid_errc, 0.0f},
+    TestItem{".", fmt_gen, 0, invalid_errc, 0.0f},
+    TestItem{"e5", fmt_gen, 0, invalid_errc, 0.0f},
+    TestItem{"in", fmt_gen, 0, invalid_errc, 0.0f},
+  }};
+}
+
+TEST_FUNC constexpr void test_from_chars(const TestItem& item)
+{
+  constexpr float init_val = 42.0f;
+
+  const auto len = cuda::std::strlen(item.str);
+
+  float value      = init_val;
+  const auto result = cuda::std::from_chars(item.str, item.str + len, value, item.fmt);
+
+  assert(result.ptr == item.str + item.len);
+  assert(result.ec == item.ec);
+
+  // Check that the value is modified only on success
+  assert(value == ((item.ec == success_errc) ? item.val : init_val));
+}
+
+TEST_FUNC constexpr void test_nan()
+{
+  const char* strs[] = {"nan", "-nan", "NaN(123_abc)", "nan(", "nan(1 2)"};
+  const cuda::std::size_t lens[] = {3, 4, 12, 3, 3};
+
+  for (cuda::std::size_t i = 0; i < 5; ++i)
+  {
+    float value      = 0.0f;
+    const auto result = cuda::std::from_chars(strs[i], strs[i] + cuda::std::strlen(strs[i]), value);
+    assert(result.ec == success_errc);
+    assert(result.ptr == strs[i] + lens[i]);
+    assert(value != value);
+  }
+}
+
+TEST_FUNC constexpr void test_signed_zero()
+{
+  const char str[] = "-0.0";
+
+  float value      = 1.0f;
+  const auto result = cuda::std::from_chars(str, str + 4, value);
+  assert(result.ec == success_errc);
+  assert(result.ptr == str + 4);
+  assert(value == 0.0f && cuda::std::signbit(value));
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::from_chars_result,
+                                     decltype(cuda::std::from_chars(cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<const char*>(),
+                                                                    cuda::std::declval<float&>()))>);
+  static_assert(noexcept(cuda::std::from_chars(
+    cuda::std::declval<const char*>(), cuda::std::declval<const char*>(), cuda::std::declval<float&>())));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_from_chars(item);
+  }
+
+  test_nan();
+  test_signed_zero();
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
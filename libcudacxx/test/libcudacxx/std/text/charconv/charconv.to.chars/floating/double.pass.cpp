@@ -0,0 +1,301 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  double val;
+  const char* str;
+  cuda::std::chars_format fmt = cuda::std::chars_format{};
+  int precision               = -1; // -1 means no precision
+};
+
+// The reference strings were generated with libstdc++'s std::to_chars for every value and format:
+//
+// char buff[2000];
+// auto result = (fmt == std::chars_format{}) ? std::to_chars(buff, buff + 2000, value)
+//             : (precision < 0)             ? std::to_chars(buff, buff + 2000, value, fmt)
+//                                           : std::to_chars(buff, buff + 2000, value, fmt, precision);
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 165> get_test_items()
+{
+  return {{
+      TestItem{0.0, "0"},
+      TestItem{0.0, "0e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{0.0, "0", cuda::std::chars_format::fixed, -1},
+      TestItem{0.0, "0", cuda::std::chars_format::general, -1},
+      TestItem{0.0, "0p+0", cuda::std::chars_format::hex, -1},
+      TestItem{0.0, "0.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{0.0, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{0.0, "0", cuda::std::chars_format::general, 3},
+      TestItem{0.0, "0.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{0.0, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{0.0, "0.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{-0.0, "-0"},
+      TestItem{-0.0, "-0e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{-0.0, "-0", cuda::std::chars_format::fixed, -1},
+      TestItem{-0.0, "-0", cuda::std::chars_format::general, -1},
+      TestItem{-0.0, "-0p+0", cuda::std::chars_format::hex, -1},
+      TestItem{-0.0, "-0.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{-0.0, "-0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{-0.0, "-0", cuda::std::chars_format::general, 3},
+      TestItem{-0.0, "-0.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{-0.0, "-0", cuda::std::chars_format::fixed, 0},
+      TestItem{-0.0, "-0.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{1.0, "1"},
+      TestItem{1.0, "1e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{1.0, "1", cuda::std::chars_format::fixed, -1},
+      TestItem{1.0, "1", cuda::std::chars_format::general, -1},
+      TestItem{1.0, "1p+0", cuda::std::chars_format::hex, -1},
+      TestItem{1.0, "1.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{1.0, "1.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1.0, "1", cuda::std::chars_format::general, 3},
+      TestItem{1.0, "1.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{1.0, "1", cuda::std::chars_format::fixed, 0},
+      TestItem{1.0, "1.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{-1.5, "-1.5"},
+      TestItem{-1.5, "-1.5e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{-1.5, "-1.5", cuda::std::chars_format::fixed, -1},
+      TestItem{-1.5, "-1.5", cuda::std::chars_format::general, -1},
+      TestItem{-1.5, "-1.8p+0", cuda::std::chars_format::hex, -1},
+      TestItem{-1.5, "-1.500e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{-1.5, "-1.500", cuda::std::chars_format::fixed, 3},
+      TestItem{-1.5, "-1.5", cuda::std::chars_format::general, 3},
+      TestItem{-1.5, "-1.800p+0", cuda::std::chars_format::hex, 3},
+      TestItem{-1.5, "-2", cuda::std::chars_format::fixed, 0},
+      TestItem{-1.5, "-1.50000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{0.1, "0.1"},
+      TestItem{0.1, "1e-01", cuda::std::chars_format::scientific, -1},
+      TestItem{0.1, "0.1", cuda::std::chars_format::fixed, -1},
+      TestItem{0.1, "0.1", cuda::std::chars_format::general, -1},
+      TestItem{0.1, "1.999999999999ap-4", cuda::std::chars_format::hex, -1},
+      TestItem{0.1, "1.000e-01", cuda::std::chars_format::scientific, 3},
+      TestItem{0.1, "0.100", cuda::std::chars_format::fixed, 3},
+      TestItem{0.1, "0.1", cuda::std::chars_format::general, 3},
+      TestItem{0.1, "1.99ap-4", cuda::std::chars_format::hex, 3},
+      TestItem{0.1, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{0.1, "1.00000000000000005551e-01", cuda::std::chars_format::scientific, 20},
+      TestItem{123456.0, "123456"},
+      TestItem{123456.0, "1.23456e+05", cuda::std::chars_format::scientific, -1},
+      TestItem{123456.0, "123456", cuda::std::chars_format::fixed, -1},
+      TestItem{123456.0, "123456", cuda::std::chars_format::general, -1},
+      TestItem{123456.0, "1.e24p+16", cuda::std::chars_format::hex, -1},
+      TestItem{123456.0, "1.235e+05", cuda::std::chars_format::scientific, 3},
+      TestItem{123456.0, "123456.000", cuda::std::chars_format::fixed, 3},
+      TestItem{123456.0, "1.23e+05", cuda::std::chars_format::general, 3},
+      TestItem{123456.0, "1.e24p+16", cuda::std::chars_format::hex, 3},
+      TestItem{123456.0, "123456", cuda::std::chars_format::fixed, 0},
+      TestItem{123456.0, "1.23456000000000000000e+05", cuda::std::chars_format::scientific, 20},
+      TestItem{1234567.0, "1234567"},
+      TestItem{1234567.0, "1.234567e+06", cuda::std::chars_format::scientific, -1},
+      TestItem{1234567.0, "1234567", cuda::std::chars_format::fixed, -1},
+      TestItem{1234567.0, "1.234567e+06", cuda::std::chars_format::general, -1},
+      TestItem{1234567.0, "1.2d687p+20", cuda::std::chars_format::hex, -1},
+      TestItem{1234567.0, "1.235e+06", cuda::std::chars_format::scientific, 3},
+      TestItem{1234567.0, "1234567.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1234567.0, "1.23e+06", cuda::std::chars_format::general, 3},
+      TestItem{1234567.0, "1.2d7p+20", cuda::std::chars_format::hex, 3},
+      TestItem{1234567.0, "1234567", cuda::std::chars_format::fixed, 0},
+      TestItem{1234567.0, "1.23456700000000000000e+06", cuda::std::chars_format::scientific, 20},
+      TestItem{1e23, "1e+23"},
+      TestItem{1e23, "1e+23", cuda::std::chars_format::scientific, -1},
+      TestItem{1e23, "99999999999999991611392", cuda::std::chars_format::fixed, -1},
+      TestItem{1e23, "1e+23", cuda::std::chars_format::general, -1},
+      TestItem{1e23, "1.52d02c7e14af6p+76", cuda::std::chars_format::hex, -1},
+      TestItem{1e23, "1.000e+23", cuda::std::chars_format::scientific, 3},
+      TestItem{1e23, "99999999999999991611392.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1e23, "1e+23", cuda::std::chars_format::general, 3},
+      TestItem{1e23, "1.52dp+76", cuda::std::chars_format::hex, 3},
+      TestItem{1e23, "99999999999999991611392", cuda::std::chars_format::fixed, 0},
+      TestItem{1e23, "9.99999999999999916114e+22", cuda::std::chars_format::scientific, 20},
+      TestItem{1e-5, "1e-05"},
+      TestItem{1e-5, "1e-05", cuda::std::chars_format::scientific, -1},
+      TestItem{1e-5, "0.00001", cuda::std::chars_format::fixed, -1},
+      TestItem{1e-5, "1e-05", cuda::std::chars_format::general, -1},
+      TestItem{1e-5, "1.4f8b588e368f1p-17", cuda::std::chars_format::hex, -1},
+      TestItem{1e-5, "1.000e-05", cuda::std::chars_format::scientific, 3},
+      TestItem{1e-5, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1e-5, "1e-05", cuda::std::chars_format::general, 3},
+      TestItem{1e-5, "1.4f9p-17", cuda::std::chars_format::hex, 3},
+      TestItem{1e-5, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{1e-5, "1.00000000000000008180e-05", cuda::std::chars_format::scientific, 20},
+      TestItem{2.5, "2.5"},
+      TestItem{2.5, "2.5e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{2.5, "2.5", cuda::std::chars_format::fixed, -1},
+      TestItem{2.5, "2.5", cuda::std::chars_format::general, -1},
+      TestItem{2.5, "1.4p+1", cuda::std::chars_format::hex, -1},
+      TestItem{2.5, "2.500e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{2.5, "2.500", cuda::std::chars_format::fixed, 3},
+      TestItem{2.5, "2.5", cuda::std::chars_format::general, 3},
+      TestItem{2.5, "1.400p+1", cuda::std::chars_format::hex, 3},
+      TestItem{2.5, "2", cuda::std::chars_format::fixed, 0},
+      TestItem{2.5, "2.50000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{9.9999, "9.9999"},
+      TestItem{9.9999, "9.9999e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{9.9999, "9.9999", cuda::std::chars_format::fixed, -1},
+      TestItem{9.9999, "9.9999", cuda::std::chars_format::general, -1},
+      TestItem{9.9999, "1.3fff2e48e8a72p+3", cuda::std::chars_format::hex, -1},
+      TestItem{9.9999, "1.000e+01", cuda::std::chars_format::scientific, 3},
+      TestItem{9.9999, "10.000", cuda::std::chars_format::fixed, 3},
+      TestItem{9.9999, "10", cuda::std::chars_format::general, 3},
+      TestItem{9.9999, "1.400p+3", cuda::std::chars_format::hex, 3},
+      TestItem{9.9999, "10", cuda::std::chars_format::fixed, 0},
+      TestItem{9.9999, "9.99990000000000023306e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{5e-324, "5e-324"},
+      TestItem{5e-324, "5e-324", cuda::std::chars_format::scientific, -1},
+      TestItem{5e-324, "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000005", cuda::std::chars_format::fixed, -1},
+      TestItem{5e-324, "5e-324", cuda::std::chars_format::general, -1},
+      TestItem{5e-324, "0.0000000000001p-1022", cuda::std::chars_format::hex, -1},
+      TestItem{5e-324, "4.941e-324", cuda::std::chars_format::scientific, 3},
+      TestItem{5e-324, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{5e-324, "4.94e-324", cuda::std::chars_format::general, 3},
+      TestItem{5e-324, "0.000p-1022", cuda::std::chars_format::hex, 3},
+      TestItem{5e-324, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{5e-324, "4.94065645841246544177e-324", cuda::std::chars_format::scientific, 20},
+      TestItem{2.2250738585072014e-308, "2.2250738585072014e-308"},
+      TestItem{2.2250738585072014e-308, "2.2250738585072014e-308", cuda::std::chars_format::scientific, -1},
+      TestItem{2.2250738585072014e-308, "0.000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000022250738585072014", cuda::std::chars_format::fixed, -1},
+      TestItem{2.2250738585072014e-308, "2.2250738585072014e-308", cuda::std::chars_format::general, -1},
+      TestItem{2.2250738585072014e-308, "1p-1022", cuda::std::chars_format::hex, -1},
+      TestItem{2.2250738585072014e-308, "2.225e-308", cuda::std::chars_format::scientific, 3},
+      TestItem{2.2250738585072014e-308, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{2.2250738585072014e-308, "2.23e-308", cuda::std::chars_format::general, 3},
+      TestItem{2.2250738585072014e-308, "1.000p-1022", cuda::std::chars_format::hex, 3},
+      TestItem{2.2250738585072014e-308, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{2.2250738585072014e-308, "2.22507385850720138309e-308", cuda::std::chars_format::scientific, 20},
+      TestItem{1.7976931348623157e308, "1.7976931348623157e+308"},
+      TestItem{1.7976931348623157e308, "1.7976931348623157e+308", cuda::std::chars_format::scientific, -1},
+      TestItem{1.7976931348623157e308, "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368", cuda::std::chars_format::fixed, -1},
+      TestItem{1.7976931348623157e308, "1.7976931348623157e+308", cuda::std::chars_format::general, -1},
+      TestItem{1.7976931348623157e308, "1.fffffffffffffp+1023", cuda::std::chars_format::hex, -1},
+      TestItem{1.7976931348623157e308, "1.798e+308", cuda::std::chars_format::scientific, 3},
+      TestItem{1.7976931348623157e308, "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1.7976931348623157e308, "1.8e+308", cuda::std::chars_format::general, 3},
+      TestItem{1.7976931348623157e308, "2.000p+1023", cuda::std::chars_format::hex, 3},
+      TestItem{1.7976931348623157e308, "179769313486231570814527423731704356798070567525844996598917476803157260780028538760589558632766878171540458953514382464234321326889464182768467546703537516986049910576551282076245490090389328944075868508455133942304583236903222948165808559332123348274797826204144723168738177180919299881250404026184124858368", cuda::std::chars_format::fixed, 0},
+      TestItem{1.7976931348623157e308, "1.79769313486231570815e+308", cuda::std::chars_format::scientific, 20},
+      TestItem{3.141592653589793, "3.141592653589793"},
+      TestItem{3.141592653589793, "3.141592653589793e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{3.141592653589793, "3.141592653589793", cuda::std::chars_format::fixed, -1},
+      TestItem{3.141592653589793, "3.141592653589793", cuda::std::chars_format::general, -1},
+      TestItem{3.141592653589793, "1.921fb54442d18p+1", cuda::std::chars_format::hex, -1},
+      TestItem{3.141592653589793, "3.142e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{3.141592653589793, "3.142", cuda::std::chars_format::fixed, 3},
+      TestItem{3.141592653589793, "3.14", cuda::std::chars_format::general, 3},
+      TestItem{3.141592653589793, "1.922p+1", cuda::std::chars_format::hex, 3},
+      TestItem{3.141592653589793, "3", cuda::std::chars_format::fixed, 0},
+    TestItem{3.141592653589793, "3.14159265358979311600e+00", cuda::std::chars_format::scientific, 20},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 6> get_special_test_items()
+{
+  return {{
+    TestItem{cuda::std::numeric_limits<double>::infinity(), "inf"},
+    TestItem{-cuda::std::numeric_limits<double>::infinity(), "-inf"},
+    TestItem{cuda::std::numeric_limits<double>::infinity(), "inf", cuda::std::chars_format::fixed, 3},
+    TestItem{-cuda::std::numeric_limits<double>::infinity(), "-inf", cuda::std::chars_format::hex},
+    TestItem{cuda::std::numeric_limits<double>::quiet_NaN(), "nan"},
+    TestItem{cuda::std::numeric_limits<double>::quiet_NaN(), "nan", cuda::std::chars_format::scientific, 2},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::to_chars_result test_to_chars_impl(char* first, char* last, const TestItem& item)
+{
+  if (item.fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, item.val);
+  }
+  else if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt);
+  }
+  else
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+  }
+}
+
+TEST_FUNC constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 400;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start + buff_size, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start + ref_len - 1, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), double{}, cuda::std::chars_format{}, int{})));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+  constexpr auto special_items = get_special_test_items();
+  for (const auto& item : special_items)
+  {
+    test_to_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
@@ -0,0 +1,290 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of libcu++, the C++ Standard Library for your entire system,
+// under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/array>
+#include <cuda/std/charconv>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstring>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include "test_macros.h"
+
+struct TestItem
+{
+  float val;
+  const char* str;
+  cuda::std::chars_format fmt = cuda::std::chars_format{};
+  int precision               = -1; // -1 means no precision
+};
+
+// The reference strings were generated with libstdc++'s std::to_chars for every value and format:
+//
+// char buff[2000];
+// auto result = (fmt == std::chars_format{}) ? std::to_chars(buff, buff + 2000, value)
+//             : (precision < 0)             ? std::to_chars(buff, buff + 2000, value, fmt)
+//                                           : std::to_chars(buff, buff + 2000, value, fmt, precision);
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 154> get_test_items()
+{
+  return {{
+      TestItem{0.0f, "0"},
+      TestItem{0.0f, "0e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{0.0f, "0", cuda::std::chars_format::fixed, -1},
+      TestItem{0.0f, "0", cuda::std::chars_format::general, -1},
+      TestItem{0.0f, "0p+0", cuda::std::chars_format::hex, -1},
+      TestItem{0.0f, "0.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{0.0f, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{0.0f, "0", cuda::std::chars_format::general, 3},
+      TestItem{0.0f, "0.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{0.0f, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{0.0f, "0.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{-0.0f, "-0"},
+      TestItem{-0.0f, "-0e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{-0.0f, "-0", cuda::std::chars_format::fixed, -1},
+      TestItem{-0.0f, "-0", cuda::std::chars_format::general, -1},
+      TestItem{-0.0f, "-0p+0", cuda::std::chars_format::hex, -1},
+      TestItem{-0.0f, "-0.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{-0.0f, "-0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{-0.0f, "-0", cuda::std::chars_format::general, 3},
+      TestItem{-0.0f, "-0.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{-0.0f, "-0", cuda::std::chars_format::fixed, 0},
+      TestItem{-0.0f, "-0.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{1.0f, "1"},
+      TestItem{1.0f, "1e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{1.0f, "1", cuda::std::chars_format::fixed, -1},
+      TestItem{1.0f, "1", cuda::std::chars_format::general, -1},
+      TestItem{1.0f, "1p+0", cuda::std::chars_format::hex, -1},
+      TestItem{1.0f, "1.000e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{1.0f, "1.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1.0f, "1", cuda::std::chars_format::general, 3},
+      TestItem{1.0f, "1.000p+0", cuda::std::chars_format::hex, 3},
+      TestItem{1.0f, "1", cuda::std::chars_format::fixed, 0},
+      TestItem{1.0f, "1.00000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{-1.5f, "-1.5"},
+      TestItem{-1.5f, "-1.5e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{-1.5f, "-1.5", cuda::std::chars_format::fixed, -1},
+      TestItem{-1.5f, "-1.5", cuda::std::chars_format::general, -1},
+      TestItem{-1.5f, "-1.8p+0", cuda::std::chars_format::hex, -1},
+      TestItem{-1.5f, "-1.500e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{-1.5f, "-1.500", cuda::std::chars_format::fixed, 3},
+      TestItem{-1.5f, "-1.5", cuda::std::chars_format::general, 3},
+      TestItem{-1.5f, "-1.800p+0", cuda::std::chars_format::hex, 3},
+      TestItem{-1.5f, "-2", cuda::std::chars_format::fixed, 0},
+      TestItem{-1.5f, "-1.50000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{0.1f, "0.1"},
+      TestItem{0.1f, "1e-01", cuda::std::chars_format::scientific, -1},
+      TestItem{0.1f, "0.1", cuda::std::chars_format::fixed, -1},
+      TestItem{0.1f, "0.1", cuda::std::chars_format::general, -1},
+      TestItem{0.1f, "1.99999ap-4", cuda::std::chars_format::hex, -1},
+      TestItem{0.1f, "1.000e-01", cuda::std::chars_format::scientific, 3},
+      TestItem{0.1f, "0.100", cuda::std::chars_format::fixed, 3},
+      TestItem{0.1f, "0.1", cuda::std::chars_format::general, 3},
+      TestItem{0.1f, "1.99ap-4", cuda::std::chars_format::hex, 3},
+      TestItem{0.1f, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{0.1f, "1.00000001490116119385e-01", cuda::std::chars_format::scientific, 20},
+      TestItem{123456.0f, "123456"},
+      TestItem{123456.0f, "1.23456e+05", cuda::std::chars_format::scientific, -1},
+      TestItem{123456.0f, "123456", cuda::std::chars_format::fixed, -1},
+      TestItem{123456.0f, "123456", cuda::std::chars_format::general, -1},
+      TestItem{123456.0f, "1.e24p+16", cuda::std::chars_format::hex, -1},
+      TestItem{123456.0f, "1.235e+05", cuda::std::chars_format::scientific, 3},
+      TestItem{123456.0f, "123456.000", cuda::std::chars_format::fixed, 3},
+      TestItem{123456.0f, "1.23e+05", cuda::std::chars_format::general, 3},
+      TestItem{123456.0f, "1.e24p+16", cuda::std::chars_format::hex, 3},
+      TestItem{123456.0f, "123456", cuda::std::chars_format::fixed, 0},
+      TestItem{123456.0f, "1.23456000000000000000e+05", cuda::std::chars_format::scientific, 20},
+      TestItem{1234567.0f, "1234567"},
+      TestItem{1234567.0f, "1.234567e+06", cuda::std::chars_format::scientific, -1},
+      TestItem{1234567.0f, "1234567", cuda::std::chars_format::fixed, -1},
+      TestItem{1234567.0f, "1.234567e+06", cuda::std::chars_format::general, -1},
+      TestItem{1234567.0f, "1.2d687p+20", cuda::std::chars_format::hex, -1},
+      TestItem{1234567.0f, "1.235e+06", cuda::std::chars_format::scientific, 3},
+      TestItem{1234567.0f, "1234567.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1234567.0f, "1.23e+06", cuda::std::chars_format::general, 3},
+      TestItem{1234567.0f, "1.2d7p+20", cuda::std::chars_format::hex, 3},
+      TestItem{1234567.0f, "1234567", cuda::std::chars_format::fixed, 0},
+      TestItem{1234567.0f, "1.23456700000000000000e+06", cuda::std::chars_format::scientific, 20},
+      TestItem{1e10f, "1e+10"},
+      TestItem{1e10f, "1e+10", cuda::std::chars_format::scientific, -1},
+      TestItem{1e10f, "10000000000", cuda::std::chars_format::fixed, -1},
+      TestItem{1e10f, "1e+10", cuda::std::chars_format::general, -1},
+      TestItem{1e10f, "1.2a05f2p+33", cuda::std::chars_format::hex, -1},
+      TestItem{1e10f, "1.000e+10", cuda::std::chars_format::scientific, 3},
+      TestItem{1e10f, "10000000000.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1e10f, "1e+10", cuda::std::chars_format::general, 3},
+      TestItem{1e10f, "1.2a0p+33", cuda::std::chars_format::hex, 3},
+      TestItem{1e10f, "10000000000", cuda::std::chars_format::fixed, 0},
+      TestItem{1e10f, "1.00000000000000000000e+10", cuda::std::chars_format::scientific, 20},
+      TestItem{1e-5f, "1e-05"},
+      TestItem{1e-5f, "1e-05", cuda::std::chars_format::scientific, -1},
+      TestItem{1e-5f, "0.00001", cuda::std::chars_format::fixed, -1},
+      TestItem{1e-5f, "1e-05", cuda::std::chars_format::general, -1},
+      TestItem{1e-5f, "1.4f8b58p-17", cuda::std::chars_format::hex, -1},
+      TestItem{1e-5f, "1.000e-05", cuda::std::chars_format::scientific, 3},
+      TestItem{1e-5f, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1e-5f, "1e-05", cuda::std::chars_format::general, 3},
+      TestItem{1e-5f, "1.4f9p-17", cuda::std::chars_format::hex, 3},
+      TestItem{1e-5f, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{1e-5f, "9.99999974737875163555e-06", cuda::std::chars_format::scientific, 20},
+      TestItem{2.5f, "2.5"},
+      TestItem{2.5f, "2.5e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{2.5f, "2.5", cuda::std::chars_format::fixed, -1},
+      TestItem{2.5f, "2.5", cuda::std::chars_format::general, -1},
+      TestItem{2.5f, "1.4p+1", cuda::std::chars_format::hex, -1},
+      TestItem{2.5f, "2.500e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{2.5f, "2.500", cuda::std::chars_format::fixed, 3},
+      TestItem{2.5f, "2.5", cuda::std::chars_format::general, 3},
+      TestItem{2.5f, "1.400p+1", cuda::std::chars_format::hex, 3},
+      TestItem{2.5f, "2", cuda::std::chars_format::fixed, 0},
+      TestItem{2.5f, "2.50000000000000000000e+00", cuda::std::chars_format::scientific, 20},
+      TestItem{1e-45f, "1e-45"},
+      TestItem{1e-45f, "1e-45", cuda::std::chars_format::scientific, -1},
+      TestItem{1e-45f, "0.000000000000000000000000000000000000000000001", cuda::std::chars_format::fixed, -1},
+      TestItem{1e-45f, "1e-45", cuda::std::chars_format::general, -1},
+      TestItem{1e-45f, "0.000002p-126", cuda::std::chars_format::hex, -1},
+      TestItem{1e-45f, "1.401e-45", cuda::std::chars_format::scientific, 3},
+      TestItem{1e-45f, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1e-45f, "1.4e-45", cuda::std::chars_format::general, 3},
+      TestItem{1e-45f, "0.000p-126", cuda::std::chars_format::hex, 3},
+      TestItem{1e-45f, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{1e-45f, "1.40129846432481707092e-45", cuda::std::chars_format::scientific, 20},
+      TestItem{1.17549435e-38f, "1.1754944e-38"},
+      TestItem{1.17549435e-38f, "1.1754944e-38", cuda::std::chars_format::scientific, -1},
+      TestItem{1.17549435e-38f, "0.000000000000000000000000000000000000011754944", cuda::std::chars_format::fixed, -1},
+      TestItem{1.17549435e-38f, "1.1754944e-38", cuda::std::chars_format::general, -1},
+      TestItem{1.17549435e-38f, "1p-126", cuda::std::chars_format::hex, -1},
+      TestItem{1.17549435e-38f, "1.175e-38", cuda::std::chars_format::scientific, 3},
+      TestItem{1.17549435e-38f, "0.000", cuda::std::chars_format::fixed, 3},
+      TestItem{1.17549435e-38f, "1.18e-38", cuda::std::chars_format::general, 3},
+      TestItem{1.17549435e-38f, "1.000p-126", cuda::std::chars_format::hex, 3},
+      TestItem{1.17549435e-38f, "0", cuda::std::chars_format::fixed, 0},
+      TestItem{1.17549435e-38f, "1.17549435082228750797e-38", cuda::std::chars_format::scientific, 20},
+      TestItem{3.40282347e38f, "3.4028235e+38"},
+      TestItem{3.40282347e38f, "3.4028235e+38", cuda::std::chars_format::scientific, -1},
+      TestItem{3.40282347e38f, "340282346638528859811704183484516925440", cuda::std::chars_format::fixed, -1},
+      TestItem{3.40282347e38f, "3.4028235e+38", cuda::std::chars_format::general, -1},
+      TestItem{3.40282347e38f, "1.fffffep+127", cuda::std::chars_format::hex, -1},
+      TestItem{3.40282347e38f, "3.403e+38", cuda::std::chars_format::scientific, 3},
+      TestItem{3.40282347e38f, "340282346638528859811704183484516925440.000", cuda::std::chars_format::fixed, 3},
+      TestItem{3.40282347e38f, "3.4e+38", cuda::std::chars_format::general, 3},
+      TestItem{3.40282347e38f, "2.000p+127", cuda::std::chars_format::hex, 3},
+      TestItem{3.40282347e38f, "340282346638528859811704183484516925440", cuda::std::chars_format::fixed, 0},
+      TestItem{3.40282347e38f, "3.40282346638528859812e+38", cuda::std::chars_format::scientific, 20},
+      TestItem{3.14159265f, "3.1415927"},
+      TestItem{3.14159265f, "3.1415927e+00", cuda::std::chars_format::scientific, -1},
+      TestItem{3.14159265f, "3.1415927", cuda::std::chars_format::fixed, -1},
+      TestItem{3.14159265f, "3.1415927", cuda::std::chars_format::general, -1},
+      TestItem{3.14159265f, "1.921fb6p+1", cuda::std::chars_format::hex, -1},
+      TestItem{3.14159265f, "3.142e+00", cuda::std::chars_format::scientific, 3},
+      TestItem{3.14159265f, "3.142", cuda::std::chars_format::fixed, 3},
+      TestItem{3.14159265f, "3.14", cuda::std::chars_format::general, 3},
+      TestItem{3.14159265f, "1.922p+1", cuda::std::chars_format::hex, 3},
+      TestItem{3.14159265f, "3", cuda::std::chars_format::fixed, 0},
+    TestItem{3.14159265f, "3.14159274101257324219e+00", cuda::std::chars_format::scientific, 20},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::array<TestItem, 6> get_special_test_items()
+{
+  return {{
+    TestItem{cuda::std::numeric_limits<float>::infinity(), "inf"},
+    TestItem{-cuda::std::numeric_limits<float>::infinity(), "-inf"},
+    TestItem{cuda::std::numeric_limits<float>::infinity(), "inf", cuda::std::chars_format::fixed, 3},
+    TestItem{-cuda::std::numeric_limits<float>::infinity(), "-inf", cuda::std::chars_format::hex},
+    TestItem{cuda::std::numeric_limits<float>::quiet_NaN(), "nan"},
+    TestItem{cuda::std::numeric_limits<float>::quiet_NaN(), "nan", cuda::std::chars_format::scientific, 2},
+  }};
+}
+
+TEST_FUNC constexpr cuda::std::to_chars_result test_to_chars_impl(char* first, char* last, const TestItem& item)
+{
+  if (item.fmt == cuda::std::chars_format{})
+  {
+    return cuda::std::to_chars(first, last, item.val);
+  }
+  else if (item.precision < 0)
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt);
+  }
+  else
+  {
+    return cuda::std::to_chars(first, last, item.val, item.fmt, item.precision);
+  }
+}
+
+TEST_FUNC constexpr void test_to_chars(const TestItem& item)
+{
+  constexpr cuda::std::size_t buff_size = 400;
+
+  char buff[buff_size + 1]{};
+  char* buff_start = buff + 1;
+
+  const auto ref_len = cuda::std::strlen(item.str);
+
+  // Check valid buffer size
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start + buff_size, item);
+    assert(result.ec == cuda::std::errc{});
+    assert(result.ptr == buff_start + ref_len);
+
+    // Compare with reference string
+    assert(cuda::std::strncmp(buff_start, item.str, ref_len) == 0);
+
+    // Check that the operation did not underflow the buffer
+    assert(buff[0] == '\0');
+  }
+
+  // Check too small buffer
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start + ref_len - 1, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start + ref_len - 1);
+  }
+
+  // Check zero buffer
+  {
+    const auto result = test_to_chars_impl(buff_start, buff_start, item);
+    assert(result.ec == cuda::std::errc::value_too_large);
+    assert(result.ptr == buff_start);
+  }
+}
+
+TEST_FUNC constexpr bool test()
+{
+  static_assert(cuda::std::is_same_v<cuda::std::to_chars_result,
+                                     decltype(cuda::std::to_chars(
+                                       cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}))>);
+  static_assert(noexcept(cuda::std::to_chars(cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format{})));
+  static_assert(noexcept(cuda::std::to_chars(
+    cuda::std::declval<char*>(), cuda::std::declval<char*>(), float{}, cuda::std::chars_format{}, int{})));
+
+  constexpr auto items = get_test_items();
+  for (const auto& item : items)
+  {
+    test_to_chars(item);
+  }
+  constexpr auto special_items = get_special_test_items();
+  for (const auto& item : special_items)
+  {
+    test_to_chars(item);
+  }
+
+  return true;
+}
+
+int main(int, char**)
+{
+  test();
+  static_assert(test());
+  return 0;
+}
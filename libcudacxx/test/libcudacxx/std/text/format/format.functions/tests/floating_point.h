@@ -0,0 +1,179 @@
+//===----------------------------------------------------------------------===//
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+// SPDX-FileCopyrightText: Copyright (c) 2026 NVIDIA CORPORATION & AFFILIATES.
+//
+//===----------------------------------------------------------------------===//
+
+#include <cuda/std/cassert>
+#include <cuda/std/limits>
+#include <cuda/std/string_view>
+
+#include "format_functions_common.h"
+#include "test_macros.h"
+
+// Provided by the selected checker.
+TEST_HOST_DEVICE_FUNC bool check(...);
+TEST_HOST_DEVICE_FUNC bool check_exception(...);
+
+template <class CharT, class F>
+TEST_HOST_DEVICE_FUNC _CCCL_NOINLINE void test_floating_point_default()
+{
+  // *** align-fill & width ***
+  assert(check(SV("answer is '   0.25'"), SV("answer is '{:7}'"), F(0.25)));
+  assert(check(SV("answer is '   0.25'"), SV("answer is '{:>7}'"), F(0.25)));
+  assert(check(SV("answer is '0.25   '"), SV("answer is '{:<7}'"), F(0.25)));
+  assert(check(SV("answer is ' 0.25  '"), SV("answer is '{:^7}'"), F(0.25)));
+  assert(check(SV("answer is ':::0.25'"), SV("answer is '{::>7}'"), F(0.25)));
+  assert(check(SV("answer is '0.25:::'"), SV("answer is '{::<7}'"), F(0.25)));
+  assert(check(SV("answer is ':0.25::'"), SV("answer is '{::^7}'"), F(0.25)));
+
+  // *** Sign ***
+  assert(check(SV("answer is -0.25"), SV("answer is {}"), F(-0.25)));
+  assert(check(SV("answer is 0"), SV("answer is {:-}"), F(0)));
+  assert(check(SV("answer is -0"), SV("answer is {:-}"), F(-0.0)));
+  assert(check(SV("answer is +0.25"), SV("answer is {:+}"), F(0.25)));
+  assert(check(SV("answer is  0.25"), SV("answer is {: }"), F(0.25)));
+  assert(check(SV("answer is -0.25"), SV("answer is {: }"), F(-0.25)));
+
+  // *** alternate form ***
+  assert(check(SV("answer is 0."), SV("answer is {:#}"), F(0)));
+  assert(check(SV("answer is 2.5"), SV("answer is {:#}"), F(2.5)));
+  assert(check(SV("answer is 1.e+10"), SV("answer is {:#}"), F(1e10)));
+
+  // *** zero-padding & width ***
+  assert(check(SV("answer is 0000.25"), SV("answer is {:07}"), F(0.25)));
+  assert(check(SV("answer is -000.25"), SV("answer is {:07}"), F(-0.25)));
+  assert(check(SV("answer is +000.25"), SV("answer is {:+07}"), F(0.25)));
+  assert(check(SV("answer is    0.25"), SV("answer is {:>07}"), F(0.25)));
+
+  // *** shortest representation ***
+  assert(check(SV("answer is 0.1"), SV("answer is {}"), F(0.1)));
+  assert(check(SV("answer is 1e+10"), SV("answer is {}"), F(1e10)));
+  assert(check(SV("answer is 123456"), SV("answer is {}"), F(123456)));
+  assert(check(SV("answer is 1e-05"), SV("answer is {}"), F(1e-5)));
+
+  // *** precision ***
+  assert(check(SV("answer is 0.1"), SV("answer is {:.3}"), F(0.1)));
+  assert(check(SV("answer is 1.23e+05"), SV("answer is {:.3}"), F(123456)));
+  assert(check(SV("answer is 2e+02"), SV("answer is {:.0}"), F(234)));
+  assert(check(SV("answer is 3.14"), SV("answer is {:.{}}"), F(3.14159), 3));
+}
+
+template <class CharT, class F>
+TEST_HOST_DEVICE_FUNC _CCCL_NOINLINE void test_floating_point_types()
+{
+  // *** scientific ***
+  assert(check(SV("answer is 2.500000e-01"), SV("answer is {:e}"), F(0.25)));
+  assert(check(SV("answer is 2.500000E-01"), SV("answer is {:E}"), F(0.25)));
+  assert(check(SV("answer is 2.5e-01"), SV("answer is {:.1e}"), F(0.25)));
+  assert(check(SV("answer is 2e-01"), SV("answer is {:.0e}"), F(0.25)));
+  assert(check(SV("answer is 2.e-01"), SV("answer is {:#.0e}"), F(0.25)));
+  assert(check(SV("answer is -1.234560e+05"), SV("answer is {:e}"), F(-123456)));
+  assert(check(SV("answer is 00002.500e-01"), SV("answer is {:013.3e}"), F(0.25)));
+
+  // *** fixed ***
+  assert(check(SV("answer is 0.250000"), SV("answer is {:f}"), F(0.25)));
+  assert(check(SV("answer is 0.250000"), SV("answer is {:F}"), F(0.25)));
+  assert(check(SV("answer is 0.2"), SV("answer is {:.1f}"), F(0.25)));
+  assert(check(SV("answer is 0"), SV("answer is {:.0f}"), F(0.25)));
+  assert(check(SV("answer is 0."), SV("answer is {:#.0f}"), F(0.25)));
+  assert(check(SV("answer is 123456.000"), SV("answer is {:.3f}"), F(123456)));
+  assert(check(SV("answer is -0000.250"), SV("answer is {:09.3f}"), F(-0.25)));
+
+  // *** general ***
+  assert(check(SV("answer is 0.25"), SV("answer is {:g}"), F(0.25)));
+  assert(check(SV("answer is 1.23456e+06"), SV("answer is {:g}"), F(1234560)));
+  assert(check(SV("answer is 1.23456E+06"), SV("answer is {:G}"), F(1234560)));
+  assert(check(SV("answer is 0.0001"), SV("answer is {:g}"), F(0.0001)));
+  assert(check(SV("answer is 1e-05"), SV("answer is {:g}"), F(1e-5)));
+  assert(check(SV("answer is 0.250000"), SV("answer is {:#g}"), F(0.25)));
+  assert(check(SV("answer is 2.e+02"), SV("answer is {:#.0g}"), F(234)));
+  assert(check(SV("answer is 0.2"), SV("answer is {:.1g}"), F(0.25)));
+
+  // *** hexadecimal ***
+  assert(check(SV("answer is 1p-2"), SV("answer is {:a}"), F(0.25)));
+  assert(check(SV("answer is 1P-2"), SV("answer is {:A}"), F(0.25)));
+  assert(check(SV("answer is 1.8p+1"), SV("answer is {:a}"), F(3)));
+  assert(check(SV("answer is -1.8P+1"), SV("answer is {:A}"), F(-3)));
+  assert(check(SV("answer is 1.800p+1"), SV("answer is {:.3a}"), F(3)));
+  assert(check(SV("answer is 2p+1"), SV("answer is {:.0a}"), F(3)));
+  assert(check(SV("answer is 1.p-2"), SV("answer is {:#a}"), F(0.25)));
+  assert(check(SV("answer is 00001.8p+1"), SV("answer is {:010a}"), F(3)));
+}
+
+template <class CharT, class F>
+TEST_HOST_DEVICE_FUNC _CCCL_NOINLINE void test_floating_point_non_finite()
+{
+  constexpr F inf = cuda::std::numeric_limits<F>::infinity();
+  constexpr F nan = cuda::std::numeric_limits<F>::quiet_NaN();
+
+  assert(check(SV("answer is inf"), SV("answer is {}"), inf));
+  assert(check(SV("answer is -inf"), SV("answer is {}"), -inf));
+  assert(check(SV("answer is +inf"), SV("answer is {:+}"), inf));
+  assert(check(SV("answer is INF"), SV("answer is {:E}"), inf));
+  assert(check(SV("answer is -INF"), SV("answer is {:F}"), -inf));
+  assert(check(SV("answer is inf"), SV("answer is {:#.3f}"), inf));
+  assert(check(SV("answer is nan"), SV("answer is {}"), nan));
+  assert(check(SV("answer is NAN"), SV("answer is {:G}"), nan));
+  assert(check(SV("answer is  nan"), SV("answer is {: a}"), nan));
+
+  // The zero-padding is ignored for non-finite values.
+  assert(check(SV("answer is    inf"), SV("answer is {:06}"), inf));
+  assert(check(SV("answer is    -inf"), SV("answer is {:07}"), -inf));
+  assert(check(SV("answer is inf   "), SV("answer is {:<06}"), inf));
+  assert(check(SV("answer is **nan**"), SV("answer is {:*^7}"), nan));
+}
+
+template <class CharT, class F>
+TEST_HOST_DEVICE_FUNC void test_floating_point()
+{
+  test_floating_point_default<CharT, F>();
+  test_floating_point_types<CharT, F>();
+  test_floating_point_non_finite<CharT, F>();
+}
+
+template <class CharT>
+TEST_HOST_DEVICE_FUNC _CCCL_NOINLINE void test_min_max()
+{
+  // *** check the minima and maxima ***
+  assert(check(SV("1.1754944e-38"), SV("{}"), cuda::std::numeric_limits<float>::min()));
+  assert(check(SV("3.4028235e+38"), SV("{}"), cuda::std::numeric_limits<float>::max()));
+  assert(check(SV("1e-45"), SV("{}"), cuda::std::numeric_limits<float>::denorm_min()));
+  assert(check(SV("340282346638528859811704183484516925440.000000"), SV("{:f}"), cuda::std::numeric_limits<float>::max()));
+
+  assert(check(SV("2.2250738585072014e-308"), SV("{}"), cuda::std::numeric_limits<double>::min()));
+  assert(check(SV("1.7976931348623157e+308"), SV("{}"), cuda::std::numeric_limits<double>::max()));
+  assert(check(SV("5e-324"), SV("{}"), cuda::std::numeric_limits<double>::denorm_min()));
+  assert(check(SV("4.9406564584124654417656879286822137236505980e-324"),
+               SV("{:.43e}"),
+               cuda::std::numeric_limits<double>::denorm_min()));
+  assert(check(SV("1.fffffffffffffp+1023"), SV("{:a}"), cuda::std::numeric_limits<double>::max()));
+  assert(check(SV("0.0000000000000000000000000000000000000000000000000000"), SV("{:.52f}"), 1e-60));
+  assert(check(SV("0.1000000000000000055511151231257827021181583404541015625000"), SV("{:.58f}"), 0.1));
+}
+
+template <class CharT>
+TEST_HOST_DEVICE_FUNC _CCCL_NOINLINE void test()
+{
+  test_floating_point<CharT, float>();
+  test_floating_point<CharT, double>();
+
+  test_min_max<CharT>();
+}
+
+TEST_HOST_DEVICE_FUNC void test()
+{
+  test<char>();
+#if _CCCL_HAS_WCHAR_T()
+  test<wchar_t>();
+#endif // _CCCL_HAS_WCHAR_T()
+}
+
+int main(int, char**)
+{
+  test();
+  return 0;
+}
@@ -162,13 +162,12 @@ TEST_HOST_DEVICE_FUNC void smoke_test()
   assert(check(SV("hello 42"), SV("hello {}"), static_cast<__uint128_t>(42)));
 #endif // _CCCL_HAS_INT128()
 
-  // todo(dabayer): Make formatters for fp types work.
   // *** Test floating point format argument ***
-  //   assert(check(SV("hello 42"), SV("hello {}"), static_cast<float>(42)));
-  //   assert(check(SV("hello 42"), SV("hello {}"), static_cast<double>(42)));
-  // #if _CCCL_HAS_LONG_DOUBLE()
-  //   assert(check(SV("hello 42"), SV("hello {}"), static_cast<long double>(42)));
-  // #endif // _CCCL_HAS_LONG_DOUBLE()
+  assert(check(SV("hello 42"), SV("hello {}"), static_cast<float>(42)));
+  assert(check(SV("hello 42"), SV("hello {}"), static_cast<double>(42)));
+#if _CCCL_HAS_LONG_DOUBLE()
+  assert(check(SV("hello 42"), SV("hello {}"), static_cast<long double>(42)));
+#endif // _CCCL_HAS_LONG_DOUBLE()
 
   // *** Test pointer formatter argument ***
   assert(check(SV("hello 0x0"), SV("hello {}"), nullptr));
@@ -14,6 +14,8 @@
 #include <cuda/std/__memory_>
 #include <cuda/std/array>
 #include <cuda/std/cstddef>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
 
 #if _CCCL_HOSTED()
 #  include <sstream>
@@ -181,6 +183,34 @@ TEST_HOST_DEVICE_FUNC double ks_test_statistic_discrete(
   return d_max;
 }
 
+// Perform a kolmogorov-Smirnov test on the unsorted samples
+template <class D, bool continuous, class CDF>
+TEST_HOST_DEVICE_FUNC bool
+test_ks(typename D::result_type* samples, cuda::std::size_t num_samples, const typename D::param_type param, CDF cdf)
+{
+  // Use sort when available
+  cuda::std::partial_sort(samples, samples + num_samples, samples + num_samples);
+
+  // Compute the KS statistic - specially handle discrete case
+  // Arnold, Taylor B., and John W. Emerson. "Nonparametric goodness-of-fit tests for discrete null distributions."
+  // (2011).
+  double d_max = 0.0;
+  if constexpr (continuous)
+  {
+    d_max = ks_test_statistic_continuous<D>(samples, num_samples, param, cdf);
+  }
+  else
+  {
+    d_max = ks_test_statistic_discrete<D>(samples, num_samples, param, cdf);
+  }
+
+  // Note that this critical value from the KS distribution is only valid for discrete distributions when num_samples is
+  // large
+  const double critical_value = 0.016259280113043572; // for alpha = 0.01 and n = 10000
+  assert(d_max < critical_value);
+  return true;
+}
+
 // Perform a kolmogorov-Smirnov test, comparing the observed and expected cumulative
 // distribution function from a continuous distribution.
 // Generates a fixed size of 10000 samples
@@ -210,28 +240,58 @@ TEST_HOST_DEVICE_FUNC bool test_eval(const typename D::param_type param, CDF cdf
   {
     samples[i] = dist(g, param);
   }
-  // Use sort when available
-  cuda::std::partial_sort(samples.get(), samples.get() + num_samples, samples.get() + num_samples);
+  return test_ks<D, continuous>(samples.get(), num_samples, param, cdf);
+}
 
-  // Compute the KS statistic - specially handle discrete case
-  // Arnold, Taylor B., and John W. Emerson. "Nonparametric goodness-of-fit tests for discrete null distributions."
-  // (2011).
-  double d_max = 0.0;
-  if constexpr (continuous)
+// Distributions that produce many values at once through __generate(first, last, g)
+template <class D, class URNG, class = void>
+inline constexpr bool has_generate = false;
+template <class D, class URNG>
+inline constexpr bool has_generate<
+  D,
+  URNG,
+  cuda::std::void_t<decltype(cuda::std::declval<D&>().__generate(
+    cuda::std::declval<typename D::result_type*>(),
+    cuda::std::declval<typename D::result_type*>(),
+    cuda::std::declval<URNG&>()))>> = true;
+
+// Perform a kolmogorov-Smirnov test on the values of __generate
+template <class D, bool continuous, class URNG, class CDF>
+TEST_HOST_DEVICE_FUNC bool test_generate(const typename D::param_type param, CDF cdf)
+{
+  // First check the overload with param is equivalent to the constructor param
   {
-    d_max = ks_test_statistic_continuous<D>(samples.get(), num_samples, param, cdf);
+    D d1(param);
+    D d2(param);
+    URNG g_1{};
+    URNG g_2{};
+    typename D::result_type values_1[100];
+    typename D::result_type values_2[100];
+    d1.__generate(values_1, values_1 + 100, g_1, param);
+    d2.__generate(values_2, values_2 + 100, g_2);
+    for (cuda::std::size_t i = 0; i < 100; ++i)
+    {
+      assert((values_1[i] == values_2[i]) || (cuda::std::isnan(values_1[i]) && cuda::std::isnan(values_2[i])));
+    }
+    assert(g_1 == g_2);
   }
-  else
+
+  D dist(param);
+  URNG g{};
+  const cuda::std::size_t num_samples = 10000;
+
+  // several calls of different sizes, which do not fill whole blocks
+  auto samples          = cuda::std::make_unique<typename D::result_type[]>(num_samples);
+  cuda::std::size_t pos = 0;
+  for (cuda::std::size_t count : {cuda::std::size_t{0}, cuda::std::size_t{1}, cuda::std::size_t{999}})
   {
-    d_max = ks_test_statistic_discrete<D>(samples.get(), num_samples, param, cdf);
+    dist.__generate(samples.get() + pos, samples.get() + pos + count, g, param);
+    pos += count;
   }
-
-  // Note that this critical value from the KS distribution is only valid for discrete distributions when num_samples is
-  // large
-  const double critical_value = 0.016259280113043572; // for alpha = 0.01 and n = 10000
-  assert(d_max < critical_value);
-  return true;
+  dist.__generate(samples.get() + pos, samples.get() + num_samples, g, param);
+  return test_ks<D, continuous>(samples.get(), num_samples, param, cdf);
 }
+
 template <class D, class URNG>
 TEST_HOST_DEVICE_FUNC constexpr bool test_eval_constexpr()
 {
@@ -250,6 +310,10 @@ TEST_HOST_DEVICE_FUNC void constexpr test_distribution(cuda::std::array<typename
   for (cuda::std::size_t i = 0; i < N; ++i)
   {
     detail::test_eval<D, continuous, URNG, test_constexpr>(params[i], cdf);
+    if constexpr (detail::has_generate<D, URNG>)
+    {
+      detail::test_generate<D, continuous, URNG>(params[i], cdf);
+    }
     detail::test_ctor_assign<D, URNG>(params[i]);
     detail::test_copy<D, URNG>(params[i]);
     detail::test_eq<D, URNG>(params[i]);
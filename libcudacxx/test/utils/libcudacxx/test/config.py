@@ -721,11 +721,41 @@ class Configuration(object):
                 self.config.available_features.add("glibc-%s" % maj_v)
                 self.config.available_features.add("glibc-%s.%s" % (maj_v, min_v))
 
+        # The tests of the host backends of the parallel algorithms only run
+        # when a program using the backend can be built.
+        if self.cxx.type != "nvrtcc" and not self.is_windows:
+            tbb_source = (
+                "#include <tbb/task_arena.h>\n"
+                "int main() { return tbb::this_task_arena::max_concurrency() > 0 ? 0 : 1; }\n"
+            )
+            if self.can_build(tbb_source, ["-ltbb"]):
+                self.config.available_features.add("tbb")
+
+            omp_source = (
+                "#include <omp.h>\n"
+                "int main() { return omp_get_max_threads() > 0 ? 0 : 1; }\n"
+            )
+            omp_flags = ["-fopenmp"]
+            if self.cxx.type == "nvcc":
+                omp_flags = ["-Xcompiler", "-fopenmp"]
+            if self.can_build(omp_source, omp_flags):
+                self.config.available_features.add("openmp")
+
         libcudacxx_gdb = self.get_lit_conf("libcudacxx_gdb")
         if libcudacxx_gdb and "NOTFOUND" not in libcudacxx_gdb:
             self.config.available_features.add("libcudacxx_gdb")
             self.cxx.libcudacxx_gdb = libcudacxx_gdb
 
+    def can_build(self, source, flags):
+        with libcudacxx.util.guardedTempFilename(suffix=".cpp") as source_file:
+            with open(source_file, "w") as f:
+                f.write(source)
+            with libcudacxx.util.guardedTempFilename(suffix=".exe") as exe_file:
+                _, _, _, rc = self.cxx.compileLink(
+                    source_file, out=exe_file, flags=flags
+                )
+                return rc == 0
+
     def configure_compile_flags(self):
         self.configure_default_compile_flags()
         # Configure extra flags
@@ -74,6 +74,9 @@ class LibcxxTestFormat(object):
             IntegratedTestKeywordParser(
                 "ADDITIONAL_COMPILE_OPTIONS_CUDA:", ParserKind.LIST, initial_value=[]
             ),
+            IntegratedTestKeywordParser(
+                "ADDITIONAL_LINK_OPTIONS_HOST:", ParserKind.LIST, initial_value=[]
+            ),
             IntegratedTestKeywordParser("CONSTEXPR_STEPS:", ParserKind.INTEGER),
         ]
 
@@ -191,6 +194,15 @@ class LibcxxTestFormat(object):
                 if test_cxx.addCompileFlagIfSupported(flag.strip()):
                     test_cxx.warning_flags += [flag.strip()]
 
+        extra_link_options_host = self._get_parser(
+            "ADDITIONAL_LINK_OPTIONS_HOST:", parsers
+        ).getValue()
+        for flag in extra_link_options_host:
+            if test_cxx.type == "nvcc":
+                test_cxx.link_flags += ["-Xcompiler", flag.strip()]
+            else:
+                test_cxx.link_flags += [flag.strip()]
+
         extra_modules_defines = self._get_parser("MODULES_DEFINES:", parsers).getValue()
         if "-fmodules" in test.config.available_features:
             test_cxx.compile_flags += [
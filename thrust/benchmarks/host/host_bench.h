@@ -0,0 +1,1103 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+// A drop-in replacement of nvbench and nvbench_helper for timing Thrust on the CPP, OMP and TBB
+// device systems.
+//
+// nvbench needs a GPU, so the host builds of thrust/benchmarks/bench compile the benchmark sources
+// as C++ against this header instead, which nvbench_helper.cuh next to it forwards to. It provides
+// the subset of both interfaces those benchmarks use: type axes, int64/power-of-two/string axes,
+// element counts, memory traffic, state.exec with the launch and timer arguments, input generation
+// and the benchmark policies. Every configuration is measured with wall-clock time for each thread
+// count of a sweep and reported in elements/s and GB/s.
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+
+#include <cuda/std/cmath>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/global_control.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CUDA
+#  error "The host benchmarks only support the CPP, OMP and TBB device systems; use thrust/benchmarks/bench for CUDA."
+#endif
+
+namespace host_bench
+{
+template <typename... Ts>
+struct type_list
+{};
+
+using integral_types = type_list<int8_t, int16_t, int32_t, int64_t>;
+
+using fundamental_types =
+  type_list<int8_t,
+            int16_t,
+            int32_t,
+            int64_t,
+#if _CCCL_HAS_INT128()
+            __int128_t,
+#endif
+            float,
+            double>;
+
+// complex types are left out until the CPU backends are tuned for them
+using all_types = fundamental_types;
+
+template <typename T>
+std::string type_name()
+{
+  if constexpr (::cuda::std::is_floating_point_v<T>)
+  {
+    return "F" + std::to_string(8 * sizeof(T));
+  }
+  else if constexpr (::cuda::std::is_unsigned_v<T>)
+  {
+    return "U" + std::to_string(8 * sizeof(T));
+  }
+  else
+  {
+    return "I" + std::to_string(8 * sizeof(T));
+  }
+}
+
+inline std::vector<int64_t> range(int64_t first, int64_t last, int64_t stride = 1)
+{
+  std::vector<int64_t> result;
+  for (int64_t value = first; value <= last; value += stride)
+  {
+    result.push_back(value);
+  }
+  return result;
+}
+
+template <typename T>
+void do_not_optimize(const T& value)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  static const void* volatile sink;
+  sink = &value;
+#else
+  asm volatile("" : : "g"(&value) : "memory");
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Input generation, mirroring nvbench_helper's generate()
+
+enum class bit_entropy
+{
+  _1_000 = 0,
+  _0_811 = 1,
+  _0_544 = 2,
+  _0_337 = 3,
+  _0_201 = 4,
+  _0_000 = 4200
+};
+
+inline bit_entropy str_to_entropy(const std::string& str)
+{
+  if (str == "1.000")
+  {
+    return bit_entropy::_1_000;
+  }
+  else if (str == "0.811")
+  {
+    return bit_entropy::_0_811;
+  }
+  else if (str == "0.544")
+  {
+    return bit_entropy::_0_544;
+  }
+  else if (str == "0.337")
+  {
+    return bit_entropy::_0_337;
+  }
+  else if (str == "0.201")
+  {
+    return bit_entropy::_0_201;
+  }
+  else if (str == "0.000")
+  {
+    return bit_entropy::_0_000;
+  }
+
+  throw std::runtime_error("Can't convert string to bit entropy");
+}
+
+inline double entropy_to_probability(bit_entropy entropy)
+{
+  switch (entropy)
+  {
+    case bit_entropy::_1_000:
+      return 1.0;
+    case bit_entropy::_0_811:
+      return 0.811;
+    case bit_entropy::_0_544:
+      return 0.544;
+    case bit_entropy::_0_337:
+      return 0.337;
+    case bit_entropy::_0_201:
+      return 0.201;
+    case bit_entropy::_0_000:
+      [[fallthrough]];
+    default:
+      return 0.0;
+  }
+}
+
+namespace detail
+{
+// Every AND of another random word halves the probability of a set bit, lowering the entropy
+// of the keys the same way nvbench_helper does.
+inline std::uint64_t random_bits(std::mt19937_64& rng, bit_entropy entropy)
+{
+  if (entropy == bit_entropy::_0_000)
+  {
+    return 0;
+  }
+
+  std::uint64_t bits = rng();
+  for (int i = 0; i < static_cast<int>(entropy); ++i)
+  {
+    bits &= rng();
+  }
+  return bits;
+}
+
+template <typename T>
+thrust::device_vector<T> generate(std::size_t elements, bit_entropy entropy, T min, T max)
+{
+  std::mt19937_64 rng(elements);
+  std::vector<T> data(elements);
+
+  for (T& value : data)
+  {
+    const std::uint64_t bits = random_bits(rng, entropy);
+
+    if constexpr (::cuda::std::is_floating_point_v<T>)
+    {
+      value = min + (max - min) * static_cast<T>(static_cast<double>(bits >> 11) * 0x1.0p-53);
+    }
+    else if (min == ::cuda::std::numeric_limits<T>::lowest() && max == ::cuda::std::numeric_limits<T>::max())
+    {
+      value = static_cast<T>(bits);
+    }
+    else
+    {
+      const auto span = static_cast<std::uint64_t>(max) - static_cast<std::uint64_t>(min) + 1;
+      value           = static_cast<T>(min + static_cast<T>(span == 0 ? bits : bits % span));
+    }
+  }
+
+  return thrust::device_vector<T>(data.begin(), data.end());
+}
+} // namespace detail
+
+struct vector_generator
+{
+  std::size_t elements;
+  bit_entropy entropy;
+
+  template <typename T>
+  operator thrust::device_vector<T>() const
+  {
+    if constexpr (::cuda::std::is_floating_point_v<T>)
+    {
+      return detail::generate<T>(elements, entropy, T{-1000}, T{1000});
+    }
+    else
+    {
+      return detail::generate<T>(
+        elements, entropy, ::cuda::std::numeric_limits<T>::lowest(), ::cuda::std::numeric_limits<T>::max());
+    }
+  }
+};
+
+struct key_segments_generator
+{
+  std::size_t elements;
+  std::size_t min_segment_size;
+  std::size_t max_segment_size;
+
+  // runs of equal keys with uniformly distributed lengths
+  template <typename T>
+  operator thrust::device_vector<T>() const
+  {
+    std::mt19937_64 rng(elements);
+    std::uniform_int_distribution<std::size_t> segment_size(min_segment_size, max_segment_size);
+    std::vector<T> data(elements);
+
+    std::size_t key = 0;
+    for (std::size_t i = 0; i < elements; ++key)
+    {
+      const std::size_t end = (std::min) (elements, i + segment_size(rng));
+
+      for (; i < end; ++i)
+      {
+        data[i] = static_cast<T>(key);
+      }
+    }
+
+    return thrust::device_vector<T>(data.begin(), data.end());
+  }
+};
+
+struct uniform_generator
+{
+  key_segments_generator
+  key_segments(std::size_t elements, std::size_t min_segment_size, std::size_t max_segment_size) const
+  {
+    return {elements, min_segment_size, max_segment_size};
+  }
+};
+
+struct generator
+{
+  uniform_generator uniform;
+
+  vector_generator operator()(std::size_t elements, bit_entropy entropy = bit_entropy::_1_000) const
+  {
+    return {elements, entropy};
+  }
+
+  template <typename T>
+  thrust::device_vector<T> operator()(std::size_t elements, bit_entropy entropy, T min, T max) const
+  {
+    return detail::generate<T>(elements, entropy, min, max);
+  }
+};
+
+inline constexpr generator generate{};
+
+//------------------------------------------------------------------------------
+// Thread control of the device system
+
+inline const char* device_system_name()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return "omp";
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  return "tbb";
+#else
+  return "cpp";
+#endif
+}
+
+// powers of two up to the number of hardware threads, plus that number itself
+inline std::vector<int> default_thread_counts()
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_CPP
+  return {1};
+#else
+  const int max_threads = (std::max) (1, static_cast<int>(std::thread::hardware_concurrency()));
+
+  std::vector<int> result;
+  for (int threads = 1; threads < max_threads; threads *= 2)
+  {
+    result.push_back(threads);
+  }
+  result.push_back(max_threads);
+  return result;
+#endif
+}
+
+template <typename Function>
+void with_threads([[maybe_unused]] int threads, Function f)
+{
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  const int previous = omp_get_max_threads();
+  omp_set_num_threads(threads);
+  f();
+  omp_set_num_threads(previous);
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+  ::tbb::global_control control(::tbb::global_control::max_allowed_parallelism, threads);
+  f();
+#else
+  f();
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Options, measurement and reporting
+
+struct options
+{
+  std::vector<int> threads = default_thread_counts();
+  double min_time          = 0.5; // seconds of measurements per configuration
+  int max_samples          = 10000;
+  std::string filter;
+  std::string csv_path;
+  std::vector<std::pair<std::string, std::vector<std::string>>> axis_overrides;
+  bool list = false;
+};
+
+// the device benchmarks take the stream to run on from it; the host benchmarks have none
+struct launch
+{};
+
+class timer
+{
+public:
+  void start()
+  {
+    m_start = clock::now();
+  }
+
+  void stop()
+  {
+    m_elapsed = std::chrono::duration<double>(clock::now() - m_start).count();
+  }
+
+  double elapsed() const
+  {
+    return m_elapsed;
+  }
+
+private:
+  using clock = std::chrono::steady_clock;
+
+  clock::time_point m_start{};
+  double m_elapsed = 0.0;
+};
+
+class reporter
+{
+public:
+  static reporter& get()
+  {
+    static reporter instance;
+    return instance;
+  }
+
+  // the executable name tells the configuration of the device system apart
+  void set_program(std::string program)
+  {
+    const std::size_t slash = program.find_last_of("/\\");
+    m_program               = slash == std::string::npos ? program : program.substr(slash + 1);
+  }
+
+  void open_csv(const std::string& path)
+  {
+    m_csv = std::make_unique<std::ofstream>(path);
+    if (!*m_csv)
+    {
+      throw std::runtime_error("Can't open " + path);
+    }
+    *m_csv << "Benchmark,System,Configuration,Threads,Samples,Time (s),Noise,Elem/s,GB/s\n";
+  }
+
+  void header(const std::string& benchmark, const std::vector<std::string>& columns)
+  {
+    std::printf("\n## %s %s (%s)\n\n|", m_program.c_str(), benchmark.c_str(), device_system_name());
+    for (const auto& column : columns)
+    {
+      std::printf(" %s |", column.c_str());
+    }
+    std::printf(" Threads | Samples | Time | Noise | Elem/s | GB/s |\n|");
+    for (std::size_t i = 0; i < columns.size() + 6; ++i)
+    {
+      std::printf("---|");
+    }
+    std::printf("\n");
+    std::fflush(stdout);
+  }
+
+  void row(const std::string& benchmark,
+           const std::vector<std::string>& values,
+           int threads,
+           std::size_t samples,
+           double mean,
+           double noise,
+           double elements_per_second,
+           double bytes_per_second)
+  {
+    std::string configuration;
+    std::printf("|");
+    for (const auto& value : values)
+    {
+      std::printf(" %s |", value.c_str());
+      configuration += (configuration.empty() ? "" : " ") + value;
+    }
+    std::printf(" %d | %zu | %.3f ms | %.2f%% | %.3fG | %.3f |\n",
+                threads,
+                samples,
+                mean * 1e3,
+                noise * 100.0,
+                elements_per_second * 1e-9,
+                bytes_per_second * 1e-9);
+    std::fflush(stdout);
+
+    if (m_csv)
+    {
+      *m_csv << m_program << ' ' << benchmark << ',' << device_system_name() << ',' << configuration << ','
+             << threads << ',' << samples << ',' << mean << ',' << noise << ',' << elements_per_second << ','
+             << bytes_per_second * 1e-9 << '\n';
+    }
+  }
+
+private:
+  std::string m_program;
+  std::unique_ptr<std::ofstream> m_csv;
+};
+
+class state
+{
+public:
+  state(const options& opts,
+        std::string benchmark,
+        std::vector<std::string> values,
+        std::vector<std::pair<std::string, std::string>> axes)
+      : m_options(opts)
+      , m_benchmark(std::move(benchmark))
+      , m_values(std::move(values))
+      , m_axes(std::move(axes))
+  {}
+
+  int64_t get_int64(const std::string& name) const
+  {
+    return std::stoll(get_string(name));
+  }
+
+  double get_float64(const std::string& name) const
+  {
+    return std::stod(get_string(name));
+  }
+
+  const std::string& get_string(const std::string& name) const
+  {
+    for (const auto& axis : m_axes)
+    {
+      if (axis.first == name)
+      {
+        return axis.second;
+      }
+    }
+    throw std::runtime_error("Benchmark " + m_benchmark + " has no axis " + name);
+  }
+
+  void add_element_count(std::size_t elements)
+  {
+    m_elements += elements;
+  }
+
+  template <typename T>
+  void add_global_memory_reads(std::size_t count)
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  template <typename T>
+  void add_global_memory_writes(std::size_t count)
+  {
+    m_bytes += count * sizeof(T);
+  }
+
+  // Measures f for every thread count of the sweep. f either takes a launch& and is timed as a
+  // whole, or additionally takes a timer& and times the region between timer.start() and
+  // timer.stop(). The execution tags only matter to nvbench and are ignored.
+  template <typename ExecTags, typename Function>
+  void exec(ExecTags, Function f)
+  {
+    for (int threads : m_options.threads)
+    {
+      std::vector<double> samples;
+
+      with_threads(threads, [&] {
+        run_once(f); // warm-up
+
+        double total = 0.0;
+        while (samples.empty()
+               || (total < m_options.min_time && static_cast<int>(samples.size()) < m_options.max_samples))
+        {
+          samples.push_back(run_once(f));
+          total += samples.back();
+        }
+      });
+
+      double mean = 0.0;
+      for (double sample : samples)
+      {
+        mean += sample;
+      }
+      mean /= static_cast<double>(samples.size());
+
+      double variance = 0.0;
+      for (double sample : samples)
+      {
+        variance += (sample - mean) * (sample - mean);
+      }
+      const double noise =
+        samples.size() > 1 ? std::sqrt(variance / static_cast<double>(samples.size() - 1)) / mean : 0.0;
+
+      reporter::get().row(
+        m_benchmark,
+        m_values,
+        threads,
+        samples.size(),
+        mean,
+        noise,
+        static_cast<double>(m_elements) / mean,
+        static_cast<double>(m_bytes) / mean);
+    }
+  }
+
+private:
+  template <typename Function>
+  static double run_once(Function& f)
+  {
+    launch l;
+    timer t;
+
+    if constexpr (std::is_invocable_v<Function&, launch&, timer&>)
+    {
+      f(l, t);
+    }
+    else
+    {
+      t.start();
+      f(l);
+      t.stop();
+    }
+
+    return t.elapsed();
+  }
+
+  const options& m_options;
+  std::string m_benchmark;
+  std::vector<std::string> m_values;
+  std::vector<std::pair<std::string, std::string>> m_axes;
+  std::size_t m_elements = 0;
+  std::size_t m_bytes    = 0;
+};
+
+//------------------------------------------------------------------------------
+// Registration
+
+class benchmark_base
+{
+public:
+  explicit benchmark_base(std::string name)
+      : m_name(std::move(name))
+  {}
+
+  virtual ~benchmark_base() = default;
+
+  benchmark_base& set_name(std::string name)
+  {
+    m_name = std::move(name);
+    return *this;
+  }
+
+  // accepts nvbench's "{ct}" suffix for compatibility with the device benchmarks
+  benchmark_base& set_type_axes_names(std::vector<std::string> names)
+  {
+    for (auto& name : names)
+    {
+      const auto suffix = name.find('{');
+      if (suffix != std::string::npos)
+      {
+        name.erase(suffix);
+      }
+    }
+    m_type_axes_names = std::move(names);
+    return *this;
+  }
+
+  benchmark_base& add_int64_axis(std::string name, const std::vector<int64_t>& values)
+  {
+    std::vector<std::string> strings;
+    for (int64_t value : values)
+    {
+      strings.push_back(std::to_string(value));
+    }
+    m_axes.push_back({std::move(name), std::move(strings), false});
+    return *this;
+  }
+
+  benchmark_base& add_float64_axis(std::string name, const std::vector<double>& values)
+  {
+    std::vector<std::string> strings;
+    for (double value : values)
+    {
+      char buffer[32];
+      std::snprintf(buffer, sizeof(buffer), "%g", value);
+      strings.push_back(buffer);
+    }
+    m_axes.push_back({std::move(name), std::move(strings), false});
+    return *this;
+  }
+
+  // values are the exponents, like nvbench
+  benchmark_base& add_int64_power_of_two_axis(std::string name, const std::vector<int64_t>& exponents)
+  {
+    std::vector<std::string> strings;
+    for (int64_t exponent : exponents)
+    {
+      strings.push_back(std::to_string(exponent));
+    }
+    m_axes.push_back({std::move(name), std::move(strings), true});
+    return *this;
+  }
+
+  benchmark_base& add_string_axis(std::string name, std::vector<std::string> values)
+  {
+    m_axes.push_back({std::move(name), std::move(values), false});
+    return *this;
+  }
+
+  const std::string& name() const
+  {
+    return m_name;
+  }
+
+  void run(const options& opts)
+  {
+    apply_overrides(opts);
+
+    std::vector<std::string> columns = m_type_axes_names;
+    for (const auto& axis : m_axes)
+    {
+      columns.push_back(axis.name);
+    }
+    reporter::get().header(m_name, columns);
+
+    run_types(opts);
+  }
+
+  void list() const
+  {
+    std::printf("%s\n", m_name.c_str());
+    for (const auto& axis : m_axes)
+    {
+      std::printf("  %s%s:", axis.name.c_str(), axis.power_of_two ? "[pow2]" : "");
+      for (const auto& value : axis.values)
+      {
+        std::printf(" %s", value.c_str());
+      }
+      std::printf("\n");
+    }
+  }
+
+protected:
+  struct axis
+  {
+    std::string name;
+    std::vector<std::string> values;
+    bool power_of_two;
+  };
+
+  virtual void run_types(const options& opts) = 0;
+
+  // runs fn(state) for every combination of the value axes
+  template <typename Function>
+  void for_each_configuration(const options& opts, std::vector<std::string> type_names, Function fn) const
+  {
+    std::vector<std::size_t> index(m_axes.size(), 0);
+
+    while (true)
+    {
+      std::vector<std::string> values = type_names;
+      std::vector<std::pair<std::string, std::string>> named_values;
+
+      for (std::size_t i = 0; i < m_axes.size(); ++i)
+      {
+        const auto& value = m_axes[i].values[index[i]];
+
+        if (m_axes[i].power_of_two)
+        {
+          values.push_back("2^" + value);
+          named_values.emplace_back(m_axes[i].name, std::to_string(int64_t{1} << std::stoll(value)));
+        }
+        else
+        {
+          values.push_back(value);
+          named_values.emplace_back(m_axes[i].name, value);
+        }
+      }
+
+      state s(opts, m_name, std::move(values), std::move(named_values));
+      fn(s);
+
+      // advance the last axis fastest
+      std::size_t i = m_axes.size();
+      while (i > 0 && ++index[i - 1] == m_axes[i - 1].values.size())
+      {
+        index[--i] = 0;
+      }
+      if (i == 0)
+      {
+        return;
+      }
+    }
+  }
+
+private:
+  void apply_overrides(const options& opts)
+  {
+    for (const auto& axis_override : opts.axis_overrides)
+    {
+      for (auto& axis : m_axes)
+      {
+        if (axis.name == axis_override.first)
+        {
+          axis.values = axis_override.second;
+        }
+      }
+    }
+  }
+
+  std::string m_name;
+  std::vector<std::string> m_type_axes_names;
+  std::vector<axis> m_axes;
+};
+
+namespace detail
+{
+template <typename Function, typename... Done>
+void for_each_type_combination(Function& f, type_list<Done...>)
+{
+  f(type_list<Done...>{});
+}
+
+template <typename Function, typename... Done, typename... Ts, typename... Rest>
+void for_each_type_combination(Function& f, type_list<Done...>, type_list<Ts...>, Rest... rest)
+{
+  (for_each_type_combination(f, type_list<Done..., Ts>{}, rest...), ...);
+}
+} // namespace detail
+
+template <typename Runner, typename TypeAxes>
+class benchmark;
+
+template <typename Runner, typename... TypeAxes>
+class benchmark<Runner, type_list<TypeAxes...>> : public benchmark_base
+{
+public:
+  explicit benchmark(std::string name, Runner runner)
+      : benchmark_base(std::move(name))
+      , m_runner(runner)
+  {}
+
+protected:
+  void run_types(const options& opts) override
+  {
+    auto run_combination = [&](auto types) {
+      this->for_each_configuration(opts, type_names(types), [&](state& s) {
+        m_runner(s, types);
+      });
+    };
+
+    detail::for_each_type_combination(run_combination, type_list<>{}, TypeAxes{}...);
+  }
+
+private:
+  template <typename... Ts>
+  static std::vector<std::string> type_names(type_list<Ts...>)
+  {
+    return {type_name<Ts>()...};
+  }
+
+  Runner m_runner;
+};
+
+inline std::vector<std::unique_ptr<benchmark_base>>& registry()
+{
+  static std::vector<std::unique_ptr<benchmark_base>> benchmarks;
+  return benchmarks;
+}
+
+// TypeAxes is a type_list of the type_lists of every type axis
+template <typename TypeAxes, typename Runner>
+benchmark_base& add_benchmark(std::string name, Runner runner)
+{
+  registry().push_back(std::make_unique<benchmark<Runner, TypeAxes>>(std::move(name), runner));
+  return *registry().back();
+}
+
+inline void print_help(const char* program)
+{
+  std::printf(
+    "Usage: %s [options]\n"
+    "  --list                       list the benchmarks and their axes\n"
+    "  --benchmark <name>           only run the benchmarks with this name\n"
+    "  --threads <n,...>            thread counts to sweep (default: powers of two up to the hardware threads)\n"
+    "  --axis <name>=<value,...>    override the values of an axis; power-of-two axes take exponents\n"
+    "  --min-time <seconds>         measurement time per configuration and thread count (default: 0.5)\n"
+    "  --max-samples <n>            maximum number of samples per configuration (default: 10000)\n"
+    "  --csv <path>                 also write the results to a CSV file\n",
+    program);
+}
+
+inline std::vector<std::string> split(const std::string& str, char separator)
+{
+  std::vector<std::string> result;
+  std::size_t begin = 0;
+  while (true)
+  {
+    const std::size_t end = str.find(separator, begin);
+    result.push_back(str.substr(begin, end - begin));
+    if (end == std::string::npos)
+    {
+      return result;
+    }
+    begin = end + 1;
+  }
+}
+
+inline int run(int argc, char** argv)
+{
+  options opts;
+
+  reporter::get().set_program(argv[0]);
+
+  try
+  {
+    for (int i = 1; i < argc; ++i)
+    {
+      const std::string arg = argv[i];
+
+      auto next = [&]() -> std::string {
+        if (i + 1 >= argc)
+        {
+          throw std::runtime_error("Missing value for " + arg);
+        }
+        return argv[++i];
+      };
+
+      if (arg == "--help" || arg == "-h")
+      {
+        print_help(argv[0]);
+        return 0;
+      }
+      else if (arg == "--list")
+      {
+        opts.list = true;
+      }
+      else if (arg == "--benchmark" || arg == "-b")
+      {
+        opts.filter = next();
+      }
+      else if (arg == "--threads" || arg == "-t")
+      {
+        opts.threads.clear();
+        for (const auto& value : split(next(), ','))
+        {
+          opts.threads.push_back(std::stoi(value));
+        }
+      }
+      else if (arg == "--axis" || arg == "-a")
+      {
+        const std::string value = next();
+        const std::size_t eq    = value.find('=');
+        if (eq == std::string::npos)
+        {
+          throw std::runtime_error("Expected <name>=<value,...> after --axis");
+        }
+        opts.axis_overrides.emplace_back(value.substr(0, eq), split(value.substr(eq + 1), ','));
+      }
+      else if (arg == "--min-time")
+      {
+        opts.min_time = std::stod(next());
+      }
+      else if (arg == "--max-samples")
+      {
+        opts.max_samples = std::stoi(next());
+      }
+      else if (arg == "--csv")
+      {
+        opts.csv_path = next();
+      }
+      else
+      {
+        throw std::runtime_error("Unknown option " + arg);
+      }
+    }
+
+    if (!opts.csv_path.empty())
+    {
+      reporter::get().open_csv(opts.csv_path);
+    }
+
+    for (auto& bench : registry())
+    {
+      if (!opts.filter.empty() && bench->name() != opts.filter)
+      {
+        continue;
+      }
+
+      if (opts.list)
+      {
+        bench->list();
+      }
+      else
+      {
+        bench->run(opts);
+      }
+    }
+  }
+  catch (const std::exception& e)
+  {
+    std::fprintf(stderr, "%s\n", e.what());
+    return 1;
+  }
+
+  return 0;
+}
+} // namespace host_bench
+
+//------------------------------------------------------------------------------
+// The interface of nvbench and nvbench_helper used by thrust/benchmarks/bench
+
+// the benchmarks annotate their function objects for CUDA, which a host compiler doesn't know
+#ifndef __host__
+#  define __host__
+#endif
+#ifndef __device__
+#  define __device__
+#endif
+
+namespace nvbench
+{
+template <typename... Ts>
+using type_list = ::host_bench::type_list<Ts...>;
+
+using ::host_bench::launch;
+using ::host_bench::range;
+using ::host_bench::state;
+
+using ::std::int16_t;
+using ::std::int32_t;
+using ::std::int64_t;
+using ::std::int8_t;
+using ::std::uint16_t;
+using ::std::uint32_t;
+using ::std::uint64_t;
+using ::std::uint8_t;
+using float32_t = float;
+using float64_t = double;
+
+namespace exec_tag
+{
+struct tags
+{
+  friend constexpr tags operator|(tags, tags) noexcept
+  {
+    return {};
+  }
+};
+
+inline constexpr tags gpu{};
+inline constexpr tags no_batch{};
+inline constexpr tags sync{};
+inline constexpr tags timer{};
+} // namespace exec_tag
+} // namespace nvbench
+
+#if _CCCL_HAS_INT128()
+using int128_t  = __int128_t;
+using uint128_t = __uint128_t;
+#endif
+
+using ::host_bench::all_types;
+using ::host_bench::bit_entropy;
+using ::host_bench::do_not_optimize;
+using ::host_bench::entropy_to_probability;
+using ::host_bench::fundamental_types;
+using ::host_bench::generate;
+using ::host_bench::integral_types;
+using ::host_bench::str_to_entropy;
+
+template <typename T>
+[[nodiscard]] T lerp_min_max(double at) noexcept
+{
+  if (at == 1.0)
+  {
+    return ::cuda::std::numeric_limits<T>::max();
+  }
+  const auto min_val = static_cast<double>(::cuda::std::numeric_limits<T>::lowest());
+  const auto max_val = static_cast<double>(::cuda::std::numeric_limits<T>::max());
+  return static_cast<T>(::cuda::std::lerp(min_val, max_val, at));
+}
+
+struct less_t
+{
+  template <typename DataType>
+  __host__ __device__ bool operator()(const DataType& lhs, const DataType& rhs) const
+  {
+    return lhs < rhs;
+  }
+};
+
+struct max_t
+{
+  template <typename DataType>
+  __host__ __device__ DataType operator()(const DataType& lhs, const DataType& rhs) const
+  {
+    less_t less{};
+    return less(lhs, rhs) ? rhs : lhs;
+  }
+};
+
+template <typename T>
+struct less_then_t
+{
+  T m_val;
+
+  [[nodiscard]] __device__ bool operator()(const T& val) const noexcept
+  {
+    return val < m_val;
+  }
+};
+
+// all memory comes from the device system, so there's nothing to cache
+struct caching_allocator_t
+{};
+
+inline auto policy(caching_allocator_t&)
+{
+  return thrust::device;
+}
+
+inline auto policy(caching_allocator_t&, nvbench::launch&)
+{
+  return thrust::device;
+}
+
+#define HOST_BENCH_CONCAT_IMPL(a, b) a##b
+#define HOST_BENCH_CONCAT(a, b)      HOST_BENCH_CONCAT_IMPL(a, b)
+
+#define NVBENCH_TYPE_AXES(...) ::host_bench::type_list<__VA_ARGS__>
+
+// Registers the benchmark template fn for every combination of the types of the type axes.
+#define NVBENCH_BENCH_TYPES(fn, type_axes)                                                              \
+  static ::host_bench::benchmark_base& HOST_BENCH_CONCAT(fn##_host_bench_, __LINE__) =                  \
+    ::host_bench::add_benchmark<type_axes>(#fn, [](::host_bench::state& state, auto types) {            \
+      fn(state, types);                                                                                 \
+    })
@@ -0,0 +1,9 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+#include "host_bench.h"
+
+int main(int argc, char** argv)
+{
+  return host_bench::run(argc, argv);
+}
@@ -0,0 +1,8 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: BSD-3
+
+// Stands in for nvbench_helper when thrust/benchmarks/bench is compiled for a host device system.
+
+#pragma once
+
+#include "host_bench.h"
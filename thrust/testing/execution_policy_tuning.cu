@@ -0,0 +1,300 @@
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/merge.h>
+#include <thrust/reduce.h>
+#include <thrust/scan.h>
+#include <thrust/sequence.h>
+#include <thrust/set_operations.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <atomic>
+#include <list>
+#include <thread>
+
+#include <unittest/unittest.h>
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+#  include <omp.h>
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+#  include <tbb/task_arena.h>
+#endif // THRUST_DEVICE_SYSTEM
+
+// only the OpenMP and TBB policies can be tuned
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+template <typename T>
+struct is_even
+{
+  _CCCL_HOST_DEVICE bool operator()(T x) const
+  {
+    return x % 2 == 0;
+  }
+};
+
+template <typename T>
+struct low_bits
+{
+  int shift;
+
+  _CCCL_HOST_DEVICE T operator()(T x) const
+  {
+    return (x & 0xffff) >> shift;
+  }
+};
+
+template <typename Policy>
+void TestTunedAlgorithms(Policy policy, size_t n)
+{
+  using T = int;
+
+  // small values, so that the sums do not overflow
+  thrust::host_vector<T> h_data = unittest::random_integers<T>(n);
+  thrust::transform(h_data.begin(), h_data.end(), h_data.begin(), low_bits<T>{0});
+  thrust::device_vector<T> d_data = h_data;
+
+  thrust::host_vector<T> h_result(n);
+  thrust::device_vector<T> d_result(n);
+
+  ASSERT_EQUAL(thrust::reduce(h_data.begin(), h_data.end()), thrust::reduce(policy, d_data.begin(), d_data.end()));
+
+  thrust::inclusive_scan(h_data.begin(), h_data.end(), h_result.begin());
+  thrust::inclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::exclusive_scan(h_data.begin(), h_data.end(), h_result.begin(), T{13});
+  thrust::exclusive_scan(policy, d_data.begin(), d_data.end(), d_result.begin(), T{13});
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::transform(h_data.begin(), h_data.end(), h_result.begin(), ::cuda::std::negate<T>());
+  thrust::transform(policy, d_data.begin(), d_data.end(), d_result.begin(), ::cuda::std::negate<T>());
+  ASSERT_EQUAL(h_result, d_result);
+
+  const auto h_copied =
+    thrust::copy_if(h_data.begin(), h_data.end(), h_result.begin(), is_even<T>()) - h_result.begin();
+  const auto d_copied =
+    thrust::copy_if(policy, d_data.begin(), d_data.end(), d_result.begin(), is_even<T>()) - d_result.begin();
+  ASSERT_EQUAL(h_copied, d_copied);
+  h_result.resize(h_copied);
+  d_result.resize(d_copied);
+  ASSERT_EQUAL(h_result, d_result);
+
+  thrust::host_vector<T> h_sorted   = h_data;
+  thrust::device_vector<T> d_sorted = d_data;
+  thrust::sort(h_sorted.begin(), h_sorted.end());
+  thrust::sort(policy, d_sorted.begin(), d_sorted.end());
+  ASSERT_EQUAL(h_sorted, d_sorted);
+
+  thrust::host_vector<T> h_keys   = h_data;
+  thrust::device_vector<T> d_keys = d_data;
+  thrust::host_vector<T> h_values(n);
+  thrust::device_vector<T> d_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::sequence(d_values.begin(), d_values.end());
+  thrust::stable_sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), ::cuda::std::greater<T>());
+  thrust::stable_sort_by_key(policy, d_keys.begin(), d_keys.end(), d_values.begin(), ::cuda::std::greater<T>());
+  ASSERT_EQUAL(h_keys, d_keys);
+  ASSERT_EQUAL(h_values, d_values);
+
+  h_result.resize(2 * n);
+  d_result.resize(2 * n);
+  thrust::merge(policy, d_sorted.begin(), d_sorted.end(), d_sorted.begin(), d_sorted.end(), d_result.begin());
+  thrust::merge(h_sorted.begin(), h_sorted.end(), h_sorted.begin(), h_sorted.end(), h_result.begin());
+  ASSERT_EQUAL(h_result, d_result);
+
+  const auto h_united =
+    thrust::set_union(h_sorted.begin(), h_sorted.end(), h_sorted.begin(), h_sorted.end(), h_result.begin())
+    - h_result.begin();
+  const auto d_united =
+    thrust::set_union(policy, d_sorted.begin(), d_sorted.end(), d_sorted.begin(), d_sorted.end(), d_result.begin())
+    - d_result.begin();
+  ASSERT_EQUAL(h_united, d_united);
+  ASSERT_EQUAL(h_result, d_result);
+
+  // few distinct keys, so that the runs of equal keys span many elements
+  thrust::transform(h_sorted.begin(), h_sorted.end(), h_keys.begin(), low_bits<T>{10});
+  d_keys = h_keys;
+  thrust::host_vector<T> h_reduced(n);
+  thrust::device_vector<T> d_reduced(n);
+  const auto h_end =
+    thrust::reduce_by_key(h_keys.begin(), h_keys.end(), h_data.begin(), h_result.begin(), h_reduced.begin());
+  const auto d_end =
+    thrust::reduce_by_key(policy, d_keys.begin(), d_keys.end(), d_data.begin(), d_result.begin(), d_reduced.begin());
+  ASSERT_EQUAL(h_end.first - h_result.begin(), d_end.first - d_result.begin());
+  ASSERT_EQUAL(h_reduced, d_reduced);
+
+  const auto h_unique = thrust::unique(h_keys.begin(), h_keys.end()) - h_keys.begin();
+  const auto d_unique = thrust::unique(policy, d_keys.begin(), d_keys.end()) - d_keys.begin();
+  ASSERT_EQUAL(h_unique, d_unique);
+  h_keys.resize(h_unique);
+  d_keys.resize(d_unique);
+  ASSERT_EQUAL(h_keys, d_keys);
+}
+
+template <typename Policy>
+void TestTunedAlgorithms(Policy policy)
+{
+  for (size_t n : {size_t{0}, size_t{1}, size_t{1000}, size_t{100000}, size_t{300000}})
+  {
+    TestTunedAlgorithms(policy, n);
+  }
+}
+
+// the number of threads that may run the current parallel region of the backend
+inline int current_concurrency()
+{
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+  return omp_get_num_threads();
+#  else
+  return ::tbb::this_task_arena::max_concurrency();
+#  endif // THRUST_DEVICE_SYSTEM
+}
+
+struct threads_used
+{
+  int concurrency     = 0;
+  bool off_the_caller = false;
+};
+
+// records the largest concurrency any element is processed with, and whether any is processed on another thread
+struct record_threads
+{
+  std::atomic<int>* concurrency;
+  std::atomic<bool>* off_the_caller;
+  std::thread::id caller;
+
+  void operator()(int) const
+  {
+    const int current = current_concurrency();
+    int recorded      = concurrency->load();
+    while (recorded < current && !concurrency->compare_exchange_weak(recorded, current))
+    {
+    }
+
+    if (std::this_thread::get_id() != caller)
+    {
+      off_the_caller->store(true);
+    }
+  }
+};
+
+template <typename Policy>
+threads_used threads_used_by_for_each(Policy policy, size_t n)
+{
+  thrust::device_vector<int> data(n);
+  std::atomic<int> concurrency{0};
+  std::atomic<bool> off_the_caller{false};
+
+  thrust::for_each(
+    policy, data.begin(), data.end(), record_threads{&concurrency, &off_the_caller, std::this_thread::get_id()});
+
+  return {concurrency.load(), off_the_caller.load()};
+}
+
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+
+void TestOmpTuning()
+{
+  using thrust::omp::schedule_kind;
+
+  TestTunedAlgorithms(thrust::omp::par.num_threads(1));
+  TestTunedAlgorithms(thrust::omp::par.num_threads(3));
+  TestTunedAlgorithms(thrust::omp::par.sequential_cutoff(200000));
+  TestTunedAlgorithms(thrust::omp::par.grain_size(5000).num_threads(4));
+  TestTunedAlgorithms(thrust::omp::par.schedule(schedule_kind::dynamic).grain_size(64));
+  TestTunedAlgorithms(thrust::omp::par.schedule(schedule_kind::guided));
+
+  thrust::omp::tuning tuning;
+  tuning.num_threads = 2;
+  tuning.schedule    = schedule_kind::dynamic;
+  TestTunedAlgorithms(thrust::omp::par.with(tuning));
+  TestTunedAlgorithms(thrust::omp::par(std::allocator<char>()).with(tuning));
+}
+DECLARE_UNITTEST(TestOmpTuning);
+
+void TestOmpTuningIsApplied()
+{
+  const size_t n = 100000;
+
+  for (int num_threads : {1, 2, 3})
+  {
+    ASSERT_LEQUAL(threads_used_by_for_each(thrust::omp::par.num_threads(num_threads), n).concurrency, num_threads);
+  }
+
+  // below the cutoff, all work runs on the calling thread
+  const threads_used sequential = threads_used_by_for_each(thrust::omp::par.sequential_cutoff(n + 1), n);
+  ASSERT_EQUAL(sequential.concurrency, 1);
+  ASSERT_EQUAL(sequential.off_the_caller, false);
+}
+DECLARE_UNITTEST(TestOmpTuningIsApplied);
+
+#elif THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+void TestTbbTuning()
+{
+  using thrust::tbb::partitioner_kind;
+
+  TestTunedAlgorithms(thrust::tbb::par.num_threads(1));
+  TestTunedAlgorithms(thrust::tbb::par.num_threads(3));
+  TestTunedAlgorithms(thrust::tbb::par.sequential_cutoff(200000));
+  TestTunedAlgorithms(thrust::tbb::par.grain_size(5000).num_threads(4));
+  TestTunedAlgorithms(thrust::tbb::par.partitioner(partitioner_kind::simple).grain_size(64));
+  TestTunedAlgorithms(thrust::tbb::par.partitioner(partitioner_kind::static_));
+
+  thrust::tbb::tuning tuning;
+  tuning.num_threads = 2;
+  tuning.partitioner = partitioner_kind::simple;
+  TestTunedAlgorithms(thrust::tbb::par.with(tuning));
+  TestTunedAlgorithms(thrust::tbb::par(std::allocator<char>()).with(tuning));
+}
+DECLARE_UNITTEST(TestTbbTuning);
+
+void TestTbbTuningIsApplied()
+{
+  const size_t n = 100000;
+
+  // the task arena of the algorithm has exactly the requested concurrency
+  for (int num_threads : {1, 2, 3})
+  {
+    ASSERT_EQUAL(threads_used_by_for_each(thrust::tbb::par.num_threads(num_threads), n).concurrency, num_threads);
+  }
+
+  // below the cutoff, all work runs on the calling thread
+  ASSERT_EQUAL(threads_used_by_for_each(thrust::tbb::par.sequential_cutoff(n + 1), n).off_the_caller, false);
+}
+DECLARE_UNITTEST(TestTbbTuningIsApplied);
+
+// iterators that are not random access are scanned and copied sequentially
+void TestTbbParListIterators()
+{
+  using T = int;
+
+  const std::list<T> input{3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+  std::list<T> output(input.size());
+
+  auto end = thrust::inclusive_scan(thrust::tbb::par, input.begin(), input.end(), output.begin());
+  ASSERT_EQUAL(true, end == output.end());
+  ASSERT_EQUAL(true, (output == std::list<T>{3, 4, 8, 9, 14, 23, 25, 31, 36, 39}));
+
+  end = thrust::inclusive_scan(
+    thrust::tbb::par, input.begin(), input.end(), output.begin(), T{10}, ::cuda::std::plus<T>());
+  ASSERT_EQUAL(true, end == output.end());
+  ASSERT_EQUAL(true, (output == std::list<T>{13, 14, 18, 19, 24, 33, 35, 41, 46, 49}));
+
+  end = thrust::exclusive_scan(thrust::tbb::par.grain_size(2), input.begin(), input.end(), output.begin(), T{1});
+  ASSERT_EQUAL(true, end == output.end());
+  ASSERT_EQUAL(true, (output == std::list<T>{1, 4, 5, 9, 10, 15, 24, 26, 32, 37}));
+
+  std::list<T> evens(input.size());
+  end = thrust::copy_if(thrust::tbb::par, input.begin(), input.end(), evens.begin(), is_even<T>());
+  evens.erase(end, evens.end());
+  ASSERT_EQUAL(true, (evens == std::list<T>{4, 2, 6}));
+}
+DECLARE_UNITTEST(TestTbbParListIterators);
+
+#endif // THRUST_DEVICE_SYSTEM
@@ -0,0 +1,187 @@
+#include <thrust/execution_policy.h>
+#include <thrust/generate_random.h>
+#include <thrust/random.h>
+
+#include <cuda/random>
+#include <cuda/std/random>
+
+#include <unittest/unittest.h>
+
+template <typename Engine, typename Distribution>
+void TestGenerateRandomIsDeterministic(size_t n)
+{
+  using T = typename Distribution::result_type;
+
+  const Engine engine(13);
+  const Distribution distribution = Distribution();
+
+  Engine host_engine = engine;
+  thrust::host_vector<T> h_result(n);
+  thrust::generate_random(thrust::seq, h_result.begin(), h_result.end(), host_engine, distribution);
+
+  // the values do not depend on the execution policy
+  Engine device_engine = engine;
+  thrust::device_vector<T> d_result(n);
+  thrust::generate_random(d_result.begin(), d_result.end(), device_engine, distribution);
+  ASSERT_EQUAL(h_result, d_result);
+  ASSERT_EQUAL(host_engine == device_engine, true);
+
+  // the first block is drawn from the engine as is
+  Engine sequential_engine  = engine;
+  Distribution sequential   = distribution;
+  const size_t sequential_n = n < 1000 ? n : 1000;
+  for (size_t i = 0; i < sequential_n; ++i)
+  {
+    ASSERT_EQUAL(h_result[i], sequential(sequential_engine));
+  }
+
+  // the engine advances past the values, so the next call produces new ones
+  if (n > 0)
+  {
+    ASSERT_EQUAL(host_engine == engine, false);
+
+    thrust::host_vector<T> h_next(n);
+    thrust::generate_random(thrust::seq, h_next.begin(), h_next.end(), host_engine, distribution);
+    ASSERT_EQUAL(h_next == h_result, false);
+  }
+}
+
+template <typename Engine, typename Distribution>
+void TestGenerateRandomIsDeterministic()
+{
+  for (size_t n : {size_t{0}, size_t{1}, size_t{1000}, size_t{4096}, size_t{4097}, size_t{100000}})
+  {
+    TestGenerateRandomIsDeterministic<Engine, Distribution>(n);
+  }
+}
+
+void TestGenerateRandomDeterminism()
+{
+  TestGenerateRandomIsDeterministic<cuda::std::philox4x32, thrust::uniform_real_distribution<float>>();
+  TestGenerateRandomIsDeterministic<cuda::std::philox4x64, thrust::normal_distribution<double>>();
+  TestGenerateRandomIsDeterministic<cuda::pcg64, thrust::uniform_int_distribution<int>>();
+  TestGenerateRandomIsDeterministic<cuda::pcg64, thrust::normal_distribution<float>>();
+  TestGenerateRandomIsDeterministic<thrust::minstd_rand, thrust::uniform_real_distribution<double>>();
+  TestGenerateRandomIsDeterministic<thrust::minstd_rand0, thrust::uniform_int_distribution<unsigned int>>();
+}
+DECLARE_UNITTEST(TestGenerateRandomDeterminism);
+
+void TestGenerateRandomSequentialEngine()
+{
+  // engines without fast discard generate the values in order
+  const size_t n = 10000;
+
+  thrust::ranlux24 engine(7);
+  thrust::uniform_int_distribution<int> distribution(-100, 100);
+
+  thrust::host_vector<int> h_expected(n);
+  thrust::ranlux24 expected_engine = engine;
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_expected[i] = distribution(expected_engine);
+  }
+
+  thrust::device_vector<int> d_result(n);
+  thrust::generate_random(thrust::device, d_result.begin(), d_result.end(), engine, distribution);
+  ASSERT_EQUAL(h_expected, d_result);
+  ASSERT_EQUAL(engine, expected_engine);
+}
+DECLARE_UNITTEST(TestGenerateRandomSequentialEngine);
+
+template <typename Engine, typename Distribution>
+void TestGenerateRandomIsSerial(size_t n)
+{
+  using T = typename Distribution::result_type;
+
+  Engine engine(11);
+  Distribution distribution;
+
+  thrust::host_vector<T> h_expected(n);
+  Engine expected_engine = engine;
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_expected[i] = distribution(expected_engine);
+  }
+
+  thrust::device_vector<T> d_result(n);
+  thrust::generate_random(thrust::device, d_result.begin(), d_result.end(), engine, distribution);
+  ASSERT_EQUAL(h_expected, d_result);
+  ASSERT_EQUAL(engine, expected_engine);
+}
+
+void TestGenerateRandomLinearCongruential()
+{
+  // the period of the linear congruential engines is too short to split into substreams, so they generate the values
+  // in order, the same as a serial loop over many blocks
+  const size_t n = 1 << 20;
+
+  TestGenerateRandomIsSerial<thrust::minstd_rand, thrust::uniform_int_distribution<unsigned int>>(n);
+  TestGenerateRandomIsSerial<thrust::minstd_rand0, thrust::uniform_real_distribution<double>>(n);
+}
+DECLARE_UNITTEST(TestGenerateRandomLinearCongruential);
+
+void TestGenerateRandomRange()
+{
+  const size_t n = 50000;
+
+  cuda::std::philox4x32 engine(3);
+  thrust::device_vector<int> d_result(n);
+  thrust::generate_random(d_result.begin(), d_result.end(), engine, thrust::uniform_int_distribution<int>(1, 6));
+
+  thrust::host_vector<int> h_result = d_result;
+  size_t counts[7]                  = {};
+  for (int x : h_result)
+  {
+    ASSERT_EQUAL(1 <= x && x <= 6, true);
+    ++counts[x];
+  }
+
+  for (int face = 1; face <= 6; ++face)
+  {
+    ASSERT_EQUAL(counts[face] > n / 7 && counts[face] < n / 5, true);
+  }
+}
+DECLARE_UNITTEST(TestGenerateRandomRange);
+
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+namespace backend = thrust::omp;
+#  else
+namespace backend = thrust::tbb;
+#  endif
+
+template <typename Engine, typename Distribution>
+void TestGenerateRandomThreadCount(size_t n)
+{
+  using T = typename Distribution::result_type;
+
+  Engine serial_engine(5);
+  thrust::device_vector<T> d_expected(n);
+  thrust::generate_random(
+    backend::par.num_threads(1), d_expected.begin(), d_expected.end(), serial_engine, Distribution());
+
+  for (int num_threads : {2, 3, 4, 7})
+  {
+    Engine engine(5);
+    thrust::device_vector<T> d_result(n);
+    thrust::generate_random(
+      backend::par.num_threads(num_threads), d_result.begin(), d_result.end(), engine, Distribution());
+    ASSERT_EQUAL(d_expected, d_result);
+    ASSERT_EQUAL(serial_engine == engine, true);
+  }
+}
+
+void TestGenerateRandomIndependentOfThreadCount()
+{
+  for (size_t n : {size_t{0}, size_t{1}, size_t{5000}, size_t{300000}})
+  {
+    TestGenerateRandomThreadCount<cuda::std::philox4x32, thrust::normal_distribution<float>>(n);
+    TestGenerateRandomThreadCount<cuda::std::philox4x64, cuda::std::uniform_real_distribution<double>>(n);
+    TestGenerateRandomThreadCount<cuda::pcg64, cuda::std::normal_distribution<double>>(n);
+    TestGenerateRandomThreadCount<thrust::default_random_engine, thrust::uniform_int_distribution<int>>(n);
+  }
+}
+DECLARE_UNITTEST(TestGenerateRandomIndependentOfThreadCount);
+
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
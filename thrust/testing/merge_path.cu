@@ -0,0 +1,113 @@
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/sort.h>
+#include <thrust/system/detail/internal/merge_path.h>
+
+#include <unittest/unittest.h>
+
+using thrust::system::detail::internal::merge_path;
+using thrust::system::detail::internal::set_operation_partition;
+
+void TestMergePathSimple()
+{
+  // the stable merge of a and b is 0a 1a 1b 1b 2a 3b 4a
+  thrust::host_vector<int> a{0, 1, 2, 4};
+  thrust::host_vector<int> b{1, 1, 3};
+
+  const int expected[] = {0, 1, 2, 2, 2, 3, 3, 4};
+
+  for (int diag = 0; diag <= 7; ++diag)
+  {
+    ASSERT_EQUAL(merge_path(a.begin(), 4, b.begin(), 3, diag, ::cuda::std::less<int>()), expected[diag]);
+  }
+}
+DECLARE_UNITTEST(TestMergePathSimple);
+
+template <typename T>
+void TestMergePath(const size_t n)
+{
+  thrust::host_vector<T> a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> b = unittest::random_integers<T>(n / 2);
+
+  // a small key space produces many equivalent elements across both ranges
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = a[i] % 8;
+  }
+  for (size_t i = 0; i < b.size(); ++i)
+  {
+    b[i] = b[i] % 8;
+  }
+
+  thrust::sort(a.begin(), a.end());
+  thrust::sort(b.begin(), b.end());
+
+  const long n1 = static_cast<long>(a.size());
+  const long n2 = static_cast<long>(b.size());
+
+  // walk the stable merge and check every diagonal
+  long i = 0;
+  for (long diag = 0; diag <= n1 + n2; ++diag)
+  {
+    ASSERT_EQUAL(merge_path(a.begin(), n1, b.begin(), n2, diag, ::cuda::std::less<T>()), i);
+
+    if (diag < n1 + n2 && i < n1 && (diag - i == n2 || !(b[diag - i] < a[i])))
+    {
+      ++i;
+    }
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestMergePath);
+
+template <typename T>
+void TestSetOperationPartition(const size_t n)
+{
+  thrust::host_vector<T> a = unittest::random_integers<T>(n);
+  thrust::host_vector<T> b = unittest::random_integers<T>(n);
+
+  for (size_t i = 0; i < a.size(); ++i)
+  {
+    a[i] = a[i] % 16;
+    b[i] = b[i] % 16;
+  }
+
+  thrust::sort(a.begin(), a.end());
+  thrust::sort(b.begin(), b.end());
+
+  const long n1 = static_cast<long>(a.size());
+  const long n2 = static_cast<long>(b.size());
+
+  ::cuda::std::pair<long, long> prev(0, 0);
+
+  for (long diag = 0; diag <= n1 + n2; diag += 1 + (n1 + n2) / 64)
+  {
+    ::cuda::std::pair<long, long> split =
+      set_operation_partition(a.begin(), n1, b.begin(), n2, diag, ::cuda::std::less<T>());
+
+    // splits are monotonic and never land past the diagonal
+    ASSERT_EQUAL(split.first >= prev.first, true);
+    ASSERT_EQUAL(split.second >= prev.second, true);
+    ASSERT_EQUAL(split.first + split.second <= diag, true);
+
+    // splits never separate equivalent elements
+    if (split.first > 0 && split.first < n1)
+    {
+      ASSERT_EQUAL(a[split.first - 1] < a[split.first], true);
+    }
+    if (split.second > 0 && split.second < n2)
+    {
+      ASSERT_EQUAL(b[split.second - 1] < b[split.second], true);
+    }
+    if (split.first > 0 && split.second < n2)
+    {
+      ASSERT_EQUAL(a[split.first - 1] < b[split.second], true);
+    }
+    if (split.second > 0 && split.first < n1)
+    {
+      ASSERT_EQUAL(b[split.second - 1] < a[split.first], true);
+    }
+
+    prev = split;
+  }
+}
+DECLARE_INTEGRAL_VARIABLE_UNITTEST(TestSetOperationPartition);
@@ -0,0 +1,155 @@
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/concurrent_pool.h>
+#include <thrust/mr/new.h>
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include <unittest/unittest.h>
+
+using Pool = thrust::mr::concurrent_pool_resource<thrust::mr::new_delete_resource>;
+
+void TestConcurrentPoolReuse()
+{
+  thrust::mr::new_delete_resource upstream;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts, 1);
+  ASSERT_EQUAL(pool.shard_count(), 1u);
+
+  void* a1 = pool.do_allocate(100);
+  pool.do_deallocate(a1, 100);
+
+  // the block returned to the shard is handed out again
+  void* a2 = pool.do_allocate(128);
+  ASSERT_EQUAL(a1, a2);
+
+  // a block of another size is not
+  void* a3 = pool.do_allocate(256);
+  ASSERT_EQUAL(a3 != a2, true);
+
+  pool.do_deallocate(a2, 128);
+  pool.do_deallocate(a3, 256);
+
+  // oversized requests are forwarded to the depot, which caches them
+  void* a4 = pool.do_allocate(4096);
+  pool.do_deallocate(a4, 4096);
+  void* a5 = pool.do_allocate(4096);
+  ASSERT_EQUAL(a4, a5);
+  pool.do_deallocate(a5, 4096);
+
+  thrust::mr::concurrent_pool_statistics stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.depot_refills, 2u);
+  ASSERT_EQUAL(stats.shard_hits, 4u);
+  ASSERT_EQUAL(stats.oversized_requests, 4u);
+  ASSERT_EQUAL(stats.shard_contentions, 0u);
+  ASSERT_EQUAL(stats.depot_contentions, 0u);
+
+  pool.release();
+
+  stats = pool.get_statistics();
+  ASSERT_EQUAL(stats.depot_refills, 0u);
+  ASSERT_EQUAL(stats.shard_hits, 0u);
+}
+DECLARE_UNITTEST(TestConcurrentPoolReuse);
+
+void TestConcurrentPoolBatchReturn()
+{
+  thrust::mr::new_delete_resource upstream;
+
+  Pool pool(&upstream, Pool::get_default_options(), 1);
+
+  // allocate many more blocks than a shard keeps, so that deallocating them returns batches to the depot
+  std::vector<void*> blocks;
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    blocks.push_back(pool.do_allocate(64));
+  }
+
+  for (std::size_t i = 0; i < blocks.size(); ++i)
+  {
+    pool.do_deallocate(blocks[i], 64);
+  }
+
+  thrust::mr::concurrent_pool_statistics stats = pool.get_statistics();
+  ASSERT_GEQUAL(stats.depot_refills, 1u);
+  ASSERT_GEQUAL(stats.depot_returns, 1u);
+}
+DECLARE_UNITTEST(TestConcurrentPoolBatchReturn);
+
+void TestConcurrentPoolThreads()
+{
+  thrust::mr::new_delete_resource upstream;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.largest_block_size       = 4096;
+
+  // fewer shards than threads, so that some threads share them
+  Pool pool(&upstream, opts, 2);
+
+  const std::size_t thread_count = 8;
+  std::vector<std::thread> threads;
+  std::vector<int> failures(thread_count, 0);
+
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads.emplace_back([&, t] {
+      std::vector<unsigned char*> blocks;
+      std::vector<std::size_t> sizes;
+
+      for (std::size_t i = 0; i < 2000; ++i)
+      {
+        // sizes spanning several buckets, and an occasional oversized one
+        const std::size_t size = 8 + ((i * 37 + t * 11) % 5000);
+        auto p                 = static_cast<unsigned char*>(pool.do_allocate(size));
+        std::memset(p, static_cast<int>(t), size);
+        blocks.push_back(p);
+        sizes.push_back(size);
+
+        if (i % 3 == 2)
+        {
+          // free an older block, checking no other thread wrote over it
+          const std::size_t j = blocks.size() / 2;
+          for (std::size_t k = 0; k < sizes[j]; ++k)
+          {
+            failures[t] += blocks[j][k] != t;
+          }
+
+          pool.do_deallocate(blocks[j], sizes[j]);
+          blocks.erase(blocks.begin() + j);
+          sizes.erase(sizes.begin() + j);
+        }
+      }
+
+      for (std::size_t j = 0; j < blocks.size(); ++j)
+      {
+        pool.do_deallocate(blocks[j], sizes[j]);
+      }
+    });
+  }
+
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    threads[t].join();
+  }
+
+  for (std::size_t t = 0; t < thread_count; ++t)
+  {
+    ASSERT_EQUAL(failures[t], 0);
+  }
+
+  thrust::mr::concurrent_pool_statistics stats = pool.get_statistics();
+  ASSERT_GEQUAL(stats.shard_hits, 1u);
+  ASSERT_GEQUAL(stats.oversized_requests, 1u);
+}
+DECLARE_UNITTEST(TestConcurrentPoolThreads);
+
+void TestConcurrentGlobalPool()
+{
+  ASSERT_EQUAL(thrust::mr::get_global_resource<Pool>() != nullptr, true);
+}
+DECLARE_UNITTEST(TestConcurrentGlobalPool);
@@ -0,0 +1,208 @@
+#include <thrust/detail/config.h>
+
+#include <thrust/detail/allocator/copy_construct_range.h>
+#include <thrust/equal.h>
+#include <thrust/fill.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/mr/allocator.h>
+#include <thrust/mr/page_resource.h>
+#include <thrust/sequence.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+
+#include <limits>
+#include <list>
+#include <new>
+
+#if _CCCL_OS(LINUX)
+#  include <unistd.h>
+#endif // _CCCL_OS(LINUX)
+
+#include <unittest/unittest.h>
+
+#if _CCCL_OS(LINUX)
+// the alignment of the mappings of a page kind, which is the granularity of their sizes
+std::size_t mapping_alignment(thrust::mr::page_kind kind)
+{
+  switch (kind)
+  {
+    case thrust::mr::page_kind::normal:
+      return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    case thrust::mr::page_kind::huge_1gb:
+      return std::size_t{1} << 30;
+    default:
+      return std::size_t{1} << 21;
+  }
+}
+#endif // _CCCL_OS(LINUX)
+
+void TestPageResource(thrust::mr::page_resource_options options, std::size_t size, std::size_t alignment, bool mapped)
+{
+  thrust::mr::page_resource memres(options);
+
+  void* ptr = memres.do_allocate(size, alignment);
+  ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % alignment, 0u);
+#if _CCCL_OS(LINUX)
+  // on other systems, every allocation is served by new_delete_resource
+  if (mapped)
+  {
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % mapping_alignment(options.pages), 0u);
+  }
+#endif // _CCCL_OS(LINUX)
+
+  char* char_ptr = reinterpret_cast<char*>(ptr);
+  thrust::fill(char_ptr, char_ptr + size, char{1});
+  ASSERT_EQUAL(char_ptr[0] + char_ptr[size - 1], 2);
+
+  memres.do_deallocate(ptr, size, alignment);
+}
+
+void TestPageResourceAllocation()
+{
+  const thrust::mr::page_kind kinds[] = {
+    thrust::mr::page_kind::normal,
+    thrust::mr::page_kind::transparent_huge,
+    thrust::mr::page_kind::huge_2mb,
+    thrust::mr::page_kind::huge_1gb};
+  const thrust::mr::numa_placement placements[] = {
+    thrust::mr::numa_placement::first_touch,
+    thrust::mr::numa_placement::local,
+    thrust::mr::numa_placement::interleave};
+
+  for (auto kind : kinds)
+  {
+    for (auto placement : placements)
+    {
+      thrust::mr::page_resource_options options;
+      options.pages            = kind;
+      options.placement        = placement;
+      options.min_mapped_bytes = 64 * 1024;
+
+      // smaller than min_mapped_bytes, served by new_delete_resource
+      TestPageResource(options, 1000, 16, false);
+
+      // aligned to 8 MiB, which is more than the pages of every kind but huge_1gb, so only that kind maps it
+      TestPageResource(options, 128 * 1024, 8192 * 1024, kind == thrust::mr::page_kind::huge_1gb);
+
+      // mapped
+      TestPageResource(options, 64 * 1024, 16, true);
+      TestPageResource(options, 3 * 1024 * 1024 + 1, 4096, true);
+    }
+  }
+}
+DECLARE_UNITTEST(TestPageResourceAllocation);
+
+void TestPageResourceWithoutFallback()
+{
+  thrust::mr::page_resource_options options;
+  options.pages                    = thrust::mr::page_kind::huge_1gb;
+  options.min_mapped_bytes         = 1;
+  options.fallback_to_normal_pages = false;
+  thrust::mr::page_resource memres(options);
+
+  // 1 GiB pages are only available if the administrator reserved them
+  try
+  {
+    void* ptr = memres.do_allocate(4096);
+    ASSERT_EQUAL(reinterpret_cast<std::size_t>(ptr) % (std::size_t{1} << 30), 0u);
+    memres.do_deallocate(ptr, 4096);
+  }
+  catch (const std::bad_alloc&)
+  {}
+}
+DECLARE_UNITTEST(TestPageResourceWithoutFallback);
+
+void TestPageResourceTooLarge()
+{
+  const thrust::mr::page_kind kinds[] = {
+    thrust::mr::page_kind::normal,
+    thrust::mr::page_kind::transparent_huge,
+    thrust::mr::page_kind::huge_2mb,
+    thrust::mr::page_kind::huge_1gb};
+
+  for (auto kind : kinds)
+  {
+    thrust::mr::page_resource_options options;
+    options.pages = kind;
+    thrust::mr::page_resource memres(options);
+
+    // sizes whose mapping, rounded up to whole pages and padded for alignment, does not fit into the address space
+    for (std::size_t k : {std::size_t{0}, std::size_t{1}, std::size_t{4095}, std::size_t{1} << 21})
+    {
+      ASSERT_THROWS(memres.do_allocate(std::numeric_limits<std::size_t>::max() - k), std::bad_alloc);
+    }
+  }
+}
+DECLARE_UNITTEST(TestPageResourceTooLarge);
+
+void TestPageResourceEquality()
+{
+  thrust::mr::page_resource_options options;
+  thrust::mr::page_resource a(options);
+  thrust::mr::page_resource b(options);
+  ASSERT_EQUAL(a.is_equal(b), true);
+
+  options.placement = thrust::mr::numa_placement::interleave;
+  thrust::mr::page_resource interleaved(options);
+  ASSERT_EQUAL(a.is_equal(interleaved), true);
+
+  options.pages = thrust::mr::page_kind::normal;
+  thrust::mr::page_resource normal(options);
+  ASSERT_EQUAL(a.is_equal(normal), false);
+}
+DECLARE_UNITTEST(TestPageResourceEquality);
+
+void TestPageResourceVector()
+{
+  using allocator = thrust::mr::allocator<int, thrust::mr::page_resource>;
+
+  thrust::mr::page_resource_options options;
+  options.placement = thrust::mr::numa_placement::interleave;
+  thrust::mr::page_resource memres(options);
+
+  const std::size_t n = 1 << 20;
+  thrust::host_vector<int, allocator> v(n, 0, allocator(&memres));
+  thrust::sequence(v.begin(), v.end());
+  ASSERT_EQUAL(v[0], 0);
+  ASSERT_EQUAL(v[n - 1], static_cast<int>(n - 1));
+
+  thrust::host_vector<int, allocator> copy(v, allocator(&memres));
+  ASSERT_EQUAL(copy == v, true);
+
+  v.resize(2 * n);
+  ASSERT_EQUAL(v[n - 1], static_cast<int>(n - 1));
+}
+DECLARE_UNITTEST(TestPageResourceVector);
+
+void TestConstructOnAllocatorSystem()
+{
+  using thrust::detail::construct_on_allocator_system;
+  using cpp_tag           = thrust::system::cpp::tag;
+  using omp_tag           = thrust::system::omp::tag;
+  using host_iterator     = thrust::host_vector<int>::iterator;
+  using list_iterator     = std::list<int>::iterator;
+  using counting_iterator = thrust::counting_iterator<int>;
+
+  // the OpenMP system refines the C++ system, so it constructs from random access ranges of it
+  static_assert(construct_on_allocator_system<cpp_tag, omp_tag, host_iterator>);
+  static_assert(construct_on_allocator_system<cpp_tag, omp_tag, int*>);
+  static_assert(construct_on_allocator_system<cpp_tag, omp_tag, counting_iterator>);
+
+  // but not from ranges without random access, from its own system, or from a system which refines it
+  static_assert(!construct_on_allocator_system<cpp_tag, omp_tag, list_iterator>);
+  static_assert(!construct_on_allocator_system<omp_tag, omp_tag, host_iterator>);
+  static_assert(!construct_on_allocator_system<cpp_tag, cpp_tag, host_iterator>);
+  static_assert(!construct_on_allocator_system<omp_tag, cpp_tag, host_iterator>);
+
+  // copy constructing a vector of a refining system reads the source range on that system
+  thrust::host_vector<int> h_data(100000);
+  thrust::sequence(h_data.begin(), h_data.end());
+  thrust::device_vector<int> d_data(h_data);
+  ASSERT_EQUAL(h_data, d_data);
+
+  const std::list<int> l(h_data.begin(), h_data.begin() + 1000);
+  thrust::device_vector<int> d_list(l.begin(), l.end());
+  ASSERT_EQUAL(d_list.size(), 1000u);
+  ASSERT_EQUAL(thrust::equal(d_list.begin(), d_list.end(), h_data.begin()), true);
+}
+DECLARE_UNITTEST(TestConstructOnAllocatorSystem);
@@ -6,6 +6,8 @@
 
 #include <unittest/unittest.h>
 
+#include <vector>
+
 template <typename T>
 struct reference
 {
@@ -346,6 +348,133 @@ void TestSynchronizedPoolCachingOversized()
 }
 DECLARE_UNITTEST(TestSynchronizedPoolCachingOversized);
 
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedBestFit()
+{
+  tracked_resource upstream;
+
+  upstream.id_to_allocate = -1u;
+
+  using Pool = PoolTemplate<tracked_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+  opts.max_cached_bytes         = 24 * 1024;
+
+  Pool pool(&upstream, opts);
+
+  upstream.id_to_allocate  = 1;
+  tracked_pointer<void> a1 = pool.do_allocate(4096);
+  ASSERT_EQUAL(a1.id, 1u);
+
+  upstream.id_to_allocate  = 2;
+  tracked_pointer<void> a2 = pool.do_allocate(8192);
+  ASSERT_EQUAL(a2.id, 2u);
+
+  pool.do_deallocate(a1, 4096);
+  pool.do_deallocate(a2, 8192);
+
+  // make sure the smallest fitting block is used, even if it's not the most recently cached one
+  tracked_pointer<void> a3 = pool.do_allocate(3000);
+  ASSERT_EQUAL(a3.id, 1u);
+
+  upstream.id_to_allocate  = 3;
+  tracked_pointer<void> a4 = pool.do_allocate(16384);
+  ASSERT_EQUAL(a4.id, 3u);
+
+  pool.do_deallocate(a3, 3000);
+
+  // make sure that exceeding options.max_cached_bytes returns the least recently cached block to upstream
+  upstream.id_to_deallocate = 2;
+  pool.do_deallocate(a4, 16384);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  tracked_pointer<void> a5 = pool.do_allocate(8192);
+  ASSERT_EQUAL(a5.id, 3u);
+
+  tracked_pointer<void> a6 = pool.do_allocate(4096);
+  ASSERT_EQUAL(a6.id, 1u);
+
+  // a block bigger than the limit is not kept at all
+  upstream.id_to_allocate  = 4;
+  tracked_pointer<void> a7 = pool.do_allocate(32 * 1024);
+  ASSERT_EQUAL(a7.id, 4u);
+
+  upstream.id_to_deallocate = 4;
+  pool.do_deallocate(a7, 32 * 1024);
+  ASSERT_EQUAL(upstream.id_to_deallocate, 0u);
+
+  pool.do_deallocate(a5, 8192);
+  pool.do_deallocate(a6, 4096);
+}
+
+void TestUnsynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedBestFit);
+
+void TestSynchronizedPoolCachingOversizedBestFit()
+{
+  TestPoolCachingOversizedBestFit<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedBestFit);
+
+template <template <typename> class PoolTemplate>
+void TestPoolCachingOversizedManyBlocks()
+{
+  thrust::mr::new_delete_resource upstream;
+
+  using Pool = PoolTemplate<thrust::mr::new_delete_resource>;
+
+  thrust::mr::pool_options opts = Pool::get_default_options();
+  opts.cache_oversized          = true;
+  opts.largest_block_size       = 1024;
+
+  Pool pool(&upstream, opts);
+
+  const std::size_t count = 257;
+  const std::size_t step  = 64;
+
+  // allocate and cache blocks of distinct sizes in an order unrelated to their sizes
+  std::vector<void*> blocks(count);
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const std::size_t j = i * 97 % count;
+    blocks[j]           = pool.do_allocate(2048 + j * step);
+  }
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const std::size_t j = i * 31 % count;
+    pool.do_deallocate(blocks[j], 2048 + j * step);
+  }
+
+  // every request must get the smallest cached block that fits it
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    const std::size_t j = i * 53 % count;
+    void* ptr           = pool.do_allocate(2048 + j * step - step / 2);
+    ASSERT_EQUAL(ptr == blocks[j], true);
+  }
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    pool.do_deallocate(blocks[i], 2048 + i * step - step / 2);
+  }
+}
+
+void TestUnsynchronizedPoolCachingOversizedManyBlocks()
+{
+  TestPoolCachingOversizedManyBlocks<thrust::mr::unsynchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestUnsynchronizedPoolCachingOversizedManyBlocks);
+
+void TestSynchronizedPoolCachingOversizedManyBlocks()
+{
+  TestPoolCachingOversizedManyBlocks<thrust::mr::synchronized_pool_resource>();
+}
+DECLARE_UNITTEST(TestSynchronizedPoolCachingOversizedManyBlocks);
+
 template <template <typename> class PoolTemplate>
 void TestGlobalPool()
 {
@@ -0,0 +1,139 @@
+#include <thrust/detail/config.h>
+
+#include <thrust/mr/new.h>
+#include <thrust/mr/polymorphic_adaptor.h>
+#include <thrust/mr/pool.h>
+#include <thrust/mr/statistics_adaptor.h>
+
+#include <cuda/std/type_traits>
+
+#include <unittest/unittest.h>
+
+void TestStatisticsAdaptorCounts()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_adaptor_resource<thrust::mr::new_delete_resource> stats(&upstream);
+
+  void* a1 = stats.allocate(100);
+  void* a2 = stats.allocate(128);
+  void* a3 = stats.allocate(1000, 64);
+
+  thrust::mr::allocation_statistics s = stats.get_statistics();
+  ASSERT_EQUAL(s.allocations, 3u);
+  ASSERT_EQUAL(s.deallocations, 0u);
+  ASSERT_EQUAL(s.current_bytes, 1228u);
+  ASSERT_EQUAL(s.peak_bytes, 1228u);
+  ASSERT_EQUAL(s.size_class_allocations[7], 2u);
+  ASSERT_EQUAL(s.size_class_allocations[10], 1u);
+
+  stats.deallocate(a3, 1000, 64);
+  stats.deallocate(a1, 100);
+
+  s = stats.get_statistics();
+  ASSERT_EQUAL(s.deallocations, 2u);
+  ASSERT_EQUAL(s.current_bytes, 128u);
+  ASSERT_EQUAL(s.peak_bytes, 1228u);
+  ASSERT_EQUAL(s.total_bytes, 1228u);
+
+  stats.reset_statistics();
+
+  s = stats.get_statistics();
+  ASSERT_EQUAL(s.allocations, 0u);
+  ASSERT_EQUAL(s.current_bytes, 128u);
+  ASSERT_EQUAL(s.peak_bytes, 128u);
+  ASSERT_EQUAL(s.size_class_allocations[7], 0u);
+
+  stats.deallocate(a2, 128);
+
+  ASSERT_EQUAL(stats.get_statistics().current_bytes, 0u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorCounts);
+
+void TestStatisticsAdaptorSizeClass()
+{
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(0), 0u);
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(1), 0u);
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(2), 1u);
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(3), 2u);
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(4), 2u);
+  ASSERT_EQUAL(thrust::mr::allocation_statistics::size_class(5), 3u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorSizeClass);
+
+void TestStatisticsAdaptorGlobalUpstream()
+{
+  using adaptor = thrust::mr::statistics_adaptor_resource<thrust::mr::new_delete_resource>;
+
+  // a size does not convert to an adaptor implicitly
+  static_assert(!::cuda::std::is_convertible_v<std::size_t, adaptor>);
+  static_assert(::cuda::std::is_default_constructible_v<adaptor>);
+
+  adaptor stats{};
+  stats.deallocate(stats.allocate(100), 100);
+  ASSERT_EQUAL(stats.get_statistics().allocations, 1u);
+  ASSERT_EQUAL(stats.get_trace().size(), 0u);
+
+  adaptor traced(std::size_t{2});
+  traced.deallocate(traced.allocate(100), 100);
+  ASSERT_EQUAL(traced.get_trace().size(), 2u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorGlobalUpstream);
+
+void TestStatisticsAdaptorTrace()
+{
+  thrust::mr::new_delete_resource upstream;
+  thrust::mr::statistics_adaptor_resource<thrust::mr::new_delete_resource> stats(&upstream, 3);
+
+  ASSERT_EQUAL(stats.get_trace().size(), 0u);
+
+  void* a1 = stats.allocate(16);
+  void* a2 = stats.allocate(32);
+  stats.deallocate(a1, 16);
+  void* a3 = stats.allocate(64);
+
+  // only the most recent requests are kept, oldest first
+  auto trace = stats.get_trace();
+  ASSERT_EQUAL(trace.size(), 3u);
+  ASSERT_EQUAL(trace[0].sequence_number, 1u);
+  ASSERT_EQUAL(trace[0].is_allocation, true);
+  ASSERT_EQUAL(trace[0].pointer, a2);
+  ASSERT_EQUAL(trace[0].bytes, 32u);
+  ASSERT_EQUAL(trace[1].is_allocation, false);
+  ASSERT_EQUAL(trace[1].pointer, a1);
+  ASSERT_EQUAL(trace[2].pointer, a3);
+  ASSERT_EQUAL(trace[2].bytes, 64u);
+
+  stats.deallocate(a2, 32);
+  stats.deallocate(a3, 64);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorTrace);
+
+void TestStatisticsAdaptorHitRate()
+{
+  using upstream_stats = thrust::mr::statistics_adaptor_resource<thrust::mr::new_delete_resource>;
+  using pool           = thrust::mr::unsynchronized_pool_resource<upstream_stats>;
+
+  // count the requests made by the pool to its upstream resource, and the requests served by the pool
+  upstream_stats upstream(thrust::mr::get_global_resource<thrust::mr::new_delete_resource>());
+  pool p(&upstream);
+  thrust::mr::polymorphic_adaptor_resource<void*> adaptor(&p);
+  thrust::mr::statistics_adaptor_resource<thrust::mr::memory_resource<void*>> stats(&adaptor);
+
+  // ignore the pool's own bookkeeping allocations
+  upstream.reset_statistics();
+
+  for (int i = 0; i < 10; ++i)
+  {
+    void* ptr = stats.allocate(256);
+    stats.deallocate(ptr, 256);
+  }
+
+  ASSERT_EQUAL(stats.get_statistics().allocations, 10u);
+  ASSERT_EQUAL(upstream.get_statistics().allocations, 1u);
+  ASSERT_EQUAL(stats.get_statistics().hit_rate(upstream.get_statistics()), 0.9);
+
+  p.release();
+
+  ASSERT_EQUAL(upstream.get_statistics().deallocations, 1u);
+}
+DECLARE_UNITTEST(TestStatisticsAdaptorHitRate);
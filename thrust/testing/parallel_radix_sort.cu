@@ -0,0 +1,81 @@
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/system/cpp/execution_policy.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+
+#include <algorithm>
+
+#include <unittest/unittest.h>
+
+using thrust::system::detail::internal::parallel_radix_sort;
+using thrust::system::detail::internal::radix_sort_detail::no_values;
+
+// visits the tiles in reverse to make sure they do not depend on being processed in order
+struct reverse_for
+{
+  template <typename Size, typename Function>
+  void operator()(Size n, Function f) const
+  {
+    for (Size i = n; i > 0; --i)
+    {
+      f(i - 1);
+    }
+  }
+};
+
+template <typename T>
+struct TestParallelRadixSort
+{
+  void operator()(const size_t n)
+  {
+    thrust::host_vector<T> h_keys = unittest::random_samples<T>(n);
+    thrust::host_vector<T> h_ref  = h_keys;
+
+    std::stable_sort(h_ref.begin(), h_ref.end());
+
+    thrust::cpp::tag exec;
+    parallel_radix_sort<false>(exec, reverse_for{}, 7l, h_keys.begin(), no_values{}, static_cast<long>(n));
+
+    ASSERT_EQUAL(h_ref, h_keys);
+
+    std::stable_sort(h_ref.begin(), h_ref.end(), ::cuda::std::greater<T>());
+
+    parallel_radix_sort<true>(exec, reverse_for{}, 3l, h_keys.begin(), no_values{}, static_cast<long>(n));
+
+    ASSERT_EQUAL(h_ref, h_keys);
+  }
+};
+VariableUnitTest<TestParallelRadixSort, unittest::type_list<char, short, int, long long, float, double>>
+  TestParallelRadixSortInstance;
+
+template <typename T>
+struct TestParallelRadixSortByKeyStability
+{
+  void operator()(const size_t n)
+  {
+    // few distinct keys so that stability matters
+    thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+    for (size_t i = 0; i < n; ++i)
+    {
+      h_keys[i] = static_cast<T>(h_keys[i] % 17);
+    }
+
+    thrust::host_vector<int> h_values(n);
+    thrust::sequence(h_values.begin(), h_values.end());
+
+    thrust::host_vector<T> h_ref_keys     = h_keys;
+    thrust::host_vector<int> h_ref_values = h_values;
+    thrust::stable_sort_by_key(
+      thrust::cpp::par, h_ref_keys.begin(), h_ref_keys.end(), h_ref_values.begin(), ::cuda::std::greater<T>());
+
+    thrust::cpp::tag exec;
+    parallel_radix_sort<true>(exec, reverse_for{}, 5l, h_keys.begin(), h_values.begin(), static_cast<long>(n));
+
+    ASSERT_EQUAL(h_ref_keys, h_keys);
+    ASSERT_EQUAL(h_ref_values, h_values);
+  }
+};
+VariableUnitTest<TestParallelRadixSortByKeyStability, unittest::type_list<unsigned char, int, unsigned long long>>
+  TestParallelRadixSortByKeyStabilityInstance;
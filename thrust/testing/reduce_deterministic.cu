@@ -0,0 +1,192 @@
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/transform_reduce.h>
+
+#include <cuda/std/bit>
+#include <cuda/std/cstdint>
+#include <cuda/std/type_traits>
+
+#include <atomic>
+#include <thread>
+
+#include <unittest/unittest.h>
+
+// only the OpenMP and TBB policies can require determinism
+#if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
+
+#  if THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP
+namespace backend = thrust::omp;
+#  else
+namespace backend = thrust::tbb;
+#  endif
+
+namespace determinism = cuda::execution::determinism;
+
+// compares floating-point results bit for bit
+template <typename T>
+auto bits(T x)
+{
+  using bits_type = ::cuda::std::conditional_t<sizeof(T) == 4, ::cuda::std::uint32_t, ::cuda::std::uint64_t>;
+  return ::cuda::std::bit_cast<bits_type>(x);
+}
+
+// values of both signs spread over many orders of magnitude, whose sum depends on the association of the additions
+template <typename T>
+thrust::host_vector<T> mixed_magnitudes(size_t n)
+{
+  thrust::host_vector<int> h_integers = unittest::random_integers<int>(n);
+  thrust::host_vector<T> h_data(n);
+
+  for (size_t i = 0; i < n; ++i)
+  {
+    const int x = h_integers[i];
+    h_data[i]   = static_cast<T>(x % 100000) * static_cast<T>(1 << (x & 15)) / T(1000);
+  }
+
+  return h_data;
+}
+
+template <typename T, typename Guarantee>
+void TestDeterministicReduce(Guarantee guarantee, size_t n)
+{
+  thrust::host_vector<T> h_data   = mixed_magnitudes<T>(n);
+  thrust::device_vector<T> d_data = h_data;
+
+  const T init = T(13);
+
+  const auto serial = backend::par.num_threads(1).require(guarantee);
+  const T sum       = thrust::reduce(serial, d_data.begin(), d_data.end(), init);
+  const T negated   = thrust::transform_reduce(
+    serial, d_data.begin(), d_data.end(), ::cuda::std::negate<T>(), init, ::cuda::std::plus<T>());
+
+  for (int num_threads : {2, 3, 4, 7})
+  {
+    const auto policy = backend::par.num_threads(num_threads).require(guarantee);
+
+    ASSERT_EQUAL(bits(sum), bits(thrust::reduce(policy, d_data.begin(), d_data.end(), init)));
+    ASSERT_EQUAL(bits(sum), bits(thrust::reduce(policy, d_data.begin(), d_data.end(), init, thrust::plus<T>())));
+    ASSERT_EQUAL(bits(negated),
+                 bits(thrust::transform_reduce(
+                   policy, d_data.begin(), d_data.end(), ::cuda::std::negate<T>(), init, ::cuda::std::plus<T>())));
+  }
+
+  // neither does running sequentially on the calling thread change the result
+  const auto sequential = backend::par.sequential_cutoff(n + 1).require(guarantee);
+  ASSERT_EQUAL(bits(sum), bits(thrust::reduce(sequential, d_data.begin(), d_data.end(), init)));
+}
+
+template <typename T>
+void TestReproducibleSum(size_t n)
+{
+  thrust::host_vector<T> h_data = mixed_magnitudes<T>(n);
+
+  // the exact sum of the values, rounded once
+  long double exact = 0;
+  for (size_t i = 0; i < n; ++i)
+  {
+    exact += h_data[i];
+  }
+
+  thrust::device_vector<T> d_data = h_data;
+
+  const auto policy = backend::par.require(determinism::gpu_to_gpu);
+  const T sum       = thrust::reduce(policy, d_data.begin(), d_data.end());
+  ASSERT_ALMOST_EQUAL(static_cast<T>(exact), sum);
+
+  // reproducible sums do not depend on the order of the values
+  thrust::device_vector<T> d_reversed(d_data.rbegin(), d_data.rend());
+  ASSERT_EQUAL(bits(sum), bits(thrust::reduce(policy.num_threads(3), d_reversed.begin(), d_reversed.end())));
+}
+
+// adds two values, and records whether it is called on another thread than the caller
+template <typename T>
+struct plus_on_caller
+{
+  std::thread::id caller;
+  std::atomic<bool>* off_the_caller;
+
+  T operator()(T x, T y) const
+  {
+    if (std::this_thread::get_id() != caller)
+    {
+      off_the_caller->store(true);
+    }
+    return x + y;
+  }
+};
+
+template <typename T>
+void TestDeterministicReduceByKey(size_t n)
+{
+  thrust::host_vector<T> h_values = mixed_magnitudes<T>(n);
+
+  // few distinct keys, so that segments span many blocks
+  thrust::host_vector<int> h_keys(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<int>(i / 40000);
+  }
+
+  thrust::device_vector<int> d_keys   = h_keys;
+  thrust::device_vector<T> d_values   = h_values;
+  const size_t num_segments           = (n + 39999) / 40000;
+  thrust::device_vector<int> d_keys_out(num_segments);
+  thrust::device_vector<T> d_expected(num_segments);
+
+  const auto serial = backend::par.num_threads(1).require(determinism::run_to_run);
+  thrust::reduce_by_key(serial, d_keys.begin(), d_keys.end(), d_values.begin(), d_keys_out.begin(), d_expected.begin());
+
+  std::atomic<bool> off_the_caller{false};
+  const plus_on_caller<T> plus{std::this_thread::get_id(), &off_the_caller};
+
+  const auto check = [&](auto policy) {
+    thrust::device_vector<T> d_sums(num_segments);
+    const auto end = thrust::reduce_by_key(
+      policy,
+      d_keys.begin(),
+      d_keys.end(),
+      d_values.begin(),
+      d_keys_out.begin(),
+      d_sums.begin(),
+      ::cuda::std::equal_to<int>(),
+      plus);
+    ASSERT_EQUAL(static_cast<size_t>(end.second - d_sums.begin()), num_segments);
+
+    for (size_t i = 0; i < num_segments; ++i)
+    {
+      ASSERT_EQUAL(bits(T(d_expected[i])), bits(T(d_sums[i])));
+    }
+  };
+
+  for (int num_threads : {2, 3, 4, 7})
+  {
+    check(backend::par.num_threads(num_threads).require(determinism::run_to_run));
+  }
+
+  // neither does running sequentially on the calling thread below the cutoff change the result
+  off_the_caller = false;
+  check(backend::par.num_threads(4).sequential_cutoff(n + 1).require(determinism::run_to_run));
+  ASSERT_EQUAL(off_the_caller.load(), false);
+}
+
+void TestReduceDeterminism()
+{
+  for (size_t n : {size_t{0}, size_t{1}, size_t{1000}, size_t{100000}, size_t{300000}})
+  {
+    TestDeterministicReduce<float>(determinism::run_to_run, n);
+    TestDeterministicReduce<double>(determinism::run_to_run, n);
+    TestDeterministicReduce<float>(determinism::gpu_to_gpu, n);
+    TestDeterministicReduce<double>(determinism::gpu_to_gpu, n);
+    TestDeterministicReduce<int>(determinism::gpu_to_gpu, n);
+
+    TestReproducibleSum<float>(n);
+    TestReproducibleSum<double>(n);
+
+    TestDeterministicReduceByKey<float>(n);
+    TestDeterministicReduceByKey<double>(n);
+  }
+}
+DECLARE_UNITTEST(TestReduceDeterminism);
+
+#endif // THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_OMP || THRUST_DEVICE_SYSTEM == THRUST_DEVICE_SYSTEM_TBB
@@ -1,7 +1,10 @@
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator>
@@ -126,3 +129,84 @@ void TestSortTrivial()
   ASSERT_EQUAL(h_data, ref);
 }
 DECLARE_UNITTEST(TestSortTrivial);
+
+// not one of the comparators of the radix sort, so that the comparison sort is used
+struct custom_greater
+{
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return rhs < lhs;
+  }
+};
+
+// inputs that quicksorts are prone to partition badly
+template <typename T>
+thrust::host_vector<T> sort_pattern(int pattern, size_t n)
+{
+  thrust::host_vector<T> data = unittest::random_integers<T>(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    switch (pattern)
+    {
+      case 0: // ascending
+        data[i] = static_cast<T>(i);
+        break;
+      case 1: // descending
+        data[i] = static_cast<T>(n - i);
+        break;
+      case 2: // organ pipe
+        data[i] = static_cast<T>(i < n / 2 ? i : n - i);
+        break;
+      case 3: // nearly sorted
+        data[i] = i % 100 == 0 ? data[i] : static_cast<T>(i);
+        break;
+      case 4: // few distinct values
+        data[i] = static_cast<T>(i % 4);
+        break;
+      case 5: // sawtooth
+        data[i] = static_cast<T>(i % 32);
+        break;
+      default: // random
+        break;
+    }
+  }
+  return data;
+}
+
+template <typename T>
+void TestSortPatternsCustomCompare(const size_t n)
+{
+  for (int pattern = 0; pattern <= 6; ++pattern)
+  {
+    thrust::host_vector<T> h_data   = sort_pattern<T>(pattern, n);
+    thrust::device_vector<T> d_data = h_data;
+    thrust::host_vector<T> h_ref    = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end(), custom_greater{});
+
+    thrust::sort(h_data.begin(), h_data.end(), custom_greater{});
+    thrust::sort(d_data.begin(), d_data.end(), custom_greater{});
+
+    ASSERT_EQUAL(h_ref, h_data);
+    ASSERT_EQUAL(h_ref, d_data);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSortPatternsCustomCompare);
+
+template <typename T>
+void TestSortSeqCustomCompare(const size_t n)
+{
+  for (int pattern = 0; pattern <= 6; ++pattern)
+  {
+    thrust::host_vector<T> h_data = sort_pattern<T>(pattern, n);
+    thrust::host_vector<T> h_ref  = h_data;
+
+    std::sort(h_ref.begin(), h_ref.end(), custom_greater{});
+
+    thrust::sort(thrust::seq, h_data.begin(), h_data.end(), custom_greater{});
+
+    ASSERT_EQUAL(h_ref, h_data);
+  }
+}
+DECLARE_VARIABLE_UNITTEST(TestSortSeqCustomCompare);
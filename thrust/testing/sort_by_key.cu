@@ -1,7 +1,10 @@
 #include <thrust/functional.h>
 #include <thrust/iterator/retag.h>
+#include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <algorithm>
+
 #include <unittest/unittest.h>
 
 template <typename RandomAccessIterator1, typename RandomAccessIterator2>
@@ -150,3 +153,59 @@ void TestSortByKeyLongDouble()
   ASSERT_EQUAL(h_values, h_values_expected);
 }
 DECLARE_UNITTEST(TestSortByKeyLongDouble);
+
+// not one of the comparators of the radix sort, so that the comparison sort is used
+struct custom_greater
+{
+  template <typename T>
+  _CCCL_HOST_DEVICE bool operator()(const T& lhs, const T& rhs) const
+  {
+    return rhs < lhs;
+  }
+};
+
+template <typename T>
+void TestSortByKeyCustomCompare(const size_t n)
+{
+  // every third key is one of a few distinct values, so that many keys compare equal
+  thrust::host_vector<T> h_keys = unittest::random_integers<T>(n);
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_keys[i] = static_cast<T>(i % 3 == 0 ? i % 8 : i);
+  }
+  const thrust::host_vector<T> h_input = h_keys;
+
+  thrust::host_vector<T> h_ref = h_keys;
+  std::sort(h_ref.begin(), h_ref.end(), custom_greater{});
+
+  // the values are the positions of the keys in the input
+  thrust::host_vector<int> h_values(n);
+  thrust::sequence(h_values.begin(), h_values.end());
+  thrust::device_vector<T> d_keys     = h_keys;
+  thrust::device_vector<int> d_values = h_values;
+
+  thrust::sort_by_key(h_keys.begin(), h_keys.end(), h_values.begin(), custom_greater{});
+  thrust::sort_by_key(d_keys.begin(), d_keys.end(), d_values.begin(), custom_greater{});
+
+  ASSERT_EQUAL(h_ref, h_keys);
+  ASSERT_EQUAL(h_ref, d_keys);
+
+  // the sort is not stable, but every value has to move with its key
+  thrust::host_vector<T> h_gathered(n);
+  thrust::host_vector<T> d_gathered(n);
+  thrust::host_vector<int> d_values_h = d_values;
+  for (size_t i = 0; i < n; ++i)
+  {
+    h_gathered[i] = h_input[h_values[i]];
+    d_gathered[i] = h_input[d_values_h[i]];
+  }
+  ASSERT_EQUAL(h_ref, h_gathered);
+  ASSERT_EQUAL(h_ref, d_gathered);
+
+  // and no value may be lost or duplicated
+  thrust::host_vector<int> h_positions(n);
+  thrust::sequence(h_positions.begin(), h_positions.end());
+  std::sort(h_values.begin(), h_values.end());
+  ASSERT_EQUAL(h_positions, h_values);
+}
+DECLARE_VARIABLE_UNITTEST(TestSortByKeyCustomCompare);
@@ -17,8 +17,10 @@
 #include <thrust/detail/copy.h>
 #include <thrust/detail/execution_policy.h>
 #include <thrust/for_each.h>
+#include <thrust/iterator/iterator_categories.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/system/cpp/detail/execution_policy.h>
 
 #include <cuda/std/__host_stdlib/memory>
 #include <cuda/std/__iterator/advance.h>
@@ -26,6 +28,7 @@
 #include <cuda/std/__memory/allocator_traits.h>
 #include <cuda/std/__memory/pointer_traits.h>
 #include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__type_traits/is_trivially_copy_constructible.h>
 #include <cuda/std/tuple>
 
@@ -61,6 +64,16 @@ template <typename U, typename T>
 inline constexpr bool needs_copy_construct_via_allocator<std::allocator<U>, T> =
   !::cuda::std::is_trivially_copy_constructible_v<T>;
 
+// a host system which refines the system of a random access source range, like the OpenMP and TBB systems refine the
+// C++ system of std::vector and host_vector, can read the source range itself. Constructing the new elements on it
+// instead of copying across systems lets a parallel system touch the pages of the new range from the threads which
+// later work on them, which places them on the NUMA nodes of those threads.
+template <typename FromSystem, typename ToSystem, typename InputIterator>
+inline constexpr bool construct_on_allocator_system =
+  !::cuda::std::is_same_v<FromSystem, ToSystem> && ::cuda::std::is_convertible_v<ToSystem, FromSystem>
+  && ::cuda::std::is_convertible_v<ToSystem, thrust::system::cpp::tag>
+  && ::cuda::std::is_convertible_v<iterator_traversal_t<InputIterator>, random_access_traversal_tag>;
+
 // XXX it's regrettable that this implementation is copied almost
 //     exactly from system::detail::generic::uninitialized_copy
 //     perhaps generic::uninitialized_copy could call this routine
@@ -151,15 +164,22 @@ template <typename System, typename Allocator, typename InputIterator, typename
 _CCCL_HOST_DEVICE Pointer copy_construct_range(
   thrust::execution_policy<System>& from_system, Allocator& a, InputIterator first, InputIterator last, Pointer result)
 {
-  if constexpr (needs_copy_construct_via_allocator<Allocator,
-                                                   typename ::cuda::std::pointer_traits<Pointer>::element_type>)
+  auto&& to_system = allocator_system<Allocator>::get(a);
+
+  if constexpr (construct_on_allocator_system<System, typename allocator_system<Allocator>::type, InputIterator>)
   {
-    return uninitialized_copy_with_allocator(a, from_system, allocator_system<Allocator>::get(a), first, last, result);
+    // the allocator's system reads the source range itself
+    return copy_construct_range(to_system, a, first, last, result);
+  }
+  else if constexpr (needs_copy_construct_via_allocator<Allocator,
+                                                        typename ::cuda::std::pointer_traits<Pointer>::element_type>)
+  {
+    return uninitialized_copy_with_allocator(a, from_system, to_system, first, last, result);
   }
   else
   {
     // just call two_system_copy
-    return thrust::detail::two_system_copy(from_system, allocator_system<Allocator>::get(a), first, last, result);
+    return thrust::detail::two_system_copy(from_system, to_system, first, last, result);
   }
 }
 
@@ -167,15 +187,22 @@ template <typename System, typename Allocator, typename InputIterator, typename
 _CCCL_HOST_DEVICE Pointer copy_construct_range_n(
   thrust::execution_policy<System>& from_system, Allocator& a, InputIterator first, Size n, Pointer result)
 {
-  if constexpr (needs_copy_construct_via_allocator<Allocator,
-                                                   typename ::cuda::std::pointer_traits<Pointer>::element_type>)
+  auto&& to_system = allocator_system<Allocator>::get(a);
+
+  if constexpr (construct_on_allocator_system<System, typename allocator_system<Allocator>::type, InputIterator>)
+  {
+    // the allocator's system reads the source range itself
+    return copy_construct_range_n(to_system, a, first, n, result);
+  }
+  else if constexpr (needs_copy_construct_via_allocator<Allocator,
+                                                        typename ::cuda::std::pointer_traits<Pointer>::element_type>)
   {
-    return uninitialized_copy_with_allocator_n(a, from_system, allocator_system<Allocator>::get(a), first, n, result);
+    return uninitialized_copy_with_allocator_n(a, from_system, to_system, first, n, result);
   }
   else
   {
     // just call two_system_copy_n
-    return thrust::detail::two_system_copy_n(from_system, allocator_system<Allocator>::get(a), first, n, result);
+    return thrust::detail::two_system_copy_n(from_system, to_system, first, n, result);
   }
 }
 } // namespace detail
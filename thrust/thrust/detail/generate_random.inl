@@ -0,0 +1,49 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/generate_random.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/generate_random.h>
+#include <thrust/system/detail/generic/select_system.h>
+
+THRUST_NAMESPACE_BEGIN
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename ForwardIterator, typename RandomEngine, typename Distribution>
+_CCCL_HOST_DEVICE void generate_random(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  RandomEngine&& engine,
+  Distribution&& distribution)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::generate_random");
+  using thrust::system::detail::generic::generate_random;
+  return generate_random(
+    thrust::detail::derived_cast(thrust::detail::strip_const(exec)), first, last, engine, distribution);
+}
+
+template <typename ForwardIterator, typename RandomEngine, typename Distribution>
+void generate_random(ForwardIterator first, ForwardIterator last, RandomEngine&& engine, Distribution&& distribution)
+{
+  _CCCL_NVTX_RANGE_SCOPE("thrust::generate_random");
+  using thrust::system::detail::generic::select_system;
+
+  using System = typename thrust::iterator_system<ForwardIterator>::type;
+  System system;
+
+  return thrust::generate_random(select_system(system), first, last, engine, distribution);
+}
+
+THRUST_NAMESPACE_END
@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file generate_random.h
+ *  \brief Fills a range with values drawn from a random distribution
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+
+THRUST_NAMESPACE_BEGIN
+
+/*! \addtogroup transformations
+ *  \{
+ */
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with values drawn from the random distribution
+ *  \p distribution, using random engine \p engine as the source of randomness.
+ *
+ *  The algorithm's execution is parallelized as determined by \p exec.
+ *
+ *  When \p engine can discard values quickly and <tt>[first, last)</tt> is a random access range, the range is
+ *  divided into blocks of a fixed number of elements. Every block draws its values from a copy of \p distribution,
+ *  which is \c reset, and from a copy of \p engine, which is advanced to a substream of its own. This is the case for
+ *  \p cuda::std::philox4x32, \p cuda::std::philox4x64 and \p cuda::pcg64, among others.
+ *  The blocks are then generated in parallel, and the values only depend on the state of \p engine and the parameters
+ *  of \p distribution, and neither on the execution policy nor on the number of threads it uses. Afterwards \p engine
+ *  is advanced past the substreams of all blocks, so that the next call produces new values.
+ *
+ *  Otherwise the values are generated sequentially, as if by <tt>*i = distribution(engine)</tt> for every iterator
+ *  \c i in the range <tt>[first, last)</tt>, in order.
+ *
+ *  \param exec The execution policy to use for parallelization.
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param engine The random number engine.
+ *  \param distribution The random number distribution.
+ *
+ *  \tparam DerivedPolicy The name of the derived execution policy.
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ *          Iterator</a>, and \p ForwardIterator is mutable. The \c result_type of \p Distribution is convertible to
+ *          \p ForwardIterator's \c value_type.
+ *  \tparam RandomEngine is a uniform random bit generator, which is copyable if \p ForwardIterator is a random access
+ *          iterator.
+ *  \tparam Distribution is a random number distribution, which is copyable if \p ForwardIterator is a random access
+ *          iterator.
+ *
+ *  The following code snippet demonstrates how to use \p generate_random to fill a range with normally distributed
+ *  values using the \p thrust::omp::par execution policy for parallelization:
+ *
+ *  \code
+ *  #include <thrust/generate_random.h>
+ *  #include <thrust/random.h>
+ *  #include <thrust/system/omp/execution_policy.h>
+ *  #include <cuda/std/random>
+ *  ...
+ *  float A[100000];
+ *  cuda::std::philox4x32 engine(42);
+ *  thrust::normal_distribution<float> distribution(0.0f, 1.0f);
+ *  thrust::generate_random(thrust::omp::par, A, A + 100000, engine, distribution);
+ *
+ *  // A holds the same values at any number of threads
+ *  \endcode
+ *
+ *  \see \p generate
+ *  \see \p shuffle
+ */
+template <typename DerivedPolicy, typename ForwardIterator, typename RandomEngine, typename Distribution>
+_CCCL_HOST_DEVICE void generate_random(
+  const thrust::detail::execution_policy_base<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  RandomEngine&& engine,
+  Distribution&& distribution);
+
+/*! \p generate_random fills the range <tt>[first, last)</tt> with values drawn from the random distribution
+ *  \p distribution, using random engine \p engine as the source of randomness.
+ *
+ *  The values are the same as those of the overload with an execution policy.
+ *
+ *  \param first The beginning of the range.
+ *  \param last The end of the range.
+ *  \param engine The random number engine.
+ *  \param distribution The random number distribution.
+ *
+ *  \tparam ForwardIterator is a model of <a href="https://en.cppreference.com/w/cpp/iterator/forward_iterator">Forward
+ *          Iterator</a>, and \p ForwardIterator is mutable. The \c result_type of \p Distribution is convertible to
+ *          \p ForwardIterator's \c value_type.
+ *  \tparam RandomEngine is a uniform random bit generator, which is copyable if \p ForwardIterator is a random access
+ *          iterator.
+ *  \tparam Distribution is a random number distribution, which is copyable if \p ForwardIterator is a random access
+ *          iterator.
+ *
+ *  The following code snippet demonstrates how to use \p generate_random to fill a range with uniformly distributed
+ *  integers.
+ *
+ *  \code
+ *  #include <thrust/generate_random.h>
+ *  #include <thrust/random.h>
+ *  ...
+ *  int A[1000];
+ *  thrust::default_random_engine engine;
+ *  thrust::uniform_int_distribution<int> distribution(1, 6);
+ *  thrust::generate_random(A, A + 1000, engine, distribution);
+ *
+ *  // A holds values in [1, 6]
+ *  \endcode
+ *
+ *  \see \p generate
+ *  \see \p shuffle
+ */
+template <typename ForwardIterator, typename RandomEngine, typename Distribution>
+void generate_random(ForwardIterator first, ForwardIterator last, RandomEngine&& engine, Distribution&& distribution);
+
+/*! \} // end transformations
+ */
+
+THRUST_NAMESPACE_END
+
+#include <thrust/detail/generate_random.inl>
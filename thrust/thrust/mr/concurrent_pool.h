@@ -0,0 +1,343 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A version of \p unsynchronized_pool_resource, which can be used from many threads at once, without
+ *  serializing all of them on a single mutex.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/pool.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/__bit/integral.h>
+#include <cuda/std/__host_stdlib/algorithm>
+#include <cuda/std/cstddef>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! Counters describing how often the threads using a \p concurrent_pool_resource had to wait for each other, or had to
+ *      go to its shared depot. Every counter is monotonic until \p concurrent_pool_resource::release is called.
+ */
+struct concurrent_pool_statistics
+{
+  /*! The number of allocations and deallocations served by a shard without touching the depot.
+   */
+  std::size_t shard_hits;
+  /*! The number of times a thread found the shard it was mapped to locked by another thread.
+   */
+  std::size_t shard_contentions;
+  /*! The number of times a thread found the depot locked by another thread.
+   */
+  std::size_t depot_contentions;
+  /*! The number of batches of blocks moved from the depot to a shard.
+   */
+  std::size_t depot_refills;
+  /*! The number of batches of blocks returned from a shard to the depot.
+   */
+  std::size_t depot_returns;
+  /*! The number of oversized and/or overaligned requests, which are always forwarded to the depot.
+   */
+  std::size_t oversized_requests;
+};
+
+/*! A thread-safe version of \p unsynchronized_pool_resource, meant to be shared by many threads at once.
+ *
+ *  Unlike \p synchronized_pool_resource, which serializes every request on a single mutex, this resource keeps a
+ * number of shards, each caching a small number of blocks of every pool size. Threads are spread over the shards in a
+ * round-robin fashion, so most requests only touch a shard no other thread is using. A shard which runs out of blocks
+ * of a given size refills a batch of them from a shared depot, and a shard which caches too many returns a batch to it,
+ * so the depot lock is taken once per batch rather than once per request. The depot is an \p
+ * unsynchronized_pool_resource using the given \p pool_options; oversized and overaligned requests are forwarded to it
+ * directly.
+ *
+ *  Blocks cached in the shards are not handed back to the depot until \p release is called.
+ *
+ *  \tparam Upstream the type of memory resources that will be used for allocating memory blocks
+ */
+template <typename Upstream>
+class concurrent_pool_resource final : public memory_resource<typename Upstream::pointer>
+{
+  using depot_pool = unsynchronized_pool_resource<Upstream>;
+  using lock_t     = std::unique_lock<std::mutex>;
+
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! Get the default options for a pool. These are meant to be a sensible set of values for many use cases,
+   *      and as such, may be tuned in the future. This function is exposed so that creating a set of options that are
+   *      just a slight departure from the defaults is easy.
+   */
+  static pool_options get_default_options()
+  {
+    return depot_pool::get_default_options();
+  }
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param options pool options to use
+   *  \param shard_count the number of shards; \p 0 picks one shard per hardware thread
+   */
+  concurrent_pool_resource(
+    Upstream* upstream, pool_options options = get_default_options(), std::size_t shard_count = 0)
+      : m_options(options)
+      , m_smallest_block_log2(::cuda::ceil_ilog2(m_options.smallest_block_size))
+      , m_bucket_count(::cuda::ceil_ilog2(m_options.largest_block_size) - m_smallest_block_log2 + 1)
+      , m_shard_count(make_shard_count(shard_count))
+      , m_shards(new shard[m_shard_count])
+      , m_depot(upstream, options)
+      , m_depot_statistics()
+  {
+    // every bucket holds at most two batches, so that caching a block in do_deallocate never allocates
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      m_shards[i].buckets.resize(m_bucket_count);
+      for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+      {
+        m_shards[i].buckets[bucket].reserve(2 * blocks_per_batch(bucket + m_smallest_block_log2));
+      }
+    }
+  }
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param options pool options to use
+   *  \param shard_count the number of shards; \p 0 picks one shard per hardware thread
+   */
+  concurrent_pool_resource(pool_options options = get_default_options(), std::size_t shard_count = 0)
+      : concurrent_pool_resource(get_global_resource<Upstream>(), options, shard_count)
+  {}
+
+  /*! Destructor. Releases all held memory to upstream.
+   */
+  ~concurrent_pool_resource() override // NOLINT(bugprone-exception-escape)
+  {
+    release();
+  }
+
+  /*! Releases all held memory to upstream, and resets the statistics.
+   */
+  void release()
+  {
+    std::vector<lock_t> locks;
+    locks.reserve(m_shard_count);
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      locks.emplace_back(m_shards[i].mtx);
+      for (std::size_t bucket = 0; bucket < m_bucket_count; ++bucket)
+      {
+        m_shards[i].buckets[bucket].clear();
+      }
+      m_shards[i].statistics = concurrent_pool_statistics();
+    }
+
+    lock_t lock(m_depot_mtx);
+    m_depot.release();
+    m_depot_statistics = concurrent_pool_statistics();
+  }
+
+  /*! Returns the sum of the statistics of all the shards and of the depot.
+   */
+  concurrent_pool_statistics get_statistics()
+  {
+    concurrent_pool_statistics ret = get_depot_statistics();
+
+    for (std::size_t i = 0; i < m_shard_count; ++i)
+    {
+      lock_t lock(m_shards[i].mtx);
+      ret.shard_hits += m_shards[i].statistics.shard_hits;
+      ret.shard_contentions += m_shards[i].statistics.shard_contentions;
+      ret.depot_refills += m_shards[i].statistics.depot_refills;
+      ret.depot_returns += m_shards[i].statistics.depot_returns;
+    }
+
+    return ret;
+  }
+
+  /*! Returns the number of shards used by this resource.
+   */
+  std::size_t shard_count() const
+  {
+    return m_shard_count;
+  }
+
+  [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    bytes = (std::max) (bytes, m_options.smallest_block_size);
+
+    if (bytes > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock = lock_depot();
+      ++m_depot_statistics.oversized_requests;
+      return m_depot.do_allocate(bytes, alignment);
+    }
+
+    const std::size_t bytes_log2 = ::cuda::ceil_ilog2(bytes);
+    shard& s                     = this_thread_shard();
+    lock_t lock                  = lock_shard(s);
+
+    std::vector<void_ptr>& bucket = s.buckets[bytes_log2 - m_smallest_block_log2];
+    if (!bucket.empty())
+    {
+      ++s.statistics.shard_hits;
+      void_ptr ret = bucket.back();
+      bucket.pop_back();
+      return ret;
+    }
+
+    // the shard has no blocks of this size; get a batch of them from the depot, and keep all but one
+    const std::size_t batch = blocks_per_batch(bytes_log2);
+
+    lock_t depot_lock = lock_depot();
+    ++s.statistics.depot_refills;
+    for (std::size_t i = 1; i < batch; ++i)
+    {
+      bucket.push_back(m_depot.do_allocate(static_cast<std::size_t>(1) << bytes_log2, m_options.alignment));
+    }
+
+    return m_depot.do_allocate(static_cast<std::size_t>(1) << bytes_log2, m_options.alignment);
+  }
+
+  void do_deallocate(void_ptr p, std::size_t n, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    n = (std::max) (n, m_options.smallest_block_size);
+
+    if (n > m_options.largest_block_size || alignment > m_options.alignment)
+    {
+      lock_t lock = lock_depot();
+      ++m_depot_statistics.oversized_requests;
+      m_depot.do_deallocate(p, n, alignment);
+      return;
+    }
+
+    const std::size_t n_log2 = ::cuda::ceil_ilog2(n);
+    shard& s                 = this_thread_shard();
+    lock_t lock              = lock_shard(s);
+
+    std::vector<void_ptr>& bucket = s.buckets[n_log2 - m_smallest_block_log2];
+    const std::size_t batch       = blocks_per_batch(n_log2);
+    if (bucket.size() < 2 * batch)
+    {
+      ++s.statistics.shard_hits;
+      bucket.push_back(p);
+      return;
+    }
+
+    // the shard caches enough blocks of this size; return the most recently cached batch to the depot
+    lock_t depot_lock = lock_depot();
+    ++s.statistics.depot_returns;
+    m_depot.do_deallocate(p, static_cast<std::size_t>(1) << n_log2, m_options.alignment);
+    for (std::size_t i = 1; i < batch; ++i)
+    {
+      m_depot.do_deallocate(bucket.back(), static_cast<std::size_t>(1) << n_log2, m_options.alignment);
+      bucket.pop_back();
+    }
+  }
+
+private:
+  // the number of bytes moved between a shard and the depot at once, and the bounds on the number of blocks in a batch
+  static constexpr std::size_t batch_bytes          = static_cast<std::size_t>(1) << 16;
+  static constexpr std::size_t max_blocks_per_batch = 64;
+
+  // the shards are aligned to keep threads using different shards from sharing cache lines
+  struct alignas(64) shard
+  {
+    std::mutex mtx;
+    std::vector<std::vector<void_ptr>> buckets;
+    concurrent_pool_statistics statistics{};
+  };
+
+  pool_options m_options;
+  std::size_t m_smallest_block_log2;
+  std::size_t m_bucket_count;
+
+  std::size_t m_shard_count;
+  std::unique_ptr<shard[]> m_shards;
+
+  std::mutex m_depot_mtx;
+  depot_pool m_depot;
+  concurrent_pool_statistics m_depot_statistics;
+
+  static std::size_t make_shard_count(std::size_t shard_count)
+  {
+    if (shard_count == 0)
+    {
+      shard_count = (std::max) (std::thread::hardware_concurrency(), 1u);
+    }
+
+    // a power of two, so that mapping a thread to a shard is just a mask
+    return ::cuda::std::bit_ceil(shard_count);
+  }
+
+  static std::size_t blocks_per_batch(std::size_t bytes_log2)
+  {
+    return (std::max) ((std::min) (batch_bytes >> bytes_log2, max_blocks_per_batch), static_cast<std::size_t>(1));
+  }
+
+  shard& this_thread_shard()
+  {
+    // threads are numbered in the order they first use any concurrent pool, which spreads them evenly over the shards
+    static std::atomic<std::size_t> thread_count{0};
+    static thread_local const std::size_t thread_index = thread_count.fetch_add(1, std::memory_order_relaxed);
+
+    return m_shards[thread_index & (m_shard_count - 1)];
+  }
+
+  lock_t lock_shard(shard& s)
+  {
+    lock_t lock(s.mtx, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      lock.lock();
+      ++s.statistics.shard_contentions;
+    }
+
+    return lock;
+  }
+
+  lock_t lock_depot()
+  {
+    lock_t lock(m_depot_mtx, std::try_to_lock);
+    if (!lock.owns_lock())
+    {
+      lock.lock();
+      ++m_depot_statistics.depot_contentions;
+    }
+
+    return lock;
+  }
+
+  concurrent_pool_statistics get_depot_statistics()
+  {
+    lock_t lock(m_depot_mtx);
+    return m_depot_statistics;
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
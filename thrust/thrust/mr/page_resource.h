@@ -0,0 +1,314 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A memory resource which maps host memory directly from the operating system, optionally backed by huge
+ *  pages and placed on specific NUMA nodes.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/new.h>
+#include <thrust/system/detail/bad_alloc.h>
+
+#include <cuda/std/cstddef>
+
+#include <cstdint>
+#include <limits>
+
+#if _CCCL_OS(LINUX)
+#  include <linux/mempolicy.h>
+#  include <sys/mman.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+#endif // _CCCL_OS(LINUX)
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! The kinds of pages a \p page_resource can map its allocations with.
+ */
+enum class page_kind
+{
+  /*! Pages of the default size of the operating system.
+   */
+  normal,
+  /*! Pages of the default size, which the kernel is asked to merge into 2 MiB transparent huge pages. Allocations are
+   *      aligned to 2 MiB, so that they can be backed by huge pages from their first byte on.
+   */
+  transparent_huge,
+  /*! Explicit 2 MiB huge pages, which have to be reserved by the administrator, e.g. through
+   *      \p /proc/sys/vm/nr_hugepages.
+   */
+  huge_2mb,
+  /*! Explicit 1 GiB huge pages, which have to be reserved by the administrator, usually on the kernel command line.
+   */
+  huge_1gb
+};
+
+/*! The NUMA placements of the pages of a \p page_resource.
+ */
+enum class numa_placement
+{
+  /*! Every page is placed on the node of the thread which first writes to it. This is the default policy of the
+   *      operating system, which puts the data of a vector next to the threads that work on it if the vector is
+   *      constructed by the same threads, see \p omp::vector and \p tbb::vector.
+   */
+  first_touch,
+  /*! Pages are placed on the node of the thread which allocates them, if that node has free memory.
+   */
+  local,
+  /*! Pages are interleaved across all nodes the process may allocate memory on, which evens out the memory bandwidth
+   *      of data that all threads access.
+   */
+  interleave
+};
+
+/*! The options of a \p page_resource.
+ */
+struct page_resource_options
+{
+  /*! The kind of pages to map allocations with.
+   */
+  page_kind pages = page_kind::transparent_huge;
+  /*! The NUMA placement of the pages.
+   */
+  numa_placement placement = numa_placement::first_touch;
+  /*! Allocations smaller than this are served by \p new_delete_resource, since every mapping takes at least one page
+   *      and a system call.
+   */
+  std::size_t min_mapped_bytes = std::size_t{1} << 20;
+  /*! Whether to map pages of the default size when no explicit huge pages are available, instead of throwing.
+   */
+  bool fallback_to_normal_pages = true;
+};
+
+/*! A memory resource which maps every large allocation as a separate range of pages from the operating system. The
+ *  pages can be huge pages, which reduce the TLB misses of algorithms on large data, and can be interleaved across
+ *  NUMA nodes or placed on the node of the allocating thread.
+ *
+ *  The NUMA placement is a hint: it is not applied on systems without NUMA support, or if the process may not change
+ *  its memory policy. Small allocations, and allocations aligned to more than a page, are served by
+ *  \p new_delete_resource. On operating systems other than Linux, all allocations are.
+ *
+ *  Mapping pages is comparatively slow, so this resource is best used for long-lived allocations, or as the upstream
+ *  resource of a pool.
+ */
+class page_resource final : public memory_resource<>
+{
+public:
+  /*! Constructor.
+   *
+   *  \param options the options of the resource
+   */
+  page_resource(page_resource_options options = {})
+      : m_options(options)
+  {}
+
+  /*! Returns the options of the resource.
+   */
+  const page_resource_options& options() const noexcept
+  {
+    return m_options;
+  }
+
+  void* do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if _CCCL_OS(LINUX)
+    if (is_mapped(bytes, alignment))
+    {
+      // rounding the size up to whole pages and padding the mapping to align it must not wrap around
+      if (bytes > std::numeric_limits<std::size_t>::max() - (granularity() - 1) - alignment_padding())
+      {
+        throw thrust::system::detail::bad_alloc("page_resource: the allocation is larger than the address space");
+      }
+      return map(mapping_size(bytes));
+    }
+#endif // _CCCL_OS(LINUX)
+
+    return m_small.do_allocate(bytes, alignment);
+  }
+
+  void do_deallocate(void* p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+#if _CCCL_OS(LINUX)
+    if (is_mapped(bytes, alignment))
+    {
+      ::munmap(p, mapping_size(bytes));
+      return;
+    }
+#endif // _CCCL_OS(LINUX)
+
+    m_small.do_deallocate(p, bytes, alignment);
+  }
+
+  bool do_is_equal(const memory_resource<>& other) const noexcept override
+  {
+    const page_resource* other_pages = dynamic_cast<const page_resource*>(&other);
+    return other_pages && other_pages->m_options.pages == m_options.pages
+        && other_pages->m_options.min_mapped_bytes == m_options.min_mapped_bytes;
+  }
+
+private:
+#if _CCCL_OS(LINUX)
+  static constexpr std::size_t huge_page_2mb = std::size_t{1} << 21;
+  static constexpr std::size_t huge_page_1gb = std::size_t{1} << 30;
+
+  // mapping sizes are multiples of this, and mappings are aligned to it
+  std::size_t granularity() const noexcept
+  {
+    switch (m_options.pages)
+    {
+      case page_kind::normal:
+        return static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+      case page_kind::huge_1gb:
+        return huge_page_1gb;
+      default:
+        return huge_page_2mb;
+    }
+  }
+
+  // the pages map_aligned maps in addition to an allocation, to align it to the granularity
+  std::size_t alignment_padding() const noexcept
+  {
+    const std::size_t alignment = granularity();
+    const std::size_t page      = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return alignment > page ? alignment : 0;
+  }
+
+  // whether an allocation is mapped, which only depends on its size and alignment so that deallocations agree
+  bool is_mapped(std::size_t bytes, std::size_t alignment) const noexcept
+  {
+    return bytes >= m_options.min_mapped_bytes && alignment <= granularity();
+  }
+
+  std::size_t mapping_size(std::size_t bytes) const noexcept
+  {
+    const std::size_t page = granularity();
+    return (bytes + page - 1) / page * page;
+  }
+
+  void* map(std::size_t size) const
+  {
+    void* p = MAP_FAILED;
+
+    if (m_options.pages == page_kind::huge_2mb || m_options.pages == page_kind::huge_1gb)
+    {
+      const int page_shift = m_options.pages == page_kind::huge_2mb ? 21 : 30;
+      p                    = ::mmap(nullptr,
+                 size,
+                 PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (page_shift << MAP_HUGE_SHIFT),
+                 -1,
+                 0);
+
+      if (p == MAP_FAILED && !m_options.fallback_to_normal_pages)
+      {
+        throw thrust::system::detail::bad_alloc("page_resource: no huge pages of the requested size are available");
+      }
+    }
+
+    if (p == MAP_FAILED)
+    {
+      p = map_aligned(size);
+    }
+
+    place(p, size);
+    return p;
+  }
+
+  // maps pages of the default size aligned to the granularity, and asks for transparent huge pages
+  void* map_aligned(std::size_t size) const
+  {
+    const std::size_t alignment = granularity();
+    const std::size_t padding   = alignment_padding();
+
+    void* raw = ::mmap(nullptr, size + padding, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (raw == MAP_FAILED)
+    {
+      throw thrust::system::detail::bad_alloc("page_resource: mmap failed");
+    }
+
+    // trim the mapping to an aligned range
+    char* begin         = static_cast<char*>(raw);
+    const auto address  = reinterpret_cast<std::uintptr_t>(raw);
+    const auto leading  = padding == 0 ? 0 : (alignment - address % alignment) % alignment;
+    const auto trailing = padding - leading;
+    if (leading != 0)
+    {
+      ::munmap(begin, leading);
+    }
+    if (trailing != 0)
+    {
+      ::munmap(begin + leading + size, trailing);
+    }
+
+    void* p = begin + leading;
+    if (m_options.pages != page_kind::normal)
+    {
+      // only a hint, the kernel may have transparent huge pages disabled
+      ::madvise(p, size, MADV_HUGEPAGE);
+    }
+    return p;
+  }
+
+  // applies the NUMA placement before any page of the mapping is touched
+  void place(void* p, std::size_t size) const noexcept
+  {
+    // room for the largest number of nodes a kernel can be configured for
+    constexpr unsigned long max_nodes = 1024;
+    constexpr unsigned long bits      = sizeof(unsigned long) * 8;
+    unsigned long nodes[max_nodes / bits]{};
+
+    // the node mask system calls drop the last bit of the mask
+    constexpr unsigned long mask_size = max_nodes + 1;
+
+    switch (m_options.placement)
+    {
+      case numa_placement::local: {
+        unsigned cpu  = 0;
+        unsigned node = 0;
+        if (::syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= max_nodes)
+        {
+          return;
+        }
+        nodes[node / bits] = 1ul << (node % bits);
+        ::syscall(SYS_mbind, p, size, MPOL_PREFERRED, nodes, mask_size, 0u);
+        break;
+      }
+      case numa_placement::interleave:
+        if (::syscall(SYS_get_mempolicy, nullptr, nodes, mask_size, nullptr, MPOL_F_MEMS_ALLOWED) != 0)
+        {
+          return;
+        }
+        ::syscall(SYS_mbind, p, size, MPOL_INTERLEAVE, nodes, mask_size, 0u);
+        break;
+      default:
+        break;
+    }
+  }
+#endif // _CCCL_OS(LINUX)
+
+  page_resource_options m_options;
+  new_delete_resource m_small;
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
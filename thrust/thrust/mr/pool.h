@@ -29,6 +29,7 @@
 #include <cuda/std/__host_stdlib/algorithm>
 #include <cuda/std/cassert>
 #include <cuda/std/cstdint>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -89,6 +90,8 @@ public:
     ret.cached_size_cutoff_factor      = 16;
     ret.cached_alignment_cutoff_factor = 16;
 
+    ret.max_cached_bytes = ::cuda::std::numeric_limits<std::size_t>::max();
+
     return ret;
   }
 
@@ -104,7 +107,10 @@ public:
       , m_pools(upstream)
       , m_allocated()
       , m_oversized()
-      , m_cached_oversized()
+      , m_cached_root()
+      , m_oldest_cached()
+      , m_newest_cached()
+      , m_cached_bytes(0)
   {
     assert(m_options.validate());
 
@@ -125,7 +131,10 @@ public:
       , m_pools(get_global_resource<Upstream>())
       , m_allocated()
       , m_oversized()
-      , m_cached_oversized()
+      , m_cached_root()
+      , m_oldest_cached()
+      , m_newest_cached()
+      , m_cached_bytes(0)
   {
     assert(m_options.validate());
 
@@ -167,23 +176,24 @@ private:
 
   // this was originally a forward list, but I made it a doubly linked list
   // because that way deallocation when not caching is faster and doesn't require
-  // traversal of a linked list (it's still a forward list for the cached list,
-  // because allocation from that list already traverses)
-  //
-  // TODO: investigate whether it's better to have this be a doubly-linked list
-  // with fast do_deallocate when !m_options.cache_oversized, or to have this be
-  // a forward list and require traversal in do_deallocate
+  // traversal of a linked list
   //
-  // I assume that it is better this way, but the additional pointer could
-  // potentially hurt? these are supposed to be oversized and/or overaligned,
-  // so they are kinda memory intensive already
+  // while a block is cached, it is additionally linked into a treap of cached
+  // blocks ordered by size, and into the list of cached blocks ordered by the time
+  // they were cached; the treap makes finding the smallest fit take logarithmic
+  // time in the number of cached blocks without allocating, and the latter list
+  // is used to return the least recently cached blocks to upstream once the cache
+  // holds more than m_options.max_cached_bytes
   struct oversized_block_descriptor
   {
     std::size_t size;
     std::size_t alignment;
     oversized_block_descriptor_ptr prev;
     oversized_block_descriptor_ptr next;
-    oversized_block_descriptor_ptr next_cached;
+    oversized_block_descriptor_ptr smaller_cached;
+    oversized_block_descriptor_ptr larger_cached;
+    oversized_block_descriptor_ptr older_cached;
+    oversized_block_descriptor_ptr newer_cached;
     std::size_t current_size;
   };
 
@@ -203,7 +213,259 @@ private:
   pool_vector m_pools;
   chunk_descriptor_ptr m_allocated;
   oversized_block_descriptor_ptr m_oversized;
-  oversized_block_descriptor_ptr m_cached_oversized;
+
+  // cached oversized/overaligned blocks, in a tree ordered by size
+  oversized_block_descriptor_ptr m_cached_root;
+
+  // cached oversized/overaligned blocks, in the order they were cached
+  oversized_block_descriptor_ptr m_oldest_cached;
+  oversized_block_descriptor_ptr m_newest_cached;
+  std::size_t m_cached_bytes;
+
+  // the priority of a block in the tree of cached blocks; derived from its address, so that the tree stays balanced
+  // with high probability no matter in which order the blocks get cached
+  static std::uint64_t cached_priority(oversized_block_descriptor_ptr block)
+  {
+    const auto address = reinterpret_cast<std::uintptr_t>(::cuda::std::to_address(block));
+    return (static_cast<std::uint64_t>(address) >> 4) * 0x9E3779B97F4A7C15ull;
+  }
+
+  // the tree of cached blocks is ordered by size, and by address among blocks of the same size
+  static bool is_cached_before(
+    std::size_t lhs_size, oversized_block_descriptor_ptr lhs, std::size_t rhs_size, oversized_block_descriptor_ptr rhs)
+  {
+    return lhs_size < rhs_size
+        || (lhs_size == rhs_size && ::cuda::std::to_address(lhs) < ::cuda::std::to_address(rhs));
+  }
+
+  // inserts a block into the subtree rooted at root and returns the new root of that subtree
+  static oversized_block_descriptor_ptr
+  insert_cached(oversized_block_descriptor_ptr root, oversized_block_descriptor_ptr block, std::size_t size)
+  {
+    if (!::cuda::std::to_address(root))
+    {
+      return block;
+    }
+
+    oversized_block_descriptor& node = thrust::raw_reference_cast(*root);
+    if (is_cached_before(size, block, node.size, root))
+    {
+      node.smaller_cached = insert_cached(node.smaller_cached, block, size);
+      if (cached_priority(node.smaller_cached) > cached_priority(root))
+      {
+        // rotate right
+        oversized_block_descriptor_ptr child   = node.smaller_cached;
+        oversized_block_descriptor& child_node = thrust::raw_reference_cast(*child);
+        node.smaller_cached                    = child_node.larger_cached;
+        child_node.larger_cached               = root;
+        return child;
+      }
+    }
+    else
+    {
+      node.larger_cached = insert_cached(node.larger_cached, block, size);
+      if (cached_priority(node.larger_cached) > cached_priority(root))
+      {
+        // rotate left
+        oversized_block_descriptor_ptr child   = node.larger_cached;
+        oversized_block_descriptor& child_node = thrust::raw_reference_cast(*child);
+        node.larger_cached                     = child_node.smaller_cached;
+        child_node.smaller_cached              = root;
+        return child;
+      }
+    }
+
+    return root;
+  }
+
+  // joins two subtrees, all blocks of the first one ordered before all blocks of the second one
+  static oversized_block_descriptor_ptr
+  merge_cached(oversized_block_descriptor_ptr smaller, oversized_block_descriptor_ptr larger)
+  {
+    if (!::cuda::std::to_address(smaller))
+    {
+      return larger;
+    }
+    if (!::cuda::std::to_address(larger))
+    {
+      return smaller;
+    }
+
+    if (cached_priority(smaller) > cached_priority(larger))
+    {
+      oversized_block_descriptor& node = thrust::raw_reference_cast(*smaller);
+      node.larger_cached               = merge_cached(node.larger_cached, larger);
+      return smaller;
+    }
+
+    oversized_block_descriptor& node = thrust::raw_reference_cast(*larger);
+    node.smaller_cached              = merge_cached(smaller, node.smaller_cached);
+    return larger;
+  }
+
+  // removes a block from the subtree rooted at root, which must contain it, and returns the new root of that subtree
+  static oversized_block_descriptor_ptr
+  erase_cached(oversized_block_descriptor_ptr root, oversized_block_descriptor_ptr block, std::size_t size)
+  {
+    oversized_block_descriptor& node = thrust::raw_reference_cast(*root);
+    if (::cuda::std::to_address(root) == ::cuda::std::to_address(block))
+    {
+      return merge_cached(node.smaller_cached, node.larger_cached);
+    }
+
+    if (is_cached_before(size, block, node.size, root))
+    {
+      node.smaller_cached = erase_cached(node.smaller_cached, block, size);
+    }
+    else
+    {
+      node.larger_cached = erase_cached(node.larger_cached, block, size);
+    }
+
+    return root;
+  }
+
+  bool is_cached_fit(const oversized_block_descriptor& desc, std::size_t bytes, std::size_t alignment) const
+  {
+    // if the size or the alignment is bigger than the requested one by a factor
+    // bigger than or equal to the specified cutoff, allocate a new block instead
+    return desc.size >= bytes && desc.alignment >= alignment && desc.size / bytes < m_options.cached_size_cutoff_factor
+        && desc.alignment / alignment < m_options.cached_alignment_cutoff_factor;
+  }
+
+  // finds the smallest block in the subtree rooted at root that fits the request
+  oversized_block_descriptor_ptr
+  find_cached_oversized(oversized_block_descriptor_ptr root, std::size_t bytes, std::size_t alignment) const
+  {
+    if (!::cuda::std::to_address(root))
+    {
+      return oversized_block_descriptor_ptr();
+    }
+
+    oversized_block_descriptor desc = *root;
+    if (desc.size < bytes)
+    {
+      return find_cached_oversized(desc.larger_cached, bytes, alignment);
+    }
+
+    oversized_block_descriptor_ptr ptr = find_cached_oversized(desc.smaller_cached, bytes, alignment);
+    if (::cuda::std::to_address(ptr))
+    {
+      return ptr;
+    }
+
+    if (is_cached_fit(desc, bytes, alignment))
+    {
+      return root;
+    }
+
+    // everything to the right is at least as big as this block, and so too big as well
+    if (desc.size / bytes >= m_options.cached_size_cutoff_factor)
+    {
+      return oversized_block_descriptor_ptr();
+    }
+
+    // only blocks of insufficient alignment are skipped here
+    return find_cached_oversized(desc.larger_cached, bytes, alignment);
+  }
+
+  // finds a cached block fitting the request, preferring the smallest one
+  oversized_block_descriptor_ptr find_cached_oversized(std::size_t bytes, std::size_t alignment) const
+  {
+    return find_cached_oversized(m_cached_root, bytes, alignment);
+  }
+
+  // links a block into the cache; the block's descriptor is updated in place and
+  // read back into desc, so that the caller may still write desc back afterwards
+  void cache_oversized(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    desc.smaller_cached = oversized_block_descriptor_ptr();
+    desc.larger_cached  = oversized_block_descriptor_ptr();
+
+    desc.older_cached = m_newest_cached;
+    desc.newer_cached = oversized_block_descriptor_ptr();
+    if (::cuda::std::to_address(m_newest_cached))
+    {
+      thrust::raw_reference_cast(*m_newest_cached).newer_cached = block;
+    }
+    else
+    {
+      m_oldest_cached = block;
+    }
+    m_newest_cached = block;
+
+    *block        = desc;
+    m_cached_root = insert_cached(m_cached_root, block, desc.size);
+    desc          = *block;
+
+    m_cached_bytes += desc.size;
+  }
+
+  // unlinks a cached block from the cache; desc must hold the block's current
+  // descriptor, and the caller writes it back or releases the block
+  void uncache_oversized(oversized_block_descriptor_ptr block, oversized_block_descriptor& desc)
+  {
+    m_cached_root = erase_cached(m_cached_root, block, desc.size);
+
+    if (::cuda::std::to_address(desc.older_cached))
+    {
+      thrust::raw_reference_cast(*desc.older_cached).newer_cached = desc.newer_cached;
+    }
+    else
+    {
+      m_oldest_cached = desc.newer_cached;
+    }
+
+    if (::cuda::std::to_address(desc.newer_cached))
+    {
+      thrust::raw_reference_cast(*desc.newer_cached).older_cached = desc.older_cached;
+    }
+    else
+    {
+      m_newest_cached = desc.older_cached;
+    }
+
+    desc.smaller_cached = oversized_block_descriptor_ptr();
+    desc.larger_cached  = oversized_block_descriptor_ptr();
+    desc.older_cached   = oversized_block_descriptor_ptr();
+    desc.newer_cached   = oversized_block_descriptor_ptr();
+
+    m_cached_bytes -= desc.size;
+  }
+
+  // unlinks a block from the list of all oversized blocks and returns it to upstream
+  void free_oversized(oversized_block_descriptor_ptr block, const oversized_block_descriptor& desc)
+  {
+    if (::cuda::std::to_address(desc.prev))
+    {
+      thrust::raw_reference_cast(*desc.prev).next = desc.next;
+    }
+    else
+    {
+      m_oversized = desc.next;
+    }
+
+    if (::cuda::std::to_address(desc.next))
+    {
+      thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+    }
+
+    void_ptr p = static_cast<void_ptr>(static_cast<char_ptr>(static_cast<void_ptr>(block)) - desc.current_size);
+    m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+  }
+
+  // returns the least recently cached blocks to upstream until the cache is within its limit
+  void trim_cached_oversized()
+  {
+    while (m_cached_bytes > m_options.max_cached_bytes)
+    {
+      oversized_block_descriptor_ptr block = m_oldest_cached;
+      oversized_block_descriptor desc      = *block;
+
+      uncache_oversized(block, desc);
+      free_oversized(block, desc);
+    }
+  }
 
 public:
   /*! Releases all held memory to upstream.
@@ -241,7 +503,10 @@ public:
       m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
     }
 
-    m_cached_oversized = oversized_block_descriptor_ptr();
+    m_cached_root   = oversized_block_descriptor_ptr();
+    m_oldest_cached = oversized_block_descriptor_ptr();
+    m_newest_cached = oversized_block_descriptor_ptr();
+    m_cached_bytes  = 0;
   }
 
   [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
@@ -254,80 +519,38 @@ public:
     {
       if (m_options.cache_oversized)
       {
-        oversized_block_descriptor_ptr ptr       = m_cached_oversized;
-        oversized_block_descriptor_ptr* previous = &m_cached_oversized;
-        while (::cuda::std::to_address(ptr))
+        oversized_block_descriptor_ptr ptr = find_cached_oversized(bytes, alignment);
+        if (::cuda::std::to_address(ptr))
         {
           oversized_block_descriptor desc = *ptr;
-          bool is_good                    = desc.size >= bytes && desc.alignment >= alignment;
+          uncache_oversized(ptr, desc);
 
-          // if the size is bigger than the requested size by a factor
-          // bigger than or equal to the specified cutoff for size,
-          // allocate a new block
-          if (is_good)
-          {
-            std::size_t size_factor = desc.size / bytes;
-            if (size_factor >= m_options.cached_size_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+          auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
 
-          // if the alignment is bigger than the requested one by a factor
-          // bigger than or equal to the specified cutoff for alignment,
-          // allocate a new block
-          if (is_good)
+          if (bytes != desc.size)
           {
-            std::size_t alignment_factor = desc.alignment / alignment;
-            if (alignment_factor >= m_options.cached_alignment_cutoff_factor)
-            {
-              is_good = false;
-            }
-          }
+            desc.current_size = bytes;
 
-          if (is_good)
-          {
-            if (previous != &m_cached_oversized)
+            ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
+
+            if (::cuda::std::to_address(desc.prev))
             {
-              *previous = desc.next_cached;
+              thrust::raw_reference_cast(*desc.prev).next = ptr;
             }
             else
             {
-              m_cached_oversized = desc.next_cached;
+              m_oversized = ptr;
             }
 
-            desc.next_cached = oversized_block_descriptor_ptr();
-
-            auto ret = static_cast<char_ptr>(static_cast<void_ptr>(ptr)) - desc.size;
-
-            if (bytes != desc.size)
+            if (::cuda::std::to_address(desc.next))
             {
-              desc.current_size = bytes;
-
-              ptr = static_cast<oversized_block_descriptor_ptr>(static_cast<void_ptr>(ret + bytes));
-
-              if (::cuda::std::to_address(desc.prev))
-              {
-                thrust::raw_reference_cast(*desc.prev).next = ptr;
-              }
-              else
-              {
-                m_oversized = ptr;
-              }
-
-              if (::cuda::std::to_address(desc.next))
-              {
-                thrust::raw_reference_cast(*desc.next).prev = ptr;
-              }
+              thrust::raw_reference_cast(*desc.next).prev = ptr;
             }
-
-            *ptr = desc;
-
-            return static_cast<void_ptr>(ret);
           }
 
-          previous = &thrust::raw_reference_cast(*ptr).next_cached;
-          ptr      = *previous;
+          *ptr = desc;
+
+          return static_cast<void_ptr>(ret);
         }
       }
 
@@ -341,10 +564,13 @@ public:
       desc.alignment    = alignment;
       desc.prev         = oversized_block_descriptor_ptr();
       desc.next         = m_oversized;
-      desc.next_cached  = oversized_block_descriptor_ptr();
-      desc.current_size = bytes;
-      *block            = desc;
-      m_oversized       = block;
+      desc.smaller_cached = oversized_block_descriptor_ptr();
+      desc.larger_cached  = oversized_block_descriptor_ptr();
+      desc.older_cached   = oversized_block_descriptor_ptr();
+      desc.newer_cached   = oversized_block_descriptor_ptr();
+      desc.current_size   = bytes;
+      *block              = desc;
+      m_oversized         = block;
 
       if (::cuda::std::to_address(desc.next))
       {
@@ -439,12 +665,10 @@ public:
 
       oversized_block_descriptor desc = *block;
       assert(desc.current_size == n);
-      assert(desc.alignment == alignment);
+      assert(desc.alignment >= alignment);
 
       if (m_options.cache_oversized)
       {
-        desc.next_cached = m_cached_oversized;
-
         if (desc.size != n)
         {
           desc.current_size = desc.size;
@@ -465,27 +689,15 @@ public:
           }
         }
 
-        m_cached_oversized = block;
-        *block             = desc;
+        cache_oversized(block, desc);
+        *block = desc;
 
-        return;
-      }
+        trim_cached_oversized();
 
-      if (::cuda::std::to_address(desc.prev))
-      {
-        thrust::raw_reference_cast(*desc.prev).next = desc.next;
-      }
-      else
-      {
-        m_oversized = desc.next;
-      }
-
-      if (::cuda::std::to_address(desc.next))
-      {
-        thrust::raw_reference_cast(*desc.next).prev = desc.prev;
+        return;
       }
 
-      m_upstream->do_deallocate(p, desc.size + sizeof(oversized_block_descriptor), desc.alignment);
+      free_oversized(block, desc);
 
       return;
     }
@@ -23,6 +23,7 @@
 #include <cuda/__cmath/pow2.h>
 #include <cuda/__memory/is_valid_alignment.h>
 #include <cuda/std/cstddef>
+#include <cuda/std/limits>
 
 THRUST_NAMESPACE_BEGIN
 namespace mr
@@ -85,6 +86,12 @@ struct pool_options
    */
   std::size_t cached_alignment_cutoff_factor;
 
+  /*! The maximal number of bytes kept in cached oversized and overaligned blocks. Whenever caching a block makes the
+   *      cache exceed this limit, the least recently cached blocks are returned to the upstream resource until it fits
+   *      again. Currently only respected by \p unsynchronized_pool_resource and the resources built on top of it.
+   */
+  std::size_t max_cached_bytes = ::cuda::std::numeric_limits<std::size_t>::max();
+
   /*! Checks if the options are self-consistent.
    *
    *  /returns true if the options are self-consistent, false otherwise.
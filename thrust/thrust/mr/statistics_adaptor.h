@@ -0,0 +1,311 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file
+ *  \brief A memory resource adaptor which collects statistics of, and optionally traces, the allocations it forwards
+ *  to another memory resource.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/mr/memory_resource.h>
+#include <thrust/mr/validator.h>
+
+#include <cuda/__cmath/ilog.h>
+#include <cuda/std/climits>
+#include <cuda/std/cstddef>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+THRUST_NAMESPACE_BEGIN
+namespace mr
+{
+/** \addtogroup memory_resources Memory Resources
+ *  \ingroup memory_management
+ *  \{
+ */
+
+/*! A snapshot of the statistics collected by a \p statistics_adaptor_resource.
+ */
+struct allocation_statistics
+{
+  /*! The number of size classes; size class \p i counts the requests for more than <tt>2^(i-1)</tt> and at most
+   *      <tt>2^i</tt> bytes.
+   */
+  static constexpr std::size_t size_class_count = sizeof(std::size_t) * CHAR_BIT + 1;
+
+  /*! The number of successful allocations.
+   */
+  std::size_t allocations;
+  /*! The number of deallocations.
+   */
+  std::size_t deallocations;
+  /*! The number of allocations which threw.
+   */
+  std::size_t failed_allocations;
+
+  /*! The number of bytes currently allocated, i.e. allocated but not yet deallocated.
+   */
+  std::size_t current_bytes;
+  /*! The highest value \p current_bytes reached.
+   */
+  std::size_t peak_bytes;
+  /*! The number of bytes allocated in total.
+   */
+  std::size_t total_bytes;
+
+  /*! The number of successful allocations in every size class.
+   */
+  std::size_t size_class_allocations[size_class_count];
+
+  /*! Returns the size class of an allocation of the given size.
+   */
+  static constexpr std::size_t size_class(std::size_t bytes)
+  {
+    return bytes <= 1 ? 0 : static_cast<std::size_t>(::cuda::ceil_ilog2(bytes));
+  }
+
+  /*! Returns the fraction of the allocations described by this object which did not need to be served by an upstream
+   *      resource, given the statistics of an adaptor placed between a caching resource and its upstream resource.
+   *
+   *  \param upstream the statistics collected for the upstream resource of the resource described by this object
+   *  \return the cache hit rate, between 0 and 1; 0 if there were no allocations
+   */
+  double hit_rate(const allocation_statistics& upstream) const
+  {
+    if (allocations == 0 || upstream.allocations >= allocations)
+    {
+      return 0;
+    }
+
+    return static_cast<double>(allocations - upstream.allocations) / static_cast<double>(allocations);
+  }
+};
+
+/*! A single allocation or deallocation recorded by a \p statistics_adaptor_resource.
+ *
+ *  \tparam Pointer the pointer type of the resource
+ */
+template <typename Pointer>
+struct allocation_trace_entry
+{
+  /*! The position of this request among all the requests seen by the resource.
+   */
+  std::size_t sequence_number;
+  /*! Whether this is an allocation, as opposed to a deallocation.
+   */
+  bool is_allocation;
+  /*! The pointer allocated or deallocated.
+   */
+  Pointer pointer;
+  /*! The number of bytes requested.
+   */
+  std::size_t bytes;
+  /*! The alignment requested.
+   */
+  std::size_t alignment;
+};
+
+/*! A memory resource adaptor forwarding all requests to \p Upstream, while counting them.
+ *
+ *  The collected statistics include the number of allocations in power-of-two size classes, as well as the current and
+ * peak number of bytes allocated. Wrapping a pooling resource gives the distribution of requests it serves, while
+ * wrapping the upstream resource of a pooling resource counts the calls that pool makes to it; comparing the two with
+ * \p allocation_statistics::hit_rate gives the hit rate of the cache of the pool. The adaptor can also keep the most
+ * recent requests in a bounded trace.
+ *
+ *  Counters are updated atomically, so this adaptor can be used wherever \p Upstream can be used concurrently. To
+ * collect the statistics of resources of different types, wrap them in a \p polymorphic_adaptor_resource, or use
+ * \p memory_resource<Pointer> as \p Upstream.
+ *
+ *  \tparam Upstream the type of the memory resource the requests are forwarded to
+ */
+template <typename Upstream>
+class statistics_adaptor_resource final
+    : public memory_resource<typename Upstream::pointer>
+    , private validator<Upstream>
+{
+  using void_ptr = typename Upstream::pointer;
+
+public:
+  /*! The type of the recorded trace entries.
+   */
+  using trace_entry = allocation_trace_entry<void_ptr>;
+
+  /*! Constructor.
+   *
+   *  \param upstream the upstream memory resource for allocations
+   *  \param trace_capacity the number of the most recent requests to keep in the trace; \p 0 disables tracing
+   */
+  statistics_adaptor_resource(Upstream* upstream, std::size_t trace_capacity = 0)
+      : m_upstream(upstream)
+      , m_trace(trace_capacity)
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>, and no trace is
+   *  kept.
+   */
+  statistics_adaptor_resource()
+      : statistics_adaptor_resource(get_global_resource<Upstream>())
+  {}
+
+  /*! Constructor. The upstream resource is obtained by calling \p get_global_resource<Upstream>.
+   *
+   *  \param trace_capacity the number of the most recent requests to keep in the trace; \p 0 disables tracing
+   */
+  explicit statistics_adaptor_resource(std::size_t trace_capacity)
+      : statistics_adaptor_resource(get_global_resource<Upstream>(), trace_capacity)
+  {}
+
+  [[nodiscard]] void_ptr do_allocate(std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    void_ptr ret;
+
+    try
+    {
+      ret = m_upstream->do_allocate(bytes, alignment);
+    }
+    catch (...)
+    {
+      m_failed_allocations.fetch_add(1, std::memory_order_relaxed);
+      throw;
+    }
+
+    m_allocations.fetch_add(1, std::memory_order_relaxed);
+    m_size_class_allocations[allocation_statistics::size_class(bytes)].fetch_add(1, std::memory_order_relaxed);
+    m_total_bytes.fetch_add(bytes, std::memory_order_relaxed);
+
+    const std::size_t current = m_current_bytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    std::size_t peak          = m_peak_bytes.load(std::memory_order_relaxed);
+    while (peak < current && !m_peak_bytes.compare_exchange_weak(peak, current, std::memory_order_relaxed))
+    {
+    }
+
+    record(true, ret, bytes, alignment);
+
+    return ret;
+  }
+
+  void do_deallocate(void_ptr p, std::size_t bytes, std::size_t alignment = THRUST_MR_DEFAULT_ALIGNMENT) override
+  {
+    record(false, p, bytes, alignment);
+
+    m_deallocations.fetch_add(1, std::memory_order_relaxed);
+    m_current_bytes.fetch_sub(bytes, std::memory_order_relaxed);
+
+    m_upstream->do_deallocate(p, bytes, alignment);
+  }
+
+  /*! Returns a snapshot of the statistics collected so far. The snapshot is not atomic as a whole if other threads
+   *      use the resource at the same time.
+   */
+  allocation_statistics get_statistics() const
+  {
+    allocation_statistics ret;
+
+    ret.allocations        = m_allocations.load(std::memory_order_relaxed);
+    ret.deallocations      = m_deallocations.load(std::memory_order_relaxed);
+    ret.failed_allocations = m_failed_allocations.load(std::memory_order_relaxed);
+    ret.current_bytes      = m_current_bytes.load(std::memory_order_relaxed);
+    ret.peak_bytes         = m_peak_bytes.load(std::memory_order_relaxed);
+    ret.total_bytes        = m_total_bytes.load(std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < allocation_statistics::size_class_count; ++i)
+    {
+      ret.size_class_allocations[i] = m_size_class_allocations[i].load(std::memory_order_relaxed);
+    }
+
+    return ret;
+  }
+
+  /*! Resets all the statistics and the trace, except for the number of bytes currently allocated, which also becomes
+   *      the new peak.
+   */
+  void reset_statistics()
+  {
+    m_allocations.store(0, std::memory_order_relaxed);
+    m_deallocations.store(0, std::memory_order_relaxed);
+    m_failed_allocations.store(0, std::memory_order_relaxed);
+    m_peak_bytes.store(m_current_bytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    m_total_bytes.store(0, std::memory_order_relaxed);
+
+    for (std::size_t i = 0; i < allocation_statistics::size_class_count; ++i)
+    {
+      m_size_class_allocations[i].store(0, std::memory_order_relaxed);
+    }
+
+    std::lock_guard<std::mutex> lock(m_trace_mtx);
+    m_trace_count = 0;
+  }
+
+  /*! Returns the traced requests, from the oldest to the most recent one. At most as many requests as the trace
+   *      capacity given to the constructor are kept.
+   */
+  std::vector<trace_entry> get_trace() const
+  {
+    std::lock_guard<std::mutex> lock(m_trace_mtx);
+
+    const std::size_t capacity = m_trace.size();
+    const std::size_t size     = m_trace_count < capacity ? m_trace_count : capacity;
+
+    std::vector<trace_entry> ret;
+    ret.reserve(size);
+    for (std::size_t i = m_trace_count - size; i < m_trace_count; ++i)
+    {
+      ret.push_back(m_trace[i % capacity]);
+    }
+
+    return ret;
+  }
+
+private:
+  Upstream* m_upstream;
+
+  std::atomic<std::size_t> m_allocations{0};
+  std::atomic<std::size_t> m_deallocations{0};
+  std::atomic<std::size_t> m_failed_allocations{0};
+  std::atomic<std::size_t> m_current_bytes{0};
+  std::atomic<std::size_t> m_peak_bytes{0};
+  std::atomic<std::size_t> m_total_bytes{0};
+  std::atomic<std::size_t> m_size_class_allocations[allocation_statistics::size_class_count] = {};
+
+  // a ring buffer of the most recent requests; m_trace_count is the number of requests ever recorded
+  mutable std::mutex m_trace_mtx;
+  std::vector<trace_entry> m_trace;
+  std::size_t m_trace_count = 0;
+
+  void record(bool is_allocation, void_ptr p, std::size_t bytes, std::size_t alignment)
+  {
+    if (m_trace.empty())
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_trace_mtx);
+
+    trace_entry& entry    = m_trace[m_trace_count % m_trace.size()];
+    entry.sequence_number = m_trace_count;
+    entry.is_allocation   = is_allocation;
+    entry.pointer         = p;
+    entry.bytes           = bytes;
+    entry.alignment       = alignment;
+
+    ++m_trace_count;
+  }
+};
+
+/*! \} // memory_resources
+ */
+} // namespace mr
+THRUST_NAMESPACE_END
@@ -0,0 +1,143 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/generic/generate_random.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/__random/pcg_engine.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__random/philox_engine.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_const.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/remove_cv.h>
+#include <cuda/std/cstddef>
+#include <cuda/std/cstdint>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::generic
+{
+// the number of values of every block of generate_random, which are drawn from one substream of the engine
+inline constexpr ::cuda::std::size_t generate_random_block_size = 4096;
+
+// Engines that discard values in constant or logarithmic time, whose blocks of generate_random are generated in
+// parallel. stride is the distance between the starts of the substreams of consecutive blocks, which must exceed the
+// number of values the distribution consumes for a block. Engines with a short period, like minstd_rand, are not
+// listed: their substreams would wrap around onto each other for large inputs, so they generate the values in order.
+template <typename RandomEngine>
+struct random_substreams
+{
+  static constexpr bool value = false;
+};
+
+template <typename UIntType, ::cuda::std::size_t w, ::cuda::std::size_t n, ::cuda::std::size_t r, UIntType... consts>
+struct random_substreams<::cuda::std::philox_engine<UIntType, w, n, r, consts...>>
+{
+  static constexpr bool value                = true;
+  static constexpr unsigned long long stride = 1ull << 32;
+};
+
+template <::cuda::std::uint64_t a_hi,
+          ::cuda::std::uint64_t a_lo,
+          ::cuda::std::uint64_t c_hi,
+          ::cuda::std::uint64_t c_lo>
+struct random_substreams<::cuda::pcg64_engine<a_hi, a_lo, c_hi, c_lo>>
+{
+  static constexpr bool value                = true;
+  static constexpr unsigned long long stride = 1ull << 32;
+};
+
+template <typename RandomIterator, typename Size, typename RandomEngine, typename Distribution>
+struct generate_random_block
+{
+  RandomIterator first;
+  Size n;
+  RandomEngine engine;
+  Distribution distribution;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  _CCCL_HOST_DEVICE void operator()(Size block) const
+  {
+    const Size block_size = static_cast<Size>(generate_random_block_size);
+    const Size begin      = block * block_size;
+    const Size count      = (::cuda::std::min) (block_size, n - begin);
+
+    // every block starts at its own substream, and from the initial state of the distribution
+    RandomEngine block_engine = engine;
+    block_engine.discard(static_cast<unsigned long long>(block) * random_substreams<RandomEngine>::stride);
+
+    Distribution block_distribution = distribution;
+    block_distribution.reset();
+
+    RandomIterator iter = first + begin;
+    for (Size i = 0; i < count; ++i, ++iter)
+    {
+      *iter = block_distribution(block_engine);
+    }
+  }
+};
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename DerivedPolicy, typename ForwardIterator, typename RandomEngine, typename Distribution>
+_CCCL_HOST_DEVICE void generate_random(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ForwardIterator first,
+  ForwardIterator last,
+  RandomEngine& engine,
+  Distribution& distribution)
+{
+  using engine_type       = ::cuda::std::remove_cv_t<RandomEngine>;
+  using distribution_type = ::cuda::std::remove_cv_t<Distribution>;
+  using traversal         = typename thrust::iterator_traversal<ForwardIterator>::type;
+
+  if constexpr (random_substreams<engine_type>::value
+                && ::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+    const Size n = ::cuda::std::distance(first, last);
+    if (n <= 0)
+    {
+      return;
+    }
+
+    // the blocks have a fixed size, so the values do not depend on how they are distributed among threads
+    const Size num_blocks = ::cuda::ceil_div(n, static_cast<Size>(generate_random_block_size));
+
+    thrust::for_each_n(
+      exec,
+      thrust::counting_iterator<Size>(0),
+      num_blocks,
+      generate_random_block<ForwardIterator, Size, engine_type, distribution_type>{first, n, engine, distribution});
+
+    engine.discard(static_cast<unsigned long long>(num_blocks) * random_substreams<engine_type>::stride);
+  }
+  else
+  {
+    // a const distribution generates the values through a copy
+    ::cuda::std::conditional_t<::cuda::std::is_const_v<Distribution>, distribution_type, Distribution&>
+      sequential_distribution = distribution;
+    for (; first != last; ++first)
+    {
+      *first = sequential_distribution(engine);
+    }
+  }
+}
+} // namespace system::detail::generic
+THRUST_NAMESPACE_END
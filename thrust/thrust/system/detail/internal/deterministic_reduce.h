@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file deterministic_reduce.h
+ *  \brief Reduction whose result does not depend on the number of threads, shared by the CPU-parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/rfa.h>
+#include <thrust/detail/temporary_array.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__functional/operations.h>
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// the number of elements of every block of a deterministic reduction, which fixes the association of the operator
+inline constexpr ::cuda::std::size_t deterministic_block_size = ::cuda::std::size_t{1} << 14;
+
+// whether a reduction is a sum of float or double, which can be accumulated reproducibly
+template <typename OutputType, typename BinaryFunction>
+inline constexpr bool is_floating_point_sum_v =
+  (::cuda::std::is_same_v<OutputType, float> || ::cuda::std::is_same_v<OutputType, double>)
+  && (::cuda::std::is_same_v<BinaryFunction, ::cuda::std::plus<OutputType>>
+      || ::cuda::std::is_same_v<BinaryFunction, ::cuda::std::plus<>>);
+
+// Reduces [first, first + n) to binary_op(init, sum), where the input is folded in blocks of
+// deterministic_block_size elements and the block sums are folded in order, so the result does
+// not depend on the number of threads. With reproducible_sum, sums of float or double are
+// accumulated with a ReproducibleFloatingAccumulator instead, which makes them independent of
+// the order of the elements and equal to the deterministic sums of the CUDA backend.
+// parallel_for(num_blocks, f) must invoke f(block) for every block, potentially concurrently.
+template <typename DerivedPolicy,
+          typename ParallelFor,
+          typename InputIterator,
+          typename Size,
+          typename OutputType,
+          typename BinaryFunction>
+OutputType deterministic_reduce(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  bool reproducible_sum,
+  InputIterator first,
+  Size n,
+  OutputType init,
+  BinaryFunction binary_op)
+{
+  if (n <= 0)
+  {
+    return init;
+  }
+
+  const Size block_size = static_cast<Size>(deterministic_block_size);
+  const Size num_blocks = ::cuda::ceil_div(n, block_size);
+
+  if constexpr (is_floating_point_sum_v<OutputType, BinaryFunction>)
+  {
+    if (reproducible_sum)
+    {
+      using accumulator = thrust::detail::rfa::ReproducibleFloatingAccumulator<OutputType>;
+
+      // at most the endurance of an accumulator of floats, so every batch is renormalized once
+      constexpr int batch_size = 512;
+
+      thrust::detail::temporary_array<accumulator, DerivedPolicy> partials(exec, num_blocks);
+      accumulator* partial = thrust::raw_pointer_cast(partials.data());
+
+      parallel_for(num_blocks, [&](Size block) {
+        const Size begin = block * block_size;
+        const Size end   = (::cuda::std::min) (begin + block_size, n);
+
+        // the values are converted into a buffer, which the accumulator consumes in vectorizable loops
+        OutputType buffer[batch_size];
+        accumulator sum;
+
+        for (Size i = begin; i < end; i += batch_size)
+        {
+          const int count = static_cast<int>((::cuda::std::min) (end - i, static_cast<Size>(batch_size)));
+
+          for (int j = 0; j < count; ++j)
+          {
+            buffer[j] = static_cast<OutputType>(thrust::raw_reference_cast(first[i + j]));
+          }
+
+          sum.add(buffer, count);
+        }
+
+        partial[block] = sum;
+      });
+
+      accumulator total = partial[0];
+      for (Size block = 1; block < num_blocks; ++block)
+      {
+        total += partial[block];
+      }
+
+      return binary_op(init, total.conv_to_fp());
+    }
+  }
+
+  thrust::detail::wrapped_function<BinaryFunction, OutputType> wrapped_binary_op{binary_op};
+
+  thrust::detail::temporary_array<OutputType, DerivedPolicy> partials(exec, num_blocks);
+  OutputType* partial = thrust::raw_pointer_cast(partials.data());
+
+  parallel_for(num_blocks, [&](Size block) {
+    const Size begin = block * block_size;
+    const Size end   = (::cuda::std::min) (begin + block_size, n);
+
+    InputIterator iter = first + begin;
+    OutputType sum     = thrust::raw_reference_cast(*iter);
+
+    for (Size i = begin + 1; i < end; ++i)
+    {
+      ++iter;
+      sum = wrapped_binary_op(sum, *iter);
+    }
+
+    partial[block] = sum;
+  });
+
+  OutputType result = init;
+  for (Size block = 0; block < num_blocks; ++block)
+  {
+    result = wrapped_binary_op(result, partial[block]);
+  }
+
+  return result;
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
@@ -0,0 +1,150 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file merge_path.h
+ *  \brief Merge-path (co-rank) partitioning shared by the CPU-parallel
+ *         merge and set operation implementations.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/binary_search.h>
+#include <thrust/detail/function.h>
+#include <thrust/detail/raw_reference_cast.h>
+#include <thrust/detail/seq.h>
+#include <thrust/system/detail/sequential/set_operations.h>
+
+#include <cuda/std/__utility/pair.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+// Returns the number of elements of [first1, first1 + n1) among the first diag
+// elements of the stable merge of [first1, first1 + n1) and [first2, first2 + n2).
+// Ties are broken in favor of the first range, as in sequential::merge.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+Size merge_path(
+  RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size lo = diag > n2 ? diag - n2 : Size(0);
+  Size hi = diag < n1 ? diag : n1;
+
+  while (lo < hi)
+  {
+    Size mid = lo + (hi - lo) / 2;
+
+    if (wrapped_comp(first2[diag - 1 - mid], first1[mid]))
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  return lo;
+}
+
+// Like merge_path, but moves the split back to the start of the run of elements
+// equivalent to the next merged element, in both ranges. Partitions produced this
+// way never separate equivalent elements, so set operations can process each of
+// them independently and concatenate the results.
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename Size, typename StrictWeakOrdering>
+::cuda::std::pair<Size, Size> set_operation_partition(
+  RandomAccessIterator1 first1, Size n1, RandomAccessIterator2 first2, Size n2, Size diag, StrictWeakOrdering comp)
+{
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  Size i = merge_path(first1, n1, first2, n2, diag, comp);
+  Size j = diag - i;
+
+  if (i < n1 && (j == n2 || !wrapped_comp(first2[j], first1[i])))
+  {
+    RandomAccessIterator1 pivot = first1 + i;
+    i = thrust::lower_bound(thrust::seq, first1, pivot, raw_reference_cast(*pivot), comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, first2 + j, raw_reference_cast(*pivot), comp) - first2;
+  }
+  else if (j < n2)
+  {
+    RandomAccessIterator2 pivot = first2 + j;
+    i = thrust::lower_bound(thrust::seq, first1, first1 + i, raw_reference_cast(*pivot), comp) - first1;
+    j = thrust::lower_bound(thrust::seq, first2, pivot, raw_reference_cast(*pivot), comp) - first2;
+  }
+
+  return ::cuda::std::make_pair(i, j);
+}
+
+// Sequential workers applied to each partition by the parallel set operations.
+struct serial_set_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    thrust::detail::seq_t seq;
+    return system::detail::sequential::set_difference(seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_intersection
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    thrust::detail::seq_t seq;
+    return system::detail::sequential::set_intersection(seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_symmetric_difference
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    thrust::detail::seq_t seq;
+    return system::detail::sequential::set_symmetric_difference(seq, first1, last1, first2, last2, result, comp);
+  }
+};
+
+struct serial_set_union
+{
+  template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename StrictWeakOrdering>
+  OutputIterator operator()(InputIterator1 first1,
+                            InputIterator1 last1,
+                            InputIterator2 first2,
+                            InputIterator2 last2,
+                            OutputIterator result,
+                            StrictWeakOrdering comp) const
+  {
+    thrust::detail::seq_t seq;
+    return system::detail::sequential::set_union(seq, first1, last1, first2, last2, result, comp);
+  }
+};
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
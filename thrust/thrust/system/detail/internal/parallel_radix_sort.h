@@ -0,0 +1,313 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file parallel_radix_sort.h
+ *  \brief LSD radix sort of arithmetic keys shared by the CPU-parallel backends.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+#include <thrust/detail/raw_pointer_cast.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/sequential/stable_radix_sort.h>
+
+#include <cuda/std/__type_traits/is_same.h>
+#include <cuda/std/__utility/declval.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::internal
+{
+namespace radix_sort_detail
+{
+inline constexpr unsigned int radix_bits = 8;
+inline constexpr size_t num_buckets      = size_t{1} << radix_bits;
+
+// the number of elements staged per bucket before they are written out together
+inline constexpr size_t write_combining_size = 16;
+
+// marks a keys-only sort
+struct no_values
+{};
+
+// the value type staged and buffered alongside the keys; keys-only sorts stage keys in its place
+template <typename ValueIterator, typename KeyType>
+struct staged_value
+{
+  using type = thrust::detail::it_value_t<ValueIterator>;
+};
+
+template <typename KeyType>
+struct staged_value<no_values, KeyType>
+{
+  using type = KeyType;
+};
+
+// extracts the digit of a key at the given bit offset; descending sorts simply invert the digit
+template <typename KeyType, bool Descending>
+struct digit_functor
+{
+  using Encoder     = sequential::radix_sort_detail::RadixEncoder<KeyType>;
+  using EncodedType = decltype(::cuda::std::declval<Encoder>()(::cuda::std::declval<KeyType>()));
+
+  unsigned int bit_shift;
+
+  size_t operator()(KeyType key) const
+  {
+    const size_t digit = static_cast<size_t>((Encoder{}(key) >> bit_shift) & static_cast<EncodedType>(num_buckets - 1));
+
+    return Descending ? num_buckets - 1 - digit : digit;
+  }
+};
+
+// scatters one tile of keys (and values) to the offsets of its buckets, staging them in write-combining slots
+template <bool HasValues,
+          typename DigitFunctor,
+          typename KeyIterator1,
+          typename ValueIterator1,
+          typename KeyIterator2,
+          typename ValueIterator2,
+          typename KeyType,
+          typename ValueType,
+          typename Size>
+void scatter_tile(
+  DigitFunctor digit,
+  KeyIterator1 keys_src,
+  ValueIterator1 values_src,
+  KeyIterator2 keys_dst,
+  ValueIterator2 values_dst,
+  KeyType* key_slots,
+  ValueType* value_slots,
+  Size* offsets,
+  Size begin,
+  Size end)
+{
+  size_t counts[num_buckets] = {};
+
+  for (Size i = begin; i < end; ++i)
+  {
+    const KeyType key = keys_src[i];
+    const size_t b    = digit(key);
+    const size_t slot = b * write_combining_size + counts[b];
+
+    key_slots[slot] = key;
+
+    if constexpr (HasValues)
+    {
+      value_slots[slot] = values_src[i];
+    }
+
+    // write out the bucket's slots once they are full
+    if (++counts[b] == write_combining_size)
+    {
+      const size_t first = b * write_combining_size;
+
+      for (size_t j = 0; j < write_combining_size; ++j)
+      {
+        keys_dst[offsets[b] + j] = key_slots[first + j];
+
+        if constexpr (HasValues)
+        {
+          values_dst[offsets[b] + j] = value_slots[first + j];
+        }
+      }
+
+      offsets[b] += write_combining_size;
+      counts[b] = 0;
+    }
+  }
+
+  // flush the partially filled slots
+  for (size_t b = 0; b < num_buckets; ++b)
+  {
+    for (size_t j = 0; j < counts[b]; ++j)
+    {
+      keys_dst[offsets[b] + j] = key_slots[b * write_combining_size + j];
+
+      if constexpr (HasValues)
+      {
+        values_dst[offsets[b] + j] = value_slots[b * write_combining_size + j];
+      }
+    }
+  }
+}
+
+// counts the digits of one tile into its histogram
+template <typename DigitFunctor, typename KeyIterator, typename Size>
+void count_tile(DigitFunctor digit, KeyIterator keys, Size* histogram, Size begin, Size end)
+{
+  for (size_t b = 0; b < num_buckets; ++b)
+  {
+    histogram[b] = 0;
+  }
+
+  for (Size i = begin; i < end; ++i)
+  {
+    ++histogram[digit(keys[i])];
+  }
+}
+} // namespace radix_sort_detail
+
+// Stably sorts [keys_first, keys_first + n) (and permutes values_first alongside unless it is
+// radix_sort_detail::no_values) with one counting and one scattering pass per 8-bit digit.
+// The input is split into num_tiles tiles and parallel_for(num_tiles, f) must invoke f(tile)
+// for every tile, potentially concurrently.
+template <bool Descending,
+          typename DerivedPolicy,
+          typename ParallelFor,
+          typename KeyIterator,
+          typename ValueIterator,
+          typename Size>
+void parallel_radix_sort(
+  thrust::execution_policy<DerivedPolicy>& exec,
+  ParallelFor parallel_for,
+  Size num_tiles,
+  KeyIterator keys_first,
+  ValueIterator values_first,
+  Size n)
+{
+  using namespace radix_sort_detail;
+
+  using KeyType = thrust::detail::it_value_t<KeyIterator>;
+
+  constexpr bool has_values = !::cuda::std::is_same_v<ValueIterator, no_values>;
+
+  using ValueType = typename staged_value<ValueIterator, KeyType>::type;
+
+  using EncodedType = typename digit_functor<KeyType, Descending>::EncodedType;
+
+  constexpr unsigned int num_passes = (8 * sizeof(EncodedType) + radix_bits - 1) / radix_bits;
+
+  uniform_decomposition<Size> decomp(n, 1, num_tiles);
+  num_tiles = decomp.size();
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> keys_buffer(exec, n);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> values_buffer(exec, has_values ? n : 0);
+
+  // write-combining slots for every bucket of every tile
+  const Size slots_per_tile = static_cast<Size>(num_buckets * write_combining_size);
+
+  thrust::detail::temporary_array<KeyType, DerivedPolicy> key_slots(exec, num_tiles * slots_per_tile);
+  thrust::detail::temporary_array<ValueType, DerivedPolicy> value_slots(
+    exec, has_values ? num_tiles * slots_per_tile : 0);
+
+  // one histogram per tile, scanned in place into the tile's output offsets
+  thrust::detail::temporary_array<Size, DerivedPolicy> histograms(exec, num_tiles * num_buckets);
+
+  KeyType* keys_tmp     = thrust::raw_pointer_cast(keys_buffer.data());
+  ValueType* values_tmp = thrust::raw_pointer_cast(values_buffer.data());
+  Size* hist            = thrust::raw_pointer_cast(histograms.data());
+
+  // false if the most recent data is stored in (keys_first, values_first)
+  bool flip = false;
+
+  for (unsigned int pass = 0; pass < num_passes; ++pass)
+  {
+    const digit_functor<KeyType, Descending> digit{pass * radix_bits};
+
+    // count the digits of every tile
+    parallel_for(num_tiles, [&](Size tile) {
+      if (flip)
+      {
+        count_tile(digit, keys_tmp, hist + tile * num_buckets, decomp[tile].begin(), decomp[tile].end());
+      }
+      else
+      {
+        count_tile(digit, keys_first, hist + tile * num_buckets, decomp[tile].begin(), decomp[tile].end());
+      }
+    });
+
+    // scan the histograms in bucket-major, tile-minor order; this is only num_buckets * num_tiles
+    // elements so a serial scan is cheaper than another parallel phase
+    bool skip_pass = false;
+    Size sum       = 0;
+
+    for (size_t b = 0; b < num_buckets; ++b)
+    {
+      Size bucket_total = 0;
+
+      for (Size tile = 0; tile < num_tiles; ++tile)
+      {
+        const Size count             = hist[tile * num_buckets + b];
+        hist[tile * num_buckets + b] = sum + bucket_total;
+        bucket_total += count;
+      }
+
+      // every key has the same digit, so this pass would not move anything
+      skip_pass = skip_pass || bucket_total == n;
+      sum += bucket_total;
+    }
+
+    if (skip_pass)
+    {
+      continue;
+    }
+
+    // scatter every tile into its buckets
+    parallel_for(num_tiles, [&](Size tile) {
+      KeyType* tile_key_slots     = thrust::raw_pointer_cast(key_slots.data()) + tile * slots_per_tile;
+      ValueType* tile_value_slots = thrust::raw_pointer_cast(value_slots.data()) + tile * slots_per_tile;
+      Size* offsets               = hist + tile * num_buckets;
+
+      if (flip)
+      {
+        scatter_tile<has_values>(
+          digit,
+          keys_tmp,
+          values_tmp,
+          keys_first,
+          values_first,
+          tile_key_slots,
+          tile_value_slots,
+          offsets,
+          decomp[tile].begin(),
+          decomp[tile].end());
+      }
+      else
+      {
+        scatter_tile<has_values>(
+          digit,
+          keys_first,
+          values_first,
+          keys_tmp,
+          values_tmp,
+          tile_key_slots,
+          tile_value_slots,
+          offsets,
+          decomp[tile].begin(),
+          decomp[tile].end());
+      }
+    });
+
+    flip = !flip;
+  }
+
+  // ensure final values are in (keys_first, values_first)
+  if (flip)
+  {
+    parallel_for(num_tiles, [&](Size tile) {
+      for (Size i = decomp[tile].begin(); i < decomp[tile].end(); ++i)
+      {
+        keys_first[i] = keys_tmp[i];
+
+        if constexpr (has_values)
+        {
+          values_first[i] = values_tmp[i];
+        }
+      }
+    });
+  }
+}
+} // namespace system::detail::internal
+THRUST_NAMESPACE_END
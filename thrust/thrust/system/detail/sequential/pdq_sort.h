@@ -0,0 +1,620 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+/*! \file pdq_sort.h
+ *  \brief In-place unstable sort based on pattern-defeating quicksort.
+ *
+ *  This is an adaptation of Orson Peters' pdqsort (https://github.com/orlp/pdqsort), which in turn uses the block
+ *  partitioning of "BlockQuicksort: How Branch Mispredictions don't affect Quicksort" by Edelkamp and Weiss.
+ *  Unlike the reference implementation, the partitions are processed with a bounded explicit stack instead of
+ *  recursion, so that the sort does not need a dynamically sized stack when it runs in a CUDA thread.
+ */
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/function.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/tuple.h>
+
+#include <cuda/std/__type_traits/is_trivially_copyable.h>
+#include <cuda/std/__utility/move.h>
+#include <cuda/std/cstddef>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::detail::sequential
+{
+namespace pdq_sort_detail
+{
+// partitions below this size are insertion sorted
+inline constexpr ::cuda::std::ptrdiff_t insertion_sort_threshold = 24;
+
+// partitions above this size use Tukey's ninther to select the pivot
+inline constexpr ::cuda::std::ptrdiff_t ninther_threshold = 128;
+
+// number of element moves after which partial_insertion_sort gives up
+inline constexpr ::cuda::std::ptrdiff_t partial_insertion_sort_limit = 8;
+
+// elements classified at once by the branchless partitioning, offsets in a block have to fit into an unsigned char
+inline constexpr ::cuda::std::size_t block_size = 64;
+
+// every pending partition on the stack is at most half as large as the one below it
+inline constexpr int max_stack_depth = 64;
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator1, typename RandomAccessIterator2>
+_CCCL_HOST_DEVICE void swap_values(RandomAccessIterator1 a, RandomAccessIterator2 b)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  value_type tmp = ::cuda::std::move(*a);
+  *a             = ::cuda::std::move(*b);
+  *b             = ::cuda::std::move(tmp);
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort2(RandomAccessIterator a, RandomAccessIterator b, StrictWeakOrdering& comp)
+{
+  if (comp(*b, *a))
+  {
+    swap_values(a, b);
+  }
+}
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void
+sort3(RandomAccessIterator a, RandomAccessIterator b, RandomAccessIterator c, StrictWeakOrdering& comp)
+{
+  sort2(a, b, comp);
+  sort2(b, c, comp);
+  sort2(a, b, comp);
+}
+
+// insertion sort of [first, last), which does not check the lower bound when *(first - 1) is not greater than any
+// element of the range
+_CCCL_EXEC_CHECK_DISABLE
+template <bool Unguarded, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  if (first == last)
+  {
+    return;
+  }
+
+  for (RandomAccessIterator i = first + 1; i != last; ++i)
+  {
+    RandomAccessIterator j = i;
+    RandomAccessIterator k = i - 1;
+
+    if (comp(*j, *k))
+    {
+      value_type tmp = ::cuda::std::move(*j);
+
+      do
+      {
+        *j = ::cuda::std::move(*k);
+        --j;
+      } while ((Unguarded || j != first) && comp(tmp, *--k));
+
+      *j = ::cuda::std::move(tmp);
+    }
+  }
+}
+
+// insertion sort of [first, last) that gives up and returns false after a few moves, so that already sorted
+// partitions are detected in linear time
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE bool
+partial_insertion_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  if (first == last)
+  {
+    return true;
+  }
+
+  ::cuda::std::ptrdiff_t moves = 0;
+
+  for (RandomAccessIterator i = first + 1; i != last; ++i)
+  {
+    RandomAccessIterator j = i;
+    RandomAccessIterator k = i - 1;
+
+    if (comp(*j, *k))
+    {
+      value_type tmp = ::cuda::std::move(*j);
+
+      do
+      {
+        *j = ::cuda::std::move(*k);
+        --j;
+      } while (j != first && comp(tmp, *--k));
+
+      *j = ::cuda::std::move(tmp);
+      moves += i - j;
+    }
+
+    if (moves > partial_insertion_sort_limit)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename Size, typename T, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sift_down(RandomAccessIterator first, Size n, Size hole, T& value, StrictWeakOrdering& comp)
+{
+  for (Size child = 2 * hole + 1; child < n; child = 2 * hole + 1)
+  {
+    if (child + 1 < n && comp(first[child], first[child + 1]))
+    {
+      ++child;
+    }
+
+    if (!comp(value, first[child]))
+    {
+      break;
+    }
+
+    first[hole] = ::cuda::std::move(first[child]);
+    hole        = child;
+  }
+
+  first[hole] = ::cuda::std::move(value);
+}
+
+// fallback which bounds the run time of adversarial inputs to O(n log n)
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void heap_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using value_type      = thrust::detail::it_value_t<RandomAccessIterator>;
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  difference_type n = last - first;
+
+  for (difference_type i = n / 2; i > 0;)
+  {
+    --i;
+    value_type tmp = ::cuda::std::move(first[i]);
+    sift_down(first, n, i, tmp, comp);
+  }
+
+  while (n > 1)
+  {
+    --n;
+    value_type tmp = ::cuda::std::move(first[n]);
+    first[n]       = ::cuda::std::move(first[0]);
+    sift_down(first, n, difference_type{0}, tmp, comp);
+  }
+}
+
+template <typename RandomAccessIterator>
+struct partition_result
+{
+  RandomAccessIterator pivot;
+  bool already_partitioned;
+};
+
+// moves the elements at the offsets of a left and a right block across the pivot
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator>
+_CCCL_HOST_DEVICE void swap_offsets(
+  RandomAccessIterator first,
+  RandomAccessIterator last,
+  const unsigned char* offsets_l,
+  const unsigned char* offsets_r,
+  ::cuda::std::size_t num,
+  bool use_swaps)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  if (use_swaps)
+  {
+    // pairwise swaps keep descending inputs linear
+    for (::cuda::std::size_t i = 0; i < num; ++i)
+    {
+      swap_values(first + offsets_l[i], last - offsets_r[i]);
+    }
+  }
+  else if (num > 0)
+  {
+    // a cyclic permutation needs fewer moves than the swaps
+    RandomAccessIterator l = first + offsets_l[0];
+    RandomAccessIterator r = last - offsets_r[0];
+    value_type tmp         = ::cuda::std::move(*l);
+    *l                     = ::cuda::std::move(*r);
+    for (::cuda::std::size_t i = 1; i < num; ++i)
+    {
+      l  = first + offsets_l[i];
+      *r = ::cuda::std::move(*l);
+      r  = last - offsets_r[i];
+      *l = ::cuda::std::move(*r);
+    }
+    *r = ::cuda::std::move(tmp);
+  }
+}
+
+// partitions [first, last) around the pivot *first, so that the elements equal to the pivot end up in the right
+// partition. Requires a median of three or more to have been moved to *first.
+_CCCL_EXEC_CHECK_DISABLE
+template <bool Branchless, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE partition_result<RandomAccessIterator>
+partition_right(RandomAccessIterator begin, RandomAccessIterator end, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  value_type pivot = ::cuda::std::move(*begin);
+
+  RandomAccessIterator first = begin;
+  RandomAccessIterator last  = end;
+
+  // the median of three guarantees that an element not less than the pivot exists, which bounds this search
+  while (comp(*++first, pivot))
+    ;
+
+  // without an element less than the pivot to the left of first, the right search has to be bounded
+  if (first - 1 == begin)
+  {
+    while (first < last && !comp(*--last, pivot))
+      ;
+  }
+  else
+  {
+    while (!comp(*--last, pivot))
+      ;
+  }
+
+  // no swaps are needed if the searches met
+  const bool already_partitioned = first >= last;
+
+  if constexpr (Branchless)
+  {
+    if (!already_partitioned)
+    {
+      swap_values(first, last);
+      ++first;
+
+      // elements on the wrong side are recorded as offsets from the block bases without data dependent branches
+      unsigned char offsets_l[block_size];
+      unsigned char offsets_r[block_size];
+
+      RandomAccessIterator offsets_l_base = first;
+      RandomAccessIterator offsets_r_base = last;
+      ::cuda::std::size_t num_l           = 0;
+      ::cuda::std::size_t num_r           = 0;
+      ::cuda::std::size_t start_l         = 0;
+      ::cuda::std::size_t start_r         = 0;
+
+      while (first < last)
+      {
+        // split the unclassified elements between the blocks that are empty
+        const auto num_unknown               = static_cast<::cuda::std::size_t>(last - first);
+        const ::cuda::std::size_t left_split = num_l == 0 ? (num_r == 0 ? num_unknown / 2 : num_unknown) : 0;
+        const ::cuda::std::size_t right_split = num_r == 0 ? (num_unknown - left_split) : 0;
+
+        const ::cuda::std::size_t left_count = left_split < block_size ? left_split : block_size;
+        for (::cuda::std::size_t i = 0; i < left_count; ++i)
+        {
+          offsets_l[num_l] = static_cast<unsigned char>(i);
+          num_l += !comp(*first, pivot);
+          ++first;
+        }
+
+        const ::cuda::std::size_t right_count = right_split < block_size ? right_split : block_size;
+        for (::cuda::std::size_t i = 1; i <= right_count; ++i)
+        {
+          offsets_r[num_r] = static_cast<unsigned char>(i);
+          num_r += comp(*--last, pivot);
+        }
+
+        const ::cuda::std::size_t num = num_l < num_r ? num_l : num_r;
+        swap_offsets(offsets_l_base, offsets_r_base, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+        num_l -= num;
+        num_r -= num;
+        start_l += num;
+        start_r += num;
+
+        if (num_l == 0)
+        {
+          start_l        = 0;
+          offsets_l_base = first;
+        }
+
+        if (num_r == 0)
+        {
+          start_r        = 0;
+          offsets_r_base = last;
+        }
+      }
+
+      // at most one block has elements left, which are swapped to the boundary
+      while (num_l > 0)
+      {
+        --num_l;
+        swap_values(offsets_l_base + offsets_l[start_l + num_l], --last);
+        first = last;
+      }
+
+      while (num_r > 0)
+      {
+        --num_r;
+        swap_values(offsets_r_base - offsets_r[start_r + num_r], first);
+        ++first;
+        last = first;
+      }
+    }
+  }
+  else
+  {
+    while (first < last)
+    {
+      swap_values(first, last);
+      while (comp(*++first, pivot))
+        ;
+      while (!comp(*--last, pivot))
+        ;
+    }
+  }
+
+  RandomAccessIterator pivot_pos = first - 1;
+  *begin                         = ::cuda::std::move(*pivot_pos);
+  *pivot_pos                     = ::cuda::std::move(pivot);
+
+  return {pivot_pos, already_partitioned};
+}
+
+// partitions [first, last) around the pivot *first, so that the elements equal to the pivot end up in the left
+// partition. Used when *(first - 1) equals the pivot, in which case the left partition needs no further sorting.
+_CCCL_EXEC_CHECK_DISABLE
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE RandomAccessIterator
+partition_left(RandomAccessIterator begin, RandomAccessIterator end, StrictWeakOrdering& comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  value_type pivot = ::cuda::std::move(*begin);
+
+  RandomAccessIterator first = begin;
+  RandomAccessIterator last  = end;
+
+  while (comp(pivot, *--last))
+    ;
+
+  if (last + 1 == end)
+  {
+    while (first < last && !comp(pivot, *++first))
+      ;
+  }
+  else
+  {
+    while (!comp(pivot, *++first))
+      ;
+  }
+
+  while (first < last)
+  {
+    swap_values(first, last);
+    while (comp(pivot, *--last))
+      ;
+    while (!comp(pivot, *++first))
+      ;
+  }
+
+  *begin = ::cuda::std::move(*last);
+  *last  = ::cuda::std::move(pivot);
+
+  return last;
+}
+
+// scatters a few elements of a partition to break up patterns that led to an unbalanced partitioning
+template <typename RandomAccessIterator, typename Size>
+_CCCL_HOST_DEVICE void break_patterns(RandomAccessIterator first, RandomAccessIterator last, Size size)
+{
+  if (size >= insertion_sort_threshold)
+  {
+    swap_values(first, first + size / 4);
+    swap_values(last - 1, last - size / 4);
+
+    if (size > ninther_threshold)
+    {
+      swap_values(first + 1, first + (size / 4 + 1));
+      swap_values(first + 2, first + (size / 4 + 2));
+      swap_values(last - 2, last - (size / 4 + 1));
+      swap_values(last - 3, last - (size / 4 + 2));
+    }
+  }
+}
+
+// stores offsets instead of iterators, which need not be default constructible
+template <typename Size>
+struct pending_partition
+{
+  Size first;
+  Size last;
+  int bad_allowed;
+  bool leftmost;
+};
+
+_CCCL_EXEC_CHECK_DISABLE
+template <bool Branchless, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering& comp)
+{
+  using difference_type = thrust::detail::it_difference_t<RandomAccessIterator>;
+
+  // the number of unbalanced partitionings allowed before switching to heap sort
+  int bad_allowed = 0;
+  for (difference_type n = last - first; n > 1; n /= 2)
+  {
+    ++bad_allowed;
+  }
+
+  // the larger side of every partitioning is deferred, so that the stack grows at most logarithmically
+  const RandomAccessIterator base = first;
+  pending_partition<difference_type> stack[max_stack_depth];
+  int stack_size = 0;
+
+  // only partitions that are not leftmost have a pivot at first - 1, which bounds the searches to the left
+  bool leftmost = true;
+
+  while (true)
+  {
+    const difference_type size = last - first;
+
+    if (size < insertion_sort_threshold)
+    {
+      if (leftmost)
+      {
+        insertion_sort<false>(first, last, comp);
+      }
+      else
+      {
+        insertion_sort<true>(first, last, comp);
+      }
+    }
+    else
+    {
+      // move the median of three or the pseudomedian of nine to *first
+      const difference_type half = size / 2;
+      if (size > ninther_threshold)
+      {
+        sort3(first, first + half, last - 1, comp);
+        sort3(first + 1, first + (half - 1), last - 2, comp);
+        sort3(first + 2, first + (half + 1), last - 3, comp);
+        sort3(first + (half - 1), first + half, first + (half + 1), comp);
+        swap_values(first, first + half);
+      }
+      else
+      {
+        sort3(first + half, first, last - 1, comp);
+      }
+
+      // if the pivot equals the pivot of the enclosing partition, all elements equal to it are in place, which makes
+      // inputs with many equal elements linear
+      if (!leftmost && !comp(*(first - 1), *first))
+      {
+        first = partition_left(first, last, comp) + 1;
+        continue;
+      }
+
+      const auto [pivot_pos, already_partitioned] = partition_right<Branchless>(first, last, comp);
+
+      const difference_type l_size = pivot_pos - first;
+      const difference_type r_size = last - (pivot_pos + 1);
+
+      bool done = false;
+      if (l_size < size / 8 || r_size < size / 8)
+      {
+        if (--bad_allowed == 0)
+        {
+          heap_sort(first, last, comp);
+          done = true;
+        }
+        else
+        {
+          break_patterns(first, pivot_pos, l_size);
+          break_patterns(pivot_pos + 1, last, r_size);
+        }
+      }
+      else
+      {
+        // a partitioning without swaps hints at a sorted input, which is checked cheaply
+        done = already_partitioned && partial_insertion_sort(first, pivot_pos, comp)
+            && partial_insertion_sort(pivot_pos + 1, last, comp);
+      }
+
+      if (!done)
+      {
+        if (l_size < r_size)
+        {
+          stack[stack_size++] = {(pivot_pos + 1) - base, last - base, bad_allowed, false};
+          last                = pivot_pos;
+        }
+        else
+        {
+          stack[stack_size++] = {first - base, pivot_pos - base, bad_allowed, leftmost};
+          first               = pivot_pos + 1;
+          leftmost            = false;
+        }
+        continue;
+      }
+    }
+
+    if (stack_size == 0)
+    {
+      return;
+    }
+
+    --stack_size;
+    first       = base + stack[stack_size].first;
+    last        = base + stack[stack_size].last;
+    bad_allowed = stack[stack_size].bad_allowed;
+    leftmost    = stack[stack_size].leftmost;
+  }
+}
+
+// compares key-value tuples by their keys
+template <typename StrictWeakOrdering>
+struct compare_keys
+{
+  StrictWeakOrdering comp;
+
+  _CCCL_EXEC_CHECK_DISABLE
+  template <typename Tuple1, typename Tuple2>
+  _CCCL_HOST_DEVICE bool operator()(const Tuple1& lhs, const Tuple2& rhs)
+  {
+    return comp(thrust::get<0>(lhs), thrust::get<0>(rhs));
+  }
+};
+
+// the block partitioning moves more elements than a branching one, which only pays off for cheap copies
+template <typename... Ts>
+inline constexpr bool use_branchless = (::cuda::std::is_trivially_copyable_v<Ts> && ...);
+} // namespace pdq_sort_detail
+
+template <typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void pdq_sort(RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<StrictWeakOrdering, bool> wrapped_comp{comp};
+
+  pdq_sort_detail::pdq_sort<pdq_sort_detail::use_branchless<value_type>>(first, last, wrapped_comp);
+}
+
+template <typename RandomAccessIterator1, typename RandomAccessIterator2, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void pdq_sort_by_key(
+  RandomAccessIterator1 first1, RandomAccessIterator1 last1, RandomAccessIterator2 first2, StrictWeakOrdering comp)
+{
+  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+
+  // wrap comp
+  thrust::detail::wrapped_function<pdq_sort_detail::compare_keys<StrictWeakOrdering>, bool> wrapped_comp{{comp}};
+
+  // the values are moved along with their keys
+  const auto first = thrust::make_zip_iterator(first1, first2);
+  pdq_sort_detail::pdq_sort<pdq_sort_detail::use_branchless<value_type1, value_type2>>(
+    first, first + (last1 - first1), wrapped_comp);
+}
+} // namespace system::detail::sequential
+THRUST_NAMESPACE_END
@@ -21,6 +21,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reverse.h>
 #include <thrust/system/detail/sequential/execution_policy.h>
+#include <thrust/system/detail/sequential/pdq_sort.h>
 #include <thrust/system/detail/sequential/stable_merge_sort.h>
 #include <thrust/system/detail/sequential/stable_primitive_sort.h>
 
@@ -107,5 +108,44 @@ _CCCL_HOST_DEVICE void stable_sort_by_key(
       // the compilation time of stable_primitive_sort is too expensive to use within a single CUDA thread
       thrust::system::detail::sequential::stable_merge_sort_by_key(exec, first1, last1, first2, comp);));
 }
+
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort([[maybe_unused]] sequential::execution_policy<DerivedPolicy>& exec,
+                            RandomAccessIterator first,
+                            RandomAccessIterator last,
+                            StrictWeakOrdering comp)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator>;
+
+  // the radix sort on host is faster than any comparison sort, everything else is sorted in place
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (if constexpr (sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>) {
+      thrust::system::detail::sequential::stable_sort(exec, first, last, comp);
+    } else { thrust::system::detail::sequential::pdq_sort(first, last, comp); }),
+    (thrust::system::detail::sequential::pdq_sort(first, last, comp);));
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+_CCCL_HOST_DEVICE void sort_by_key(
+  [[maybe_unused]] sequential::execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  StrictWeakOrdering comp)
+{
+  using KeyType = thrust::detail::it_value_t<RandomAccessIterator1>;
+
+  // the radix sort on host is faster than any comparison sort, everything else is sorted in place
+  NV_IF_TARGET(
+    NV_IS_HOST,
+    (if constexpr (sort_detail::use_primitive_sort<KeyType, StrictWeakOrdering>) {
+      thrust::system::detail::sequential::stable_sort_by_key(exec, first1, last1, first2, comp);
+    } else { thrust::system::detail::sequential::pdq_sort_by_key(first1, last1, first2, comp); }),
+    (thrust::system::detail::sequential::pdq_sort_by_key(first1, last1, first2, comp);));
+}
 } // namespace system::detail::sequential
 THRUST_NAMESPACE_END
@@ -17,6 +17,8 @@
 #  pragma system_header
 #endif // no system header
 #include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 // don't attempt to #include this file without omp support
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
@@ -44,5 +46,21 @@ thrust::system::detail::internal::uniform_decomposition<IndexType> default_decom
   return thrust::system::detail::internal::uniform_decomposition<IndexType>(n, 1, 1);
 #endif
 }
+
+template <typename DerivedPolicy, typename IndexType>
+thrust::system::detail::internal::uniform_decomposition<IndexType>
+default_decomposition(execution_policy<DerivedPolicy>& exec, IndexType n)
+{
+  const tuning t = omp::detail::tuning_of(exec);
+
+  // untuned policies keep one interval per processor
+  if (t.num_threads == 0 && t.grain_size == 0 && t.sequential_cutoff == 0)
+  {
+    return omp::detail::default_decomposition(n);
+  }
+
+  return thrust::system::detail::internal::uniform_decomposition<IndexType>(
+    n, 1, static_cast<IndexType>(omp::detail::thread_count(t, n)));
+}
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
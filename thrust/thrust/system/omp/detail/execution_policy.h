@@ -20,6 +20,9 @@
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/__execution/determinism.h>
+#include <cuda/std/cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp
 {
@@ -52,10 +55,169 @@ struct execution_policy : cpp::execution_policy<Derived>
   }
 };
 
+//! The schedules with which \p thrust::omp::par distributes loop iterations over threads, see \p tuning.
+enum class schedule_kind
+{
+  //! Every thread runs one contiguous block of the iterations, or chunks of \p tuning::grain_size iterations
+  //! assigned round-robin.
+  static_,
+  //! Threads take chunks of \p tuning::grain_size iterations, at least one, whenever they become idle.
+  dynamic,
+  //! Like \p dynamic, but the chunks start large and shrink down to \p tuning::grain_size iterations.
+  guided
+};
+
+//! Per-call tuning parameters of the OpenMP backend, attached to \p thrust::omp::par with \p par.with(tuning) or
+//! the individual setters \p num_threads, \p grain_size, \p sequential_cutoff, \p schedule and \p require. Zero
+//! selects the default of a parameter.
+struct tuning
+{
+  //! The maximum number of threads an algorithm runs on. Defaults to \p omp_get_max_threads().
+  int num_threads = 0;
+  //! The minimum number of elements every thread or loop chunk processes. Algorithms run on fewer threads instead of
+  //! giving a thread less work. Defaults to a single element.
+  ::cuda::std::size_t grain_size = 0;
+  //! Inputs with fewer elements run sequentially on the calling thread. Defaults to a threshold chosen by every
+  //! algorithm, which is zero for most of them.
+  ::cuda::std::size_t sequential_cutoff = 0;
+  //! The schedule of algorithms which apply a function to every element independently, like \p for_each and
+  //! \p transform. Algorithms which split their input into one block per thread ignore it.
+  schedule_kind schedule = schedule_kind::static_;
+  //! The reproducibility of \p reduce, \p transform_reduce and \p reduce_by_key, set with \p require. Under
+  //! \p cuda::execution::determinism::run_to_run their results do not depend on the number of threads. Under
+  //! \p gpu_to_gpu the sums of \p float or \p double computed by \p reduce and \p transform_reduce additionally do
+  //! not depend on the order of the elements, and match the deterministic sums of the CUDA backend; \p reduce_by_key
+  //! treats it like \p run_to_run. Defaults to \p not_guaranteed.
+  ::cuda::execution::determinism::__determinism_t determinism =
+    ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+};
+
+template <typename Derived>
+struct execute_with_tuning_base : execution_policy<Derived>
+{
+private:
+  tuning m_tuning;
+
+public:
+  constexpr execute_with_tuning_base(tuning t = {})
+      : m_tuning(t)
+  {}
+
+  //! Replaces all tuning parameters.
+  Derived with(tuning t) const
+  {
+    Derived result  = thrust::detail::derived_cast(*this);
+    result.m_tuning = t;
+    return result;
+  }
+
+  //! Sets the maximum number of threads.
+  Derived num_threads(int n) const
+  {
+    Derived result              = thrust::detail::derived_cast(*this);
+    result.m_tuning.num_threads = n;
+    return result;
+  }
+
+  //! Sets the minimum number of elements per thread or loop chunk.
+  Derived grain_size(::cuda::std::size_t n) const
+  {
+    Derived result             = thrust::detail::derived_cast(*this);
+    result.m_tuning.grain_size = n;
+    return result;
+  }
+
+  //! Sets the input size below which algorithms run sequentially.
+  Derived sequential_cutoff(::cuda::std::size_t n) const
+  {
+    Derived result                    = thrust::detail::derived_cast(*this);
+    result.m_tuning.sequential_cutoff = n;
+    return result;
+  }
+
+  //! Sets the schedule of independent loop iterations.
+  Derived schedule(schedule_kind kind) const
+  {
+    Derived result           = thrust::detail::derived_cast(*this);
+    result.m_tuning.schedule = kind;
+    return result;
+  }
+
+  //! Sets the required determinism, e.g. \p cuda::execution::determinism::run_to_run.
+  template <::cuda::execution::determinism::__determinism_t Guarantee>
+  Derived require(::cuda::execution::determinism::__determinism_holder_t<Guarantee>) const
+  {
+    Derived result              = thrust::detail::derived_cast(*this);
+    result.m_tuning.determinism = Guarantee;
+    return result;
+  }
+
+private:
+  friend tuning get_tuning(const execute_with_tuning_base& exec)
+  {
+    return exec.m_tuning;
+  }
+};
+
+struct execute_with_tuning : execute_with_tuning_base<execute_with_tuning>
+{
+  execute_with_tuning() = default;
+
+  constexpr execute_with_tuning(tuning t)
+      : execute_with_tuning_base(t)
+  {}
+};
+
+// policies without attached tuning use the defaults
+template <typename Derived>
+tuning get_tuning(const execution_policy<Derived>&)
+{
+  return {};
+}
+
 struct par_t
     : execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+    , thrust::detail::allocator_aware_execution_policy<execute_with_tuning_base>
+{
+  using tuning_attachment_type = execute_with_tuning;
+
+  //! Attaches tuning parameters to the policy.
+  tuning_attachment_type with(tuning t) const
+  {
+    return execute_with_tuning(t);
+  }
+
+  //! Sets the maximum number of threads.
+  tuning_attachment_type num_threads(int n) const
+  {
+    return execute_with_tuning().num_threads(n);
+  }
+
+  //! Sets the minimum number of elements per thread or loop chunk.
+  tuning_attachment_type grain_size(::cuda::std::size_t n) const
+  {
+    return execute_with_tuning().grain_size(n);
+  }
+
+  //! Sets the input size below which algorithms run sequentially.
+  tuning_attachment_type sequential_cutoff(::cuda::std::size_t n) const
+  {
+    return execute_with_tuning().sequential_cutoff(n);
+  }
+
+  //! Sets the schedule of independent loop iterations.
+  tuning_attachment_type schedule(schedule_kind kind) const
+  {
+    return execute_with_tuning().schedule(kind);
+  }
+
+  //! Sets the required determinism, e.g. \p cuda::execution::determinism::run_to_run.
+  template <::cuda::execution::determinism::__determinism_t Guarantee>
+  tuning_attachment_type require(::cuda::execution::determinism::__determinism_holder_t<Guarantee> guarantee) const
+  {
+    return execute_with_tuning().require(guarantee);
+  }
+};
 
 // select_system(tbb, omp) & select_system(omp, tbb) are ambiguous because both convert to cpp without these overloads,
 // which we arbitrarily define in the omp backend
@@ -85,6 +247,12 @@ using detail::tag;
 //! Thrust's OpenMP backend system.
 using detail::execution_policy;
 
+//! \p thrust::omp::tuning holds the per-call tuning parameters of \p thrust::omp::par.
+using detail::tuning;
+
+//! \p thrust::omp::schedule_kind selects how \p thrust::omp::par distributes loop iterations over threads.
+using detail::schedule_kind;
+
 //! \p thrust::omp::par is the parallel execution policy associated with Thrust's OpenMP backend system.
 //!
 //! Instead of relying on implicit algorithm dispatch through iterator system tags, users may directly target Thrust's
@@ -117,6 +285,19 @@ using detail::execution_policy;
 //!
 //! // 0 1 2 is printed to standard output in some unspecified order
 //! \endcode
+//!
+//! Tuning parameters can be attached per call, e.g. to keep small latency-sensitive calls on the calling thread while
+//! large calls use all threads:
+//!
+//! \code
+//! thrust::sort(thrust::omp::par.sequential_cutoff(1 << 16).num_threads(8), vec.begin(), vec.end());
+//! thrust::for_each(thrust::omp::par.schedule(thrust::omp::schedule_kind::dynamic).grain_size(64),
+//!                  vec.begin(), vec.end(), f);
+//!
+//! // the same sum for any number of threads
+//! float sum =
+//!   thrust::reduce(thrust::omp::par.require(cuda::execution::determinism::gpu_to_gpu), vec.begin(), vec.end());
+//! \endcode
 inline constexpr detail::par_t par;
 
 //! \}
@@ -127,6 +308,8 @@ namespace omp
 {
 using system::omp::execution_policy;
 using system::omp::par;
+using system::omp::schedule_kind;
 using system::omp::tag;
+using system::omp::tuning;
 } // namespace omp
 THRUST_NAMESPACE_END
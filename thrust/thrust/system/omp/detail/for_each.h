@@ -23,7 +23,7 @@
 #include <thrust/for_each.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 #include <cuda/std/__iterator/distance.h>
 
@@ -31,7 +31,8 @@ THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
   // we're attempting to launch an omp kernel, assert we're compiling with omp support
   // ========================================================================
@@ -54,12 +55,11 @@ RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIt
   using DifferenceType    = thrust::detail::it_difference_t<RandomAccessIterator>;
   DifferenceType signed_n = n;
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (DifferenceType i = 0; i < signed_n; ++i)
-  {
+  const tuning t = omp::detail::tuning_of(exec);
+  omp::detail::parallel_for(t, omp::detail::thread_count(t, signed_n), signed_n, [&](DifferenceType i) {
     RandomAccessIterator temp = first + i;
     wrapped_f(*temp);
-  }
+  });
 
   return first + n;
 } // end for_each_n()
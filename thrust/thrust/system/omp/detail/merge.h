@@ -13,5 +13,226 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits merge
-#include <thrust/system/cpp/detail/merge.h>
+#include <thrust/detail/seq.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/merge.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/sequential/merge.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+// Threshold below which a serial merge is faster than a parallel one
+inline constexpr size_t parallel_merge_threshold = 1 << 14;
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator
+merge(execution_policy<DerivedPolicy>& exec,
+      InputIterator1 first1,
+      InputIterator1 last1,
+      InputIterator2 first2,
+      InputIterator2 last2,
+      OutputIterator result,
+      StrictWeakOrdering comp)
+{
+  using traversal = thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                                                 typename iterator_traversal<InputIterator2>::type,
+                                                 typename iterator_traversal<OutputIterator>::type>;
+
+  if constexpr (!::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    return system::detail::sequential::merge(exec, first1, last1, first2, last2, result, comp);
+  }
+  else
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    const Size n1 = ::cuda::std::distance(first1, last1);
+    const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+    const Size n  = n1 + n2;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    const int num_threads = omp::detail::thread_count(exec, n, parallel_merge_threshold);
+
+    if (num_threads <= 1)
+    {
+      return thrust::merge(thrust::seq, first1, last1, first2, last2, result, comp);
+    }
+
+    THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+    {
+      thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, omp_get_num_threads());
+
+      // process id
+      Size p_i = omp_get_thread_num();
+
+      // every thread merges the slice of the output between two diagonals of the merge path
+      if (p_i < decomp.size())
+      {
+        const Size diag_begin = decomp[p_i].begin();
+        const Size diag_end   = decomp[p_i].end();
+
+        const Size i_begin = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, diag_begin, comp);
+        const Size i_end   = thrust::system::detail::internal::merge_path(first1, n1, first2, n2, diag_end, comp);
+
+        thrust::merge(
+          thrust::seq,
+          first1 + i_begin,
+          first1 + i_end,
+          first2 + (diag_begin - i_begin),
+          first2 + (diag_end - i_end),
+          result + diag_begin,
+          comp);
+      }
+    }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+    return result + n;
+  }
+} // end merge()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename InputIterator3,
+          typename InputIterator4,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename StrictWeakOrdering>
+::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first1,
+  InputIterator1 keys_last1,
+  InputIterator2 keys_first2,
+  InputIterator2 keys_last2,
+  InputIterator3 values_first1,
+  InputIterator4 values_first2,
+  OutputIterator1 keys_result,
+  OutputIterator2 values_result,
+  StrictWeakOrdering comp)
+{
+  using traversal = thrust::detail::minimum_type<
+    typename iterator_traversal<InputIterator1>::type,
+    typename iterator_traversal<InputIterator2>::type,
+    typename iterator_traversal<InputIterator3>::type,
+    typename iterator_traversal<InputIterator4>::type,
+    typename iterator_traversal<OutputIterator1>::type,
+    typename iterator_traversal<OutputIterator2>::type>;
+
+  if constexpr (!::cuda::std::is_convertible_v<traversal, random_access_traversal_tag>)
+  {
+    return system::detail::sequential::merge_by_key(
+      exec,
+      keys_first1,
+      keys_last1,
+      keys_first2,
+      keys_last2,
+      values_first1,
+      values_first2,
+      keys_result,
+      values_result,
+      comp);
+  }
+  else
+  {
+    // we're attempting to launch an omp kernel, assert we're compiling with omp support
+    // ========================================================================
+    // X Note to the user: If you've found this line due to a compiler error, X
+    // X you need to enable OpenMP support in your compiler.                  X
+    // ========================================================================
+    static_assert(thrust::detail::depend_on_instantiation<InputIterator1,
+                                                          (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                  "OpenMP compiler support is not enabled");
+
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+    const Size n1 = ::cuda::std::distance(keys_first1, keys_last1);
+    const Size n2 = static_cast<Size>(::cuda::std::distance(keys_first2, keys_last2));
+    const Size n  = n1 + n2;
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+    const int num_threads = omp::detail::thread_count(exec, n, parallel_merge_threshold);
+
+    if (num_threads <= 1)
+    {
+      return thrust::merge_by_key(
+        thrust::seq,
+        keys_first1,
+        keys_last1,
+        keys_first2,
+        keys_last2,
+        values_first1,
+        values_first2,
+        keys_result,
+        values_result,
+        comp);
+    }
+
+    THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
+    {
+      thrust::system::detail::internal::uniform_decomposition<Size> decomp(n, 1, omp_get_num_threads());
+
+      // process id
+      Size p_i = omp_get_thread_num();
+
+      // every thread merges the slice of the output between two diagonals of the merge path
+      if (p_i < decomp.size())
+      {
+        const Size diag_begin = decomp[p_i].begin();
+        const Size diag_end   = decomp[p_i].end();
+
+        const Size i_begin =
+          thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, diag_begin, comp);
+        const Size i_end = thrust::system::detail::internal::merge_path(keys_first1, n1, keys_first2, n2, diag_end, comp);
+
+        const Size j_begin = diag_begin - i_begin;
+        const Size j_end   = diag_end - i_end;
+
+        thrust::merge_by_key(
+          thrust::seq,
+          keys_first1 + i_begin,
+          keys_first1 + i_end,
+          keys_first2 + j_begin,
+          keys_first2 + j_end,
+          values_first1 + i_begin,
+          values_first2 + j_begin,
+          keys_result + diag_begin,
+          values_result + diag_begin,
+          comp);
+      }
+    }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+    return ::cuda::std::make_pair(keys_result + n, values_result + n);
+  }
+} // end merge_by_key()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
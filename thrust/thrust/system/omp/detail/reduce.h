@@ -19,9 +19,11 @@
 
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/omp/detail/reduce_intervals.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 #include <cuda/std/__iterator/distance.h>
 
@@ -39,9 +41,31 @@ OutputType reduce(execution_policy<DerivedPolicy>& exec,
 
   const difference_type n = ::cuda::std::distance(first, last);
 
+  tuning t = omp::detail::tuning_of(exec);
+
+  if (t.determinism != ::cuda::execution::determinism::__determinism_t::__not_guaranteed)
+  {
+    const int num_threads = omp::detail::thread_count(t, n);
+
+    // every block is reduced by one thread, and already holds many elements
+    t.grain_size = 0;
+
+    return thrust::system::detail::internal::deterministic_reduce(
+      exec,
+      [&](difference_type num_blocks, auto f) {
+        omp::detail::parallel_for(
+          t, num_blocks < num_threads ? static_cast<int>(num_blocks) : num_threads, num_blocks, f);
+      },
+      t.determinism == ::cuda::execution::determinism::__determinism_t::__gpu_to_gpu,
+      first,
+      n,
+      init,
+      binary_op);
+  }
+
   // determine first and second level decomposition
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp1 =
-    thrust::system::omp::detail::default_decomposition(n);
+    thrust::system::omp::detail::default_decomposition(exec, n);
   thrust::system::detail::internal::uniform_decomposition<difference_type> decomp2(decomp1.size() + 1, 1, 1);
 
   // allocate storage for the initializer and partial sums
@@ -17,12 +17,227 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/reduce_by_key.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
+#include <thrust/system/detail/sequential/reduce_by_key.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace reduce_by_key_detail
+{
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator1, typename OutputIterator2>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                               typename iterator_traversal<InputIterator2>::type,
+                               typename iterator_traversal<OutputIterator1>::type,
+                               typename iterator_traversal<OutputIterator2>::type>,
+  random_access_traversal_tag>;
+
+// Every block counts its segment heads, then reduces the segments starting inside it in a single
+// pass at its scanned output offset. The reduction of a block's last segment and of a leading
+// segment continued from the previous block are combined serially afterwards, so every value
+// is written exactly once and the output is never read back. There is one block per thread,
+// unless the policy requires determinism, in which case the blocks have a fixed size.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+::cuda::std::pair<OutputIterator1, OutputIterator2> reduce_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  InputIterator1 keys_last,
+  InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  OutputIterator2 values_output,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using namespace thrust::detail;
+
+  using KeyType = it_value_t<InputIterator1>;
+  using Size    = it_difference_t<InputIterator1>;
+
+  // Use the input iterator's value type per https://wg21.link/P0571
+  using TemporaryType = it_value_t<InputIterator2>;
+
+  const Size n = ::cuda::std::distance(keys_first, keys_last);
+
+  const tuning t = omp::detail::tuning_of(exec);
+
+  int num_threads = omp::detail::thread_count(t, n, parallel_scan_threshold);
+
+  // the sums of segments spanning several blocks only depend on the block size, which is fixed for determinism
+  const bool deterministic = t.determinism != ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+  const Size block_size =
+    deterministic
+      ? static_cast<Size>(system::detail::internal::deterministic_block_size)
+      : ::cuda::ceil_div(n, static_cast<Size>((::cuda::std::max) (num_threads, 1)));
+
+  // Use serial reduction for small arrays where parallel overhead dominates
+  if (deterministic ? n <= block_size : num_threads <= 1)
+  {
+    return system::detail::sequential::reduce_by_key(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+
+  // The chosen block size may leave some threads without work
+  const Size num_blocks = ::cuda::ceil_div(n, block_size);
+  if (num_blocks < num_threads)
+  {
+    num_threads = static_cast<int>(num_blocks);
+  }
+
+  // the number of segment heads in every block, scanned into output offsets
+  temporary_array<Size, DerivedPolicy> offsets(exec, num_blocks + 1);
+
+  // the reduction of every block's leading segment if it continues from the previous block
+  temporary_array<TemporaryType, DerivedPolicy> carries(exec, num_blocks);
+
+  // the reduction of the last segment starting in every block, up to the end of the block
+  temporary_array<TemporaryType, DerivedPolicy> block_sums(exec, num_blocks);
+
+  // Step 1: Count the segment heads of each block (N key reads)
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static))
+  for (Size block = 0; block < num_blocks; ++block)
+  {
+    const Size start = block * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    KeyType prev_key = keys_first[start];
+    Size count       = (block == 0 || !binary_pred(KeyType(keys_first[start - 1]), prev_key)) ? 1 : 0;
+
+    for (Size i = start + 1; i < end; ++i)
+    {
+      KeyType key = keys_first[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+      if (!binary_pred(prev_key, key))
+      {
+        ++count;
+      }
+
+      prev_key = key;
+    }
+
+    offsets[block] = count;
+  }
+
+  // Step 2: Scan the head counts
+  Size sum = 0;
+  for (Size block = 0; block < num_blocks; ++block)
+  {
+    const Size count = offsets[block];
+    offsets[block]   = sum;
+    sum += count;
+  }
+  offsets[num_blocks] = sum;
+
+  // Step 3: Reduce the segments of each block, deferring the value of its last segment (N reads/writes)
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static))
+  for (Size block = 0; block < num_blocks; ++block)
+  {
+    const Size start = block * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    KeyType prev_key = keys_first[start];
+    Size i           = start;
+
+    if (block > 0 && binary_pred(KeyType(keys_first[start - 1]), prev_key))
+    {
+      TemporaryType value = values_first[start];
+
+      for (++i; i < end; ++i)
+      {
+        KeyType key = keys_first[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+        if (!binary_pred(prev_key, key))
+        {
+          break;
+        }
+
+        value    = binary_op(value, values_first[i]);
+        prev_key = key;
+      }
+
+      carries[block] = value;
+    }
+
+    // i is the first segment head of this block, if it has any
+    if (i < end)
+    {
+      Size out            = offsets[block];
+      TemporaryType value = values_first[i];
+      prev_key            = keys_first[i];
+      keys_output[out]    = prev_key;
+
+      for (++i; i < end; ++i)
+      {
+        KeyType key = keys_first[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+        if (binary_pred(prev_key, key))
+        {
+          value = binary_op(value, values_first[i]);
+        }
+        else
+        {
+          values_output[out] = value;
+          ++out;
+          keys_output[out] = key;
+
+          value = values_first[i];
+        }
+
+        prev_key = key;
+      }
+
+      // the last segment may continue into the next block
+      block_sums[block] = value;
+    }
+  }
+
+  // Step 4: Combine the segments spanning block boundaries, which only depends on the block size
+  Size open_segment   = offsets[1] - 1;
+  TemporaryType value = block_sums[0];
+
+  for (Size block = 1; block < num_blocks; ++block)
+  {
+    const Size start = block * block_size;
+
+    if (binary_pred(KeyType(keys_first[start - 1]), KeyType(keys_first[start])))
+    {
+      value = binary_op(value, carries[block]);
+    }
+
+    if (offsets[block] < offsets[block + 1])
+    {
+      values_output[open_segment] = value;
+      open_segment                = offsets[block + 1] - 1;
+      value                       = block_sums[block];
+    }
+  }
+
+  values_output[open_segment] = value;
+
+  return ::cuda::std::make_pair(keys_output + sum, values_output + sum);
+}
+} // namespace reduce_by_key_detail
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
@@ -40,9 +255,17 @@ template <typename DerivedPolicy,
   BinaryPredicate binary_pred,
   BinaryFunction binary_op)
 {
-  // omp prefers generic::reduce_by_key to cpp::reduce_by_key
-  return thrust::system::detail::generic::reduce_by_key(
-    exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  if constexpr (reduce_by_key_detail::
+                  is_random_access_v<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>)
+  {
+    return reduce_by_key_detail::reduce_by_key(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
+  else
+  {
+    return system::detail::sequential::reduce_by_key(
+      exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred, binary_op);
+  }
 } // end reduce_by_key()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
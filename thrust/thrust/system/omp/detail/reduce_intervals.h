@@ -21,7 +21,7 @@
 #include <thrust/detail/static_assert.h> // for depend_on_instantiation
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
-#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 #include <cuda/std/cstdint>
 
@@ -34,7 +34,7 @@ template <typename DerivedPolicy,
           typename BinaryFunction,
           typename Decomposition>
 void reduce_intervals(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator input,
   OutputIterator output,
   BinaryFunction binary_op,
@@ -59,9 +59,13 @@ void reduce_intervals(
 
   index_type n = static_cast<index_type>(decomp.size());
 
-  THRUST_PRAGMA_OMP(parallel for)
-  for (index_type i = 0; i < n; i++)
-  {
+  // every interval is reduced by one thread, and already holds at least grain_size elements
+  tuning t              = omp::detail::tuning_of(exec);
+  t.grain_size          = 0;
+  const int threads     = omp::detail::max_threads(t);
+  const int num_threads = n < threads ? static_cast<int>(n) : threads;
+
+  omp::detail::parallel_for(t, num_threads, n, [&](index_type i) {
     InputIterator begin = input + decomp[i].begin();
     InputIterator end   = input + decomp[i].end();
 
@@ -80,7 +84,7 @@ void reduce_intervals(
       OutputIterator tmp = output + i;
       *tmp               = sum;
     }
-  }
+  });
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
 } // end namespace system::omp::detail
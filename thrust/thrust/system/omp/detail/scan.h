@@ -19,9 +19,9 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/omp/detail/execution_policy.h>
 #include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
 
 #include <cuda/__cmath/ceil_div.h>
-#include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
@@ -73,11 +73,10 @@ OutputIterator scan_impl(
 
   auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
 
-  const int num_threads = omp_get_max_threads();
+  const int num_threads = omp::detail::thread_count(exec, n, parallel_scan_threshold);
 
   // Use serial scan for small arrays where parallel overhead dominates
-  if (static_cast<size_t>(n) < (::cuda::std::max) (parallel_scan_threshold, static_cast<size_t>(num_threads))
-      || num_threads <= 1)
+  if (num_threads <= 1)
   {
     if constexpr (IsInclusive)
     {
@@ -13,11 +13,306 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits this algorithm
-#include <thrust/system/cpp/detail/scan_by_key.h>
-
-// Ensure OMP scan is available before using generic scan_by_key
+// OMP parallel scan_by_key implementation
+#include <thrust/detail/function.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/scan_by_key.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
 #include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/conditional.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_same.h>
+
+#include <omp.h>
 
-// use generic parallel implementation
+// generic implementations of the overloads without a predicate or operator
 #include <thrust/system/detail/generic/scan_by_key.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+// Every block scans the segments which start inside it in a single pass. A segment which
+// continues from the previous block is only reduced, then rescanned once the carry into the
+// block is known, so the output is written but never read back.
+template <bool IsInclusive,
+          typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator scan_by_key_impl(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  [[maybe_unused]] InitialValueType init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  using namespace thrust::detail;
+
+  // follow the sequential implementation: inclusive scans accumulate in the value type, exclusive ones in the init type
+  using accum_t = ::cuda::std::conditional_t<IsInclusive, it_value_t<InputIterator2>, InitialValueType>;
+  using KeyType = it_value_t<InputIterator1>;
+  using Size    = it_difference_t<InputIterator1>;
+
+  const Size n = ::cuda::std::distance(first1, last1);
+
+  if (n == 0)
+  {
+    return result;
+  }
+
+  auto wrapped_binary_op = wrapped_function<BinaryFunction, accum_t>{binary_op};
+
+  const int num_threads = omp::detail::thread_count(exec, n, parallel_scan_threshold);
+
+  // Use serial scan for small arrays where parallel overhead dominates
+  if (num_threads <= 1)
+  {
+    if constexpr (IsInclusive)
+    {
+      return system::detail::sequential::inclusive_scan_by_key(
+        exec, first1, last1, first2, result, binary_pred, binary_op);
+    }
+    else
+    {
+      return system::detail::sequential::exclusive_scan_by_key(
+        exec, first1, last1, first2, result, init, binary_pred, binary_op);
+    }
+  }
+
+  // The chosen block size may leave some threads without work
+  const Size block_size    = ::cuda::ceil_div(n, static_cast<Size>(num_threads));
+  const int active_threads = static_cast<int>(::cuda::ceil_div(n, block_size));
+
+  // the index of the first segment head in every block; a block whose first element continues
+  // the segment of the previous block has its head past its start, or none at all
+  temporary_array<Size, DerivedPolicy> first_heads(exec, active_threads);
+
+  // the reduction of every block's leading segment if it continues from the previous block,
+  // replaced by the carry into the block in step 2
+  temporary_array<accum_t, DerivedPolicy> carries(exec, active_threads);
+
+  // the scan state at the end of every block, once again including the carry after step 2
+  temporary_array<accum_t, DerivedPolicy> block_sums(exec, active_threads);
+
+  // Compare the keys on either side of every block boundary up front; in-place scans may overwrite them in step 1
+  for (int tid = 0; tid < active_threads; ++tid)
+  {
+    const Size start     = tid * block_size;
+    const bool continued = tid > 0 && binary_pred(KeyType(first1[start - 1]), KeyType(first1[start]));
+
+    first_heads[tid] = continued ? start + 1 : start;
+  }
+
+  // Step 1: Scan the segments starting in each block and reduce the continued ones (N reads/writes)
+  THRUST_PRAGMA_OMP(parallel num_threads(active_threads))
+  {
+    const int tid    = omp_get_thread_num();
+    const Size start = tid * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    KeyType prev_key = first1[start];
+    Size i           = start;
+
+    if (first_heads[tid] > start)
+    {
+      accum_t sum = first2[start];
+
+      for (++i; i < end; ++i)
+      {
+        KeyType key = first1[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+        if (!binary_pred(prev_key, key))
+        {
+          break;
+        }
+
+        sum      = wrapped_binary_op(sum, first2[i]);
+        prev_key = key;
+      }
+
+      carries[tid] = sum;
+    }
+
+    first_heads[tid] = i;
+
+    if (i < end)
+    {
+      if constexpr (IsInclusive)
+      {
+        accum_t sum = first2[i];
+        prev_key    = first1[i];
+        result[i]   = sum;
+
+        for (++i; i < end; ++i)
+        {
+          KeyType key = first1[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+          if (binary_pred(prev_key, key))
+          {
+            sum = wrapped_binary_op(sum, first2[i]);
+          }
+          else
+          {
+            sum = first2[i];
+          }
+
+          result[i] = sum;
+          prev_key  = key;
+        }
+
+        block_sums[tid] = sum;
+      }
+      else
+      {
+        accum_t next = init;
+        prev_key     = first1[i];
+
+        for (const Size head = i; i < end; ++i)
+        {
+          // use temps to permit in-place scans
+          KeyType key         = first1[i]; // NOLINT(performance-unnecessary-copy-initialization)
+          const accum_t value = first2[i];
+
+          if (i > head && !binary_pred(prev_key, key))
+          {
+            next = init; // reset sum
+          }
+
+          result[i] = next;
+          next      = wrapped_binary_op(next, value);
+          prev_key  = key;
+        }
+
+        block_sums[tid] = next;
+      }
+    }
+  }
+
+  // Step 2: Propagate the carries through the blocks, which only depends on the number of threads
+  for (int tid = 1; tid < active_threads; ++tid)
+  {
+    const Size start = tid * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    if (first_heads[tid] > start)
+    {
+      const accum_t carry = block_sums[tid - 1];
+
+      if (first_heads[tid] == end)
+      {
+        // the whole block continues the previous segment
+        block_sums[tid] = wrapped_binary_op(carry, carries[tid]);
+      }
+
+      carries[tid] = carry;
+    }
+  }
+
+  // Step 3: Scan the continued segments from their carries (reads/writes only the continued segments)
+  THRUST_PRAGMA_OMP(parallel num_threads(active_threads))
+  {
+    const int tid    = omp_get_thread_num();
+    const Size start = tid * block_size;
+
+    if (first_heads[tid] > start)
+    {
+      accum_t sum = carries[tid];
+
+      for (Size i = start; i < first_heads[tid]; ++i)
+      {
+        // use temp to permit in-place scans
+        const accum_t value = first2[i];
+
+        if constexpr (IsInclusive)
+        {
+          sum       = wrapped_binary_op(sum, value);
+          result[i] = sum;
+        }
+        else
+        {
+          result[i] = sum;
+          sum       = wrapped_binary_op(sum, value);
+        }
+      }
+    }
+  }
+
+  return result + n;
+}
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+inline constexpr bool scan_by_key_is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                               typename iterator_traversal<InputIterator2>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator inclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  if constexpr (scan_by_key_is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return scan_by_key_impl<true>(exec, first1, last1, first2, result, __no_init_tag{}, binary_pred, binary_op);
+  }
+  else
+  {
+    return system::detail::sequential::inclusive_scan_by_key(
+      exec, first1, last1, first2, result, binary_pred, binary_op);
+  }
+}
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename T,
+          typename BinaryPredicate,
+          typename BinaryFunction>
+OutputIterator exclusive_scan_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  OutputIterator result,
+  T init,
+  BinaryPredicate binary_pred,
+  BinaryFunction binary_op)
+{
+  if constexpr (scan_by_key_is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return scan_by_key_impl<false>(exec, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+  else
+  {
+    return system::detail::sequential::exclusive_scan_by_key(
+      exec, first1, last1, first2, result, init, binary_pred, binary_op);
+  }
+}
+} // namespace system::omp::detail
+THRUST_NAMESPACE_END
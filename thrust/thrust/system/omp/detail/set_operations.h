@@ -13,5 +13,250 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/static_assert.h> // for depend_on_instantiation
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/decompose.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/sequential/set_operations.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__numeric/exclusive_scan.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
+#include <cuda/std/cstdint>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+namespace set_operations_detail
+{
+// Threshold below which the serial set operations are faster than the parallel ones
+inline constexpr size_t parallel_set_operation_threshold = 1 << 14;
+
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                               typename iterator_traversal<InputIterator2>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
+// Splits both inputs into partitions which never separate equivalent elements,
+// counts the output of each partition, then applies serial_op to every partition
+// in parallel at its scanned output offset.
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+RandomAccessIterator3 set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  RandomAccessIterator3 result,
+  StrictWeakOrdering comp,
+  SerialSetOperation serial_op)
+{
+  // we're attempting to launch an omp kernel, assert we're compiling with omp support
+  // ========================================================================
+  // X Note to the user: If you've found this line due to a compiler error, X
+  // X you need to enable OpenMP support in your compiler.                  X
+  // ========================================================================
+  static_assert(thrust::detail::depend_on_instantiation<RandomAccessIterator1,
+                                                        (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)>::value,
+                "OpenMP compiler support is not enabled");
+
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  using Size       = thrust::detail::it_difference_t<RandomAccessIterator1>;
+  using index_type = std::intptr_t;
+
+  const Size n1 = ::cuda::std::distance(first1, last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+
+  const int num_threads = omp::detail::thread_count(exec, n1 + n2, parallel_set_operation_threshold);
+
+  if (num_threads <= 1)
+  {
+    return serial_op(first1, last1, first2, last2, result, comp);
+  }
+
+  thrust::system::detail::internal::uniform_decomposition<Size> decomp(n1 + n2, 1, num_threads);
+
+  const index_type num_partitions = static_cast<index_type>(decomp.size());
+
+  // the split points of every partition, plus the end of both inputs
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits1(exec, num_partitions + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits2(exec, num_partitions + 1);
+
+  // the output size of every partition, scanned into output offsets
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_partitions + 1);
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+  for (index_type i = 0; i < num_partitions; ++i)
+  {
+    ::cuda::std::pair<Size, Size> split =
+      thrust::system::detail::internal::set_operation_partition(first1, n1, first2, n2, decomp[i].begin(), comp);
+
+    splits1[i] = split.first;
+    splits2[i] = split.second;
+  }
+
+  splits1[num_partitions] = n1;
+  splits2[num_partitions] = n2;
+  offsets[num_partitions] = 0;
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+  for (index_type i = 0; i < num_partitions; ++i)
+  {
+    offsets[i] =
+      serial_op(
+        first1 + splits1[i],
+        first1 + splits1[i + 1],
+        first2 + splits2[i],
+        first2 + splits2[i + 1],
+        thrust::make_discard_iterator(),
+        comp)
+      - thrust::make_discard_iterator();
+  }
+
+  ::cuda::std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), Size(0));
+
+  THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+  for (index_type i = 0; i < num_partitions; ++i)
+  {
+    serial_op(first1 + splits1[i],
+              first1 + splits1[i + 1],
+              first2 + splits2[i],
+              first2 + splits2[i + 1],
+              result + offsets[i],
+              comp);
+  }
+
+  return result + offsets[num_partitions];
+#else
+  return serial_op(first1, last1, first2, last2, result, comp);
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference{});
+  }
+  else
+  {
+    return system::detail::sequential::set_difference(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection{});
+  }
+  else
+  {
+    return system::detail::sequential::set_intersection(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec,
+      first1,
+      last1,
+      first2,
+      last2,
+      result,
+      comp,
+      thrust::system::detail::internal::serial_set_symmetric_difference{});
+  }
+  else
+  {
+    return system::detail::sequential::set_symmetric_difference(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union{});
+  }
+  else
+  {
+    return system::detail::sequential::set_union(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_union()
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
@@ -20,59 +20,152 @@
 #  include <omp.h>
 #endif // omp support
 
+#include <thrust/copy.h>
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
 #include <thrust/system/detail/generic/select_system.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <thrust/system/omp/detail/default_decomposition.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__algorithm/min.h>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
 namespace sort_detail
 {
-template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
-void inplace_merge(execution_policy<DerivedPolicy>& exec,
-                   RandomAccessIterator first,
-                   RandomAccessIterator middle,
-                   RandomAccessIterator last,
-                   StrictWeakOrdering comp)
+// Threshold below which the sequential radix sort is faster than the parallel one
+inline constexpr size_t parallel_radix_sort_threshold = 1 << 16;
+
+// invokes f(i) for every i in [0, n) with an OpenMP parallel loop
+struct parallel_for_fn
 {
-  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+  int num_threads;
+
+  template <typename Size, typename Function>
+  void operator()(Size n, Function f) const
+  {
+    THRUST_PRAGMA_OMP(parallel for num_threads(num_threads))
+    for (Size i = 0; i < n; ++i)
+    {
+      f(i);
+    }
+  }
+};
+
+// Calls merge_slice(begin, middle, end, diag_begin, diag_end) for each pair of adjacent sorted runs of h tiles
+// [begin, middle) and [middle, end) whose merged output overlaps [lo, hi). [diag_begin, diag_end) is the overlapping
+// slice of the pair's merged output, relative to begin.
+template <typename IndexType, typename MergeSlice>
+void for_each_merge_slice(
+  const thrust::system::detail::internal::uniform_decomposition<IndexType>& decomp,
+  IndexType h,
+  IndexType lo,
+  IndexType hi,
+  MergeSlice merge_slice)
+{
+  const IndexType num_tiles = decomp.size();
+
+  for (IndexType a = 0; a < num_tiles; a += 2 * h)
+  {
+    const IndexType b = (::cuda::std::min) (a + h, num_tiles);
+    const IndexType c = (::cuda::std::min) (a + 2 * h, num_tiles);
+
+    const IndexType begin  = decomp[a].begin();
+    const IndexType middle = decomp[b - 1].end();
+    const IndexType end    = decomp[c - 1].end();
 
-  thrust::detail::temporary_array<value_type, DerivedPolicy> a(exec, first, middle);
-  thrust::detail::temporary_array<value_type, DerivedPolicy> b(exec, middle, last);
+    const IndexType slice_begin = (::cuda::std::max) (lo, begin);
+    const IndexType slice_end   = (::cuda::std::min) (hi, end);
 
-  thrust::merge(thrust::seq, a.begin(), a.end(), b.begin(), b.end(), first, comp);
+    if (slice_begin < slice_end)
+    {
+      merge_slice(begin, middle, end, slice_begin - begin, slice_end - begin);
+    }
+  }
 }
 
-template <typename DerivedPolicy,
-          typename RandomAccessIterator1,
+// Merges [diag_begin, diag_end) of the stable merge of src[begin, middle) and src[middle, end) into dst
+template <typename RandomAccessIterator1,
           typename RandomAccessIterator2,
+          typename IndexType,
           typename StrictWeakOrdering>
-void inplace_merge_by_key(
-  execution_policy<DerivedPolicy>& exec,
-  RandomAccessIterator1 first1,
-  RandomAccessIterator1 middle1,
-  RandomAccessIterator1 last1,
-  RandomAccessIterator2 first2,
+void merge_slice(
+  RandomAccessIterator1 src,
+  RandomAccessIterator2 dst,
+  IndexType begin,
+  IndexType middle,
+  IndexType end,
+  IndexType diag_begin,
+  IndexType diag_end,
   StrictWeakOrdering comp)
 {
-  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
-  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+  const IndexType n1 = middle - begin;
+  const IndexType n2 = end - middle;
+
+  const IndexType i_begin =
+    thrust::system::detail::internal::merge_path(src + begin, n1, src + middle, n2, diag_begin, comp);
+  const IndexType i_end =
+    thrust::system::detail::internal::merge_path(src + begin, n1, src + middle, n2, diag_end, comp);
+
+  thrust::merge(
+    thrust::seq,
+    src + begin + i_begin,
+    src + begin + i_end,
+    src + middle + (diag_begin - i_begin),
+    src + middle + (diag_end - i_end),
+    dst + begin + diag_begin,
+    comp);
+}
 
-  RandomAccessIterator2 middle2 = first2 + (middle1 - first1);
-  RandomAccessIterator2 last2   = first2 + (last1 - first1);
+template <typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename RandomAccessIterator4,
+          typename IndexType,
+          typename StrictWeakOrdering>
+void merge_slice_by_key(
+  RandomAccessIterator1 keys_src,
+  RandomAccessIterator2 values_src,
+  RandomAccessIterator3 keys_dst,
+  RandomAccessIterator4 values_dst,
+  IndexType begin,
+  IndexType middle,
+  IndexType end,
+  IndexType diag_begin,
+  IndexType diag_end,
+  StrictWeakOrdering comp)
+{
+  const IndexType n1 = middle - begin;
+  const IndexType n2 = end - middle;
+
+  const IndexType i_begin =
+    thrust::system::detail::internal::merge_path(keys_src + begin, n1, keys_src + middle, n2, diag_begin, comp);
+  const IndexType i_end =
+    thrust::system::detail::internal::merge_path(keys_src + begin, n1, keys_src + middle, n2, diag_end, comp);
 
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> lhs1(exec, first1, middle1);
-  thrust::detail::temporary_array<value_type1, DerivedPolicy> rhs1(exec, middle1, last1);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> lhs2(exec, first2, middle2);
-  thrust::detail::temporary_array<value_type2, DerivedPolicy> rhs2(exec, middle2, last2);
+  const IndexType j_begin = diag_begin - i_begin;
+  const IndexType j_end   = diag_end - i_end;
 
   thrust::merge_by_key(
-    thrust::seq, lhs1.begin(), lhs1.end(), rhs1.begin(), rhs1.end(), lhs2.begin(), rhs2.begin(), first1, first2, comp);
+    thrust::seq,
+    keys_src + begin + i_begin,
+    keys_src + begin + i_end,
+    keys_src + middle + j_begin,
+    keys_src + middle + j_end,
+    values_src + begin + i_begin,
+    values_src + middle + j_begin,
+    keys_dst + begin + diag_begin,
+    values_dst + begin + diag_begin,
+    comp);
 }
 } // namespace sort_detail
 
@@ -93,12 +186,42 @@ void stable_sort(
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using IndexType = thrust::detail::it_difference_t<RandomAccessIterator>;
 
+  using value_type = thrust::detail::it_value_t<RandomAccessIterator>;
+
   if (first == last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const int num_threads = omp::detail::thread_count(exec, last - first);
+
+  if (num_threads <= 1)
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  // arithmetic keys compared with less or greater are radix sorted
+  if constexpr (system::detail::sequential::sort_detail::use_primitive_sort<value_type, StrictWeakOrdering>)
+  {
+    if (static_cast<size_t>(last - first) >= sort_detail::parallel_radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_radix_sort<
+        system::detail::sequential::sort_detail::needs_reverse<value_type, StrictWeakOrdering>>(
+        exec,
+        sort_detail::parallel_for_fn{num_threads},
+        static_cast<IndexType>(num_threads),
+        first,
+        thrust::system::detail::internal::radix_sort_detail::no_values{},
+        static_cast<IndexType>(last - first));
+      return;
+    }
+  }
+
+  // the merge rounds ping-pong between the input and this buffer
+  thrust::detail::temporary_array<value_type, DerivedPolicy> buffer(exec, last - first);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(last - first, 1, omp_get_num_threads());
 
@@ -116,36 +239,45 @@ void stable_sort(
     // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    // every round merges pairs of sorted runs of h tiles, and every thread produces its own tile of the output
+    bool in_buffer = false;
 
-    while (nseg > 1)
+    for (IndexType h = 1; h < decomp.size(); h *= 2)
     {
-      if (c >= decomp.size())
-      {
-        c = decomp.size() - 1;
-      }
-
-      if ((p_i % h) == 0 && c > b)
+      if (p_i < decomp.size())
       {
-        sort_detail::inplace_merge(
-          exec, first + decomp[a].begin(), first + decomp[b].end(), first + decomp[c].end(), comp);
-
-        b = c;
-        c += h;
+        auto merge_into_buffer = [&](IndexType begin, IndexType middle, IndexType end, IndexType d0, IndexType d1) {
+          sort_detail::merge_slice(first, buffer.begin(), begin, middle, end, d0, d1, comp);
+        };
+        auto merge_from_buffer = [&](IndexType begin, IndexType middle, IndexType end, IndexType d0, IndexType d1) {
+          sort_detail::merge_slice(buffer.begin(), first, begin, middle, end, d0, d1, comp);
+        };
+
+        if (in_buffer)
+        {
+          sort_detail::for_each_merge_slice(decomp, h, decomp[p_i].begin(), decomp[p_i].end(), merge_from_buffer);
+        }
+        else
+        {
+          sort_detail::for_each_merge_slice(decomp, h, decomp[p_i].begin(), decomp[p_i].end(), merge_into_buffer);
+        }
       }
 
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
     }
+
+    if (in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   buffer.begin() + decomp[p_i].begin(),
+                   buffer.begin() + decomp[p_i].end(),
+                   first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
@@ -174,12 +306,44 @@ void stable_sort_by_key(
 #if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
   using IndexType = thrust::detail::it_difference_t<RandomAccessIterator1>;
 
+  using value_type1 = thrust::detail::it_value_t<RandomAccessIterator1>;
+  using value_type2 = thrust::detail::it_value_t<RandomAccessIterator2>;
+
   if (keys_first == keys_last)
   {
     return;
   }
 
-  THRUST_PRAGMA_OMP(parallel)
+  const int num_threads = omp::detail::thread_count(exec, keys_last - keys_first);
+
+  if (num_threads <= 1)
+  {
+    thrust::stable_sort_by_key(thrust::seq, keys_first, keys_last, values_first, comp);
+    return;
+  }
+
+  // arithmetic keys compared with less or greater are radix sorted
+  if constexpr (system::detail::sequential::sort_detail::use_primitive_sort<value_type1, StrictWeakOrdering>)
+  {
+    if (static_cast<size_t>(keys_last - keys_first) >= sort_detail::parallel_radix_sort_threshold)
+    {
+      thrust::system::detail::internal::parallel_radix_sort<
+        system::detail::sequential::sort_detail::needs_reverse<value_type1, StrictWeakOrdering>>(
+        exec,
+        sort_detail::parallel_for_fn{num_threads},
+        static_cast<IndexType>(num_threads),
+        keys_first,
+        values_first,
+        static_cast<IndexType>(keys_last - keys_first));
+      return;
+    }
+  }
+
+  // the merge rounds ping-pong between the input and these buffers
+  thrust::detail::temporary_array<value_type1, DerivedPolicy> keys_buffer(exec, keys_last - keys_first);
+  thrust::detail::temporary_array<value_type2, DerivedPolicy> values_buffer(exec, keys_last - keys_first);
+
+  THRUST_PRAGMA_OMP(parallel num_threads(num_threads))
   {
     thrust::system::detail::internal::uniform_decomposition<IndexType> decomp(
       keys_last - keys_first, 1, omp_get_num_threads());
@@ -203,43 +367,75 @@ void stable_sort_by_key(
     // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
     ;
 
-    IndexType nseg = decomp.size();
-    IndexType h    = 2;
-
-    // keep track of which sub-range we're processing
-    IndexType a = p_i, b = p_i, c = p_i + 1;
+    // every round merges pairs of sorted runs of h tiles, and every thread produces its own tile of the output
+    bool in_buffer = false;
 
-    while (nseg > 1)
+    for (IndexType h = 1; h < decomp.size(); h *= 2)
     {
-      if (c >= decomp.size())
+      if (p_i < decomp.size())
       {
-        c = decomp.size() - 1;
+        auto merge_into_buffer = [&](IndexType begin, IndexType middle, IndexType end, IndexType d0, IndexType d1) {
+          sort_detail::merge_slice_by_key(
+            keys_first, values_first, keys_buffer.begin(), values_buffer.begin(), begin, middle, end, d0, d1, comp);
+        };
+        auto merge_from_buffer = [&](IndexType begin, IndexType middle, IndexType end, IndexType d0, IndexType d1) {
+          sort_detail::merge_slice_by_key(
+            keys_buffer.begin(), values_buffer.begin(), keys_first, values_first, begin, middle, end, d0, d1, comp);
+        };
+
+        if (in_buffer)
+        {
+          sort_detail::for_each_merge_slice(decomp, h, decomp[p_i].begin(), decomp[p_i].end(), merge_from_buffer);
+        }
+        else
+        {
+          sort_detail::for_each_merge_slice(decomp, h, decomp[p_i].begin(), decomp[p_i].end(), merge_into_buffer);
+        }
       }
 
-      if ((p_i % h) == 0 && c > b)
-      {
-        sort_detail::inplace_merge_by_key(
-          exec,
-          keys_first + decomp[a].begin(),
-          keys_first + decomp[b].end(),
-          keys_first + decomp[c].end(),
-          values_first + decomp[a].begin(),
-          comp);
-
-        b = c;
-        c += h;
-      }
-
-      nseg = (nseg + 1) / 2;
-      h *= 2;
+      in_buffer = !in_buffer;
 
       THRUST_PRAGMA_OMP(barrier)
 
       // #5020: For some reason, MSVC may yield an error unless we include this meaningless semicolon here
       ;
     }
+
+    if (in_buffer && p_i < decomp.size())
+    {
+      thrust::copy(thrust::seq,
+                   keys_buffer.begin() + decomp[p_i].begin(),
+                   keys_buffer.begin() + decomp[p_i].end(),
+                   keys_first + decomp[p_i].begin());
+      thrust::copy(thrust::seq,
+                   values_buffer.begin() + decomp[p_i].begin(),
+                   values_buffer.begin() + decomp[p_i].end(),
+                   values_first + decomp[p_i].begin());
+    }
   }
 #endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
 }
+
+// the parallel merge sort is also used for unstable sorts, instead of the sequential sort inherited from cpp
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  thrust::stable_sort(exec, first, last, comp);
+}
+
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  thrust::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
+}
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
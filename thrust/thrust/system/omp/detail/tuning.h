@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+
+#include <cuda/std/cstddef>
+
+// don't attempt to #include this file without omp support
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <omp.h>
+#endif // omp support
+
+THRUST_NAMESPACE_BEGIN
+namespace system::omp::detail
+{
+template <typename DerivedPolicy>
+tuning tuning_of(execution_policy<DerivedPolicy>& exec)
+{
+  return get_tuning(thrust::detail::derived_cast(exec));
+}
+
+// the maximum number of threads of an algorithm, ignoring its input size
+inline int max_threads(const tuning& t)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  return t.num_threads > 0 ? t.num_threads : omp_get_max_threads();
+#else
+  return 1;
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+}
+
+// the number of threads to process n elements with, or one to process them sequentially on the calling thread.
+// default_cutoff is the input size below which the algorithm runs sequentially unless the policy sets a cutoff.
+template <typename Size>
+int thread_count(const tuning& t, Size n, ::cuda::std::size_t default_cutoff = 0)
+{
+  const ::cuda::std::size_t size   = n > 0 ? static_cast<::cuda::std::size_t>(n) : 0;
+  const ::cuda::std::size_t cutoff = t.sequential_cutoff > 0 ? t.sequential_cutoff : default_cutoff;
+
+  if (size < cutoff)
+  {
+    return 1;
+  }
+
+  // every thread gets at least grain_size elements
+  const ::cuda::std::size_t grain = t.grain_size > 0 ? t.grain_size : 1;
+  const ::cuda::std::size_t limit = (size + grain - 1) / grain;
+
+  const auto threads = static_cast<::cuda::std::size_t>(max_threads(t));
+  return static_cast<int>(threads < limit ? threads : (limit > 0 ? limit : 1));
+}
+
+template <typename DerivedPolicy, typename Size>
+int thread_count(execution_policy<DerivedPolicy>& exec, Size n, ::cuda::std::size_t default_cutoff = 0)
+{
+  return omp::detail::thread_count(omp::detail::tuning_of(exec), n, default_cutoff);
+}
+
+// invokes f(i) for every i in [0, n) on the given number of threads, with the schedule of the tuning
+template <typename Size, typename Function>
+void parallel_for(const tuning& t, [[maybe_unused]] int num_threads, Size n, Function f)
+{
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+  if (num_threads > 1)
+  {
+    const Size chunk = t.grain_size > 0 ? static_cast<Size>(t.grain_size) : Size(1);
+
+    switch (t.schedule)
+    {
+      case schedule_kind::dynamic:
+        THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(dynamic, chunk))
+        for (Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+        return;
+      case schedule_kind::guided:
+        THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(guided, chunk))
+        for (Size i = 0; i < n; ++i)
+        {
+          f(i);
+        }
+        return;
+      default:
+        if (t.grain_size > 0)
+        {
+          THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static, chunk))
+          for (Size i = 0; i < n; ++i)
+          {
+            f(i);
+          }
+        }
+        else
+        {
+          THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) schedule(static))
+          for (Size i = 0; i < n; ++i)
+          {
+            f(i);
+          }
+        }
+        return;
+    }
+  }
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
+  for (Size i = 0; i < n; ++i)
+  {
+    f(i);
+  }
+}
+} // end namespace system::omp::detail
+THRUST_NAMESPACE_END
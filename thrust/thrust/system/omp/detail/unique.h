@@ -13,10 +13,17 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/unique.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/unique.h>
+#include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/tuning.h>
+#include <thrust/system/omp/detail/unique_by_key.h>
 
-#include <cuda/std/__utility/pair.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/cstdint>
 
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
@@ -25,8 +32,31 @@ template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredi
 ForwardIterator
 unique(execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique to cpp::unique
-  return thrust::system::detail::generic::unique(exec, first, last, binary_pred);
+  using Size = thrust::detail::it_difference_t<ForwardIterator>;
+
+  if constexpr (unique_by_key_detail::is_random_access_v<ForwardIterator>)
+  {
+    const Size n = ::cuda::std::distance(first, last);
+
+    if (unique_by_key_detail::use_parallel_unique(exec, n))
+    {
+      // the blocks cannot compact in place without racing each other, so stage the heads
+      thrust::detail::temporary_array<thrust::detail::it_value_t<ForwardIterator>, DerivedPolicy> keys(exec, n);
+
+      const Size count = unique_by_key_detail::unique_by_key_copy(
+        exec,
+        first,
+        n,
+        unique_by_key_detail::no_values{},
+        keys.begin(),
+        unique_by_key_detail::no_values{},
+        binary_pred);
+
+      return omp::detail::copy(exec, keys.begin(), keys.begin() + count, first);
+    }
+  }
+
+  return system::detail::sequential::unique(exec, first, last, binary_pred);
 } // end unique()
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryPredicate>
@@ -37,16 +67,63 @@ OutputIterator unique_copy(
   OutputIterator output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_copy to cpp::unique_copy
-  return thrust::system::detail::generic::unique_copy(exec, first, last, output, binary_pred);
+  using Size = thrust::detail::it_difference_t<InputIterator>;
+
+  if constexpr (unique_by_key_detail::is_random_access_v<InputIterator, OutputIterator>)
+  {
+    const Size n = ::cuda::std::distance(first, last);
+
+    if (unique_by_key_detail::use_parallel_unique(exec, n))
+    {
+      const Size count = unique_by_key_detail::unique_by_key_copy(
+        exec,
+        first,
+        n,
+        unique_by_key_detail::no_values{},
+        output,
+        unique_by_key_detail::no_values{},
+        binary_pred);
+
+      return output + count;
+    }
+  }
+
+  return system::detail::sequential::unique_copy(exec, first, last, output, binary_pred);
 } // end unique_copy()
 
 template <typename DerivedPolicy, typename ForwardIterator, typename BinaryPredicate>
 thrust::detail::it_difference_t<ForwardIterator> unique_count(
   execution_policy<DerivedPolicy>& exec, ForwardIterator first, ForwardIterator last, BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_count to cpp::unique_count
-  return thrust::system::detail::generic::unique_count(exec, first, last, binary_pred);
+  using KeyType    = thrust::detail::it_value_t<ForwardIterator>;
+  using Size       = thrust::detail::it_difference_t<ForwardIterator>;
+  using index_type = std::intptr_t;
+
+  if constexpr (unique_by_key_detail::is_random_access_v<ForwardIterator>)
+  {
+    const Size n = ::cuda::std::distance(first, last);
+
+    if (unique_by_key_detail::use_parallel_unique(exec, n))
+    {
+      // the first element is always a segment head
+      Size count = 1;
+
+      const int num_threads = omp::detail::thread_count(exec, n, parallel_scan_threshold);
+
+      THRUST_PRAGMA_OMP(parallel for num_threads(num_threads) reduction(+ : count))
+      for (index_type i = 1; i < static_cast<index_type>(n); ++i)
+      {
+        if (!binary_pred(KeyType(first[i - 1]), KeyType(first[i])))
+        {
+          ++count;
+        }
+      }
+
+      return count;
+    }
+  }
+
+  return system::detail::sequential::unique_count(exec, first, last, binary_pred);
 } // end unique_count()
 } // end namespace system::omp::detail
 THRUST_NAMESPACE_END
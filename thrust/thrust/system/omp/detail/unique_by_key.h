@@ -13,14 +13,159 @@
 #  pragma system_header
 #endif // no system header
 
-#include <thrust/system/detail/generic/unique_by_key.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/unique_by_key.h>
+#include <thrust/system/omp/detail/copy.h>
 #include <thrust/system/omp/detail/execution_policy.h>
+#include <thrust/system/omp/detail/pragma_omp.h>
+#include <thrust/system/omp/detail/scan.h>
+#include <thrust/system/omp/detail/tuning.h>
 
+#include <cuda/__cmath/ceil_div.h>
+#include <cuda/std/__algorithm/min.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__type_traits/is_same.h>
 #include <cuda/std/__utility/pair.h>
 
+#include <omp.h>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::omp::detail
 {
+namespace unique_by_key_detail
+{
+// marks a keys-only unique
+struct no_values
+{};
+
+template <typename... Iterators>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<Iterators>::type...>,
+  random_access_traversal_tag>;
+
+// Returns whether [keys_first, keys_first + n) is large enough to be worth the parallel unique
+template <typename DerivedPolicy, typename Size>
+bool use_parallel_unique(execution_policy<DerivedPolicy>& exec, Size n)
+{
+  return omp::detail::thread_count(exec, n, parallel_scan_threshold) > 1;
+}
+
+// Every block counts its segment heads, then copies them to its scanned output offset.
+// values_first and values_output are ignored if they are no_values.
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator1,
+          typename OutputIterator2,
+          typename BinaryPredicate>
+thrust::detail::it_difference_t<InputIterator1> unique_by_key_copy(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 keys_first,
+  thrust::detail::it_difference_t<InputIterator1> n,
+  [[maybe_unused]] InputIterator2 values_first,
+  OutputIterator1 keys_output,
+  [[maybe_unused]] OutputIterator2 values_output,
+  BinaryPredicate binary_pred)
+{
+  using namespace thrust::detail;
+
+  using KeyType = it_value_t<InputIterator1>;
+  using Size    = it_difference_t<InputIterator1>;
+
+  constexpr bool has_values = !::cuda::std::is_same_v<InputIterator2, no_values>;
+
+  // The chosen block size may leave some threads without work
+  const int num_threads    = omp::detail::thread_count(exec, n, parallel_scan_threshold);
+  const Size block_size    = ::cuda::ceil_div(n, static_cast<Size>(num_threads));
+  const int active_threads = static_cast<int>(::cuda::ceil_div(n, block_size));
+
+  // the number of segment heads in every block, scanned into output offsets
+  temporary_array<Size, DerivedPolicy> offsets(exec, active_threads);
+
+  // Step 1: Count the segment heads of each block (N key reads)
+  THRUST_PRAGMA_OMP(parallel num_threads(active_threads))
+  {
+    const int tid    = omp_get_thread_num();
+    const Size start = tid * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    KeyType prev_key = keys_first[start];
+    Size count       = (tid == 0 || !binary_pred(KeyType(keys_first[start - 1]), prev_key)) ? 1 : 0;
+
+    for (Size i = start + 1; i < end; ++i)
+    {
+      KeyType key = keys_first[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+      if (!binary_pred(prev_key, key))
+      {
+        ++count;
+      }
+
+      prev_key = key;
+    }
+
+    offsets[tid] = count;
+  }
+
+  // Step 2: Scan the head counts
+  Size sum = 0;
+  for (int tid = 0; tid < active_threads; ++tid)
+  {
+    const Size count = offsets[tid];
+    offsets[tid]     = sum;
+    sum += count;
+  }
+
+  // Step 3: Copy the segment heads of each block (N key reads, output writes)
+  THRUST_PRAGMA_OMP(parallel num_threads(active_threads))
+  {
+    const int tid    = omp_get_thread_num();
+    const Size start = tid * block_size;
+    const Size end   = (::cuda::std::min) (start + block_size, n);
+
+    Size out = offsets[tid];
+
+    KeyType prev_key = keys_first[start];
+
+    if (tid == 0 || !binary_pred(KeyType(keys_first[start - 1]), prev_key))
+    {
+      keys_output[out] = prev_key;
+
+      if constexpr (has_values)
+      {
+        values_output[out] = values_first[start];
+      }
+
+      ++out;
+    }
+
+    for (Size i = start + 1; i < end; ++i)
+    {
+      KeyType key = keys_first[i]; // NOLINT(performance-unnecessary-copy-initialization)
+
+      if (!binary_pred(prev_key, key))
+      {
+        keys_output[out] = key;
+
+        if constexpr (has_values)
+        {
+          values_output[out] = values_first[i];
+        }
+
+        ++out;
+      }
+
+      prev_key = key;
+    }
+  }
+
+  return sum;
+}
+} // namespace unique_by_key_detail
+
 template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIterator2, typename BinaryPredicate>
 ::cuda::std::pair<ForwardIterator1, ForwardIterator2> unique_by_key(
   execution_policy<DerivedPolicy>& exec,
@@ -29,8 +174,29 @@ template <typename DerivedPolicy, typename ForwardIterator1, typename ForwardIte
   ForwardIterator2 values_first,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key to cpp::unique_by_key
-  return thrust::system::detail::generic::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
+  using Size = thrust::detail::it_difference_t<ForwardIterator1>;
+
+  if constexpr (unique_by_key_detail::is_random_access_v<ForwardIterator1, ForwardIterator2>)
+  {
+    const Size n = ::cuda::std::distance(keys_first, keys_last);
+
+    if (unique_by_key_detail::use_parallel_unique(exec, n))
+    {
+      // the blocks cannot compact in place without racing each other, so stage the heads
+      thrust::detail::temporary_array<thrust::detail::it_value_t<ForwardIterator1>, DerivedPolicy> keys(exec, n);
+      thrust::detail::temporary_array<thrust::detail::it_value_t<ForwardIterator2>, DerivedPolicy> values(exec, n);
+
+      const Size count = unique_by_key_detail::unique_by_key_copy(
+        exec, keys_first, n, values_first, keys.begin(), values.begin(), binary_pred);
+
+      omp::detail::copy(exec, keys.begin(), keys.begin() + count, keys_first);
+      omp::detail::copy(exec, values.begin(), values.begin() + count, values_first);
+
+      return ::cuda::std::make_pair(keys_first + count, values_first + count);
+    }
+  }
+
+  return system::detail::sequential::unique_by_key(exec, keys_first, keys_last, values_first, binary_pred);
 } // end unique_by_key()
 
 template <typename DerivedPolicy,
@@ -48,8 +214,23 @@ template <typename DerivedPolicy,
   OutputIterator2 values_output,
   BinaryPredicate binary_pred)
 {
-  // omp prefers generic::unique_by_key_copy to cpp::unique_by_key_copy
-  return thrust::system::detail::generic::unique_by_key_copy(
+  using Size = thrust::detail::it_difference_t<InputIterator1>;
+
+  if constexpr (unique_by_key_detail::
+                  is_random_access_v<InputIterator1, InputIterator2, OutputIterator1, OutputIterator2>)
+  {
+    const Size n = ::cuda::std::distance(keys_first, keys_last);
+
+    if (unique_by_key_detail::use_parallel_unique(exec, n))
+    {
+      const Size count = unique_by_key_detail::unique_by_key_copy(
+        exec, keys_first, n, values_first, keys_output, values_output, binary_pred);
+
+      return ::cuda::std::make_pair(keys_output + count, values_output + count);
+    }
+  }
+
+  return system::detail::sequential::unique_by_key_copy(
     exec, keys_first, keys_last, values_first, keys_output, values_output, binary_pred);
 } // end unique_by_key_copy()
 } // end namespace system::omp::detail
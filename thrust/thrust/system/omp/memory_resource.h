@@ -19,6 +19,7 @@
 
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/page_resource.h>
 #include <thrust/system/omp/pointer.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -31,6 +32,8 @@ using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delet
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::omp::universal_pointer<void>>;
+
+using page_native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::page_resource, thrust::omp::pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -51,6 +54,11 @@ using universal_memory_resource = detail::universal_native_resource;
 /*! An alias for \p omp::universal_memory_resource. */
 using universal_host_pinned_memory_resource = universal_memory_resource;
 
+/*! A memory resource for the OpenMP system which maps large allocations with huge pages and can place them on
+ *  specific NUMA nodes. Uses \p mr::page_resource and tags it with \p omp::pointer.
+ */
+using page_memory_resource = detail::page_native_resource;
+
 /*! \}
  */
 } // namespace system::omp
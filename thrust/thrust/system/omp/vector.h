@@ -21,6 +21,13 @@
 #include <thrust/detail/vector_base.h>
 #include <thrust/system/omp/memory.h>
 
+// construct elements with the parallel algorithms, so that the pages of a vector are first touched by, and placed on
+// the NUMA nodes of, the threads which later work on them
+#if (THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE == THRUST_TRUE)
+#  include <thrust/system/omp/detail/copy.h>
+#  include <thrust/system/omp/detail/for_each.h>
+#endif // THRUST_DEVICE_COMPILER_IS_OMP_CAPABLE
+
 #include <vector>
 
 THRUST_NAMESPACE_BEGIN
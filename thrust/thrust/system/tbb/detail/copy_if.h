@@ -14,11 +14,15 @@
 #endif // no system header
 
 #include <thrust/detail/function.h>
+#include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/copy_if.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
@@ -28,6 +32,14 @@ namespace system::tbb::detail
 {
 namespace copy_if_detail
 {
+// the body offsets the iterators to the start of every range, so only random access iterators are copied in parallel
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                               typename iterator_traversal<InputIterator2>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
 template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate, typename Size>
 struct body
 {
@@ -95,23 +107,39 @@ struct body
 }; // end body
 } // namespace copy_if_detail
 
-template <typename InputIterator1, typename InputIterator2, typename OutputIterator, typename Predicate>
-OutputIterator
-copy_if(tag, InputIterator1 first, InputIterator1 last, InputIterator2 stencil, OutputIterator result, Predicate pred)
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename Predicate>
+OutputIterator copy_if(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first,
+  InputIterator1 last,
+  InputIterator2 stencil,
+  OutputIterator result,
+  Predicate pred)
 {
-  using Size = thrust::detail::it_difference_t<InputIterator1>;
-  using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
+  if constexpr (copy_if_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    using Size = thrust::detail::it_difference_t<InputIterator1>;
+    using Body = typename copy_if_detail::body<InputIterator1, InputIterator2, OutputIterator, Predicate, Size>;
 
-  Size n = ::cuda::std::distance(first, last);
+    Size n = ::cuda::std::distance(first, last);
 
-  if (n != 0)
+    if (n != 0)
+    {
+      Body body(first, stencil, result, pred);
+      tbb::detail::parallel_scan(tbb::detail::tuning_of(exec), n, body);
+      ::cuda::std::advance(result, body.sum);
+    }
+
+    return result;
+  }
+  else
   {
-    Body body(first, stencil, result, pred);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), body);
-    ::cuda::std::advance(result, body.sum);
+    return system::detail::sequential::copy_if(exec, first, last, stencil, result, pred);
   }
-
-  return result;
 } // end copy_if()
 } // namespace system::tbb::detail
 THRUST_NAMESPACE_END
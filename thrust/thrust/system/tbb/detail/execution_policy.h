@@ -16,6 +16,9 @@
 #include <thrust/system/cpp/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 
+#include <cuda/__execution/determinism.h>
+#include <cuda/std/cstddef>
+
 THRUST_NAMESPACE_BEGIN
 namespace system::tbb
 {
@@ -48,10 +51,168 @@ struct execution_policy : cpp::execution_policy<Derived>
   }
 };
 
+//! The TBB partitioners with which \p thrust::tbb::par splits ranges into tasks, see \p tuning.
+enum class partitioner_kind
+{
+  //! Splits ranges adaptively, depending on the load of the worker threads.
+  auto_,
+  //! Splits ranges down to \p tuning::grain_size elements.
+  simple,
+  //! Splits ranges evenly over the worker threads up front. Scans, which do not support it, use \p auto_.
+  static_
+};
+
+//! Per-call tuning parameters of the TBB backend, attached to \p thrust::tbb::par with \p par.with(tuning) or the
+//! individual setters \p num_threads, \p grain_size, \p sequential_cutoff, \p partitioner and \p require. Zero
+//! selects the default of a parameter.
+struct tuning
+{
+  //! The maximum number of threads an algorithm runs on. Algorithms run in a task arena of this many threads if it
+  //! differs from the concurrency of the current task arena, which is the default.
+  int num_threads = 0;
+  //! The number of elements below which ranges are not split further. Defaults to a size chosen by every algorithm.
+  ::cuda::std::size_t grain_size = 0;
+  //! Inputs with fewer elements run sequentially on the calling thread. Defaults to a threshold chosen by every
+  //! algorithm, which is zero for most of them.
+  ::cuda::std::size_t sequential_cutoff = 0;
+  //! The partitioner of algorithms which split a range of elements, like \p for_each, \p reduce and
+  //! \p inclusive_scan. Algorithms which split their input into explicit partitions ignore it.
+  partitioner_kind partitioner = partitioner_kind::auto_;
+  //! The reproducibility of \p reduce, \p transform_reduce and \p reduce_by_key, set with \p require. Under
+  //! \p cuda::execution::determinism::run_to_run their results do not depend on the number of threads. Under
+  //! \p gpu_to_gpu the sums of \p float or \p double computed by \p reduce and \p transform_reduce additionally do
+  //! not depend on the order of the elements, and match the deterministic sums of the CUDA backend; \p reduce_by_key
+  //! treats it like \p run_to_run. Defaults to \p not_guaranteed.
+  ::cuda::execution::determinism::__determinism_t determinism =
+    ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+};
+
+template <typename Derived>
+struct execute_with_tuning_base : execution_policy<Derived>
+{
+private:
+  tuning m_tuning;
+
+public:
+  constexpr execute_with_tuning_base(tuning t = {})
+      : m_tuning(t)
+  {}
+
+  //! Replaces all tuning parameters.
+  Derived with(tuning t) const
+  {
+    Derived result  = thrust::detail::derived_cast(*this);
+    result.m_tuning = t;
+    return result;
+  }
+
+  //! Sets the maximum number of threads.
+  Derived num_threads(int n) const
+  {
+    Derived result              = thrust::detail::derived_cast(*this);
+    result.m_tuning.num_threads = n;
+    return result;
+  }
+
+  //! Sets the number of elements below which ranges are not split further.
+  Derived grain_size(::cuda::std::size_t n) const
+  {
+    Derived result             = thrust::detail::derived_cast(*this);
+    result.m_tuning.grain_size = n;
+    return result;
+  }
+
+  //! Sets the input size below which algorithms run sequentially.
+  Derived sequential_cutoff(::cuda::std::size_t n) const
+  {
+    Derived result                    = thrust::detail::derived_cast(*this);
+    result.m_tuning.sequential_cutoff = n;
+    return result;
+  }
+
+  //! Sets the partitioner of ranges.
+  Derived partitioner(partitioner_kind kind) const
+  {
+    Derived result              = thrust::detail::derived_cast(*this);
+    result.m_tuning.partitioner = kind;
+    return result;
+  }
+
+  //! Sets the required determinism, e.g. \p cuda::execution::determinism::run_to_run.
+  template <::cuda::execution::determinism::__determinism_t Guarantee>
+  Derived require(::cuda::execution::determinism::__determinism_holder_t<Guarantee>) const
+  {
+    Derived result              = thrust::detail::derived_cast(*this);
+    result.m_tuning.determinism = Guarantee;
+    return result;
+  }
+
+private:
+  friend tuning get_tuning(const execute_with_tuning_base& exec)
+  {
+    return exec.m_tuning;
+  }
+};
+
+struct execute_with_tuning : execute_with_tuning_base<execute_with_tuning>
+{
+  execute_with_tuning() = default;
+
+  constexpr execute_with_tuning(tuning t)
+      : execute_with_tuning_base(t)
+  {}
+};
+
+// policies without attached tuning use the defaults
+template <typename Derived>
+tuning get_tuning(const execution_policy<Derived>&)
+{
+  return {};
+}
+
 struct par_t
     : execution_policy<par_t>
-    , thrust::detail::allocator_aware_execution_policy<execution_policy>
-{};
+    , thrust::detail::allocator_aware_execution_policy<execute_with_tuning_base>
+{
+  using tuning_attachment_type = execute_with_tuning;
+
+  //! Attaches tuning parameters to the policy.
+  tuning_attachment_type with(tuning t) const
+  {
+    return execute_with_tuning(t);
+  }
+
+  //! Sets the maximum number of threads.
+  tuning_attachment_type num_threads(int n) const
+  {
+    return execute_with_tuning().num_threads(n);
+  }
+
+  //! Sets the number of elements below which ranges are not split further.
+  tuning_attachment_type grain_size(::cuda::std::size_t n) const
+  {
+    return execute_with_tuning().grain_size(n);
+  }
+
+  //! Sets the input size below which algorithms run sequentially.
+  tuning_attachment_type sequential_cutoff(::cuda::std::size_t n) const
+  {
+    return execute_with_tuning().sequential_cutoff(n);
+  }
+
+  //! Sets the partitioner of ranges.
+  tuning_attachment_type partitioner(partitioner_kind kind) const
+  {
+    return execute_with_tuning().partitioner(kind);
+  }
+
+  //! Sets the required determinism, e.g. \p cuda::execution::determinism::run_to_run.
+  template <::cuda::execution::determinism::__determinism_t Guarantee>
+  tuning_attachment_type require(::cuda::execution::determinism::__determinism_holder_t<Guarantee> guarantee) const
+  {
+    return execute_with_tuning().require(guarantee);
+  }
+};
 } // namespace detail
 
 //! \addtogroup execution_policies
@@ -66,6 +227,12 @@ using detail::tag;
 //! Thrust's TBB backend system.
 using detail::execution_policy;
 
+//! \p thrust::tbb::tuning holds the per-call tuning parameters of \p thrust::tbb::par.
+using detail::tuning;
+
+//! \p thrust::tbb::partitioner_kind selects how \p thrust::tbb::par splits ranges into tasks.
+using detail::partitioner_kind;
+
 //! \p thrust::tbb::par is the parallel execution policy associated with Thrust's TBB backend system.
 //!
 //! Instead of relying on implicit algorithm dispatch through iterator system tags, users may directly target Thrust's
@@ -98,6 +265,19 @@ using detail::execution_policy;
 //!
 //! // 0 1 2 is printed to standard output in some unspecified order
 //! \endcode
+//!
+//! Tuning parameters can be attached per call, e.g. to keep small latency-sensitive calls on the calling thread while
+//! large calls use all threads:
+//!
+//! \code
+//! thrust::sort(thrust::tbb::par.sequential_cutoff(1 << 16).num_threads(8), vec.begin(), vec.end());
+//! thrust::for_each(thrust::tbb::par.partitioner(thrust::tbb::partitioner_kind::simple).grain_size(64),
+//!                  vec.begin(), vec.end(), f);
+//!
+//! // the same sum for any number of threads
+//! float sum =
+//!   thrust::reduce(thrust::tbb::par.require(cuda::execution::determinism::gpu_to_gpu), vec.begin(), vec.end());
+//! \endcode
 inline constexpr detail::par_t par;
 
 //! \}
@@ -108,6 +288,8 @@ namespace tbb
 {
 using system::tbb::execution_policy;
 using system::tbb::par;
+using system::tbb::partitioner_kind;
 using system::tbb::tag;
+using system::tbb::tuning;
 } // namespace tbb
 THRUST_NAMESPACE_END
@@ -17,6 +17,7 @@
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__iterator/distance.h>
 
@@ -54,9 +55,10 @@ body<RandomAccessIterator, Size, UnaryFunction> make_body(RandomAccessIterator f
 } // namespace for_each_detail
 
 template <typename DerivedPolicy, typename RandomAccessIterator, typename Size, typename UnaryFunction>
-RandomAccessIterator for_each_n(execution_policy<DerivedPolicy>&, RandomAccessIterator first, Size n, UnaryFunction f)
+RandomAccessIterator
+for_each_n(execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, Size n, UnaryFunction f)
 {
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, n), for_each_detail::make_body<Size>(first, f));
+  tbb::detail::parallel_for(tbb::detail::tuning_of(exec), n, for_each_detail::make_body<Size>(first, f));
 
   // return the end of the range
   return first + n;
@@ -18,6 +18,7 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <tbb/parallel_for.h>
 
@@ -229,13 +230,19 @@ struct body
 };
 } // end namespace merge_by_key_detail
 
+// the number of elements below which merge ranges are not split
+inline size_t merge_grain_size(const tuning& t, size_t n)
+{
+  return tbb::detail::runs_sequentially(t, n) ? n : tbb::detail::grain_size(t, size_t{1024});
+}
+
 template <typename DerivedPolicy,
           typename InputIterator1,
           typename InputIterator2,
           typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
-merge(execution_policy<DerivedPolicy>&,
+merge(execution_policy<DerivedPolicy>& exec,
       InputIterator1 first1,
       InputIterator1 last1,
       InputIterator2 first2,
@@ -245,10 +252,16 @@ merge(execution_policy<DerivedPolicy>&,
 {
   using Range = typename merge_detail::range<InputIterator1, InputIterator2, OutputIterator, StrictWeakOrdering>;
   using Body  = merge_detail::body;
-  Range range(first1, last1, first2, last2, result, comp);
+  const tuning t = tbb::detail::tuning_of(exec);
+  const size_t n = ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2);
+
+  // ranges below the sequential cutoff are never split
+  Range range(first1, last1, first2, last2, result, comp, tbb::detail::merge_grain_size(t, n));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  tbb::detail::execute(t, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   ::cuda::std::advance(result, ::cuda::std::distance(first1, last1) + ::cuda::std::distance(first2, last2));
 
@@ -264,7 +277,7 @@ template <typename DerivedPolicy,
           typename OutputIterator2,
           typename StrictWeakOrdering>
 ::cuda::std::pair<OutputIterator1, OutputIterator2> merge_by_key(
-  execution_policy<DerivedPolicy>&,
+  execution_policy<DerivedPolicy>& exec,
   InputIterator1 keys_first1,
   InputIterator1 keys_last1,
   InputIterator2 keys_first2,
@@ -285,11 +298,26 @@ template <typename DerivedPolicy,
     StrictWeakOrdering>;
   using Body = merge_by_key_detail::body;
 
+  const tuning t = tbb::detail::tuning_of(exec);
+  const size_t n = ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2);
+
+  // ranges below the sequential cutoff are never split
   Range range(
-    keys_first1, keys_last1, keys_first2, keys_last2, values_first3, values_first4, keys_result, values_result, comp);
+    keys_first1,
+    keys_last1,
+    keys_first2,
+    keys_last2,
+    values_first3,
+    values_first4,
+    keys_result,
+    values_result,
+    comp,
+    tbb::detail::merge_grain_size(t, n));
   Body body;
 
-  ::tbb::parallel_for(range, body);
+  tbb::detail::execute(t, [&] {
+    ::tbb::parallel_for(range, body);
+  });
 
   ::cuda::std::advance(keys_result,
                        ::cuda::std::distance(keys_first1, keys_last1) + ::cuda::std::distance(keys_first2, keys_last2));
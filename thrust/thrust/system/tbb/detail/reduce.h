@@ -20,11 +20,14 @@
 #include <thrust/detail/static_assert.h>
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/reduce.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__iterator/distance.h>
 
 #include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_reduce.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -99,12 +102,46 @@ struct body
 
 template <typename DerivedPolicy, typename InputIterator, typename OutputType, typename BinaryFunction>
 OutputType reduce(
-  execution_policy<DerivedPolicy>&, InputIterator begin, InputIterator end, OutputType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator begin,
+  InputIterator end,
+  OutputType init,
+  BinaryFunction binary_op)
 {
   using Size = thrust::detail::it_difference_t<InputIterator>;
 
   Size n = ::cuda::std::distance(begin, end);
 
+  const tuning t = tbb::detail::tuning_of(exec);
+
+  if (t.determinism != ::cuda::execution::determinism::__determinism_t::__not_guaranteed)
+  {
+    const bool sequential = tbb::detail::runs_sequentially(t, n);
+
+    return thrust::system::detail::internal::deterministic_reduce(
+      exec,
+      [&](Size num_blocks, auto f) {
+        if (sequential)
+        {
+          for (Size block = 0; block < num_blocks; ++block)
+          {
+            f(block);
+          }
+        }
+        else
+        {
+          tbb::detail::execute(t, [&] {
+            ::tbb::parallel_for(Size(0), num_blocks, f);
+          });
+        }
+      },
+      t.determinism == ::cuda::execution::determinism::__determinism_t::__gpu_to_gpu,
+      begin,
+      n,
+      init,
+      binary_op);
+  }
+
   if (n == 0)
   {
     return init;
@@ -113,7 +150,7 @@ OutputType reduce(
   {
     using Body = typename reduce_detail::body<InputIterator, OutputType, BinaryFunction>;
     Body reduce_body(begin, init, binary_op);
-    ::tbb::parallel_reduce(::tbb::blocked_range<Size>(0, n), reduce_body);
+    tbb::detail::parallel_reduce(t, n, reduce_body);
     return binary_op(init, reduce_body.sum);
   }
 }
@@ -16,8 +16,10 @@
 #include <thrust/detail/seq.h>
 #include <thrust/detail/temporary_array.h>
 #include <thrust/scan.h>
+#include <thrust/system/detail/internal/deterministic_reduce.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
 #include <thrust/system/tbb/detail/reduce_intervals.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__algorithm/max.h>
 #include <cuda/std/__algorithm/min.h>
@@ -26,8 +28,6 @@
 #include <cuda/std/__utility/pair.h>
 #include <cuda/std/cassert>
 
-#include <thread>
-
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_for.h>
 
@@ -290,10 +290,17 @@ template <typename DerivedPolicy,
     return ::cuda::std::make_pair(keys_result, values_result);
   }
 
-  // XXX this value is a tuning opportunity
+  const tuning t = tbb::detail::tuning_of(exec);
+
+  // the default threshold can be overridden by the policy
   const difference_type parallelism_threshold = 10000;
 
-  if (n < parallelism_threshold)
+  // the sums of segments spanning several intervals only depend on the interval size, fixed for determinism
+  const bool deterministic = t.determinism != ::cuda::execution::determinism::__determinism_t::__not_guaranteed;
+  const auto deterministic_interval_size =
+    static_cast<difference_type>(system::detail::internal::deterministic_block_size);
+
+  if (deterministic ? n <= deterministic_interval_size : tbb::detail::runs_sequentially(t, n, parallelism_threshold))
   {
     // don't bother parallelizing for small n
     return thrust::reduce_by_key(
@@ -301,13 +308,18 @@ template <typename DerivedPolicy,
   }
 
   // count the number of processors
-  const unsigned int p = ::cuda::std::max<unsigned int>(1u, std::thread::hardware_concurrency());
+  const unsigned int p = static_cast<unsigned int>(tbb::detail::max_threads(t));
 
-  // generate O(P) intervals of sequential work
+  // generate O(P) intervals of sequential work, unless the policy sets the interval size
   // XXX oversubscribing is a tuning opportunity
   const unsigned int subscription_rate = 1;
-  difference_type interval_size        = ::cuda::std::min<difference_type>(
-    parallelism_threshold, ::cuda::std::max<difference_type>(n, n / (subscription_rate * p)));
+  difference_type interval_size =
+    deterministic
+      ? deterministic_interval_size
+      : tbb::detail::grain_size(
+          t,
+          ::cuda::std::min<difference_type>(
+            parallelism_threshold, ::cuda::std::max<difference_type>(n, n / (subscription_rate * p))));
   difference_type num_intervals = reduce_by_key_detail::divide_ri(n, interval_size);
 
   // decompose the input into intervals of size N / num_intervals
@@ -338,22 +350,35 @@ template <typename DerivedPolicy,
   using carry_type = typename reduce_by_key_detail::partial_sum_type<Iterator2, BinaryFunction>::type;
   thrust::detail::temporary_array<carry_type, DerivedPolicy> carries(0, exec, num_intervals - 1);
 
-  // force grainsize == 1 with simple_partioner()
-  ::tbb::parallel_for(
-    ::tbb::blocked_range<difference_type>(0, num_intervals, 1),
-    reduce_by_key_detail::make_serial_reduce_by_key_body(
-      keys_first,
-      values_first,
-      interval_output_offsets.begin(),
-      keys_result,
-      values_result,
-      carries.begin(),
-      n,
-      interval_size,
-      num_intervals,
-      binary_pred,
-      binary_op),
-    ::tbb::simple_partitioner());
+  const auto body = reduce_by_key_detail::make_serial_reduce_by_key_body(
+    keys_first,
+    values_first,
+    interval_output_offsets.begin(),
+    keys_result,
+    values_result,
+    carries.begin(),
+    n,
+    interval_size,
+    num_intervals,
+    binary_pred,
+    binary_op);
+
+  if (tbb::detail::runs_sequentially(t, n))
+  {
+    // a deterministic reduction below the cutoff of the policy reduces the same intervals on the calling thread
+    for (difference_type i = 0; i < num_intervals; ++i)
+    {
+      body(::tbb::blocked_range<difference_type>(i, i + 1, 1));
+    }
+  }
+  else
+  {
+    // force grainsize == 1 with simple_partioner()
+    tbb::detail::execute(t, [&] {
+      ::tbb::parallel_for(
+        ::tbb::blocked_range<difference_type>(0, num_intervals, 1), body, ::tbb::simple_partitioner());
+    });
+  }
 
   difference_type size_of_result = interval_output_offsets[num_intervals];
 
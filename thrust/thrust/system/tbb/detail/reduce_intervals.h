@@ -17,6 +17,7 @@
 #include <thrust/reduce.h>
 #include <thrust/system/cpp/memory.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__algorithm/min.h>
 #include <cuda/std/__type_traits/decay.h>
@@ -85,7 +86,7 @@ template <typename DerivedPolicy,
           typename RandomAccessIterator2,
           typename BinaryFunction>
 void reduce_intervals(
-  thrust::tbb::execution_policy<DerivedPolicy>&,
+  thrust::tbb::execution_policy<DerivedPolicy>& exec,
   RandomAccessIterator1 first,
   RandomAccessIterator1 last,
   Size interval_size,
@@ -96,9 +97,22 @@ void reduce_intervals(
 
   Size num_intervals = reduce_intervals_detail::divide_ri(n, interval_size);
 
-  ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1),
-                      reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op),
-                      ::tbb::simple_partitioner());
+  const tuning t  = tbb::detail::tuning_of(exec);
+  const auto body = reduce_intervals_detail::make_body(first, result, Size(n), interval_size, binary_op);
+
+  // below the cutoff of the policy, the same intervals are reduced on the calling thread
+  if (tbb::detail::runs_sequentially(t, n))
+  {
+    for (Size i = 0; i < num_intervals; ++i)
+    {
+      body(::tbb::blocked_range<Size>(i, i + 1, 1));
+    }
+    return;
+  }
+
+  tbb::detail::execute(t, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_intervals, 1), body, ::tbb::simple_partitioner());
+  });
 }
 
 template <typename DerivedPolicy, typename RandomAccessIterator1, typename Size, typename RandomAccessIterator2>
@@ -18,12 +18,16 @@
 #endif // no system header
 #include <thrust/detail/function.h>
 #include <thrust/detail/type_traits.h>
+#include <thrust/detail/type_traits/minimum_type.h>
 #include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/sequential/scan.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__functional/invoke.h>
 #include <cuda/std/__iterator/advance.h>
 #include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__type_traits/is_convertible.h>
 
 #include <tbb/blocked_range.h>
 #include <tbb/parallel_scan.h>
@@ -33,6 +37,14 @@ namespace system::tbb::detail
 {
 namespace scan_detail
 {
+// the scan bodies offset the iterators to the start of every range, so only random access iterators are scanned in
+// parallel
+template <typename InputIterator, typename OutputIterator>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
 template <typename InputIterator, typename OutputIterator, typename BinaryFunction, typename ValueType, bool HasInit>
 struct inclusive_body
 {
@@ -218,77 +230,121 @@ struct exclusive_body
 };
 } // namespace scan_detail
 
-template <typename InputIterator, typename OutputIterator, typename BinaryFunction>
-OutputIterator
-inclusive_scan(tag, InputIterator first, InputIterator last, OutputIterator result, BinaryFunction binary_op)
+template <typename DerivedPolicy, typename InputIterator, typename OutputIterator, typename BinaryFunction>
+OutputIterator inclusive_scan(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
-  // Use the input iterator's value type per https://wg21.link/P0571
-  using ValueType = thrust::detail::it_value_t<InputIterator>;
+  if constexpr (scan_detail::is_random_access_v<InputIterator, OutputIterator>)
+  {
+    // Use the input iterator's value type per https://wg21.link/P0571
+    using ValueType = thrust::detail::it_value_t<InputIterator>;
 
-  using Size = thrust::detail::it_difference_t<InputIterator>;
-  Size n     = ::cuda::std::distance(first, last);
+    using Size = thrust::detail::it_difference_t<InputIterator>;
+    Size n     = ::cuda::std::distance(first, last);
 
-  if (n != 0)
-  {
-    using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
-    Body scan_body(first, result, binary_op, *first);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
-  }
+    if (n != 0)
+    {
+      using Body =
+        typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, false>;
+      Body scan_body(first, result, binary_op, *first);
+      tbb::detail::parallel_scan(tbb::detail::tuning_of(exec), n, scan_body);
+    }
 
-  ::cuda::std::advance(result, n);
+    ::cuda::std::advance(result, n);
 
-  return result;
+    return result;
+  }
+  else
+  {
+    return system::detail::sequential::inclusive_scan(exec, first, last, result, binary_op);
+  }
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator inclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
-  // Use the input iterator's value type and the initial value type per wg21.link/p2322
-  using ValueType =
-    typename ::cuda::std::__accumulator_t<BinaryFunction, thrust::detail::it_value_t<InputIterator>, InitialValueType>;
+  if constexpr (scan_detail::is_random_access_v<InputIterator, OutputIterator>)
+  {
+    // Use the input iterator's value type and the initial value type per wg21.link/p2322
+    using ValueType = typename ::cuda::std::
+      __accumulator_t<BinaryFunction, thrust::detail::it_value_t<InputIterator>, InitialValueType>;
 
-  using Size = thrust::detail::it_difference_t<InputIterator>;
-  Size n     = ::cuda::std::distance(first, last);
+    using Size = thrust::detail::it_difference_t<InputIterator>;
+    Size n     = ::cuda::std::distance(first, last);
 
-  if (n != 0)
-  {
-    using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
-    Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
-  }
+    if (n != 0)
+    {
+      using Body = typename scan_detail::inclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType, true>;
+      Body scan_body(first, result, binary_op, init);
+      tbb::detail::parallel_scan(tbb::detail::tuning_of(exec), n, scan_body);
+    }
 
-  ::cuda::std::advance(result, n);
+    ::cuda::std::advance(result, n);
 
-  return result;
+    return result;
+  }
+  else
+  {
+    return system::detail::sequential::inclusive_scan(exec, first, last, result, init, binary_op);
+  }
 }
 
-template <typename InputIterator, typename OutputIterator, typename InitialValueType, typename BinaryFunction>
+template <typename DerivedPolicy,
+          typename InputIterator,
+          typename OutputIterator,
+          typename InitialValueType,
+          typename BinaryFunction>
 OutputIterator exclusive_scan(
-  tag, InputIterator first, InputIterator last, OutputIterator result, InitialValueType init, BinaryFunction binary_op)
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator first,
+  InputIterator last,
+  OutputIterator result,
+  InitialValueType init,
+  BinaryFunction binary_op)
 {
   using namespace thrust::detail;
 
-  // Use the initial value type per https://wg21.link/P0571
-  using ValueType = InitialValueType;
+  if constexpr (scan_detail::is_random_access_v<InputIterator, OutputIterator>)
+  {
+    // Use the initial value type per https://wg21.link/P0571
+    using ValueType = InitialValueType;
 
-  using Size = thrust::detail::it_difference_t<InputIterator>;
-  Size n     = ::cuda::std::distance(first, last);
+    using Size = thrust::detail::it_difference_t<InputIterator>;
+    Size n     = ::cuda::std::distance(first, last);
 
-  if (n != 0)
-  {
-    using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
-    Body scan_body(first, result, binary_op, init);
-    ::tbb::parallel_scan(::tbb::blocked_range<Size>(0, n), scan_body);
-  }
+    if (n != 0)
+    {
+      using Body = typename scan_detail::exclusive_body<InputIterator, OutputIterator, BinaryFunction, ValueType>;
+      Body scan_body(first, result, binary_op, init);
+      tbb::detail::parallel_scan(tbb::detail::tuning_of(exec), n, scan_body);
+    }
 
-  ::cuda::std::advance(result, n);
+    ::cuda::std::advance(result, n);
 
-  return result;
+    return result;
+  }
+  else
+  {
+    return system::detail::sequential::exclusive_scan(exec, first, last, result, init, binary_op);
+  }
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -13,5 +13,253 @@
 #  pragma system_header
 #endif // no system header
 
-// this system inherits set_operations
-#include <thrust/system/cpp/detail/set_operations.h>
+#include <thrust/detail/temporary_array.h>
+#include <thrust/detail/type_traits/minimum_type.h>
+#include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/iterator_traits.h>
+#include <thrust/system/detail/internal/merge_path.h>
+#include <thrust/system/detail/sequential/set_operations.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
+
+#include <cuda/std/__algorithm/max.h>
+#include <cuda/std/__iterator/distance.h>
+#include <cuda/std/__numeric/exclusive_scan.h>
+#include <cuda/std/__type_traits/is_convertible.h>
+#include <cuda/std/__utility/pair.h>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+namespace set_operations_detail
+{
+template <typename InputIterator1, typename InputIterator2, typename OutputIterator>
+inline constexpr bool is_random_access_v = ::cuda::std::is_convertible_v<
+  thrust::detail::minimum_type<typename iterator_traversal<InputIterator1>::type,
+                               typename iterator_traversal<InputIterator2>::type,
+                               typename iterator_traversal<OutputIterator>::type>,
+  random_access_traversal_tag>;
+
+// Splits both inputs into partitions which never separate equivalent elements,
+// counts the output of each partition, then applies serial_op to every partition
+// in parallel at its scanned output offset.
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename RandomAccessIterator3,
+          typename StrictWeakOrdering,
+          typename SerialSetOperation>
+RandomAccessIterator3 set_operation(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 first1,
+  RandomAccessIterator1 last1,
+  RandomAccessIterator2 first2,
+  RandomAccessIterator2 last2,
+  RandomAccessIterator3 result,
+  StrictWeakOrdering comp,
+  SerialSetOperation serial_op)
+{
+  using Size = thrust::detail::it_difference_t<RandomAccessIterator1>;
+
+  const Size n1 = ::cuda::std::distance(first1, last1);
+  const Size n2 = static_cast<Size>(::cuda::std::distance(first2, last2));
+
+  const tuning t = tbb::detail::tuning_of(exec);
+
+  // the default threshold can be overridden by the policy
+  const Size parallelism_threshold = 1 << 14;
+
+  if (tbb::detail::runs_sequentially(t, n1 + n2, parallelism_threshold))
+  {
+    // don't bother parallelizing for small n
+    return serial_op(first1, last1, first2, last2, result, comp);
+  }
+
+  // count the number of processors
+  const unsigned int p = static_cast<unsigned int>(tbb::detail::max_threads(t));
+
+  // generate O(P) partitions of sequential work, oversubscribed because the
+  // partitions are not balanced when the inputs contain long runs of equivalent elements,
+  // unless the policy sets the partition size
+  // XXX the subscription rate is a tuning opportunity
+  const unsigned int subscription_rate = 4;
+  const Size partition_size            = tbb::detail::grain_size(
+    t,
+    ::cuda::std::max<Size>(parallelism_threshold / 4, (n1 + n2 + subscription_rate * p - 1) / (subscription_rate * p)));
+  const Size num_partitions = (n1 + n2 + partition_size - 1) / partition_size;
+
+  // the split points of every partition, plus the end of both inputs
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits1(exec, num_partitions + 1);
+  thrust::detail::temporary_array<Size, DerivedPolicy> splits2(exec, num_partitions + 1);
+
+  // the output size of every partition, scanned into output offsets
+  thrust::detail::temporary_array<Size, DerivedPolicy> offsets(exec, num_partitions + 1);
+
+  tbb::detail::execute(t, [&] {
+    ::tbb::parallel_for(::tbb::blocked_range<Size>(0, num_partitions), [&](const ::tbb::blocked_range<Size>& r) {
+      for (Size i = r.begin(); i < r.end(); ++i)
+      {
+        ::cuda::std::pair<Size, Size> split =
+          thrust::system::detail::internal::set_operation_partition(first1, n1, first2, n2, i * partition_size, comp);
+
+        splits1[i] = split.first;
+        splits2[i] = split.second;
+      }
+    });
+
+    splits1[num_partitions] = n1;
+    splits2[num_partitions] = n2;
+    offsets[num_partitions] = 0;
+
+    // force grainsize == 1 with simple_partitioner()
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Size>(0, num_partitions, 1),
+      [&](const ::tbb::blocked_range<Size>& r) {
+        for (Size i = r.begin(); i < r.end(); ++i)
+        {
+          offsets[i] =
+            serial_op(
+              first1 + splits1[i],
+              first1 + splits1[i + 1],
+              first2 + splits2[i],
+              first2 + splits2[i + 1],
+              thrust::make_discard_iterator(),
+              comp)
+            - thrust::make_discard_iterator();
+        }
+      },
+      ::tbb::simple_partitioner());
+
+    ::cuda::std::exclusive_scan(offsets.begin(), offsets.end(), offsets.begin(), Size(0));
+
+    ::tbb::parallel_for(
+      ::tbb::blocked_range<Size>(0, num_partitions, 1),
+      [&](const ::tbb::blocked_range<Size>& r) {
+        for (Size i = r.begin(); i < r.end(); ++i)
+        {
+          serial_op(first1 + splits1[i],
+                    first1 + splits1[i + 1],
+                    first2 + splits2[i],
+                    first2 + splits2[i + 1],
+                    result + offsets[i],
+                    comp);
+        }
+      },
+      ::tbb::simple_partitioner());
+  });
+
+  return result + offsets[num_partitions];
+}
+} // namespace set_operations_detail
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_difference{});
+  }
+  else
+  {
+    return system::detail::sequential::set_difference(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_intersection(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_intersection{});
+  }
+  else
+  {
+    return system::detail::sequential::set_intersection(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_intersection()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_symmetric_difference(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec,
+      first1,
+      last1,
+      first2,
+      last2,
+      result,
+      comp,
+      thrust::system::detail::internal::serial_set_symmetric_difference{});
+  }
+  else
+  {
+    return system::detail::sequential::set_symmetric_difference(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_symmetric_difference()
+
+template <typename DerivedPolicy,
+          typename InputIterator1,
+          typename InputIterator2,
+          typename OutputIterator,
+          typename StrictWeakOrdering>
+OutputIterator set_union(
+  execution_policy<DerivedPolicy>& exec,
+  InputIterator1 first1,
+  InputIterator1 last1,
+  InputIterator2 first2,
+  InputIterator2 last2,
+  OutputIterator result,
+  StrictWeakOrdering comp)
+{
+  if constexpr (set_operations_detail::is_random_access_v<InputIterator1, InputIterator2, OutputIterator>)
+  {
+    return set_operations_detail::set_operation(
+      exec, first1, last1, first2, last2, result, comp, thrust::system::detail::internal::serial_set_union{});
+  }
+  else
+  {
+    return system::detail::sequential::set_union(exec, first1, last1, first2, last2, result, comp);
+  }
+} // end set_union()
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -18,10 +18,14 @@
 #include <thrust/iterator/iterator_traits.h>
 #include <thrust/merge.h>
 #include <thrust/sort.h>
+#include <thrust/system/detail/internal/parallel_radix_sort.h>
+#include <thrust/system/detail/sequential/sort.h>
 #include <thrust/system/tbb/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/tuning.h>
 
 #include <cuda/std/__iterator/distance.h>
 
+#include <tbb/parallel_for.h>
 #include <tbb/parallel_invoke.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -29,9 +33,53 @@ namespace system::tbb::detail
 {
 namespace sort_detail
 {
+// the size of the sequentially sorted leaves unless the policy sets a grain size
 // TODO tune this based on data type and comp
 const static int threshold = 128 * 1024;
 
+// XXX this value is a tuning opportunity
+const static int radix_sort_threshold = 64 * 1024;
+
+// invokes f(i) for every i in [0, n) with a TBB parallel loop
+struct parallel_for_fn
+{
+  template <typename Size, typename Function>
+  void operator()(Size n, Function f) const
+  {
+    ::tbb::parallel_for(Size(0), n, f);
+  }
+};
+
+// radix sorts arithmetic keys compared with less or greater, returns false if the keys need a comparison sort
+template <typename DerivedPolicy, typename KeyIterator, typename ValueIterator, typename StrictWeakOrdering>
+bool try_radix_sort(execution_policy<DerivedPolicy>& exec,
+                    KeyIterator keys_first,
+                    KeyIterator keys_last,
+                    ValueIterator values_first,
+                    StrictWeakOrdering)
+{
+  using key_type        = thrust::detail::it_value_t<KeyIterator>;
+  using difference_type = thrust::detail::it_difference_t<KeyIterator>;
+
+  if constexpr (system::detail::sequential::sort_detail::use_primitive_sort<key_type, StrictWeakOrdering>)
+  {
+    const difference_type n = ::cuda::std::distance(keys_first, keys_last);
+
+    // count the number of processors
+    const unsigned int p = static_cast<unsigned int>(tbb::detail::max_threads(tbb::detail::tuning_of(exec)));
+
+    if (n >= radix_sort_threshold && p > 1)
+    {
+      thrust::system::detail::internal::parallel_radix_sort<
+        system::detail::sequential::sort_detail::needs_reverse<key_type, StrictWeakOrdering>>(
+        exec, parallel_for_fn{}, static_cast<difference_type>(p), keys_first, values_first, n);
+      return true;
+    }
+  }
+
+  return false;
+}
+
 template <typename DerivedPolicy, typename Iterator1, typename Iterator2, typename StrictWeakOrdering>
 void merge_sort(execution_policy<DerivedPolicy>& exec,
                 Iterator1 first1,
@@ -82,7 +130,7 @@ void merge_sort(execution_policy<DerivedPolicy>& exec,
 
   difference_type n = ::cuda::std::distance(first1, last1);
 
-  if (n < threshold)
+  if (n < tbb::detail::grain_size(tbb::detail::tuning_of(exec), difference_type(threshold)))
   {
     thrust::stable_sort(thrust::seq, first1, last1, comp);
 
@@ -205,7 +253,7 @@ void merge_sort_by_key(
   Iterator2 last2 = first2 + n;
   Iterator3 last3 = first3 + n;
 
-  if (n < threshold)
+  if (n < tbb::detail::grain_size(tbb::detail::tuning_of(exec), difference_type(threshold)))
   {
     thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
 
@@ -243,9 +291,25 @@ void stable_sort(
 {
   using key_type = thrust::detail::it_value_t<RandomAccessIterator>;
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
+  const tuning t = tbb::detail::tuning_of(exec);
+
+  if (tbb::detail::runs_sequentially(t, ::cuda::std::distance(first, last)))
+  {
+    thrust::stable_sort(thrust::seq, first, last, comp);
+    return;
+  }
+
+  tbb::detail::execute(t, [&] {
+    if (sort_detail::try_radix_sort(
+          exec, first, last, thrust::system::detail::internal::radix_sort_detail::no_values{}, comp))
+    {
+      return;
+    }
+
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp(exec, first, last);
 
-  sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+    sort_detail::merge_sort(exec, first, last, temp.begin(), comp, true);
+  });
 }
 
 template <typename DerivedPolicy,
@@ -262,12 +326,49 @@ void stable_sort_by_key(
   using key_type = thrust::detail::it_value_t<RandomAccessIterator1>;
   using val_type = thrust::detail::it_value_t<RandomAccessIterator2>;
 
-  RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+  const tuning t = tbb::detail::tuning_of(exec);
+
+  if (tbb::detail::runs_sequentially(t, ::cuda::std::distance(first1, last1)))
+  {
+    thrust::stable_sort_by_key(thrust::seq, first1, last1, first2, comp);
+    return;
+  }
+
+  tbb::detail::execute(t, [&] {
+    if (sort_detail::try_radix_sort(exec, first1, last1, first2, comp))
+    {
+      return;
+    }
+
+    RandomAccessIterator2 last2 = first2 + ::cuda::std::distance(first1, last1);
+
+    thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
+    thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+
+    sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+  });
+}
 
-  thrust::detail::temporary_array<key_type, DerivedPolicy> temp1(exec, first1, last1);
-  thrust::detail::temporary_array<val_type, DerivedPolicy> temp2(exec, first2, last2);
+// the parallel merge sort is also used for unstable sorts, instead of the sequential sort inherited from cpp
+template <typename DerivedPolicy, typename RandomAccessIterator, typename StrictWeakOrdering>
+void sort(
+  execution_policy<DerivedPolicy>& exec, RandomAccessIterator first, RandomAccessIterator last, StrictWeakOrdering comp)
+{
+  thrust::stable_sort(exec, first, last, comp);
+}
 
-  sort_by_key_detail::merge_sort_by_key(exec, first1, last1, first2, temp1.begin(), temp2.begin(), comp, true);
+template <typename DerivedPolicy,
+          typename RandomAccessIterator1,
+          typename RandomAccessIterator2,
+          typename StrictWeakOrdering>
+void sort_by_key(
+  execution_policy<DerivedPolicy>& exec,
+  RandomAccessIterator1 keys_first,
+  RandomAccessIterator1 keys_last,
+  RandomAccessIterator2 values_first,
+  StrictWeakOrdering comp)
+{
+  thrust::stable_sort_by_key(exec, keys_first, keys_last, values_first, comp);
 }
 } // end namespace system::tbb::detail
 THRUST_NAMESPACE_END
@@ -0,0 +1,178 @@
+// SPDX-FileCopyrightText: Copyright (c) 2026, NVIDIA CORPORATION. All rights reserved.
+// SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <thrust/detail/config.h>
+
+#if defined(_CCCL_IMPLICIT_SYSTEM_HEADER_GCC)
+#  pragma GCC system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_CLANG)
+#  pragma clang system_header
+#elif defined(_CCCL_IMPLICIT_SYSTEM_HEADER_MSVC)
+#  pragma system_header
+#endif // no system header
+
+#include <thrust/detail/execution_policy.h>
+#include <thrust/system/tbb/detail/execution_policy.h>
+
+#include <cuda/std/cstddef>
+
+#include <map>
+#include <mutex>
+
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_reduce.h>
+#include <tbb/parallel_scan.h>
+#include <tbb/partitioner.h>
+#include <tbb/task_arena.h>
+
+THRUST_NAMESPACE_BEGIN
+namespace system::tbb::detail
+{
+template <typename DerivedPolicy>
+tuning tuning_of(execution_policy<DerivedPolicy>& exec)
+{
+  return get_tuning(thrust::detail::derived_cast(exec));
+}
+
+// the maximum number of threads of an algorithm, ignoring its input size
+inline int max_threads(const tuning& t)
+{
+  return t.num_threads > 0 ? t.num_threads : ::tbb::this_task_arena::max_concurrency();
+}
+
+// the input size below which an algorithm runs sequentially, default_cutoff unless the policy sets one
+inline ::cuda::std::size_t sequential_cutoff(const tuning& t, ::cuda::std::size_t default_cutoff = 0)
+{
+  return t.sequential_cutoff > 0 ? t.sequential_cutoff : default_cutoff;
+}
+
+template <typename Size>
+bool runs_sequentially(const tuning& t, Size n, ::cuda::std::size_t default_cutoff = 0)
+{
+  return n <= 0 || static_cast<::cuda::std::size_t>(n) < tbb::detail::sequential_cutoff(t, default_cutoff);
+}
+
+// the grain size of the policy, or default_grain_size
+template <typename Size>
+Size grain_size(const tuning& t, Size default_grain_size)
+{
+  return t.grain_size > 0 ? static_cast<Size>(t.grain_size) : default_grain_size;
+}
+
+// the task arena with num_threads threads. building an arena is expensive, so every arena is kept for the following
+// calls with the same number of threads
+inline ::tbb::task_arena& arena_of(int num_threads)
+{
+  static std::mutex mutex;
+  static std::map<int, ::tbb::task_arena> arenas;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  return arenas.try_emplace(num_threads, num_threads).first->second;
+}
+
+// invokes f in a task arena with the number of threads of the tuning, or in the current arena if the tuning sets none
+template <typename Function>
+decltype(auto) execute(const tuning& t, Function&& f)
+{
+  if (t.num_threads > 0 && t.num_threads != ::tbb::this_task_arena::max_concurrency())
+  {
+    return tbb::detail::arena_of(t.num_threads).execute(f);
+  }
+
+  return f();
+}
+
+// ::tbb::parallel_for over [0, n) with the grain size, partitioner, cutoff and number of threads of the tuning
+template <typename Size, typename Body>
+void parallel_for(const tuning& t, Size n, const Body& body)
+{
+  if (tbb::detail::runs_sequentially(t, n))
+  {
+    if (n > 0)
+    {
+      body(::tbb::blocked_range<Size>(0, n));
+    }
+    return;
+  }
+
+  const ::tbb::blocked_range<Size> range(0, n, tbb::detail::grain_size(t, Size(1)));
+
+  tbb::detail::execute(t, [&] {
+    switch (t.partitioner)
+    {
+      case partitioner_kind::simple:
+        ::tbb::parallel_for(range, body, ::tbb::simple_partitioner());
+        break;
+      case partitioner_kind::static_:
+        ::tbb::parallel_for(range, body, ::tbb::static_partitioner());
+        break;
+      default:
+        ::tbb::parallel_for(range, body, ::tbb::auto_partitioner());
+        break;
+    }
+  });
+}
+
+// ::tbb::parallel_reduce over [0, n) with the grain size, partitioner, cutoff and number of threads of the tuning
+template <typename Size, typename Body>
+void parallel_reduce(const tuning& t, Size n, Body& body)
+{
+  if (tbb::detail::runs_sequentially(t, n))
+  {
+    if (n > 0)
+    {
+      body(::tbb::blocked_range<Size>(0, n));
+    }
+    return;
+  }
+
+  const ::tbb::blocked_range<Size> range(0, n, tbb::detail::grain_size(t, Size(1)));
+
+  tbb::detail::execute(t, [&] {
+    switch (t.partitioner)
+    {
+      case partitioner_kind::simple:
+        ::tbb::parallel_reduce(range, body, ::tbb::simple_partitioner());
+        break;
+      case partitioner_kind::static_:
+        ::tbb::parallel_reduce(range, body, ::tbb::static_partitioner());
+        break;
+      default:
+        ::tbb::parallel_reduce(range, body, ::tbb::auto_partitioner());
+        break;
+    }
+  });
+}
+
+// ::tbb::parallel_scan over [0, n) with the grain size, partitioner, cutoff and number of threads of the tuning.
+// parallel_scan has no static partitioner, so the static partitioner falls back to the auto partitioner.
+template <typename Size, typename Body>
+void parallel_scan(const tuning& t, Size n, Body& body)
+{
+  if (tbb::detail::runs_sequentially(t, n))
+  {
+    if (n > 0)
+    {
+      body(::tbb::blocked_range<Size>(0, n), ::tbb::final_scan_tag());
+    }
+    return;
+  }
+
+  const ::tbb::blocked_range<Size> range(0, n, tbb::detail::grain_size(t, Size(1)));
+
+  tbb::detail::execute(t, [&] {
+    if (t.partitioner == partitioner_kind::simple)
+    {
+      ::tbb::parallel_scan(range, body, ::tbb::simple_partitioner());
+    }
+    else
+    {
+      ::tbb::parallel_scan(range, body, ::tbb::auto_partitioner());
+    }
+  });
+}
+} // end namespace system::tbb::detail
+THRUST_NAMESPACE_END
@@ -18,6 +18,7 @@
 #endif // no system header
 #include <thrust/mr/fancy_pointer_resource.h>
 #include <thrust/mr/new.h>
+#include <thrust/mr/page_resource.h>
 #include <thrust/system/tbb/pointer.h>
 
 THRUST_NAMESPACE_BEGIN
@@ -30,6 +31,8 @@ using native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::new_delet
 
 using universal_native_resource =
   thrust::mr::fancy_pointer_resource<thrust::mr::new_delete_resource, thrust::tbb::universal_pointer<void>>;
+
+using page_native_resource = thrust::mr::fancy_pointer_resource<thrust::mr::page_resource, thrust::tbb::pointer<void>>;
 } // namespace detail
 //! \endcond
 
@@ -50,6 +53,11 @@ using universal_memory_resource = detail::universal_native_resource;
 /*! An alias for \p tbb::universal_memory_resource. */
 using universal_host_pinned_memory_resource = universal_memory_resource;
 
+/*! A memory resource for the TBB system which maps large allocations with huge pages and can place them on
+ *  specific NUMA nodes. Uses \p mr::page_resource and tags it with \p tbb::pointer.
+ */
+using page_memory_resource = detail::page_native_resource;
+
 /*! \} // memory_resources
  */
 } // namespace system::tbb
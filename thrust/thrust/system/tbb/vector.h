@@ -20,6 +20,11 @@
 #include <thrust/detail/vector_base.h>
 #include <thrust/system/tbb/memory.h>
 
+// construct elements with the parallel algorithms, so that the pages of a vector are first touched by, and placed on
+// the NUMA nodes of, the threads which later work on them
+#include <thrust/system/tbb/detail/copy.h>
+#include <thrust/system/tbb/detail/for_each.h>
+
 #include <vector>
 
 THRUST_NAMESPACE_BEGIN